@@ -3,12 +3,16 @@ ifndef verbose
 endif
 
 .PHONY: all
-all: kApi GoSdk GoSdkExample 
+all: kApi kApiBenchmark GoSdk GoSdkExample GoSdkXmlBenchmark GoSdkSerializerBenchmark GoSdkDataBenchmark GoSdkLoopbackBenchmark 
 
 .PHONY: kApi
 kApi: 
 	$(SILENT) $(MAKE) -C ../Platform/kApi -f kApi-Linux_X64.mk
 
+.PHONY: kApiBenchmark
+kApiBenchmark: kApi 
+	$(SILENT) $(MAKE) -C ../Platform/kApi -f kApiBenchmark-Linux_X64.mk
+
 .PHONY: GoSdk
 GoSdk: kApi 
 	$(SILENT) $(MAKE) -C GoSdk -f GoSdk-Linux_X64.mk
@@ -17,13 +21,33 @@ GoSdk: kApi
 GoSdkExample: GoSdk 
 	$(SILENT) $(MAKE) -C GoSdk -f GoSdkExample-Linux_X64.mk
 
+.PHONY: GoSdkXmlBenchmark
+GoSdkXmlBenchmark: GoSdk 
+	$(SILENT) $(MAKE) -C GoSdk -f GoSdkXmlBenchmark-Linux_X64.mk
+
+.PHONY: GoSdkSerializerBenchmark
+GoSdkSerializerBenchmark: GoSdk 
+	$(SILENT) $(MAKE) -C GoSdk -f GoSdkSerializerBenchmark-Linux_X64.mk
+
+.PHONY: GoSdkDataBenchmark
+GoSdkDataBenchmark: GoSdk 
+	$(SILENT) $(MAKE) -C GoSdk -f GoSdkDataBenchmark-Linux_X64.mk
+
+.PHONY: GoSdkLoopbackBenchmark
+GoSdkLoopbackBenchmark: GoSdk 
+	$(SILENT) $(MAKE) -C GoSdk -f GoSdkLoopbackBenchmark-Linux_X64.mk
+
 .PHONY: clean
-clean: kApi-clean GoSdk-clean GoSdkExample-clean 
+clean: kApi-clean kApiBenchmark-clean GoSdk-clean GoSdkExample-clean GoSdkXmlBenchmark-clean GoSdkSerializerBenchmark-clean GoSdkDataBenchmark-clean GoSdkLoopbackBenchmark-clean 
 
 .PHONY: kApi-clean
 kApi-clean:
 	$(SILENT) $(MAKE) -C ../Platform/kApi -f kApi-Linux_X64.mk clean
 
+.PHONY: kApiBenchmark-clean
+kApiBenchmark-clean:
+	$(SILENT) $(MAKE) -C ../Platform/kApi -f kApiBenchmark-Linux_X64.mk clean
+
 .PHONY: GoSdk-clean
 GoSdk-clean:
 	$(SILENT) $(MAKE) -C GoSdk -f GoSdk-Linux_X64.mk clean
@@ -32,4 +56,20 @@ GoSdk-clean:
 GoSdkExample-clean:
 	$(SILENT) $(MAKE) -C GoSdk -f GoSdkExample-Linux_X64.mk clean
 
+.PHONY: GoSdkXmlBenchmark-clean
+GoSdkXmlBenchmark-clean:
+	$(SILENT) $(MAKE) -C GoSdk -f GoSdkXmlBenchmark-Linux_X64.mk clean
+
+.PHONY: GoSdkSerializerBenchmark-clean
+GoSdkSerializerBenchmark-clean:
+	$(SILENT) $(MAKE) -C GoSdk -f GoSdkSerializerBenchmark-Linux_X64.mk clean
+
+.PHONY: GoSdkDataBenchmark-clean
+GoSdkDataBenchmark-clean:
+	$(SILENT) $(MAKE) -C GoSdk -f GoSdkDataBenchmark-Linux_X64.mk clean
+
+.PHONY: GoSdkLoopbackBenchmark-clean
+GoSdkLoopbackBenchmark-clean:
+	$(SILENT) $(MAKE) -C GoSdk -f GoSdkLoopbackBenchmark-Linux_X64.mk clean
+
 
@@ -104,6 +104,7 @@ ifeq ($(config),Debug)
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoLayout.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoAdvanced.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoMaterial.c.o \
+	../../build/GoSdk-gnumk_linux_x64-Debug/GoMetricsServer.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoMultiplexBank.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoPartDetection.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoPartMatching.c.o \
@@ -116,6 +117,8 @@ ifeq ($(config),Debug)
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSections.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSensor.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSensorInfo.c.o \
+	../../build/GoSdk-gnumk_linux_x64-Debug/GoFuture.c.o \
+	../../build/GoSdk-gnumk_linux_x64-Debug/GoSessionPool.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSetup.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSurfaceGeneration.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSystem.c.o \
@@ -126,7 +129,9 @@ ifeq ($(config),Debug)
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoAlgorithm.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoAccelSensorPortAlloc.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoControl.c.o \
+	../../build/GoSdk-gnumk_linux_x64-Debug/GoControlDispatcher.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoDiscovery.c.o \
+	../../build/GoSdk-gnumk_linux_x64-Debug/GoHealthTable.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoReceiver.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSerializer.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoDataSet.c.o \
@@ -161,6 +166,7 @@ ifeq ($(config),Debug)
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoLayout.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoAdvanced.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoMaterial.c.d \
+	../../build/GoSdk-gnumk_linux_x64-Debug/GoMetricsServer.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoMultiplexBank.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoPartDetection.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoPartMatching.c.d \
@@ -173,6 +179,8 @@ ifeq ($(config),Debug)
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSections.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSensor.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSensorInfo.c.d \
+	../../build/GoSdk-gnumk_linux_x64-Debug/GoFuture.c.d \
+	../../build/GoSdk-gnumk_linux_x64-Debug/GoSessionPool.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSetup.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSurfaceGeneration.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSystem.c.d \
@@ -183,7 +191,9 @@ ifeq ($(config),Debug)
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoAlgorithm.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoAccelSensorPortAlloc.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoControl.c.d \
+	../../build/GoSdk-gnumk_linux_x64-Debug/GoControlDispatcher.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoDiscovery.c.d \
+	../../build/GoSdk-gnumk_linux_x64-Debug/GoHealthTable.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoReceiver.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoSerializer.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Debug/GoDataSet.c.d \
@@ -265,6 +275,7 @@ ifeq ($(config),Release)
 	../../build/GoSdk-gnumk_linux_x64-Release/GoLayout.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoAdvanced.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoMaterial.c.o \
+	../../build/GoSdk-gnumk_linux_x64-Release/GoMetricsServer.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoMultiplexBank.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoPartDetection.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoPartMatching.c.o \
@@ -277,6 +288,8 @@ ifeq ($(config),Release)
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSections.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSensor.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSensorInfo.c.o \
+	../../build/GoSdk-gnumk_linux_x64-Release/GoFuture.c.o \
+	../../build/GoSdk-gnumk_linux_x64-Release/GoSessionPool.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSetup.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSurfaceGeneration.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSystem.c.o \
@@ -287,7 +300,9 @@ ifeq ($(config),Release)
 	../../build/GoSdk-gnumk_linux_x64-Release/GoAlgorithm.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoAccelSensorPortAlloc.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoControl.c.o \
+	../../build/GoSdk-gnumk_linux_x64-Release/GoControlDispatcher.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoDiscovery.c.o \
+	../../build/GoSdk-gnumk_linux_x64-Release/GoHealthTable.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoReceiver.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSerializer.c.o \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoDataSet.c.o \
@@ -322,6 +337,7 @@ ifeq ($(config),Release)
 	../../build/GoSdk-gnumk_linux_x64-Release/GoLayout.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoAdvanced.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoMaterial.c.d \
+	../../build/GoSdk-gnumk_linux_x64-Release/GoMetricsServer.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoMultiplexBank.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoPartDetection.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoPartMatching.c.d \
@@ -334,6 +350,8 @@ ifeq ($(config),Release)
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSections.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSensor.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSensorInfo.c.d \
+	../../build/GoSdk-gnumk_linux_x64-Release/GoFuture.c.d \
+	../../build/GoSdk-gnumk_linux_x64-Release/GoSessionPool.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSetup.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSurfaceGeneration.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSystem.c.d \
@@ -344,7 +362,9 @@ ifeq ($(config),Release)
 	../../build/GoSdk-gnumk_linux_x64-Release/GoAlgorithm.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoAccelSensorPortAlloc.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoControl.c.d \
+	../../build/GoSdk-gnumk_linux_x64-Release/GoControlDispatcher.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoDiscovery.c.d \
+	../../build/GoSdk-gnumk_linux_x64-Release/GoHealthTable.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoReceiver.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoSerializer.c.d \
 	../../build/GoSdk-gnumk_linux_x64-Release/GoDataSet.c.d \
@@ -441,6 +461,10 @@ ifeq ($(config),Debug)
 	$(SILENT) $(info GccX64 GoSdk/GoMaterial.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Debug/GoMaterial.c.o -c GoSdk/GoMaterial.c -MMD -MP
 
+../../build/GoSdk-gnumk_linux_x64-Debug/GoMetricsServer.c.o ../../build/GoSdk-gnumk_linux_x64-Debug/GoMetricsServer.c.d: GoSdk/GoMetricsServer.c
+	$(SILENT) $(info GccX64 GoSdk/GoMetricsServer.c)
+	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Debug/GoMetricsServer.c.o -c GoSdk/GoMetricsServer.c -MMD -MP
+
 ../../build/GoSdk-gnumk_linux_x64-Debug/GoMultiplexBank.c.o ../../build/GoSdk-gnumk_linux_x64-Debug/GoMultiplexBank.c.d: GoSdk/GoMultiplexBank.c
 	$(SILENT) $(info GccX64 GoSdk/GoMultiplexBank.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Debug/GoMultiplexBank.c.o -c GoSdk/GoMultiplexBank.c -MMD -MP
@@ -489,6 +513,14 @@ ifeq ($(config),Debug)
 	$(SILENT) $(info GccX64 GoSdk/GoSensorInfo.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Debug/GoSensorInfo.c.o -c GoSdk/GoSensorInfo.c -MMD -MP
 
+../../build/GoSdk-gnumk_linux_x64-Debug/GoFuture.c.o ../../build/GoSdk-gnumk_linux_x64-Debug/GoFuture.c.d: GoSdk/GoFuture.c
+	$(SILENT) $(info GccX64 GoSdk/GoFuture.c)
+	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Debug/GoFuture.c.o -c GoSdk/GoFuture.c -MMD -MP
+
+../../build/GoSdk-gnumk_linux_x64-Debug/GoSessionPool.c.o ../../build/GoSdk-gnumk_linux_x64-Debug/GoSessionPool.c.d: GoSdk/GoSessionPool.c
+	$(SILENT) $(info GccX64 GoSdk/GoSessionPool.c)
+	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Debug/GoSessionPool.c.o -c GoSdk/GoSessionPool.c -MMD -MP
+
 ../../build/GoSdk-gnumk_linux_x64-Debug/GoSetup.c.o ../../build/GoSdk-gnumk_linux_x64-Debug/GoSetup.c.d: GoSdk/GoSetup.c
 	$(SILENT) $(info GccX64 GoSdk/GoSetup.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Debug/GoSetup.c.o -c GoSdk/GoSetup.c -MMD -MP
@@ -529,10 +561,18 @@ ifeq ($(config),Debug)
 	$(SILENT) $(info GccX64 GoSdk/Internal/GoControl.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Debug/GoControl.c.o -c GoSdk/Internal/GoControl.c -MMD -MP
 
+../../build/GoSdk-gnumk_linux_x64-Debug/GoControlDispatcher.c.o ../../build/GoSdk-gnumk_linux_x64-Debug/GoControlDispatcher.c.d: GoSdk/Internal/GoControlDispatcher.c
+	$(SILENT) $(info GccX64 GoSdk/Internal/GoControlDispatcher.c)
+	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Debug/GoControlDispatcher.c.o -c GoSdk/Internal/GoControlDispatcher.c -MMD -MP
+
 ../../build/GoSdk-gnumk_linux_x64-Debug/GoDiscovery.c.o ../../build/GoSdk-gnumk_linux_x64-Debug/GoDiscovery.c.d: GoSdk/Internal/GoDiscovery.c
 	$(SILENT) $(info GccX64 GoSdk/Internal/GoDiscovery.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Debug/GoDiscovery.c.o -c GoSdk/Internal/GoDiscovery.c -MMD -MP
 
+../../build/GoSdk-gnumk_linux_x64-Debug/GoHealthTable.c.o ../../build/GoSdk-gnumk_linux_x64-Debug/GoHealthTable.c.d: GoSdk/Internal/GoHealthTable.c
+	$(SILENT) $(info GccX64 GoSdk/Internal/GoHealthTable.c)
+	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Debug/GoHealthTable.c.o -c GoSdk/Internal/GoHealthTable.c -MMD -MP
+
 ../../build/GoSdk-gnumk_linux_x64-Debug/GoReceiver.c.o ../../build/GoSdk-gnumk_linux_x64-Debug/GoReceiver.c.d: GoSdk/Internal/GoReceiver.c
 	$(SILENT) $(info GccX64 GoSdk/Internal/GoReceiver.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Debug/GoReceiver.c.o -c GoSdk/Internal/GoReceiver.c -MMD -MP
@@ -673,6 +713,10 @@ ifeq ($(config),Release)
 	$(SILENT) $(info GccX64 GoSdk/GoMaterial.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Release/GoMaterial.c.o -c GoSdk/GoMaterial.c -MMD -MP
 
+../../build/GoSdk-gnumk_linux_x64-Release/GoMetricsServer.c.o ../../build/GoSdk-gnumk_linux_x64-Release/GoMetricsServer.c.d: GoSdk/GoMetricsServer.c
+	$(SILENT) $(info GccX64 GoSdk/GoMetricsServer.c)
+	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Release/GoMetricsServer.c.o -c GoSdk/GoMetricsServer.c -MMD -MP
+
 ../../build/GoSdk-gnumk_linux_x64-Release/GoMultiplexBank.c.o ../../build/GoSdk-gnumk_linux_x64-Release/GoMultiplexBank.c.d: GoSdk/GoMultiplexBank.c
 	$(SILENT) $(info GccX64 GoSdk/GoMultiplexBank.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Release/GoMultiplexBank.c.o -c GoSdk/GoMultiplexBank.c -MMD -MP
@@ -721,6 +765,14 @@ ifeq ($(config),Release)
 	$(SILENT) $(info GccX64 GoSdk/GoSensorInfo.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Release/GoSensorInfo.c.o -c GoSdk/GoSensorInfo.c -MMD -MP
 
+../../build/GoSdk-gnumk_linux_x64-Release/GoFuture.c.o ../../build/GoSdk-gnumk_linux_x64-Release/GoFuture.c.d: GoSdk/GoFuture.c
+	$(SILENT) $(info GccX64 GoSdk/GoFuture.c)
+	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Release/GoFuture.c.o -c GoSdk/GoFuture.c -MMD -MP
+
+../../build/GoSdk-gnumk_linux_x64-Release/GoSessionPool.c.o ../../build/GoSdk-gnumk_linux_x64-Release/GoSessionPool.c.d: GoSdk/GoSessionPool.c
+	$(SILENT) $(info GccX64 GoSdk/GoSessionPool.c)
+	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Release/GoSessionPool.c.o -c GoSdk/GoSessionPool.c -MMD -MP
+
 ../../build/GoSdk-gnumk_linux_x64-Release/GoSetup.c.o ../../build/GoSdk-gnumk_linux_x64-Release/GoSetup.c.d: GoSdk/GoSetup.c
 	$(SILENT) $(info GccX64 GoSdk/GoSetup.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Release/GoSetup.c.o -c GoSdk/GoSetup.c -MMD -MP
@@ -761,10 +813,18 @@ ifeq ($(config),Release)
 	$(SILENT) $(info GccX64 GoSdk/Internal/GoControl.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Release/GoControl.c.o -c GoSdk/Internal/GoControl.c -MMD -MP
 
+../../build/GoSdk-gnumk_linux_x64-Release/GoControlDispatcher.c.o ../../build/GoSdk-gnumk_linux_x64-Release/GoControlDispatcher.c.d: GoSdk/Internal/GoControlDispatcher.c
+	$(SILENT) $(info GccX64 GoSdk/Internal/GoControlDispatcher.c)
+	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Release/GoControlDispatcher.c.o -c GoSdk/Internal/GoControlDispatcher.c -MMD -MP
+
 ../../build/GoSdk-gnumk_linux_x64-Release/GoDiscovery.c.o ../../build/GoSdk-gnumk_linux_x64-Release/GoDiscovery.c.d: GoSdk/Internal/GoDiscovery.c
 	$(SILENT) $(info GccX64 GoSdk/Internal/GoDiscovery.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Release/GoDiscovery.c.o -c GoSdk/Internal/GoDiscovery.c -MMD -MP
 
+../../build/GoSdk-gnumk_linux_x64-Release/GoHealthTable.c.o ../../build/GoSdk-gnumk_linux_x64-Release/GoHealthTable.c.d: GoSdk/Internal/GoHealthTable.c
+	$(SILENT) $(info GccX64 GoSdk/Internal/GoHealthTable.c)
+	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Release/GoHealthTable.c.o -c GoSdk/Internal/GoHealthTable.c -MMD -MP
+
 ../../build/GoSdk-gnumk_linux_x64-Release/GoReceiver.c.o ../../build/GoSdk-gnumk_linux_x64-Release/GoReceiver.c.d: GoSdk/Internal/GoReceiver.c
 	$(SILENT) $(info GccX64 GoSdk/Internal/GoReceiver.c)
 	$(SILENT) $(GNU_C_COMPILER) $(GNU_COMPILER_FLAGS) $(C_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/GoSdk-gnumk_linux_x64-Release/GoReceiver.c.o -c GoSdk/Internal/GoReceiver.c -MMD -MP
@@ -886,6 +946,7 @@ include ../../build/GoSdk-gnumk_linux_x64-Debug/GoAccelerator.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoLayout.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoAdvanced.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoMaterial.c.d
+include ../../build/GoSdk-gnumk_linux_x64-Debug/GoMetricsServer.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoMultiplexBank.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoPartDetection.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoPartMatching.c.d
@@ -898,6 +959,8 @@ include ../../build/GoSdk-gnumk_linux_x64-Debug/GoSection.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoSections.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoSensor.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoSensorInfo.c.d
+include ../../build/GoSdk-gnumk_linux_x64-Debug/GoFuture.c.d
+include ../../build/GoSdk-gnumk_linux_x64-Debug/GoSessionPool.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoSetup.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoSurfaceGeneration.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoSystem.c.d
@@ -908,7 +971,9 @@ include ../../build/GoSdk-gnumk_linux_x64-Debug/GoUtils.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoAlgorithm.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoAccelSensorPortAlloc.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoControl.c.d
+include ../../build/GoSdk-gnumk_linux_x64-Debug/GoControlDispatcher.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoDiscovery.c.d
+include ../../build/GoSdk-gnumk_linux_x64-Debug/GoHealthTable.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoReceiver.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoSerializer.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Debug/GoDataSet.c.d
@@ -948,6 +1013,7 @@ include ../../build/GoSdk-gnumk_linux_x64-Release/GoAccelerator.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoLayout.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoAdvanced.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoMaterial.c.d
+include ../../build/GoSdk-gnumk_linux_x64-Release/GoMetricsServer.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoMultiplexBank.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoPartDetection.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoPartMatching.c.d
@@ -960,6 +1026,8 @@ include ../../build/GoSdk-gnumk_linux_x64-Release/GoSection.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoSections.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoSensor.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoSensorInfo.c.d
+include ../../build/GoSdk-gnumk_linux_x64-Release/GoFuture.c.d
+include ../../build/GoSdk-gnumk_linux_x64-Release/GoSessionPool.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoSetup.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoSurfaceGeneration.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoSystem.c.d
@@ -970,7 +1038,9 @@ include ../../build/GoSdk-gnumk_linux_x64-Release/GoUtils.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoAlgorithm.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoAccelSensorPortAlloc.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoControl.c.d
+include ../../build/GoSdk-gnumk_linux_x64-Release/GoControlDispatcher.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoDiscovery.c.d
+include ../../build/GoSdk-gnumk_linux_x64-Release/GoHealthTable.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoReceiver.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoSerializer.c.d
 include ../../build/GoSdk-gnumk_linux_x64-Release/GoDataSet.c.d
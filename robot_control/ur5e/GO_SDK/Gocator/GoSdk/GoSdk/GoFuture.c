@@ -0,0 +1,177 @@
+/**
+ * @file    GoFuture.c
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#include <GoSdk/GoFuture.h>
+
+kBeginClassEx(Go, GoFuture)
+    kAddVMethod(GoFuture, kObject, VRelease)
+kEndClassEx()
+
+GoFx(kStatus) GoFuture_Construct(GoFuture* future, kAlloc allocator)
+{
+    kAlloc alloc = kAlloc_Fallback(allocator);
+    kStatus status;
+
+    kCheck(kAlloc_GetObject(alloc, kTypeOf(GoFuture), future));
+
+    if (!kSuccess(status = GoFuture_Init(*future, kTypeOf(GoFuture), alloc)))
+    {
+        kAlloc_FreeRef(alloc, future);
+    }
+
+    return status;
+}
+
+GoFx(kStatus) GoFuture_Init(GoFuture future, kType type, kAlloc alloc)
+{
+    kObjR(GoFuture, future);
+    kStatus status;
+
+    kCheck(kObject_Init(future, type, alloc));
+    obj->lock = kNULL;
+    obj->completion = kNULL;
+    kAtomic32s_Init(&obj->isPending, kFALSE);
+    obj->isSignalled = kFALSE;
+    obj->status = kERROR_STATE;
+    obj->onComplete.function = kNULL;
+    obj->onComplete.receiver = kNULL;
+
+    kTry
+    {
+        kTest(kLock_Construct(&obj->lock, alloc));
+        kTest(kSemaphore_Construct(&obj->completion, 0, alloc));
+    }
+    kCatch(&status)
+    {
+        GoFuture_VRelease(future);
+        kEndCatch(status);
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoFuture_VRelease(GoFuture future)
+{
+    kObj(GoFuture, future);
+
+    kCheck(kDestroyRef(&obj->completion));
+    kCheck(kDestroyRef(&obj->lock));
+
+    return kObject_VRelease(future);
+}
+
+GoFx(kStatus) GoFuture_SetCompletionHandler(GoFuture future, kCallbackFx function, kPointer receiver)
+{
+    kObj(GoFuture, future);
+
+    kCheckState(!kAtomic32s_Get(&obj->isPending));
+
+    obj->onComplete.function = function;
+    obj->onComplete.receiver = receiver;
+
+    return kOK;
+}
+
+GoFx(kStatus) GoFuture_Wait(GoFuture future, k64u timeout)
+{
+    kObj(GoFuture, future);
+
+    if (kAtomic32s_Get(&obj->isPending))
+    {
+        kCheck(kSemaphore_Wait(obj->completion, timeout));
+
+        //restore the signal, so that later waits (or other waiters) also succeed
+        kCheck(kSemaphore_Post(obj->completion));
+    }
+
+    return obj->status;
+}
+
+GoFx(kBool) GoFuture_IsComplete(GoFuture future)
+{
+    kObj(GoFuture, future);
+
+    return !kAtomic32s_Get(&obj->isPending);
+}
+
+GoFx(kStatus) GoFuture_Status(GoFuture future)
+{
+    kObj(GoFuture, future);
+
+    return kAtomic32s_Get(&obj->isPending) ? kERROR_BUSY : obj->status;
+}
+
+// Prepares the future for a new command. Fails if a command is already pending.
+GoFx(kStatus) GoFuture_Begin(GoFuture future)
+{
+    kObj(GoFuture, future);
+    kStatus status = kOK;
+
+    kLock_Enter(obj->lock);
+    {
+        if (kAtomic32s_Get(&obj->isPending))
+        {
+            status = kERROR_STATE;
+        }
+        else
+        {
+            //discard the signal left by a previous completion; a waiter that has taken
+            //the signal restores it promptly, so this does not block for long
+            if (obj->isSignalled)
+            {
+                status = kSemaphore_Wait(obj->completion, kINFINITE);
+                obj->isSignalled = kFALSE;
+            }
+
+            obj->status = kERROR_BUSY;
+            kAtomic32s_Exchange(&obj->isPending, kTRUE);
+        }
+    }
+    kLock_Exit(obj->lock);
+
+    return status;
+}
+
+GoFx(kStatus) GoFuture_Complete(GoFuture future, kStatus status)
+{
+    kObj(GoFuture, future);
+
+    //a waiter can return as soon as the semaphore is posted; holding the lock until the
+    //state is consistent ensures that an immediate GoFuture_Begin sees this completion
+    kLock_Enter(obj->lock);
+    {
+        obj->status = status;
+        obj->isSignalled = kTRUE;
+        kAtomic32s_Exchange(&obj->isPending, kFALSE);
+
+        kSemaphore_Post(obj->completion);
+    }
+    kLock_Exit(obj->lock);
+
+    if (!kIsNull(obj->onComplete.function))
+    {
+        obj->onComplete.function(obj->onComplete.receiver, future, kNULL);
+    }
+
+    return kOK;
+}
+
+// Returns the future to the idle state after a command could not be issued.
+GoFx(kStatus) GoFuture_Cancel(GoFuture future, kStatus status)
+{
+    kObj(GoFuture, future);
+
+    kLock_Enter(obj->lock);
+    {
+        obj->status = status;
+        kAtomic32s_Exchange(&obj->isPending, kFALSE);
+    }
+    kLock_Exit(obj->lock);
+
+    return kOK;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file    GoFuture.h
+ * @brief   Declares the GoFuture class.
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef GO_SDK_FUTURE_H
+#define GO_SDK_FUTURE_H
+
+#include <GoSdk/GoSdkDef.h>
+
+/**
+ * @class   GoFuture
+ * @extends kObject
+ * @ingroup GoSdk
+ * @brief   Represents the completion of an asynchronous sensor command.
+ *
+ * A future is constructed by the caller and passed to an asynchronous command function,
+ * such as GoSensor_StatesAsync. Commands issued to the same sensor are pipelined on a
+ * dedicated control connection and complete in the order in which they were issued.
+ *
+ * Completion can be observed by waiting on the future, or by registering a completion
+ * handler before the command is issued. Handlers are invoked on the system's shared I/O
+ * thread and must not block (e.g. must not wait on other futures). A handler can disconnect
+ * the sensor, which fails its remaining commands, but must not destroy the sensor or system.
+ *
+ * A future can be reused once its command has completed.
+ */
+typedef kObject GoFuture;
+
+/**
+ * Constructs a GoFuture object.
+ *
+ * @public              @memberof GoFuture
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   future      Receives constructed future.
+ * @param   allocator   Memory allocator (or kNULL for default)
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoFuture_Construct(GoFuture* future, kAlloc allocator);
+
+/**
+ * Sets a handler that is invoked when the command completes.
+ *
+ * The handler receives the future as the sender argument; the args argument is unused.
+ *
+ * @public              @memberof GoFuture
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   future      GoFuture object.
+ * @param   function    Completion handler (or kNULL to unregister).
+ * @param   receiver    Receiver argument for handler.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoFuture_SetCompletionHandler(GoFuture future, kCallbackFx function, kPointer receiver);
+
+/**
+ * Waits for the command to complete.
+ *
+ * @public              @memberof GoFuture
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   future      GoFuture object.
+ * @param   timeout     Timeout (us).
+ * @return              Command status, or kERROR_TIMEOUT if the command did not complete in time.
+ */
+GoFx(kStatus) GoFuture_Wait(GoFuture future, k64u timeout);
+
+/**
+ * Reports whether the command has completed.
+ *
+ * @public              @memberof GoFuture
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   future      GoFuture object.
+ * @return              kTRUE if complete.
+ */
+GoFx(kBool) GoFuture_IsComplete(GoFuture future);
+
+/**
+ * Gets the command status.
+ *
+ * @public              @memberof GoFuture
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   future      GoFuture object.
+ * @return              Command status, or kERROR_BUSY if the command has not completed.
+ */
+GoFx(kStatus) GoFuture_Status(GoFuture future);
+
+#include <GoSdk/GoFuture.x.h>
+
+#endif
@@ -0,0 +1,37 @@
+/**
+ * @file    GoFuture.x.h
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef GO_SDK_FUTURE_X_H
+#define GO_SDK_FUTURE_X_H
+
+#include <kApi/Threads/kAtomic.h>
+#include <kApi/Threads/kLock.h>
+#include <kApi/Threads/kSemaphore.h>
+
+typedef struct GoFutureClass
+{
+    kObjectClass base;
+
+    kLock lock;                                 //serializes state transitions (begin/complete)
+    kSemaphore completion;                      //signalled on completion
+    kAtomic32s isPending;                       //command issued but not yet completed
+    kBool isSignalled;                          //completion semaphore holds a signal (protected by lock)
+    kStatus status;                             //command status (valid once complete)
+    kCallback onComplete;                       //completion handler
+} GoFutureClass;
+
+kDeclareClassEx(Go, GoFuture, kObject)
+
+GoFx(kStatus) GoFuture_Init(GoFuture future, kType type, kAlloc alloc);
+GoFx(kStatus) GoFuture_VRelease(GoFuture future);
+
+GoFx(kStatus) GoFuture_Begin(GoFuture future);
+GoFx(kStatus) GoFuture_Complete(GoFuture future, kStatus status);
+GoFx(kStatus) GoFuture_Cancel(GoFuture future, kStatus status);
+
+#endif
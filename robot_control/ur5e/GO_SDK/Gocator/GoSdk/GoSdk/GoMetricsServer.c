@@ -0,0 +1,482 @@
+/**
+ * @file    GoMetricsServer.c
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#include <GoSdk/GoMetricsServer.h>
+#include <GoSdk/GoSensor.h>
+#include <GoSdk/Messages/GoHealth.h>
+#include <kApi/Io/kHttpServerChannel.h>
+#include <kApi/Io/kHttpServerRequest.h>
+#include <kApi/Io/kHttpServerResponse.h>
+#include <kApi/Utils/kDebugAlloc.h>
+#include <kApi/Utils/kStatsAlloc.h>
+#include <kApi/Utils/kUtils.h>
+
+// Health indicators exported under their own metric names; all indicators are also
+// exported by id as gosdk_sensor_health_indicator.
+GoMetricsIndicator g_MetricsHealthIndicators[] =
+{
+    { GO_HEALTH_CPU_USED,               "gosdk_sensor_cpu_used_percent",            "gauge",    "Sensor CPU usage (percentage of maximum)." },
+    { GO_HEALTH_MEMORY_USED,            "gosdk_sensor_memory_used_bytes",           "gauge",    "Sensor memory in use." },
+    { GO_HEALTH_TEMPERATURE,            "gosdk_sensor_temperature_celsius",         "gauge",    "Sensor internal temperature." },
+    { GO_HEALTH_CPU_TEMPERATURE,        "gosdk_sensor_cpu_temperature_celsius",     "gauge",    "Sensor CPU temperature." },
+    { GO_HEALTH_SPEED,                  "gosdk_sensor_frame_rate_hz",               "gauge",    "Sensor frame rate." },
+    { GO_HEALTH_PROCESSING_DROPS,       "gosdk_sensor_processing_drops_total",      "counter",  "Frames dropped by sensor processing." },
+    { GO_HEALTH_TRIGGER_DROPS,          "gosdk_sensor_trigger_drops_total",         "counter",  "Triggers dropped by the sensor." },
+    { GO_HEALTH_OUTPUT_DROPS,           "gosdk_sensor_output_drops_total",          "counter",  "Output messages dropped by the sensor (all outputs)." },
+    { GO_HEALTH_ETHERNET_DROPS,         "gosdk_sensor_ethernet_drops_total",        "counter",  "Ethernet output messages dropped by the sensor." }
+};
+
+kBeginValueEx(Go, GoMetricsSensor)
+kEndValueEx()
+
+kBeginClassEx(Go, GoMetricsServer)
+    kAddVMethod(GoMetricsServer, kObject, VRelease)
+kEndClassEx()
+
+GoFx(kStatus) GoMetricsServer_Construct(GoMetricsServer* server, GoSystem system, kAlloc allocator)
+{
+    kAlloc alloc = kAlloc_Fallback(allocator);
+    kStatus status;
+
+    kCheck(kAlloc_GetObject(alloc, kTypeOf(GoMetricsServer), server));
+
+    if (!kSuccess(status = GoMetricsServer_Init(*server, kTypeOf(GoMetricsServer), system, alloc)))
+    {
+        kAlloc_FreeRef(alloc, server);
+    }
+
+    return status;
+}
+
+GoFx(kStatus) GoMetricsServer_Init(GoMetricsServer server, kType type, GoSystem system, kAlloc alloc)
+{
+    kObjR(GoMetricsServer, server);
+    kStatus status;
+
+    kCheck(kObject_Init(server, type, alloc));
+    obj->system = system;
+    obj->server = kNULL;
+    obj->updater = kNULL;
+    obj->updatePeriod = GO_METRICS_SERVER_UPDATE_PERIOD;
+    obj->sensors = kNULL;
+    obj->lock = kNULL;
+    obj->snapshot = kNULL;
+
+    kTry
+    {
+        kTest(kHttpServer_Construct(&obj->server, alloc));
+        kTest(kHttpServer_SetPort(obj->server, GO_METRICS_SERVER_DEFAULT_PORT));
+        kTest(kHttpServer_SetHandler(obj->server, GoMetricsServer_OnRequest, server));
+
+        kTest(kPeriodic_Construct(&obj->updater, alloc));
+        kTest(kArrayList_Construct(&obj->sensors, kTypeOf(GoMetricsSensor), 0, alloc));
+        kTest(kLock_Construct(&obj->lock, alloc));
+        kTest(kString_Construct(&obj->snapshot, "", alloc));
+    }
+    kCatch(&status)
+    {
+        GoMetricsServer_VRelease(server);
+        kEndCatch(status);
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoMetricsServer_VRelease(GoMetricsServer server)
+{
+    kObj(GoMetricsServer, server);
+
+    if (!kIsNull(obj->server) && !kIsNull(obj->updater))
+    {
+        kCheck(GoMetricsServer_Stop(server));
+    }
+
+    kCheck(kDestroyRef(&obj->server));
+    kCheck(kDestroyRef(&obj->updater));
+    kCheck(kDestroyRef(&obj->sensors));
+    kCheck(kDestroyRef(&obj->lock));
+    kCheck(kDestroyRef(&obj->snapshot));
+
+    return kObject_VRelease(server);
+}
+
+GoFx(kStatus) GoMetricsServer_SetAddress(GoMetricsServer server, kIpAddress address)
+{
+    kObj(GoMetricsServer, server);
+
+    return kHttpServer_SetAddress(obj->server, address);
+}
+
+GoFx(kStatus) GoMetricsServer_SetPort(GoMetricsServer server, k32u port)
+{
+    kObj(GoMetricsServer, server);
+
+    return kHttpServer_SetPort(obj->server, port);
+}
+
+GoFx(kStatus) GoMetricsServer_SetUpdatePeriod(GoMetricsServer server, k64u period)
+{
+    kObj(GoMetricsServer, server);
+
+    kCheckState(!kPeriodic_Enabled(obj->updater));
+    kCheckArgs(period > 0);
+
+    obj->updatePeriod = period;
+
+    return kOK;
+}
+
+GoFx(kStatus) GoMetricsServer_Start(GoMetricsServer server)
+{
+    kObj(GoMetricsServer, server);
+
+    kCheckState(!kPeriodic_Enabled(obj->updater));
+
+    //render a first snapshot, so that early scrapes are not empty
+    kCheck(GoMetricsServer_OnUpdate(server, obj->updater));
+
+    kCheck(kHttpServer_Start(obj->server));
+    kCheck(kPeriodic_Start(obj->updater, obj->updatePeriod, GoMetricsServer_OnUpdate, server));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoMetricsServer_Stop(GoMetricsServer server)
+{
+    kObj(GoMetricsServer, server);
+
+    kCheck(kPeriodic_Stop(obj->updater));
+    kCheck(kHttpServer_Stop(obj->server));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoMetricsServer_LocalEndPoint(GoMetricsServer server, kIpEndPoint* endPoint)
+{
+    kObj(GoMetricsServer, server);
+
+    return kHttpServer_LocalEndPoint(obj->server, endPoint);
+}
+
+GoFx(kStatus) GoMetricsServer_OnRequest(GoMetricsServer server, kHttpServer sender, kHttpServerChannel channel)
+{
+    kObj(GoMetricsServer, server);
+    kHttpServerRequest request = kHttpServerChannel_Request(channel);
+    kHttpServerResponse response = kHttpServerChannel_Response(channel);
+    kString snapshot = kNULL;
+    kStream stream = kNULL;
+
+    if (!kStrEquals(kHttpServerRequest_UriPath(request), GO_METRICS_SERVER_PATH))
+    {
+        //an empty body still needs a content length, or the client waits for the connection to close
+        kCheck(kHttpServerResponse_SetStatus(response, kHTTP_STATUS_NOT_FOUND));
+        return kHttpServerResponse_BeginWriteContent(response, 0, &stream);
+    }
+
+    //the snapshot is shared rather than copied; the updater publishes a new string instead of
+    //modifying this one, so it can be written without holding the lock
+    kLock_Enter(obj->lock);
+    {
+        snapshot = obj->snapshot;
+        kObject_Share(snapshot);
+    }
+    kLock_Exit(obj->lock);
+
+    kTry
+    {
+        kTest(kHttpServerResponse_SetStatus(response, kHTTP_STATUS_OK));
+        kTest(kHttpServerResponse_AddHeader(response, "Content-Type", GO_METRICS_SERVER_CONTENT_TYPE));
+        kTest(kHttpServerResponse_BeginWriteContent(response, kString_Length(snapshot), &stream));
+        kTest(kStream_Write(stream, kString_Chars(snapshot), kString_Length(snapshot)));
+    }
+    kFinally
+    {
+        kObject_Destroy(snapshot);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoMetricsServer_OnUpdate(GoMetricsServer server, kPeriodic timer)
+{
+    kObj(GoMetricsServer, server);
+    kString text = kNULL;
+    kString previous = kNULL;
+
+    kTry
+    {
+        kTest(kString_Construct(&text, "", kObject_Alloc(server)));
+        kTest(kString_Reserve(text, kString_Length(obj->snapshot)));
+
+        kTest(GoMetricsServer_Gather(server));
+        kTest(GoMetricsServer_Format(server, text));
+
+        kLock_Enter(obj->lock);
+        {
+            previous = obj->snapshot;
+            obj->snapshot = text;
+            text = kNULL;
+        }
+        kLock_Exit(obj->lock);
+    }
+    kFinally
+    {
+        GoMetricsServer_ClearSensors(server);
+
+        kObject_Destroy(previous);
+        kObject_Destroy(text);
+
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+// Collects per-sensor values under the system state lock; formatting happens afterwards.
+GoFx(kStatus) GoMetricsServer_Gather(GoMetricsServer server)
+{
+    kObj(GoMetricsServer, server);
+    GoMetricsSensor entry;
+    kSize i;
+
+    kCheck(GoSystem_LockState(obj->system));
+
+    kTry
+    {
+        for (i = 0; i < GoSystem_SensorCount(obj->system); ++i)
+        {
+            GoSensor sensor = GoSystem_SensorAt(obj->system, i);
+
+            entry.id = GoSensor_Id(sensor);
+            entry.health = kNULL;
+            kTest(GoSensor_DataStats(sensor, &entry.stats));
+
+            kTest(kArrayList_AddT(obj->sensors, &entry));
+            kTest(GoSensor_LastHealth(sensor, &kArrayList_LastT(obj->sensors, GoMetricsSensor)->health));
+        }
+    }
+    kFinally
+    {
+        GoSystem_UnlockState(obj->system);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoMetricsServer_ClearSensors(GoMetricsServer server)
+{
+    kObj(GoMetricsServer, server);
+    kSize i;
+
+    for (i = 0; i < kArrayList_Count(obj->sensors); ++i)
+    {
+        kCheck(kObject_Dispose(kArrayList_AtT(obj->sensors, i, GoMetricsSensor)->health));
+    }
+
+    return kArrayList_Clear(obj->sensors);
+}
+
+GoFx(kStatus) GoMetricsServer_Format(GoMetricsServer server, kString text)
+{
+    kCheck(GoMetricsServer_FormatHealth(server, text));
+    kCheck(GoMetricsServer_FormatData(server, text));
+    kCheck(GoMetricsServer_FormatAlloc(server, text));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoMetricsServer_FormatHealth(GoMetricsServer server, kString text)
+{
+    kObj(GoMetricsServer, server);
+    kSize i, j, k, m;
+
+    // Named indicators first, then every indicator by id; each metric family must be contiguous.
+    for (i = 0; i <= kCountOf(g_MetricsHealthIndicators); ++i)
+    {
+        const GoMetricsIndicator* named = (i < kCountOf(g_MetricsHealthIndicators)) ? &g_MetricsHealthIndicators[i] : kNULL;
+
+        if (kIsNull(named))
+        {
+            kCheck(GoMetricsServer_AddHeader(text, "gosdk_sensor_health_indicator", "gauge", "Most recent value of each sensor health indicator."));
+        }
+        else
+        {
+            kCheck(GoMetricsServer_AddHeader(text, named->name, named->type, named->help));
+        }
+
+        for (j = 0; j < kArrayList_Count(obj->sensors); ++j)
+        {
+            const GoMetricsSensor* sensor = kArrayList_AtT(obj->sensors, j, GoMetricsSensor);
+
+            for (k = 0; !kIsNull(sensor->health) && (k < GoDataSet_Count(sensor->health)); ++k)
+            {
+                GoHealthMsg health = GoDataSet_At(sensor->health, k);
+
+                for (m = 0; m < GoHealthMsg_Count(health); ++m)
+                {
+                    const GoIndicator* indicator = GoHealthMsg_At(health, m);
+
+                    if (kIsNull(named))
+                    {
+                        kCheck(kString_Addf(text, "gosdk_sensor_health_indicator{sensor=\"%u\",source=\"%d\",id=\"%u\",instance=\"%u\"} %lld\n",
+                            sensor->id, GoHealthMsg_Source(health), indicator->id, indicator->instance, (k64s)indicator->value));
+                    }
+                    else if (indicator->id == named->id)
+                    {
+                        kCheck(kString_Addf(text, "%s{sensor=\"%u\",source=\"%d\",instance=\"%u\"} %lld\n",
+                            named->name, sensor->id, GoHealthMsg_Source(health), indicator->instance, (k64s)indicator->value));
+                    }
+                }
+            }
+        }
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoMetricsServer_FormatData(GoMetricsServer server, kString text)
+{
+    kObj(GoMetricsServer, server);
+    GoDataStats queue;
+    kSize i, j;
+
+    kCheck(GoMetricsServer_AddDataCounter(server, text, "gosdk_data_received_bytes_total", "counter", "Bytes received on sensor data connections.", offsetof(GoDataStats, bytesReceived)));
+    kCheck(GoMetricsServer_AddDataCounter(server, text, "gosdk_data_datasets_total", "counter", "Datasets received on sensor data connections.", offsetof(GoDataStats, dataSetCount)));
+    kCheck(GoMetricsServer_AddDataCounter(server, text, "gosdk_data_reconnects_total", "counter", "Times a sensor data connection was re-established.", offsetof(GoDataStats, reconnectCount)));
+
+    kCheck(GoMetricsServer_AddHeader(text, "gosdk_data_messages_total", "counter", "Data messages received, by message type."));
+
+    for (i = 0; i < kArrayList_Count(obj->sensors); ++i)
+    {
+        const GoMetricsSensor* sensor = kArrayList_AtT(obj->sensors, i, GoMetricsSensor);
+
+        for (j = 0; j < GO_DATA_STATS_MESSAGE_TYPE_COUNT; ++j)
+        {
+            if (sensor->stats.messageCount[j] > 0)
+            {
+                kCheck(kString_Addf(text, "gosdk_data_messages_total{sensor=\"%u\",type=\"%u\"} %llu\n", sensor->id, (k32u)j, (k64u)sensor->stats.messageCount[j]));
+            }
+        }
+    }
+
+    kCheck(GoMetricsServer_AddHeader(text, "gosdk_data_deserialization_seconds", "summary", "Time taken to read and deserialize a dataset."));
+
+    for (i = 0; i < kArrayList_Count(obj->sensors); ++i)
+    {
+        const GoMetricsSensor* sensor = kArrayList_AtT(obj->sensors, i, GoMetricsSensor);
+        const GoLatencyStats* time = &sensor->stats.deserialization;
+
+        kCheck(kString_Addf(text, "gosdk_data_deserialization_seconds{sensor=\"%u\",quantile=\"0.5\"} %.9f\n", sensor->id, time->p50 / 1e9));
+        kCheck(kString_Addf(text, "gosdk_data_deserialization_seconds{sensor=\"%u\",quantile=\"0.99\"} %.9f\n", sensor->id, time->p99 / 1e9));
+        kCheck(kString_Addf(text, "gosdk_data_deserialization_seconds{sensor=\"%u\",quantile=\"0.999\"} %.9f\n", sensor->id, time->p999 / 1e9));
+        kCheck(kString_Addf(text, "gosdk_data_deserialization_seconds{sensor=\"%u\",quantile=\"1\"} %.9f\n", sensor->id, time->max / 1e9));
+        kCheck(kString_Addf(text, "gosdk_data_deserialization_seconds_count{sensor=\"%u\"} %llu\n", sensor->id, (k64u)time->count));
+    }
+
+    kCheck(GoMetricsServer_AddHeader(text, "gosdk_data_jitter_seconds", "gauge", "Smoothed variation of the dataset inter-arrival time."));
+
+    for (i = 0; i < kArrayList_Count(obj->sensors); ++i)
+    {
+        const GoMetricsSensor* sensor = kArrayList_AtT(obj->sensors, i, GoMetricsSensor);
+
+        kCheck(kString_Addf(text, "gosdk_data_jitter_seconds{sensor=\"%u\"} %.9f\n", sensor->id, sensor->stats.jitter / 1e9));
+    }
+
+    kCheck(GoSystem_DataQueueStats(obj->system, &queue));
+
+    kCheck(GoMetricsServer_AddHeader(text, "gosdk_data_queue_high_watermark", "gauge", "Largest count of datasets held in the system data queue."));
+    kCheck(kString_Addf(text, "gosdk_data_queue_high_watermark %llu\n", (k64u)queue.queueHighWatermark));
+
+    kCheck(GoMetricsServer_AddHeader(text, "gosdk_data_queue_drops_total", "counter", "Datasets dropped from the system data queue."));
+    kCheck(kString_Addf(text, "gosdk_data_queue_drops_total %llu\n", (k64u)queue.dropCount));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoMetricsServer_FormatAlloc(GoMetricsServer server, kString text)
+{
+    kAlloc appAlloc = kAlloc_App();
+
+    // Only the debug allocator keeps track of the amount of memory allocated.
+    if (kObject_Is(appAlloc, kTypeOf(kDebugAlloc)))
+    {
+        kCheck(GoMetricsServer_AddHeader(text, "gosdk_allocator_allocated_bytes", "gauge", "Memory currently allocated through the allocator."));
+        kCheck(kString_Addf(text, "gosdk_allocator_allocated_bytes{allocator=\"app\"} %llu\n", (k64u)kDebugAlloc_Allocated(appAlloc)));
+    }
+    else if (kObject_Is(appAlloc, kTypeOf(kStatsAlloc)))
+    {
+        kCheck(GoMetricsServer_FormatAllocStats(server, text, appAlloc));
+    }
+
+    return kOK;
+}
+
+// Reports the statistics of a kStatsAlloc, as of its most recent merge.
+GoFx(kStatus) GoMetricsServer_FormatAllocStats(GoMetricsServer server, kString text, kStatsAlloc alloc)
+{
+    kStatsAllocInfo info;
+    kArrayList types = kNULL;
+    kSize i;
+
+    kCheck(kStatsAlloc_Stats(alloc, &info));
+
+    kCheck(GoMetricsServer_AddHeader(text, "gosdk_allocator_allocated_bytes", "gauge", "Memory currently allocated through the allocator."));
+    kCheck(kString_Addf(text, "gosdk_allocator_allocated_bytes{allocator=\"app\"} %llu\n", info.liveBytes));
+    kCheck(GoMetricsServer_AddHeader(text, "gosdk_allocator_peak_bytes", "gauge", "Largest amount of memory allocated through the allocator."));
+    kCheck(kString_Addf(text, "gosdk_allocator_peak_bytes{allocator=\"app\"} %llu\n", info.peakBytes));
+    kCheck(GoMetricsServer_AddHeader(text, "gosdk_allocator_allocations_total", "counter", "Number of allocations made through the allocator."));
+    kCheck(kString_Addf(text, "gosdk_allocator_allocations_total{allocator=\"app\"} %llu\n", info.allocCount));
+
+    kTry
+    {
+        kTest(kStatsAlloc_TypeStats(alloc, &types, kObject_Alloc(server)));
+
+        kTest(GoMetricsServer_AddHeader(text, "gosdk_allocator_type_live_bytes", "gauge", "Estimated memory allocated for objects of each type (sampled)."));
+
+        for (i = 0; i < kArrayList_Count(types); ++i)
+        {
+            const kStatsAllocTypeInfo* item = kArrayList_AtT(types, i, kStatsAllocTypeInfo);
+            const kChar* name = kIsNull(item->type) ? "untyped" : kType_Name(item->type);
+
+            kTest(kString_Addf(text, "gosdk_allocator_type_live_bytes{allocator=\"app\",type=\"%s\"} %llu\n", name, item->info.liveBytes));
+        }
+    }
+    kFinally
+    {
+        kObject_Destroy(types);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoMetricsServer_AddHeader(kString text, const kChar* name, const kChar* type, const kChar* help)
+{
+    return kString_Addf(text, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+// Adds a metric family for one k64u field of GoDataStats, identified by its offset.
+GoFx(kStatus) GoMetricsServer_AddDataCounter(GoMetricsServer server, kString text, const kChar* name, const kChar* type, const kChar* help, kSize offset)
+{
+    kObj(GoMetricsServer, server);
+    kSize i;
+
+    kCheck(GoMetricsServer_AddHeader(text, name, type, help));
+
+    for (i = 0; i < kArrayList_Count(obj->sensors); ++i)
+    {
+        const GoMetricsSensor* sensor = kArrayList_AtT(obj->sensors, i, GoMetricsSensor);
+        k64u value = *(const k64u*)((const kByte*)&sensor->stats + offset);
+
+        kCheck(kString_Addf(text, "%s{sensor=\"%u\"} %llu\n", name, sensor->id, value));
+    }
+
+    return kOK;
+}
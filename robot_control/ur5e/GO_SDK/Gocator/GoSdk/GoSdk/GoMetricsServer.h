@@ -0,0 +1,132 @@
+/**
+ * @file    GoMetricsServer.h
+ * @brief   Declares the GoMetricsServer class.
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef GO_SDK_METRICS_SERVER_H
+#define GO_SDK_METRICS_SERVER_H
+
+#include <GoSdk/GoSdkDef.h>
+#include <GoSdk/GoSystem.h>
+
+#define GO_METRICS_SERVER_DEFAULT_PORT              (9464)      ///< Default metrics server port.
+#define GO_METRICS_SERVER_PATH                      "/metrics"  ///< Path at which metrics are served.
+
+/**
+ * @class   GoMetricsServer
+ * @extends kObject
+ * @ingroup GoSdk
+ * @brief   Serves sensor health and SDK data path metrics over HTTP, in Prometheus text format.
+ *
+ * The server exports the most recent health indicators of each sensor in a GoSystem (e.g.
+ * CPU usage, temperature, frame rate and drop counts), the data channel counters reported
+ * by GoSensor_DataStats and, when the application allocator is a kDebugAlloc or a kStatsAlloc,
+ * allocator usage. A kStatsAlloc reports the values of its most recent merge (see
+ * kStatsAlloc_SetMergePeriod).
+ *
+ * Metrics are rendered into a snapshot on a background thread at a fixed period. Requests
+ * are answered from the most recent snapshot, so scrapes never wait on sensor I/O and
+ * receiver threads never wait on scrapes.
+ *
+ * Typical usage:
+ *
+ *    GoMetricsServer_Construct(&metrics, system, kNULL);
+ *    GoMetricsServer_SetPort(metrics, GO_METRICS_SERVER_DEFAULT_PORT);
+ *    GoMetricsServer_Start(metrics);
+ *    ...
+ *    GoDestroy(metrics);
+ *
+ * The server must be destroyed before the system.
+ */
+typedef kObject GoMetricsServer;
+
+/**
+ * Constructs a GoMetricsServer object.
+ *
+ * @public              @memberof GoMetricsServer
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   server      Receives constructed metrics server.
+ * @param   system      System whose metrics are served.
+ * @param   allocator   Memory allocator (or kNULL for default)
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoMetricsServer_Construct(GoMetricsServer* server, GoSystem system, kAlloc allocator);
+
+/**
+ * Sets the local address on which the server listens (default: any address).
+ *
+ * This function can only be called while the server is stopped.
+ *
+ * @public              @memberof GoMetricsServer
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   server      GoMetricsServer object.
+ * @param   address     Local IP address.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoMetricsServer_SetAddress(GoMetricsServer server, kIpAddress address);
+
+/**
+ * Sets the local port on which the server listens (default: GO_METRICS_SERVER_DEFAULT_PORT).
+ *
+ * A port of zero selects an ephemeral port; see GoMetricsServer_LocalEndPoint. This function
+ * can only be called while the server is stopped.
+ *
+ * @public              @memberof GoMetricsServer
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   server      GoMetricsServer object.
+ * @param   port        Local port number.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoMetricsServer_SetPort(GoMetricsServer server, k32u port);
+
+/**
+ * Sets the period at which the metrics snapshot is updated (default: one second).
+ *
+ * This function can only be called while the server is stopped.
+ *
+ * @public              @memberof GoMetricsServer
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   server      GoMetricsServer object.
+ * @param   period      Update period, in microseconds.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoMetricsServer_SetUpdatePeriod(GoMetricsServer server, k64u period);
+
+/**
+ * Starts serving metrics.
+ *
+ * @public              @memberof GoMetricsServer
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   server      GoMetricsServer object.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoMetricsServer_Start(GoMetricsServer server);
+
+/**
+ * Stops serving metrics.
+ *
+ * @public              @memberof GoMetricsServer
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   server      GoMetricsServer object.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoMetricsServer_Stop(GoMetricsServer server);
+
+/**
+ * Reports the local end point on which the server is listening.
+ *
+ * @public              @memberof GoMetricsServer
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   server      GoMetricsServer object.
+ * @param   endPoint    Receives the local end point.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoMetricsServer_LocalEndPoint(GoMetricsServer server, kIpEndPoint* endPoint);
+
+#include <GoSdk/GoMetricsServer.x.h>
+
+#endif
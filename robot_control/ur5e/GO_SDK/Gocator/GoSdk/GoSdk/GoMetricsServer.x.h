@@ -0,0 +1,71 @@
+/**
+ * @file    GoMetricsServer.x.h
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef GO_SDK_METRICS_SERVER_X_H
+#define GO_SDK_METRICS_SERVER_X_H
+
+#include <kApi/Data/kArrayList.h>
+#include <kApi/Data/kString.h>
+#include <kApi/Io/kHttpServer.h>
+#include <kApi/Threads/kLock.h>
+#include <kApi/Threads/kPeriodic.h>
+
+#define GO_METRICS_SERVER_UPDATE_PERIOD             (1000000)           //default snapshot update period (us)
+#define GO_METRICS_SERVER_CONTENT_TYPE              "text/plain; version=0.0.4; charset=utf-8"
+
+// Describes a health indicator that is exported under its own metric name.
+typedef struct GoMetricsIndicator
+{
+    k32u id;                                    //indicator id (e.g. GO_HEALTH_CPU_USED)
+    const kChar* name;                          //metric name
+    const kChar* type;                          //metric type ("gauge" or "counter")
+    const kChar* help;                          //metric description
+} GoMetricsIndicator;
+
+typedef struct GoMetricsSensor
+{
+    k32u id;                                    //sensor serial number
+    GoDataStats stats;                          //data channel counters
+    GoDataSet health;                           //most recent health message set (shared reference, or kNULL)
+} GoMetricsSensor;
+
+kDeclareValueEx(Go, GoMetricsSensor, kValue)
+
+typedef struct GoMetricsServerClass
+{
+    kObjectClass base;
+
+    GoSystem system;                            //system whose metrics are served
+    kHttpServer server;                         //http server
+    kPeriodic updater;                          //renders the snapshot in the background
+    k64u updatePeriod;                          //snapshot update period (us)
+    kArrayList sensors;                         //values gathered during an update (kArrayList<GoMetricsSensor>; updater only)
+
+    kLock lock;                                 //protects snapshot
+    kString snapshot;                           //most recent metrics text; never modified once published
+} GoMetricsServerClass;
+
+kDeclareClassEx(Go, GoMetricsServer, kObject)
+
+GoFx(kStatus) GoMetricsServer_Init(GoMetricsServer server, kType type, GoSystem system, kAlloc alloc);
+GoFx(kStatus) GoMetricsServer_VRelease(GoMetricsServer server);
+
+GoFx(kStatus) GoMetricsServer_OnRequest(GoMetricsServer server, kHttpServer sender, kHttpServerChannel channel);
+GoFx(kStatus) GoMetricsServer_OnUpdate(GoMetricsServer server, kPeriodic timer);
+
+GoFx(kStatus) GoMetricsServer_Gather(GoMetricsServer server);
+GoFx(kStatus) GoMetricsServer_ClearSensors(GoMetricsServer server);
+GoFx(kStatus) GoMetricsServer_Format(GoMetricsServer server, kString text);
+GoFx(kStatus) GoMetricsServer_FormatHealth(GoMetricsServer server, kString text);
+GoFx(kStatus) GoMetricsServer_FormatData(GoMetricsServer server, kString text);
+GoFx(kStatus) GoMetricsServer_FormatAlloc(GoMetricsServer server, kString text);
+GoFx(kStatus) GoMetricsServer_FormatAllocStats(GoMetricsServer server, kString text, kStatsAlloc alloc);
+GoFx(kStatus) GoMetricsServer_AddHeader(kString text, const kChar* name, const kChar* type, const kChar* help);
+GoFx(kStatus) GoMetricsServer_AddDataCounter(GoMetricsServer server, kString text, const kChar* name, const kChar* type, const kChar* help, kSize offset);
+
+#endif
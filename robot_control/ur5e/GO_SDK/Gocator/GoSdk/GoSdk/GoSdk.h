@@ -15,11 +15,14 @@
 #include <GoSdk/GoAccelerator.h>
 #include <GoSdk/GoAcceleratorMgr.h>
 #include <GoSdk/GoAlgorithm.h>
+#include <GoSdk/GoFuture.h>
+#include <GoSdk/GoMetricsServer.h>
 #include <GoSdk/GoPartModel.h>
 #include <GoSdk/GoReplay.h>
 #include <GoSdk/GoSections.h>
 #include <GoSdk/GoSensor.h>
 #include <GoSdk/GoSensorInfo.h>
+#include <GoSdk/GoSessionPool.h>
 #include <GoSdk/GoSetup.h>
 #include <GoSdk/GoSystem.h>
 #include <GoSdk/GoTracheid.h>
@@ -28,7 +31,9 @@
 #include <GoSdk/GoUtils.h>
 #include <GoSdk/Internal/GoAccelSensorPortAlloc.h>
 #include <GoSdk/Internal/GoControl.h>
+#include <GoSdk/Internal/GoControlDispatcher.h>
 #include <GoSdk/Internal/GoDiscovery.h>
+#include <GoSdk/Internal/GoHealthTable.h>
 #include <GoSdk/Internal/GoReceiver.h>
 #include <GoSdk/Internal/GoSerializer.h>
 #include <GoSdk/Messages/GoDataSet.h>
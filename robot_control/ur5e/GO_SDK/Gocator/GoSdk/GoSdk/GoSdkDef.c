@@ -505,6 +505,61 @@ kBeginValueEx(Go, GoBuddyInfo)
     kAddField(GoBuddyInfo, GoBuddyState, state)
 kEndValueEx()
 
+kBeginValueEx(Go, GoSensorResult)
+    kAddField(GoSensorResult, k32u, id)
+    kAddField(GoSensorResult, kStatus, status)
+    kAddField(GoSensorResult, k64u, duration)
+kEndValueEx()
+
+kBeginValueEx(Go, GoStartupTimes)
+    kAddField(GoStartupTimes, k64u, discovery)
+    kAddField(GoStartupTimes, k64u, connect)
+    kAddField(GoStartupTimes, k64u, configRead)
+kEndValueEx()
+
+kBeginValueEx(Go, GoLowLatencyOptions)
+    kAddField(GoLowLatencyOptions, kBool, enabled)
+    kAddField(GoLowLatencyOptions, k32s, cpu)
+    kAddField(GoLowLatencyOptions, kThreadPriorityClass, priorityClass)
+    kAddField(GoLowLatencyOptions, k64u, busyPollTime)
+kEndValueEx()
+
+kBeginValueEx(Go, GoAdaptiveBufferOptions)
+    kAddField(GoAdaptiveBufferOptions, kBool, enabled)
+    kAddField(GoAdaptiveBufferOptions, kSize, socketSize)
+    kAddField(GoAdaptiveBufferOptions, kSize, minStreamSize)
+    kAddField(GoAdaptiveBufferOptions, kSize, maxStreamSize)
+    kAddField(GoAdaptiveBufferOptions, kSize, directReadThreshold)
+kEndValueEx()
+
+kBeginValueEx(Go, GoLatencyStats)
+    kAddField(GoLatencyStats, k64u, count)
+    kAddField(GoLatencyStats, k64u, p50)
+    kAddField(GoLatencyStats, k64u, p99)
+    kAddField(GoLatencyStats, k64u, p999)
+    kAddField(GoLatencyStats, k64u, max)
+kEndValueEx()
+
+kBeginValueEx(Go, GoDataStats)
+    kAddField(GoDataStats, k64u, bytesReceived)
+    kAddField(GoDataStats, k64u, dataSetCount)
+    kAddField(GoDataStats, GoLatencyStats, deserialization)
+    kAddField(GoDataStats, k64u, queueHighWatermark)
+    kAddField(GoDataStats, k64u, dropCount)
+    kAddField(GoDataStats, k64u, reconnectCount)
+    kAddField(GoDataStats, k64u, jitter)
+kEndValueEx()
+
+kBeginValueEx(Go, GoHealthCrossingFxArgs)
+    kAddField(GoHealthCrossingFxArgs, k32u, sensorId)
+    kAddField(GoHealthCrossingFxArgs, k32u, id)
+    kAddField(GoHealthCrossingFxArgs, k32u, instance)
+    kAddField(GoHealthCrossingFxArgs, k64s, threshold)
+    kAddField(GoHealthCrossingFxArgs, k64s, previous)
+    kAddField(GoHealthCrossingFxArgs, k64s, value)
+    kAddField(GoHealthCrossingFxArgs, kBool, rising)
+kEndValueEx()
+
 kBeginValueEx(Go, GoElement64f)
     kAddField(GoElement64f, kBool, enabled)
     kAddField(GoElement64f, k64f, systemValue)
@@ -75,6 +75,50 @@ typedef struct GoUpgradeFxArgs
 
 typedef kStatus (kCall* GoUpgradeFx) (kPointer receiver, kObject sender, GoUpgradeFxArgs* args);
 
+/**
+ * @struct  GoTransferFxArgs
+ * @extends kValue
+ * @ingroup GoSdk
+ * @brief   Represents arguments provided to a file transfer progress callback function.
+ */
+typedef struct GoTransferFxArgs
+{
+    k64u completed;         ///< Bytes transferred so far.
+    k64u total;             ///< Total bytes to be transferred (0 if not known in advance).
+} GoTransferFxArgs;
+
+/**
+ * Callback signature used to report file transfer progress.
+ *
+ * Returning an error status from the callback cancels the transfer.
+ */
+typedef kStatus (kCall* GoTransferFx) (kPointer receiver, kObject sender, GoTransferFxArgs* args);
+
+/**
+ * @struct  GoHealthCrossingFxArgs
+ * @extends kValue
+ * @ingroup GoSdk
+ * @brief   Represents arguments provided to a health threshold callback function.
+ */
+typedef struct GoHealthCrossingFxArgs
+{
+    k32u sensorId;          ///< Serial number of the reporting sensor.
+    k32u id;                ///< Indicator ID (e.g. GO_HEALTH_CPU_USED).
+    k32u instance;          ///< Indicator instance number.
+    k64s threshold;         ///< Threshold that was crossed.
+    k64s previous;          ///< Previous indicator value (equal to value for the first report of an indicator).
+    k64s value;             ///< Current indicator value.
+    kBool rising;           ///< kTRUE if the value rose to or above the threshold; kFALSE if it fell below.
+} GoHealthCrossingFxArgs;
+
+/**
+ * Callback signature used to report health indicator threshold crossings.
+ *
+ * The callback is invoked on the health receiver thread of the reporting sensor; it should
+ * return promptly.
+ */
+typedef kStatus (kCall* GoHealthCrossingFx) (kPointer receiver, kObject sender, GoHealthCrossingFxArgs* args);
+
 /**
  * @struct  GoDeviceState
  * @extends kValue
@@ -875,6 +919,112 @@ typedef struct GoBuddyInfo
     GoBuddyState state;///< Buddy state of this device.
 } GoBuddyInfo;
 
+/**
+ * @struct  GoSensorResult
+ * @extends kValue
+ * @ingroup GoSdk
+ * @brief   Outcome of an operation performed on one sensor of a GoSystem.
+ */
+typedef struct GoSensorResult
+{
+    k32u id;                    ///< Serial number of the device.
+    kStatus status;             ///< Operation status.
+    k64u duration;              ///< Operation duration, in microseconds.
+} GoSensorResult;
+
+/**
+ * @struct  GoStartupTimes
+ * @extends kValue
+ * @ingroup GoSdk
+ * @brief   Breakdown of the time taken to bring up a GoSystem, in microseconds.
+ *
+ * Sensors are connected concurrently, so the connection fields report the longest time among all sensors.
+ */
+typedef struct GoStartupTimes
+{
+    k64u discovery;             ///< Time spent waiting for the first discovery enumeration (0 if discovery was bypassed).
+    k64u connect;               ///< Time taken to establish the control connection.
+    k64u configRead;            ///< Time taken to read sensor information, configuration and transform after connecting.
+} GoStartupTimes;
+
+/**
+ * @struct  GoLowLatencyOptions
+ * @extends kValue
+ * @ingroup GoSdk
+ * @brief   Receive options for a low-latency data connection.
+ *
+ * In low-latency mode, the data thread blocks directly in the socket read instead of polling 
+ * for data, and is unblocked by shutting down the socket when data is disabled.
+ */
+typedef struct GoLowLatencyOptions
+{
+    kBool enabled;                          ///< Enables low-latency mode.
+    k32s cpu;                               ///< Processor to which the data thread is pinned (-1 for no affinity).
+    kThreadPriorityClass priorityClass;     ///< Priority class of the data thread.
+    k64u busyPollTime;                      ///< Socket busy-poll duration, in microseconds (0 to disable; Linux only).
+} GoLowLatencyOptions;
+
+/**
+ * @struct  GoAdaptiveBufferOptions
+ * @extends kValue
+ * @ingroup GoSdk
+ * @brief   Buffer sizing options for a data connection.
+ *
+ * When enabled, the socket read buffer is set before connecting and keeps its size: on Linux, the 
+ * TCP window scale is fixed when the connection is made, so a socket buffer that grows afterwards 
+ * can't widen the receive window. Operating systems may limit socket buffer sizes (e.g., 
+ * net.core.rmem_max on Linux). The stream (client) read buffer is sized from the observed message 
+ * sizes and bandwidth, to batch several small messages per socket read; sizes are rounded up to 
+ * powers of two and kept within the given bounds.
+ */
+typedef struct GoAdaptiveBufferOptions
+{
+    kBool enabled;                          ///< Enables adaptive buffer sizing.
+    kSize socketSize;                       ///< Socket read buffer size, in bytes (0 for the operating system default).
+    kSize minStreamSize;                    ///< Minimum stream read buffer size, in bytes (at least one).
+    kSize maxStreamSize;                    ///< Maximum stream read buffer size, in bytes.
+    kSize directReadThreshold;              ///< Reads of at least this many bytes bypass the stream buffer (0 to disable).
+} GoAdaptiveBufferOptions;
+
+/**
+ * @struct  GoLatencyStats
+ * @extends kValue
+ * @ingroup GoSdk
+ * @brief   Distribution of a latency measurement, in nanoseconds.
+ *
+ * Percentiles are estimated from a histogram with a relative error of at most 12.5%.
+ */
+typedef struct GoLatencyStats
+{
+    k64u count;                 ///< Number of messages measured.
+    k64u p50;                   ///< Median latency.
+    k64u p99;                   ///< 99th percentile latency.
+    k64u p999;                  ///< 99.9th percentile latency.
+    k64u max;                   ///< Maximum latency.
+} GoLatencyStats;
+
+#define GO_DATA_STATS_MESSAGE_TYPE_COUNT        (40)        ///< Number of message types counted individually by GoDataStats.
+
+/**
+ * @struct  GoDataStats
+ * @extends kValue
+ * @ingroup GoSdk
+ * @brief   Data connection counters, accumulated over all data connections since the sensor was added.
+ *
+ * Queue fields describe the GoSystem data queue, which is shared by all sensors of a system.
+ */
+typedef struct GoDataStats
+{
+    k64u bytesReceived;                                 ///< Bytes received.
+    k64u dataSetCount;                                  ///< Datasets received.
+    k64u messageCount[GO_DATA_STATS_MESSAGE_TYPE_COUNT];///< Messages received, indexed by GoDataMessageType.
+    GoLatencyStats deserialization;                     ///< Time taken to read and deserialize each dataset.
+    k64u queueHighWatermark;                            ///< Largest count of datasets held in the data queue.
+    k64u dropCount;                                     ///< Datasets dropped from the data queue.
+    k64u reconnectCount;                                ///< Times the data connection was re-established.
+    k64u jitter;                                        ///< Smoothed variation of the dataset inter-arrival time, in nanoseconds.
+} GoDataStats;
+
 /**
  * @struct  GoElement64f
  * @extends kValue
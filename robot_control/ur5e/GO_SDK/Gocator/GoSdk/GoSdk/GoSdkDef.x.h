@@ -293,9 +293,11 @@ kDeclareEnumEx(Go, GoVoltageSetting, kValue)
 
 kDeclareValueEx(Go, Go3dTransform64f, kValue)
 kDeclareValueEx(Go, GoActiveAreaConfig, kValue)
+kDeclareValueEx(Go, GoAdaptiveBufferOptions, kValue)
 kDeclareValueEx(Go, GoAddressInfo, kValue)
 kDeclareValueEx(Go, GoAsciiConfig, kValue)
 kDeclareValueEx(Go, GoBuddyInfo, kValue)
+kDeclareValueEx(Go, GoDataStats, kValue)
 kDeclareValueEx(Go, GoDataStream, kValue)
 kDeclareValueEx(Go, GoDataStreamId, kValue)
 kDeclareValueEx(Go, GoEipConfig, kValue)
@@ -305,6 +307,8 @@ kDeclareValueEx(Go, GoElement64f, kValue)
 kDeclareValueEx(Go, GoFacet32u, kValue)
 kDeclareValueEx(Go, GoFeatureOption, kValue)
 kDeclareValueEx(Go, GoFilter, kValue)
+kDeclareValueEx(Go, GoLatencyStats, kValue)
+kDeclareValueEx(Go, GoLowLatencyOptions, kValue)
 kDeclareValueEx(Go, GoMeshMsgChannel, kValue)
 kDeclareValueEx(Go, GoModbusConfig, kValue)
 kDeclareValueEx(Go, GoMeasurementOption, kValue)
@@ -313,11 +317,15 @@ kDeclareValueEx(Go, GoPolygonCornerParameters, kValue)
 kDeclareValueEx(Go, GoPortInfo, kValue)
 kDeclareValueEx(Go, GoProfinetConfig, kValue)
 kDeclareValueEx(Go, GoSelcomConfig, kValue)
+kDeclareValueEx(Go, GoSensorResult, kValue)
+kDeclareValueEx(Go, GoStartupTimes, kValue)
 kDeclareValueEx(Go, GoStates, kValue)
 kDeclareValueEx(Go, GoToolDataOutputOption, kValue)
 kDeclareValueEx(Go, GoTransformation, kValue)
 kDeclareValueEx(Go, GoTransformedDataRegion, kValue)
 kDeclareValueEx(Go, GoUpgradeFxArgs, kValue)
+kDeclareValueEx(Go, GoTransferFxArgs, kValue)
+kDeclareValueEx(Go, GoHealthCrossingFxArgs, kValue)
 
 typedef struct GoTypePair
 {
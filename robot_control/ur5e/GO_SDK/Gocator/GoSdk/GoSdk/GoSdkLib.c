@@ -9,6 +9,7 @@
 #include <GoSdk/GoSdkLib.h>
 #include <kApi/kApiLib.h>
 #include <GoSdk/GoSdk.h>
+#include <GoSdk/Internal/GoSerializer.h>
 
 #define GO_SDK_VERSION  kVersion_Stringify_(GO_SDK_VERSION_MAJOR, GO_SDK_VERSION_MINOR, GO_SDK_VERSION_RELEASE, GO_SDK_VERSION_BUILD)
 
@@ -29,6 +30,7 @@ kBeginAssemblyEx(Go, GoSdk, GO_SDK_VERSION, GO_SDK_VERSION)
     kAddType(GoAcceleratorMgrWorkerMsg)
     kAddType(GoAccelSensorPortAllocPorts)
     kAddType(GoActiveAreaConfig)
+    kAddType(GoAdaptiveBufferOptions)
     kAddType(GoAddressInfo)
     kAddType(GoAdvancedType)
     kAddType(GoAlignmentRef)
@@ -45,8 +47,10 @@ kBeginAssemblyEx(Go, GoSdk, GO_SDK_VERSION, GO_SDK_VERSION)
     kAddType(GoBrandingType)
     kAddType(GoBuddyInfo)
     kAddType(GoBuddyState)
+    kAddType(GoControlAsyncCommand)
     kAddType(GoDataMessageType)
     kAddType(GoDataSource)
+    kAddType(GoDataStats)
     kAddType(GoDataStep)
     kAddType(GoDataStream)
     kAddType(GoDataStreamId)
@@ -86,15 +90,23 @@ kBeginAssemblyEx(Go, GoSdk, GO_SDK_VERSION, GO_SDK_VERSION)
     kAddType(GoFilter)
     kAddType(GoFrameRateMaxSource)
     kAddType(GoGammaType)
+    kAddType(GoHealthCrossing)
+    kAddType(GoHealthCrossingFxArgs)
+    kAddType(GoHealthEntry)
+    kAddType(GoHealthKey)
     kAddType(GoHealthIndicatorId)
+    kAddType(GoHealthWatch)
     kAddType(GoImageType)
     kAddType(GoImplicitTriggerOverride)
     kAddType(GoIndicator)
     kAddType(GoInputSource)
+    kAddType(GoLatencyStats)
+    kAddType(GoLowLatencyOptions)
     kAddType(GoMaterialType)
     kAddType(GoMeasurementData)
     kAddType(GoMeasurementOption)
     kAddType(GoMeasurementType)
+    kAddType(GoMetricsSensor)
     kAddType(GoMode)
     kAddType(GoMultiplexBank)
     kAddType(GoOcclusionReductionAlg)
@@ -136,12 +148,15 @@ kBeginAssemblyEx(Go, GoSdk, GO_SDK_VERSION, GO_SDK_VERSION)
     kAddType(GoSelcomFormat)
     kAddType(GoSensorAccelState)
     kAddType(GoSensorAccelStatus)
+    kAddType(GoSensorResult)
     kAddType(GoSerialProtocol)
     kAddType(GoSerializerTypeInfo)
+    kAddType(GoSessionPoolEntry)
     kAddType(GoSpacingIntervalType)
     kAddType(GoSpotSelectionType)
     kAddType(GoTranslucentThreadingMode)
     kAddType(GoStamp)
+    kAddType(GoStartupTimes)
     kAddType(GoState)
     kAddType(GoStates)
     kAddType(GoSurfaceCountersunkHoleShape)
@@ -173,12 +188,17 @@ kBeginAssemblyEx(Go, GoSdk, GO_SDK_VERSION, GO_SDK_VERSION)
     kAddType(GoAcceleratorMgr)
     kAddType(GoAccelSensorPortAlloc)
     kAddType(GoControl)
+    kAddType(GoControlDispatcher)
     kAddType(GoDataSet)
     kAddType(GoDiscovery)
     kAddType(GoDiscoveryExtInfo)
+    kAddType(GoFuture)
+    kAddType(GoHealthTable)
+    kAddType(GoMetricsServer)
     kAddType(GoReceiver)
     kAddType(GoSensorInfo)
     kAddType(GoSerializer)
+    kAddType(GoSessionPool)
     kAddType(GoSystem)
 
     // Configuration classes.
@@ -527,3 +547,14 @@ kBeginAssemblyEx(Go, GoSdk, GO_SDK_VERSION, GO_SDK_VERSION)
     kAddType(GoScriptOutput)
 
 kEndAssemblyEx()
+
+GoFx(kStatus) GoSdk_StartupStats(GoSdkStartupStats* stats)
+{
+    kCheckState(!kIsNull(kAssemblyOf(GoSdk)));
+
+    stats->apiInitTime = kAssembly_InitDuration(kAssemblyOf(kApiLib));
+    stats->sdkInitTime = kAssembly_InitDuration(kAssemblyOf(GoSdk));
+    stats->serializerInitTime = GoSerializer_SharedInitDuration();
+
+    return kOK;
+}
@@ -33,6 +33,32 @@
  */
 GoFx(kStatus) GoSdk_Construct(kAssembly* assembly);
 
+/**
+ * @struct  GoSdkStartupStats
+ * @ingroup GoSdk
+ * @brief   Reports the time spent initializing the Gocator SDK library.
+ */
+typedef struct GoSdkStartupStats
+{
+    k64u apiInitTime;           ///< Time required to initialize kApi types (us).
+    k64u sdkInitTime;           ///< Time required to initialize GoSdk types (us).
+    k64u serializerInitTime;    ///< Time required to build the shared serializer type table (us); zero until the first serializer is constructed.
+} GoSdkStartupStats;
+
+/**
+ * Reports the time spent initializing the Gocator SDK library.
+ *
+ * Tool, measurement and feature name tables and the serializer type table are created
+ * on first use rather than during GoSdk_Construct; the time required to build the
+ * serializer type table is reported separately.
+ *
+ * @public
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   stats       Receives startup statistics.
+ * @return              Operation status (kERROR_STATE if the library has not been constructed).
+ */
+GoFx(kStatus) GoSdk_StartupStats(GoSdkStartupStats* stats);
+
 #include <GoSdk/GoSdkLib.x.h>
 
 #endif 
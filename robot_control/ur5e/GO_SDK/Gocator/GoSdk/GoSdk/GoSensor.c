@@ -11,8 +11,10 @@
 #include <GoSdk/GoUtils.h>
 #include <GoSdk/GoSdkDef.h>
 #include <GoSdk/Messages/GoHealth.h>
+#include <kApi/Io/kDirectory.h>
 #include <kApi/Io/kFile.h>
 #include <kApi/Io/kPath.h>
+#include <kApi/Utils/kTrace.h>
 #include <kApi/Utils/kUtils.h>
 #include <kApi/Data/kImage.h>
 
@@ -50,6 +52,7 @@ GoFx(kStatus) GoSensor_Init(GoSensor sensor, kType type, kPointer system, const
     obj->healthCheckCount = 0;
     obj->healthMsgCount = 0;
     obj->previousHealthMsgCount = 0;
+    obj->lastHealth = kNULL;
     obj->sensorInfoTime = k64U_NULL;
     kZero(obj->address);
     obj->role = GO_ROLE_INVALID;
@@ -72,8 +75,15 @@ GoFx(kStatus) GoSensor_Init(GoSensor sensor, kType type, kPointer system, const
     kZero(obj->configXmlItem);
     obj->configValid = kFALSE;
     obj->configModified = kFALSE;
+    obj->configHash = 0;
+    obj->configHashValid = kFALSE;
+    obj->configStructure = 0;
+    obj->configRetention = kFALSE;
     obj->isSyncConfig = kFALSE;
     obj->isFlushConfig = kFALSE;
+    kZero(obj->configCacheDirectory);
+    kZero(obj->configCachePath);
+    obj->configCachePathValid = kFALSE;
     kZero(obj->transformXml);
     kZero(obj->transformXmlItem);
     obj->transformValid = kFALSE;
@@ -88,6 +98,14 @@ GoFx(kStatus) GoSensor_Init(GoSensor sensor, kType type, kPointer system, const
     obj->control = kNULL;
     obj->data = kNULL;
     obj->dataPort = GO_SENSOR_DATA_PORT;
+    kZero(obj->dataLowLatency);
+    obj->dataLowLatency.cpu = -1;
+    obj->dataLowLatency.priorityClass = kTHREAD_PRIORITY_CLASS_NORMAL;
+    obj->dataBuffers.enabled = kTRUE;
+    obj->dataBuffers.socketSize = GO_SENSOR_DATA_ADAPTIVE_SOCKET_BUFFER;
+    obj->dataBuffers.minStreamSize = GO_SENSOR_DATA_MIN_STREAM_BUFFER;
+    obj->dataBuffers.maxStreamSize = GO_SENSOR_DATA_MAX_STREAM_BUFFER;
+    obj->dataBuffers.directReadThreshold = GO_SENSOR_DATA_DIRECT_READ_THRESHOLD;
     obj->onDataSet = kNULL;
     obj->onDataSetContext = kNULL;
     obj->health = kNULL;
@@ -101,6 +119,21 @@ GoFx(kStatus) GoSensor_Init(GoSensor sensor, kType type, kPointer system, const
     obj->replay = kNULL;
     kZero(obj->accelInfo);
     kZero(obj->discoveryInfo);
+    obj->isDirect = kFALSE;
+    obj->connectDuration = 0;
+    obj->configReadDuration = 0;
+    obj->snapshotLock = kNULL;
+    obj->snapshotSignal = kNULL;
+    obj->snapshotPending = kFALSE;
+    kZero(obj->snapshotStamp);
+    obj->snapshotResult = kNULL;
+    kZero(obj->lastStamp);
+    obj->lastStamp.frameIndex = k64U_NULL;
+    kAtomic32s_Init(&obj->dataStatsVersion, 0);
+    kZero(obj->dataCounters);
+    obj->dataCounters.lastArrival = k64U_NULL;
+    obj->dataCounters.lastInterval = k64U_NULL;
+    obj->dataOpened = kFALSE;
 
     obj->system = system;
     if (discoveryInfo != kNULL)
@@ -119,6 +152,8 @@ GoFx(kStatus) GoSensor_Init(GoSensor sensor, kType type, kPointer system, const
         kTest(kArrayList_Construct(&obj->partModelList, kTypeOf(GoPartModel), 0, alloc));
         kTest(kTimer_Construct(&obj->timer, alloc));
         kTest(kPeriodic_Construct(&obj->resetTimer, alloc));
+        kTest(kLock_Construct(&obj->snapshotLock, alloc));
+        kTest(kSemaphore_Construct(&obj->snapshotSignal, 0, alloc));
 
         kTest(kArrayList_Construct(&obj->remoteSensorInfo, kTypeOf(GoSensorInfo), 0, alloc));
         kTest(kArrayList_Construct(&obj->buddySensorInfo, kTypeOf(GoBuddyInfo), 0, alloc));
@@ -159,6 +194,11 @@ GoFx(kStatus) GoSensor_VRelease(GoSensor sensor)
     kCheck(kDestroyRef(&obj->configXml));
     kCheck(kDestroyRef(&obj->transformXml));
 
+    kCheck(kDisposeRef(&obj->snapshotResult));
+    kCheck(kDisposeRef(&obj->lastHealth));
+    kCheck(kDestroyRef(&obj->snapshotSignal));
+    kCheck(kDestroyRef(&obj->snapshotLock));
+
     kCheck(kObject_VRelease(sensor));
 
     return kOK;
@@ -271,6 +311,13 @@ GoFx(kStatus) GoSensor_CompleteConnection(GoSensor sensor)
         {
             kTest(GoSensor_ReadInfo(sensor));
             obj->deviceId = GoSensorInfo_Id(obj->localSensorInfo);
+
+            //sensors added by address have not been seen by discovery
+            if (obj->discoveryInfo.firmwareVersion == 0)
+            {
+                obj->discoveryInfo.firmwareVersion = GoSensorInfo_Firmware(obj->localSensorInfo);
+            }
+
             kTest(GoSensor_CacheConfig(sensor));
             kTest(GoSensor_ReadPartModels(sensor));
             kTest(GoSensor_ReadTransform(sensor));
@@ -291,6 +338,7 @@ GoFx(kStatus) GoSensor_Connect(GoSensor sensor)
 
     kStatus status = kERROR;
     GoStates states;
+    k64u startTime = kTimer_Now();
 
     kTry
     {
@@ -303,7 +351,12 @@ GoFx(kStatus) GoSensor_Connect(GoSensor sensor)
             kTest(GO_ERROR_AUTHENTICATION);
         }
 
+        obj->connectDuration = kTimer_Now() - startTime;
+        startTime = kTimer_Now();
+
         kTest(GoSensor_CompleteConnection(sensor));
+
+        obj->configReadDuration = kTimer_Now() - startTime;
     }
     kCatch(&status)
     {
@@ -318,6 +371,7 @@ GoFx(kStatus) GoSensor_ConnectAndLogin(GoSensor sensor, GoUser user, const kChar
 {
     kObj(GoSensor, sensor);
     kStatus status = kERROR;
+    k64u startTime = kTimer_Now();
 
     kTry
     {
@@ -325,8 +379,13 @@ GoFx(kStatus) GoSensor_ConnectAndLogin(GoSensor sensor, GoUser user, const kChar
 
         kTest(GoControl_Login(obj->control, user, password));
 
+        obj->connectDuration = kTimer_Now() - startTime;
+        startTime = kTimer_Now();
+
         kTest(GoSensor_CompleteConnection(sensor));
 
+        obj->configReadDuration = kTimer_Now() - startTime;
+
         kTest(GoSensor_InvalidateInfo(sensor));
     }
     kCatch(&status)
@@ -371,6 +430,35 @@ GoFx(kStatus) GoSensor_Disconnect(GoSensor sensor)
     return kOK;
 }
 
+GoFx(kStatus) GoSensor_SetDirectAddress(GoSensor sensor, kIpAddress address)
+{
+    kObj(GoSensor, sensor);
+
+    obj->address.address = address;
+    obj->isDirect = kTRUE;
+
+    kCheck(GoControl_SetRemoteAddress(obj->control, address));
+
+    return kOK;
+}
+
+GoFx(kBool) GoSensor_IsDirect(GoSensor sensor)
+{
+    kObj(GoSensor, sensor);
+
+    return obj->isDirect;
+}
+
+GoFx(kStatus) GoSensor_ConnectionTimes(GoSensor sensor, k64u* connect, k64u* configRead)
+{
+    kObj(GoSensor, sensor);
+
+    *connect = obj->connectDuration;
+    *configRead = obj->configReadDuration;
+
+    return kOK;
+}
+
 GoFx(kStatus) GoSensor_SetConnected(GoSensor sensor, kBool isConnected, kBool isCompatible)
 {
     kObj(GoSensor, sensor);
@@ -586,7 +674,7 @@ GoFx(kStatus) GoSensor_GetLivePartModel(GoSensor sensor, const kChar* name, kXml
         kStrCopy(configurationPath, 256, "_live.job/");
         kStrCat(configurationPath, 256, name);
         kStrCat(configurationPath, 256, ".mdl/config.xml");
-        kTest(GoControl_ReadFile(obj->control, configurationPath, &fileData, &fileSize, tempAlloc));
+        kTest(GoSensor_ReadLiveFile(sensor, configurationPath, &fileData, &fileSize, tempAlloc));
 
         // Uncomment to save config to file (useful for debugging config problems)
         //kTest(kFile_Save("GoSensor_GetLivePartModel-Debug.cfg", fileData, fileSize));
@@ -622,6 +710,7 @@ GoFx(kStatus) GoSensor_SetLivePartModel(GoSensor sensor, const kChar* name, kXml
         kStrCopy(configurationPath, 256, "_live.job/");
         kStrCat(configurationPath, 256, name);
         kStrCat(configurationPath, 256, ".mdl/config.xml");
+        kTest(GoSensor_InvalidateConfigCache(sensor));
         kTest(GoControl_WriteFile(obj->control, configurationPath, fileData, fileSize));
     }
     kFinally
@@ -698,6 +787,7 @@ GoFx(kStatus) GoSensor_WritePartModel(GoSensor sensor, GoPartModel model)
                 kTest(kStrCat(modelConfigString, 256, "_live.job/"));
                 kTest(kStrCat(modelConfigString, 256, GoPartModel_Name(model)));
                 kTest(kStrCat(modelConfigString, 256, ".mdl/config.xml"));
+                kTest(GoSensor_InvalidateConfigCache(sensor));
                 kTest(GoControl_WriteFile(obj->control, modelConfigString, fileData, fileSize));
 
                 modelObj->isModified = kFALSE;
@@ -778,6 +868,7 @@ GoFx(GoPartModel) GoSensor_PartMatchModel(GoSensor sensor, const kChar* name)
 GoFx(kStatus) GoSensor_FlushConfig(GoSensor sensor)
 {
     kObj(GoSensor, sensor);
+    k64u structure = 0;
 
     if (obj->configModified && !obj->isFlushConfig)
     {
@@ -785,14 +876,71 @@ GoFx(kStatus) GoSensor_FlushConfig(GoSensor sensor)
         {
             obj->isFlushConfig = kTRUE;
             kTest(GoSensor_WriteConfig(sensor));
+            kTest(GoSensor_ConfigStructure(sensor, &structure));
         }
         kFinally
         {
             obj->isFlushConfig = kFALSE;
             kEndFinally();
         }
+
         obj->configModified = kFALSE;
-        obj->configValid = kFALSE;
+
+        // The config is read back on next access, so that values that the sensor assigns, clamps
+        // or derives are visible. If retention is enabled, the local model is kept instead, unless
+        // tools or measurements were added or removed (the sensor fills in their defaults, e.g. ids).
+        // The upload hash remains valid either way, as the sensor still holds what was uploaded.
+        if (!obj->configRetention || (structure != obj->configStructure))
+        {
+            obj->configValid = kFALSE;
+        }
+    }
+
+    return kOK;
+}
+
+// Computes a signature of the tools, measurements and feature outputs in the local config model.
+GoFx(kStatus) GoSensor_ConfigStructure(GoSensor sensor, k64u* signature)
+{
+    kObj(GoSensor, sensor);
+    kArrayList items = kNULL;
+    kSize i, j;
+
+    if (kIsNull(obj->tools))
+    {
+        *signature = 0;
+        return kOK;
+    }
+
+    kTry
+    {
+        kTest(kArrayList_Construct(&items, kTypeOf(k32s), 0, kObject_Alloc(sensor)));
+
+        for (i = 0; i < GoTools_ToolCount(obj->tools); ++i)
+        {
+            GoTool tool = GoTools_ToolAt(obj->tools, i);
+            k32s type = (k32s)GoTool_Type(tool);
+            k32s measurementCount = (k32s)GoTool_MeasurementCount(tool);
+            k32s featureCount = (k32s)GoTool_FeatureOutputCount(tool);
+
+            kTest(kArrayList_AddT(items, &type));
+            kTest(kArrayList_AddT(items, &measurementCount));
+            kTest(kArrayList_AddT(items, &featureCount));
+
+            for (j = 0; j < GoTool_MeasurementCount(tool); ++j)
+            {
+                k32s measurementType = (k32s)GoMeasurement_Type(GoTool_MeasurementAt(tool, j));
+
+                kTest(kArrayList_AddT(items, &measurementType));
+            }
+        }
+
+        *signature = GoUtils_Hash64(kArrayList_Data(items), kArrayList_DataSize(items));
+    }
+    kFinally
+    {
+        kDestroyRef(&items);
+        kEndFinally();
     }
 
     return kOK;
@@ -817,6 +965,9 @@ GoFx(kStatus) GoSensor_InvalidateConfig(GoSensor sensor)
     kObj(GoSensor, sensor);
 
     obj->configValid = kFALSE;
+    obj->configHashValid = kFALSE;
+
+    kCheck(GoSensor_InvalidateConfigCache(sensor));
 
     return kOK;
 }
@@ -887,49 +1038,71 @@ GoFx(kStatus) GoSensor_ReadConfig(GoSensor sensor)
         kCheck(GoReplay_Read(obj->replay, xml, kXml_Child(xml, root, "Replay")));
     }
 
+    kCheck(GoSensor_ConfigStructure(sensor, &obj->configStructure));
+
     return kOK;
 }
 
 GoFx(kStatus) GoSensor_WriteConfig(GoSensor sensor)
 {
-    kObj(GoSensor, sensor);
     kXml xml = kNULL;
-    kXml root = kNULL;
-    kXml item = kNULL;
 
     kCheckState(GoSensor_IsConfigurable(sensor));
 
     kTry
     {
-        kTest(kXml_Construct(&xml, kObject_Alloc(sensor)));
+        kTest(GoSensor_FormatConfig(sensor, &xml));
+        kTest(GoSensor_SetLiveConfig(sensor, xml));
+    }
+    kFinally
+    {
+        kCheck(kDestroyRef(&xml));
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+// Serializes the local configuration model, merged with unrecognized content from the last config read.
+GoFx(kStatus) GoSensor_FormatConfig(GoSensor sensor, kXml* xml)
+{
+    kObj(GoSensor, sensor);
+    kXml output = kNULL;
+    kXml root = kNULL;
+    kXml item = kNULL;
+    kStatus status;
+
+    kTry
+    {
+        kTest(kXml_Construct(&output, kObject_Alloc(sensor)));
 
-        kTest(kXml_AddItem(xml, kNULL, "Configuration", &root));
-        kTest(kXml_SetAttr32u(xml, root, "version", GO_SENSOR_CONFIG_SCHEMA_VERSION));
+        kTest(kXml_AddItem(output, kNULL, "Configuration", &root));
+        kTest(kXml_SetAttr32u(output, root, "version", GO_SENSOR_CONFIG_SCHEMA_VERSION));
 
-        kTest(kXml_AddItem(xml, root, "Setup", &item));
-        kTest(GoSetup_WriteConfig(obj->setup, xml, item));
+        kTest(kXml_AddItem(output, root, "Setup", &item));
+        kTest(GoSetup_WriteConfig(obj->setup, output, item));
 
         // The "Configuration/Streams" section is sent only from sensor
         // to client, never from client to sensor. So don't write that
         // section.
 
-        kTest(kXml_AddItem(xml, root, "Tools", &item));
-        kTest(GoTools_Write(obj->tools, xml, item));
+        kTest(kXml_AddItem(output, root, "Tools", &item));
+        kTest(GoTools_Write(obj->tools, output, item));
 
-        kTest(kXml_AddItem(xml, root, "Output", &item));
-        kTest(GoOutput_Write(obj->output, xml, item));
+        kTest(kXml_AddItem(output, root, "Output", &item));
+        kTest(GoOutput_Write(obj->output, output, item));
 
-        kTest(kXml_AddItem(xml, root, "Replay", &item));
-        kTest(GoReplay_Write(obj->replay, xml, item));
+        kTest(kXml_AddItem(output, root, "Replay", &item));
+        kTest(GoReplay_Write(obj->replay, output, item));
 
-        kTest(GoUtils_XmlMerge(obj->configXml, obj->configXmlItem, xml, root));
+        kTest(GoUtils_XmlMerge(obj->configXml, obj->configXmlItem, output, root));
 
-        kTest(GoSensor_SetLiveConfig(sensor, xml));
+        *xml = output;
     }
-    kFinally
+    kCatch(&status)
     {
-        kCheck(kDestroyRef(&xml));
-        kEndFinally();
+        kDestroyRef(&output);
+        kEndCatch(status);
     }
 
     return kOK;
@@ -946,7 +1119,7 @@ GoFx(kStatus) GoSensor_GetLiveConfig(GoSensor sensor, kXml* xml, kAlloc allocato
 
     kTry
     {
-        kTest(GoControl_ReadFile(obj->control, GO_SENSOR_LIVE_CONFIG_NAME, &fileData, &fileSize, tempAlloc));
+        kTest(GoSensor_ReadLiveFile(sensor, GO_SENSOR_LIVE_CONFIG_NAME, &fileData, &fileSize, tempAlloc));
 
         // Uncomment to save config to file (useful for debugging config problems)
         //kTest(kFile_Save("GoSensor_GetLiveConfig-Debug.cfg", fileData, fileSize));
@@ -968,6 +1141,7 @@ GoFx(kStatus) GoSensor_SetLiveConfig(GoSensor sensor, kXml xml)
     kAlloc alloc = kObject_Alloc(sensor);
     kByte* fileData = kNULL;
     kSize fileSize = 0;
+    k64u hash;
 
     kCheckState(GoSensor_IsConfigurable(sensor));
 
@@ -978,7 +1152,19 @@ GoFx(kStatus) GoSensor_SetLiveConfig(GoSensor sensor, kXml xml)
         // Uncomment to save config to file (useful for debugging config problems)
         //kTest(kFile_Save("GoSensor_SetLiveConfig-Debug.cfg", fileData, fileSize));
 
-        kTest(GoControl_WriteFile(obj->control, GO_SENSOR_LIVE_CONFIG_NAME, fileData, fileSize));
+        hash = GoUtils_Hash64(fileData, fileSize);
+
+        // Skip the upload if it is byte-identical to the last upload.
+        if (!obj->configHashValid || (hash != obj->configHash))
+        {
+            obj->configHashValid = kFALSE;
+
+            kTest(GoSensor_InvalidateConfigCache(sensor));
+            kTest(GoControl_WriteFile(obj->control, GO_SENSOR_LIVE_CONFIG_NAME, fileData, fileSize));
+
+            obj->configHash = hash;
+            obj->configHashValid = kTRUE;
+        }
     }
     kFinally
     {
@@ -989,6 +1175,199 @@ GoFx(kStatus) GoSensor_SetLiveConfig(GoSensor sensor, kXml xml)
     return kOK;
 }
 
+GoFx(kStatus) GoSensor_EnableConfigCache(GoSensor sensor, const kChar* directory)
+{
+    kObj(GoSensor, sensor);
+
+    if (kIsNull(directory) || (directory[0] == 0))
+    {
+        obj->configCacheDirectory[0] = 0;
+    }
+    else
+    {
+        if (!kDirectory_Exists(directory))
+        {
+            kCheck(kDirectory_Create(directory));
+        }
+
+        kCheck(kStrCopy(obj->configCacheDirectory, kCountOf(obj->configCacheDirectory), directory));
+    }
+
+    kCheck(GoSensor_InvalidateConfigCache(sensor));
+
+    return kOK;
+}
+
+GoFx(kBool) GoSensor_ConfigCacheEnabled(GoSensor sensor)
+{
+    kObj(GoSensor, sensor);
+
+    return obj->configCacheDirectory[0] != 0;
+}
+
+GoFx(kStatus) GoSensor_EnableConfigRetention(GoSensor sensor, kBool enable)
+{
+    kObj(GoSensor, sensor);
+
+    obj->configRetention = enable;
+
+    return kOK;
+}
+
+GoFx(kBool) GoSensor_ConfigRetentionEnabled(GoSensor sensor)
+{
+    kObj(GoSensor, sensor);
+
+    return obj->configRetention;
+}
+
+GoFx(kStatus) GoSensor_InvalidateConfigCache(GoSensor sensor)
+{
+    kObj(GoSensor, sensor);
+
+    obj->configCachePath[0] = 0;
+    obj->configCachePathValid = kFALSE;
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSensor_CacheConfigPath(GoSensor sensor)
+{
+    kObj(GoSensor, sensor);
+    kText64 jobName = "";
+    kText64 entryName = "";
+    kText256 sensorPath = "";
+    kBool changed = kTRUE;
+
+    if (!obj->configCachePathValid)
+    {
+        obj->configCachePath[0] = 0;
+
+        // Entries are keyed by the loaded job. A live job that was modified after loading
+        // has no saved counterpart, so it is always read from the sensor.
+        if (GoSensor_ConfigCacheEnabled(sensor)
+            && kSuccess(GoControl_GetLoadedJob(obj->control, jobName, kCountOf(jobName), &changed))
+            && !changed && (jobName[0] != 0))
+        {
+            kCheck(kStrPrintf(entryName, kCountOf(entryName), "%u", obj->deviceId));
+            kCheck(kPath_Combine(obj->configCacheDirectory, entryName, sensorPath, kCountOf(sensorPath)));
+            kCheck(GoSensor_ConfigCacheEntryName(jobName, entryName, kCountOf(entryName)));
+            kCheck(kPath_Combine(sensorPath, entryName, obj->configCachePath, kCountOf(obj->configCachePath)));
+        }
+
+        obj->configCachePathValid = kTRUE;
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSensor_ConfigCacheEntryName(const kChar* name, kChar* entry, kSize capacity)
+{
+    kSize i;
+
+    kCheckArgs(capacity > 0);
+
+    for (i = 0; (name[i] != 0) && (i + 1 < capacity); ++i)
+    {
+        kChar ch = name[i];
+
+        entry[i] = (kChar_IsLetter(ch) || kChar_IsDigit(ch) || (ch == '.') || (ch == '-')) ? ch : '_';
+    }
+
+    entry[i] = 0;
+
+    return (name[i] == 0) ? kOK : kERROR_INCOMPLETE;
+}
+
+GoFx(kStatus) GoSensor_ReadLiveFile(GoSensor sensor, const kChar* fileName, kByte** data, kSize* size, kAlloc allocator)
+{
+    kObj(GoSensor, sensor);
+    kText32 version = "";
+    kText128 entryName = "";
+    kText256 path = "";
+    kText256 tempPath = "";
+    kSize length;
+
+    kCheck(GoSensor_CacheConfigPath(sensor));
+
+    if (obj->configCachePath[0] != 0)
+    {
+        // Entry names are prefixed by the firmware version, because the content of the
+        // live files depends on the firmware that produced them.
+        kCheck(kVersion_Format(GoSensor_FirmwareVersion(sensor), version, kCountOf(version)));
+        kCheck(kStrPrintf(entryName, kCountOf(entryName), "%s_", version));
+
+        length = kStrLength(entryName);
+        kCheck(GoSensor_ConfigCacheEntryName(fileName, &entryName[length], kCountOf(entryName) - length));
+        kCheck(kPath_Combine(obj->configCachePath, entryName, path, kCountOf(path)));
+
+        if (kSuccess(kFile_Load(path, data, size, allocator)))
+        {
+            return kOK;
+        }
+    }
+
+    kCheck(GoControl_ReadFile(obj->control, fileName, data, size, allocator));
+
+    // Caching is best-effort; entries are written under a temporary name and then moved
+    // into place, so that an interrupted write can't leave a truncated entry behind.
+    if ((path[0] != 0) && kSuccess(kStrPrintf(tempPath, kCountOf(tempPath), "%s.tmp", path)))
+    {
+        if (kDirectory_Exists(obj->configCachePath) || kSuccess(kDirectory_Create(obj->configCachePath)))
+        {
+            if (kSuccess(kFile_Save(tempPath, *data, *size)))
+            {
+                if (kFile_Exists(path))
+                {
+                    kFile_Delete(path);
+                }
+
+                if (!kSuccess(kFile_Move(tempPath, path)))
+                {
+                    kFile_Delete(tempPath);
+                }
+            }
+        }
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSensor_PurgeConfigCache(GoSensor sensor, const kChar* jobName)
+{
+    kObj(GoSensor, sensor);
+    kText64 entryName = "";
+    kText256 sensorPath = "";
+    kText256 jobPath = "";
+
+    kCheck(GoSensor_InvalidateConfigCache(sensor));
+
+    if (GoSensor_ConfigCacheEnabled(sensor))
+    {
+        kCheck(kStrPrintf(entryName, kCountOf(entryName), "%u", obj->deviceId));
+        kCheck(kPath_Combine(obj->configCacheDirectory, entryName, sensorPath, kCountOf(sensorPath)));
+
+        if (kIsNull(jobName))
+        {
+            if (kDirectory_Exists(sensorPath))
+            {
+                kCheck(kDirectory_Delete(sensorPath));
+            }
+        }
+        else if (kSuccess(GoSensor_ConfigCacheEntryName(jobName, entryName, kCountOf(entryName))))
+        {
+            kCheck(kPath_Combine(sensorPath, entryName, jobPath, kCountOf(jobPath)));
+
+            if (kDirectory_Exists(jobPath))
+            {
+                kCheck(kDirectory_Delete(jobPath));
+            }
+        }
+    }
+
+    return kOK;
+}
+
 GoFx(kStatus) GoSensor_SyncTransform(GoSensor sensor)
 {
     kObj(GoSensor, sensor);
@@ -1431,7 +1810,7 @@ GoFx(GoState) GoSensor_KnownState(GoSensor sensor)
         {
             state = GoSensor_IsDiscoveryOnline(sensor) ? GO_STATE_ONLINE : GO_STATE_OFFLINE;
         }
-        else if (!GoSensor_IsDiscoveryOnline(sensor) && !GoSensor_IsHealthOnline(sensor))
+        else if ((obj->isDirect || !GoSensor_IsDiscoveryOnline(sensor)) && !GoSensor_IsHealthOnline(sensor))
         {
             state = GO_STATE_UNRESPONSIVE;
         }
@@ -2123,6 +2502,55 @@ GoFx(kStatus) GoSensor_Snapshot(GoSensor sensor)
     return kOK;
 }
 
+GoFx(kStatus) GoSensor_SnapshotAndReceive(GoSensor sensor, GoDataSet* result, k64u timeout)
+{
+    kObj(GoSensor, sensor);
+    GoDataSet dataSet = kNULL;
+    kStatus status;
+
+    kCheckArgs(!kIsNull(result));
+    kCheckState(GoSensor_DataEnabled(sensor));
+
+    kLock_Enter(obj->snapshotLock);
+    {
+        obj->snapshotPending = kTRUE;
+        obj->snapshotStamp = obj->lastStamp;
+    }
+    kLock_Exit(obj->snapshotLock);
+
+    status = GoSensor_Snapshot(sensor);
+
+    if (kSuccess(status))
+    {
+        status = kSemaphore_Wait(obj->snapshotSignal, timeout);
+    }
+
+    kLock_Enter(obj->snapshotLock);
+    {
+        obj->snapshotPending = kFALSE;
+        dataSet = obj->snapshotResult;
+        obj->snapshotResult = kNULL;
+    }
+    kLock_Exit(obj->snapshotLock);
+
+    // The signal is only posted together with a dataset, so a successful wait always yields one.
+    if (kIsNull(dataSet))
+    {
+        return kSuccess(status) ? kERROR_STATE : status;
+    }
+
+    // The dataset arrived between the wait timing out and the request being withdrawn;
+    // consume the signal that accompanied it (posted under the lock, so it is already there).
+    if (!kSuccess(status))
+    {
+        kSemaphore_Wait(obj->snapshotSignal, 0);
+    }
+
+    *result = dataSet;
+
+    return kOK;
+}
+
 GoFx(GoState) GoSensor_State(GoSensor sensor)
 {
     //return value intentionally not checked; success not required
@@ -2371,53 +2799,128 @@ GoFx(kStatus) GoSensor_Trigger(GoSensor sensor)
     return kOK;
 }
 
-GoFx(kSize) GoSensor_FileCount(GoSensor sensor)
+// Attaches the control object to the system's shared I/O thread, on first use.
+GoFx(kStatus) GoSensor_PrepareAsync(GoSensor sensor)
 {
     kObj(GoSensor, sensor);
+    GoControlDispatcher dispatcher = kNULL;
 
-    if (!kSuccess(GoSensor_CacheFileList(sensor)))
+    if (kIsNull(GoControl_Dispatcher(obj->control)))
     {
-        return 0;
+        kCheck(GoSystem_Dispatcher(obj->system, &dispatcher));
+        kCheck(GoControl_SetDispatcher(obj->control, dispatcher));
     }
 
-    return kArrayList_Count(obj->fileList);
+    return kOK;
 }
 
-GoFx(kStatus) GoSensor_FileNameAt(GoSensor sensor, kSize index, kChar* name, kSize capacity)
+GoFx(kStatus) GoSensor_StatesAsync(GoSensor sensor, GoStates* states, GoFuture future)
 {
     kObj(GoSensor, sensor);
 
-    kCheck(GoSensor_CacheFileList(sensor));
-
-    kCheckArgs(index < kArrayList_Count(obj->fileList));
+    kCheckState(GoSensor_IsReadable(sensor));
 
-    kCheck(kStrCopy(name, capacity, kArrayList_AtT(obj->fileList, index, kChar)));
+    kCheck(GoSensor_PrepareAsync(sensor));
 
-    return kOK;
+    return GoControl_GetStatesAsync(obj->control, states, future);
 }
 
-GoFx(kStatus) GoSensor_UploadFile(GoSensor sensor, const kChar* sourcePath, const kChar* destName)
+GoFx(kStatus) GoSensor_TimestampAsync(GoSensor sensor, k64u* time, GoFuture future)
 {
     kObj(GoSensor, sensor);
-    kAlloc alloc = kObject_Alloc(sensor);
-    kByte* data = kNULL;
-    kSize size = 0;
 
     kCheckState(GoSensor_IsNormal(sensor));
 
-    kCheck(GoSensor_Flush(sensor));
+    kCheck(GoSensor_PrepareAsync(sensor));
 
-    kTry
-    {
-        kTest(kFile_Load(sourcePath, &data, &size, alloc));
+    return GoControl_GetTimestampAsync(obj->control, time, future);
+}
 
-        kTest(GoControl_WriteFile(obj->control, destName, data, size));
+GoFx(kStatus) GoSensor_EncoderAsync(GoSensor sensor, k64s* encoder, GoFuture future)
+{
+    kObj(GoSensor, sensor);
+
+    kCheckState(GoSensor_IsNormal(sensor));
+
+    kCheck(GoSensor_PrepareAsync(sensor));
+
+    return GoControl_GetEncoderAsync(obj->control, encoder, future);
+}
+
+GoFx(kStatus) GoSensor_TriggerAsync(GoSensor sensor, GoFuture future)
+{
+    kObj(GoSensor, sensor);
+
+    kCheckState(GoSensor_IsRunning(sensor));
+
+    kCheck(GoSensor_PrepareAsync(sensor));
+
+    return GoControl_TriggerAsync(obj->control, future);
+}
+
+GoFx(kStatus) GoSensor_ReadFileListAsync(GoSensor sensor, kArrayList files, const kChar* extension, GoFuture future)
+{
+    kObj(GoSensor, sensor);
+
+    kCheckState(GoSensor_IsNormal(sensor));
+
+    kCheck(GoSensor_PrepareAsync(sensor));
+
+    return GoControl_ReadFileListAsync(obj->control, files, extension, future);
+}
+
+GoFx(kSize) GoSensor_FileCount(GoSensor sensor)
+{
+    kObj(GoSensor, sensor);
+
+    if (!kSuccess(GoSensor_CacheFileList(sensor)))
+    {
+        return 0;
+    }
+
+    return kArrayList_Count(obj->fileList);
+}
+
+GoFx(kStatus) GoSensor_FileNameAt(GoSensor sensor, kSize index, kChar* name, kSize capacity)
+{
+    kObj(GoSensor, sensor);
+
+    kCheck(GoSensor_CacheFileList(sensor));
+
+    kCheckArgs(index < kArrayList_Count(obj->fileList));
+
+    kCheck(kStrCopy(name, capacity, kArrayList_AtT(obj->fileList, index, kChar)));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSensor_UploadFile(GoSensor sensor, const kChar* sourcePath, const kChar* destName)
+{
+    return GoSensor_UploadFileEx(sensor, sourcePath, destName, kNULL, kNULL);
+}
+
+GoFx(kStatus) GoSensor_UploadFileEx(GoSensor sensor, const kChar* sourcePath, const kChar* destName, GoTransferFx progress, kPointer receiver)
+{
+    kObj(GoSensor, sensor);
+    GoSensorTransferContext context = { sensor, progress, receiver };
+    kFile file = kNULL;
+
+    kCheckState(GoSensor_IsNormal(sensor));
+
+    kCheck(GoSensor_Flush(sensor));
+
+    kTry
+    {
+        kTest(kFile_Construct(&file, sourcePath, kFILE_MODE_READ, kObject_Alloc(sensor)));
+
+        kTest(GoSensor_PurgeConfigCache(sensor, destName));
+        kTest(GoControl_WriteFileFromStream(obj->control, destName, file, kFile_Length(file), GoSensor_OnTransfer, &context));
 
         kTest(GoSensor_Invalidate(sensor));
     }
     kFinally
     {
-        kAlloc_Free(alloc, data);
+        kDestroyRef(&file);
         kEndFinally();
     }
 
@@ -2425,11 +2928,99 @@ GoFx(kStatus) GoSensor_UploadFile(GoSensor sensor, const kChar* sourcePath, cons
 }
 
 GoFx(kStatus) GoSensor_DownloadFile(GoSensor sensor, const kChar* sourceName, const kChar* destPath)
+{
+    kText256 tempPath = "";
+    kFile file = kNULL;
+    kStatus status;
+
+    kCheckState(GoSensor_IsNormal(sensor));
+
+    kCheck(kStrPrintf(tempPath, kCountOf(tempPath), "%s.tmp", destPath));
+
+    // The file is received under a temporary name and moved into place when complete, so that
+    // a failed transfer can't leave a truncated file at the destination.
+    kTry
+    {
+        kTest(kFile_Construct(&file, tempPath, kFILE_MODE_WRITE, kObject_Alloc(sensor)));
+        kTest(GoSensor_DownloadFileToStream(sensor, sourceName, file, kNULL, kNULL));
+        kTest(kFile_Close(file));
+        kTest(kDestroyRef(&file));
+
+        kTest(GoSensor_ReplaceFile(tempPath, destPath));
+    }
+    kCatch(&status)
+    {
+        kDestroyRef(&file);
+        kFile_Delete(tempPath);
+        kEndCatch(status);
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSensor_ReplaceFile(const kChar* sourcePath, const kChar* destPath)
+{
+    kText256 backupPath = "";
+    kBool hasBackup = kFALSE;
+    kStatus status;
+
+    // kFile_Move isn't guaranteed to be atomic (it may copy, then delete), so the existing file is
+    // set aside rather than deleted, and put back if its replacement can't be moved into place.
+    if (kFile_Exists(destPath))
+    {
+        kCheck(kStrPrintf(backupPath, kCountOf(backupPath), "%s.bak", destPath));
+
+        if (kFile_Exists(backupPath))
+        {
+            kCheck(kFile_Delete(backupPath));
+        }
+
+        kCheck(kFile_Move(destPath, backupPath));
+        hasBackup = kTRUE;
+    }
+
+    if (!kSuccess(status = kFile_Move(sourcePath, destPath)))
+    {
+        if (hasBackup)
+        {
+            if (kFile_Exists(destPath))
+            {
+                kFile_Delete(destPath);
+            }
+
+            kFile_Move(backupPath, destPath);
+        }
+
+        return status;
+    }
+
+    if (hasBackup)
+    {
+        kFile_Delete(backupPath);
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSensor_DownloadFileToStream(GoSensor sensor, const kChar* sourceName, kStream stream, GoTransferFx progress, kPointer receiver)
 {
     kObj(GoSensor, sensor);
+    GoSensorTransferContext context = { sensor, progress, receiver };
 
     kCheckState(GoSensor_IsNormal(sensor));
-    kCheck(GoControl_ReadFileStreamed(obj->control, sourceName, destPath, kFALSE));
+    kCheck(GoControl_ReadFileStreamedToStream(obj->control, sourceName, stream, GoSensor_OnTransfer, &context));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSensor_OnTransfer(kPointer context, kObject sender, GoTransferFxArgs* args)
+{
+    GoSensorTransferContext* transfer = context;
+
+    if (!kIsNull(transfer->function))
+    {
+        return transfer->function(transfer->receiver, transfer->sensor, args);
+    }
 
     return kOK;
 }
@@ -2455,6 +3046,7 @@ GoFx(kStatus) GoSensor_CopyFile(GoSensor sensor, const kChar* sourceName, const
         }
     }
 
+    kCheck(GoSensor_PurgeConfigCache(sensor, destName));
     kCheck(GoControl_CopyFile(obj->control, sourceName, destName));
     kCheck(GoSensor_Invalidate(sensor));
     kCheck(GoSensor_SyncConfig(sensor));
@@ -2469,6 +3061,7 @@ GoFx(kStatus) GoSensor_DeleteFile(GoSensor sensor, const kChar* name)
     kCheckState(GoSensor_IsNormal(sensor));
 
     kCheck(GoSensor_Flush(sensor));
+    kCheck(GoSensor_PurgeConfigCache(sensor, name));
     kCheck(GoControl_DeleteFile(obj->control, name));
     kCheck(GoSensor_Invalidate(sensor));
 
@@ -2580,9 +3173,7 @@ GoFx(kStatus) GoSensor_ChangePassword(GoSensor sensor, GoUser user, const kChar*
 GoFx(kStatus) GoSensor_BeginUpgrade(GoSensor sensor, const kChar* sourcePath)
 {
     kObj(GoSensor, sensor);
-    kAlloc alloc = kObject_Alloc(sensor);
-    kByte* data = kNULL;
-    kSize size = 0;
+    kFile file = kNULL;
     kStatus status;
 
     kCheck(GoSensor_LockState(sensor));
@@ -2593,9 +3184,9 @@ GoFx(kStatus) GoSensor_BeginUpgrade(GoSensor sensor, const kChar* sourcePath)
 
     kTry
     {
-        kTest(kFile_Load(sourcePath, &data, &size, alloc));
+        kTest(kFile_Construct(&file, sourcePath, kFILE_MODE_READ, kObject_Alloc(sensor)));
 
-        kTest(GoControl_BeginUpgrade(obj->control, data, size));
+        kTest(GoControl_BeginUpgradeFromStream(obj->control, file, kFile_Length(file), kNULL, kNULL));
     }
     kCatchEx(&status)
     {
@@ -2604,7 +3195,7 @@ GoFx(kStatus) GoSensor_BeginUpgrade(GoSensor sensor, const kChar* sourcePath)
     }
     kFinallyEx
     {
-        kAlloc_Free(alloc, data);
+        kDestroyRef(&file);
         kEndFinallyEx();
     }
 
@@ -2704,27 +3295,44 @@ GoFx(kStatus) GoSensor_Upgrade(GoSensor sensor, const kChar* sourcePath, GoUpgra
 
 GoFx(kStatus) GoSensor_Backup(GoSensor sensor, const kChar* destPath)
 {
-    kObj(GoSensor, sensor);
-    kAlloc alloc = kObject_Alloc(sensor);
-    kByte* data = kNULL;
-    kSize size = 0;
+    kText256 tempPath = "";
+    kFile file = kNULL;
+    kStatus status;
 
     kCheckState(GoSensor_IsReady(sensor));
 
+    kCheck(kStrPrintf(tempPath, kCountOf(tempPath), "%s.tmp", destPath));
+
     kTry
     {
-        kTest(GoControl_Backup(obj->control, &data, &size, alloc));
-        kTest(kFile_Save(destPath, data, size));
+        kTest(kFile_Construct(&file, tempPath, kFILE_MODE_WRITE, kObject_Alloc(sensor)));
+        kTest(GoSensor_BackupToStream(sensor, file, kNULL, kNULL));
+        kTest(kFile_Close(file));
+        kTest(kDestroyRef(&file));
+
+        kTest(GoSensor_ReplaceFile(tempPath, destPath));
     }
-    kFinally
+    kCatch(&status)
     {
-        kAlloc_Free(alloc, data);
-        kEndFinally();
+        kDestroyRef(&file);
+        kFile_Delete(tempPath);
+        kEndCatch(status);
     }
 
     return kOK;
 }
 
+GoFx(kStatus) GoSensor_BackupToStream(GoSensor sensor, kStream stream, GoTransferFx progress, kPointer receiver)
+{
+    kObj(GoSensor, sensor);
+    GoSensorTransferContext context = { sensor, progress, receiver };
+
+    kCheckState(GoSensor_IsReady(sensor));
+    kCheck(GoControl_BackupToStream(obj->control, stream, GoSensor_OnTransfer, &context));
+
+    return kOK;
+}
+
 GoFx(kStatus) GoSensor_Restore(GoSensor sensor, const kChar* sourcePath)
 {
     kObj(GoSensor, sensor);
@@ -2739,6 +3347,7 @@ GoFx(kStatus) GoSensor_Restore(GoSensor sensor, const kChar* sourcePath)
     kTry
     {
         kTest(kFile_Load(sourcePath, &data, &size, alloc));
+        kTest(GoSensor_PurgeConfigCache(sensor, kNULL));
         kTest(GoControl_Restore(obj->control, data, size));
     }
     kFinally
@@ -2758,6 +3367,7 @@ GoFx(kStatus) GoSensor_RestoreDefaults(GoSensor sensor, kBool restoreAddress)
 
     kCheck(GoSensor_Invalidate(sensor));
 
+    kCheck(GoSensor_PurgeConfigCache(sensor, kNULL));
     kCheck(GoControl_RestoreFactory(obj->control, restoreAddress));
 
     kCheck(GoSensor_CacheInfo(sensor));
@@ -2775,14 +3385,40 @@ GoFx(kStatus) GoSensor_EnableData(GoSensor sensor, kBool enable)
 
     kCheck(kDestroyRef(&obj->data));
 
+    // Stamps are only comparable within one data session (sensor time restarts on reboot).
+    kLock_Enter(obj->snapshotLock);
+    {
+        obj->lastStamp.frameIndex = k64U_NULL;
+    }
+    kLock_Exit(obj->snapshotLock);
+
     if (enable)
     {
         kCheck(GoReceiver_Construct(&obj->data, kObject_Alloc(sensor)));
         kCheck(GoReceiver_SetBuffers(obj->data, GO_SENSOR_DATA_SOCKET_BUFFER, GO_SENSOR_DATA_STREAM_BUFFER));
+        kCheck(GoReceiver_SetLowLatency(obj->data, &obj->dataLowLatency));
+        kCheck(GoReceiver_SetAdaptiveBuffers(obj->data, &obj->dataBuffers));
         kCheck(GoReceiver_SetCancelHandler(obj->data, GoSensor_OnCancelQuery, sensor));
         kCheck(GoReceiver_SetMessageHandler(obj->data, GoSensor_OnData, sensor));
 
+        // Byte counts and arrival times are tracked per connection.
+        GoSensor_LockDataCounters(sensor);
+        {
+            obj->dataCounters.streamBytes = 0;
+            obj->dataCounters.lastArrival = k64U_NULL;
+            obj->dataCounters.lastInterval = k64U_NULL;
+        }
+        GoSensor_UnlockDataCounters(sensor);
+
         kCheck(GoReceiver_Open(obj->data, obj->address.address, obj->dataPort));
+
+        GoSensor_LockDataCounters(sensor);
+        {
+            obj->dataCounters.reconnectCount += obj->dataOpened ? 1 : 0;
+        }
+        GoSensor_UnlockDataCounters(sensor);
+
+        obj->dataOpened = kTRUE;
     }
 
     return kOK;
@@ -2794,17 +3430,218 @@ GoFx(kBool) GoSensor_DataEnabled(GoSensor sensor)
     return !kIsNull(obj->data);
 }
 
+GoFx(kStatus) GoSensor_SetDataLowLatency(GoSensor sensor, const GoLowLatencyOptions* options)
+{
+    kObj(GoSensor, sensor);
+
+    kCheckArgs(options->cpu < 0 || (kSize)options->cpu < kThread_ProcessorCount());
+
+    obj->dataLowLatency = *options;
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSensor_DataLowLatency(GoSensor sensor, GoLowLatencyOptions* options)
+{
+    kObj(GoSensor, sensor);
+
+    *options = obj->dataLowLatency;
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSensor_SetDataBuffers(GoSensor sensor, const GoAdaptiveBufferOptions* options)
+{
+    kObj(GoSensor, sensor);
+
+    kCheckArgs(!options->enabled || ((options->minStreamSize > 0) && (options->minStreamSize <= options->maxStreamSize)));
+
+    obj->dataBuffers = *options;
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSensor_DataBuffers(GoSensor sensor, GoAdaptiveBufferOptions* options)
+{
+    kObj(GoSensor, sensor);
+
+    *options = obj->dataBuffers;
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSensor_DataBufferSizes(GoSensor sensor, kSSize* socketSize, kSSize* streamSize)
+{
+    kObj(GoSensor, sensor);
+
+    kCheckState(!kIsNull(obj->data));
+
+    return GoReceiver_BufferSizes(obj->data, socketSize, streamSize);
+}
+
+GoFx(kStatus) GoSensor_DataLatencyStats(GoSensor sensor, GoLatencyStats* stats)
+{
+    kObj(GoSensor, sensor);
+
+    kCheckState(!kIsNull(obj->data));
+
+    return GoReceiver_LatencyStats(obj->data, stats);
+}
+
+GoFx(kStatus) GoSensor_DataStats(GoSensor sensor, GoDataStats* stats)
+{
+    kObj(GoSensor, sensor);
+    GoSensorDataCounters counters;
+
+    kZero(counters);
+
+    kCheck(GoSensor_AddDataCounters(sensor, &counters));
+    kCheck(GoSensor_FormatDataStats(&counters, stats));
+    kCheck(GoSystem_DataQueueStats(obj->system, stats));
+
+    return kOK;
+}
+
+// Begins an update of the data counters. Updates are short, so competing writers and 
+// readers spin rather than block.
+GoFx(void) GoSensor_LockDataCounters(GoSensor sensor)
+{
+    kObj(GoSensor, sensor);
+    k32s version;
+
+    do
+    {
+        version = kAtomic32s_Get(&obj->dataStatsVersion);
+    }
+    while ((version & 1) || !kAtomic32s_CompareExchange(&obj->dataStatsVersion, version, version + 1));
+}
+
+GoFx(void) GoSensor_UnlockDataCounters(GoSensor sensor)
+{
+    kObj(GoSensor, sensor);
+
+    kAtomic32s_Increment(&obj->dataStatsVersion);
+}
+
+// Called on the data thread for each dataset received.
+GoFx(kStatus) GoSensor_RecordData(GoSensor sensor, kSerializer reader, GoDataSet dataSet, k64u arrivalTicks, k64u readTime)
+{
+    kObj(GoSensor, sensor);
+    GoSensorDataCounters* counters = &obj->dataCounters;
+    k64u streamBytes = kStream_BytesRead(kSerializer_Stream(reader));
+    kSize i;
+
+    GoSensor_LockDataCounters(sensor);
+    {
+        counters->bytesReceived += streamBytes - counters->streamBytes;
+        counters->streamBytes = streamBytes;
+        counters->dataSetCount++;
+
+        for (i = 0; i < GoDataSet_Count(dataSet); ++i)
+        {
+            GoDataMessageType type = GoDataMsg_Type(GoDataSet_At(dataSet, i));
+
+            if ((type >= 0) && (type < GO_DATA_STATS_MESSAGE_TYPE_COUNT))
+            {
+                counters->messageCount[type]++;
+            }
+        }
+
+        counters->readMax = kMax_(counters->readMax, readTime);
+        counters->readHistogram[GoReceiver_LatencyBucket(readTime)]++;
+
+        if (counters->lastArrival != k64U_NULL)
+        {
+            k64u interval = kTimer_FromTicks(1000 * (arrivalTicks - counters->lastArrival));
+
+            if (counters->lastInterval != k64U_NULL)
+            {
+                k64s variation = (k64s)(interval - counters->lastInterval);
+                k64s deviation = (variation < 0) ? -variation : variation;
+
+                counters->jitter = (k64u)((k64s)counters->jitter + (deviation - (k64s)counters->jitter) / GO_SENSOR_DATA_JITTER_GAIN);
+            }
+
+            counters->lastInterval = interval;
+        }
+
+        counters->lastArrival = arrivalTicks;
+    }
+    GoSensor_UnlockDataCounters(sensor);
+
+    return kOK;
+}
+
+// Takes a consistent snapshot of the data counters and accumulates it into a total. Maxima
+// (read time and jitter) are combined by taking the larger value.
+GoFx(kStatus) GoSensor_AddDataCounters(GoSensor sensor, GoSensorDataCounters* total)
+{
+    kObj(GoSensor, sensor);
+    GoSensorDataCounters counters;
+    k32s version;
+    kSize i;
+
+    do
+    {
+        do
+        {
+            version = kAtomic32s_Get(&obj->dataStatsVersion);
+        }
+        while (version & 1);
+
+        kMemCopy(&counters, &obj->dataCounters, sizeof(counters));
+    }
+    while (kAtomic32s_Get(&obj->dataStatsVersion) != version);
+
+    total->bytesReceived += counters.bytesReceived;
+    total->dataSetCount += counters.dataSetCount;
+    total->readMax = kMax_(total->readMax, counters.readMax);
+    total->reconnectCount += counters.reconnectCount;
+    total->jitter = kMax_(total->jitter, counters.jitter);
+
+    for (i = 0; i < GO_DATA_STATS_MESSAGE_TYPE_COUNT; ++i)
+    {
+        total->messageCount[i] += counters.messageCount[i];
+    }
+
+    for (i = 0; i < GO_RECEIVER_LATENCY_BUCKET_COUNT; ++i)
+    {
+        total->readHistogram[i] += counters.readHistogram[i];
+    }
+
+    return kOK;
+}
+
+// Converts data counters to statistics; queue fields are left to the caller.
+GoFx(kStatus) GoSensor_FormatDataStats(const GoSensorDataCounters* counters, GoDataStats* stats)
+{
+    kZero(*stats);
+
+    stats->bytesReceived = counters->bytesReceived;
+    stats->dataSetCount = counters->dataSetCount;
+    stats->reconnectCount = counters->reconnectCount;
+    stats->jitter = counters->jitter;
+
+    kCheck(kMemCopy(stats->messageCount, counters->messageCount, sizeof(stats->messageCount)));
+    kCheck(GoReceiver_HistogramStats(counters->readHistogram, counters->dataSetCount, counters->readMax, &stats->deserialization));
+
+    return kOK;
+}
+
 GoFx(kStatus) GoSensor_OnData(GoSensor sensor, GoReceiver receiver, kSerializer reader)
 {
     kObj(GoSensor, sensor);
     kAlloc msgAlloc = kAlloc_App();    //use the default system allocator for now; revisit later (performance)
     GoDataSet dataSet = kNULL;
+    k64u arrivalTicks = kTimer_Ticks();
     kStatus status = kNULL;
 
     kTry
     {
         kTest(kSerializer_ReadObject(reader, &dataSet, msgAlloc));
         kTest(GoDataSet_SetSenderId_(dataSet, obj->deviceId));
+
+        kTest(GoSensor_RecordData(sensor, reader, dataSet, arrivalTicks, kTimer_FromTicks(1000 * (kTimer_Ticks() - arrivalTicks))));
     }
     kCatch(&status)
     {
@@ -2812,16 +3649,78 @@ GoFx(kStatus) GoSensor_OnData(GoSensor sensor, GoReceiver receiver, kSerializer
         kEndCatch(status);
     }
 
+    if (GoSensor_MatchSnapshot(sensor, dataSet))
+    {
+        return kOK;
+    }
+
+    kTrace_Begin("GoSensor.Dispatch");
+
     if (obj->onDataSet == kNULL)
     {
-        kCheck(GoSystem_OnData(obj->system, sensor, dataSet));
+        status = GoSystem_OnData(obj->system, sensor, dataSet);
     }
     else
     {
-        kCheck(obj->onDataSet(obj->onDataSetContext, sensor, dataSet));
+        status = obj->onDataSet(obj->onDataSetContext, sensor, dataSet);
     }
 
-    return kOK;
+    kTrace_End("GoSensor.Dispatch");
+
+    return status;
+}
+
+// Hands the dataset to a caller blocked in GoSensor_SnapshotAndReceive if it carries a stamp 
+// newer than the last one seen when the snapshot was triggered. Returns kTRUE if the dataset
+// was consumed.
+GoFx(kBool) GoSensor_MatchSnapshot(GoSensor sensor, GoDataSet dataSet)
+{
+    kObj(GoSensor, sensor);
+    const GoStamp* stamp = GoSensor_FindStamp(dataSet);
+    kBool matched = kFALSE;
+
+    if (kIsNull(stamp))
+    {
+        return kFALSE;
+    }
+
+    kLock_Enter(obj->snapshotLock);
+    {
+        if (obj->snapshotPending && kIsNull(obj->snapshotResult)
+            && ((obj->snapshotStamp.frameIndex == k64U_NULL)
+                || (stamp->timestamp > obj->snapshotStamp.timestamp)
+                || (stamp->frameIndex > obj->snapshotStamp.frameIndex)))
+        {
+            obj->snapshotResult = dataSet;
+            matched = kTRUE;
+
+            // Posted under the lock, so that a caller that takes the dataset after timing out
+            // can always consume the signal; a late post would satisfy the next request.
+            kSemaphore_Post(obj->snapshotSignal);
+        }
+
+        obj->lastStamp = *stamp;
+    }
+    kLock_Exit(obj->snapshotLock);
+
+    return matched;
+}
+
+GoFx(const GoStamp*) GoSensor_FindStamp(GoDataSet dataSet)
+{
+    kSize i;
+
+    for (i = 0; i < GoDataSet_Count(dataSet); ++i)
+    {
+        GoDataMsg msg = GoDataSet_At(dataSet, i);
+
+        if ((GoDataMsg_Type(msg) == GO_DATA_MESSAGE_TYPE_STAMP) && (GoStampMsg_Count(msg) > 0))
+        {
+            return GoStampMsg_At(msg, 0);
+        }
+    }
+
+    return kNULL;
 }
 
 GoFx(kStatus) GoSensor_EnableHealth(GoSensor sensor, kBool enable)
@@ -2880,8 +3779,13 @@ GoFx(kStatus) GoSensor_OnHealth(GoSensor sensor, GoReceiver receiver, kSerialize
 GoFx(kStatus) GoSensor_UpdateHealthInfo(GoSensor sensor, GoDataSet healthSet)
 {
     kObj(GoSensor, sensor);
+    GoDataSet previousHealth = kNULL;
     kSize i, j;
 
+    // Retain the message set for readers such as GoMetricsServer; it is shared rather
+    // than copied, so that the health thread does no extra work.
+    kCheck(kObject_Share(healthSet));
+
     kCheck(GoSensor_LockState(sensor));
     {
         kBool consistencyIntervalElapsed = GoSensor_ConsistencyIntervalElapsed(sensor);
@@ -2925,6 +3829,31 @@ GoFx(kStatus) GoSensor_UpdateHealthInfo(GoSensor sensor, GoDataSet healthSet)
         }
 
         obj->healthMsgCount++;
+
+        previousHealth = obj->lastHealth;
+        obj->lastHealth = healthSet;
+    }
+    kCheck(GoSensor_UnlockState(sensor));
+
+    kCheck(kObject_Dispose(previousHealth));
+
+    return kOK;
+}
+
+// Gets a shared reference to the most recent health message set (kNULL if none); 
+// the caller must dispose it.
+GoFx(kStatus) GoSensor_LastHealth(GoSensor sensor, GoDataSet* healthSet)
+{
+    kObj(GoSensor, sensor);
+
+    kCheck(GoSensor_LockState(sensor));
+    {
+        *healthSet = obj->lastHealth;
+
+        if (!kIsNull(obj->lastHealth))
+        {
+            kObject_Share(obj->lastHealth);
+        }
     }
     kCheck(GoSensor_UnlockState(sensor));
 
@@ -3684,6 +4613,12 @@ GoFx(kStatus) GoSensor_UpdateDiscoveryInfo(GoSensor sensor, const GoDiscoveryInf
     // before this refactoring.
     if (info != kNULL)
     {
+        //sensors added by address learn their id from the first matching discovery reply
+        if (obj->deviceId == 0)
+        {
+            obj->deviceId = info->id;
+        }
+
         portInfo = GoDiscoveryInfo_Ports(info);
         obj->address = GoDiscoveryInfo_Address(info);
 
@@ -3738,6 +4673,14 @@ GoFx(kStatus) GoSensor_UpdateDiscoveryCycle(GoSensor sensor)
 {
     kObj(GoSensor, sensor);
 
+    //sensors added by address may not be reachable by discovery broadcasts; until a sensor
+    //has been reached, it remains online, and after that a responsive connection counts as
+    //a discovery reply
+    if (obj->isDirect && ((obj->deviceId == 0) || (GoSensor_IsConnected(sensor) && GoSensor_IsHealthOnline(sensor))))
+    {
+        obj->discoveryHistory[obj->discoveryCount & (kCountOf(obj->discoveryHistory) - 1)] = kTRUE;
+    }
+
     obj->discoveryCount++;
 
     return kOK;
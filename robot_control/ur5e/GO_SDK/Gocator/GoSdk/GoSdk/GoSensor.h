@@ -16,6 +16,7 @@
 #include <GoSdk/GoReplay.h>
 #include <GoSdk/GoTransform.h>
 #include <GoSdk/GoSensorInfo.h>
+#include <GoSdk/GoFuture.h>
 #include <GoSdk/GoGeoCal.h>
 #include <GoSdk/Messages/GoDataSet.h>
 #include <GoSdk/Messages/GoDiscoveryExtInfo.h>
@@ -39,6 +40,10 @@ typedef kObject GoSensor;
  * Initiates a sensor configuration, model file, and transformation synchronization
  * if modifications are present.
  *
+ * The configuration is uploaded only if its serialized form differs from the configuration
+ * that was last uploaded. After an upload, the configuration is read back from the sensor on
+ * next access, unless retention is enabled (see GoSensor_EnableConfigRetention).
+ *
  * @public              @memberof GoSensor
  * @version             Introduced in firmware 4.0.10.27
  * @param   sensor      GoSensor object.
@@ -231,6 +236,110 @@ GoFx(GoMode) GoSensor_ScanMode(GoSensor sensor);
  */
 GoFx(kStatus) GoSensor_EnableData(GoSensor sensor, kBool enable);
 
+/**
+ * Configures low-latency receive options for the sensor's data channel.
+ *
+ * In low-latency mode, the data thread blocks directly in the socket read instead of waiting 
+ * for data in 100 ms intervals, can busy-poll the network device (Linux, SO_BUSY_POLL), and can 
+ * be pinned to a processor and run in a higher priority class. Thread priority, affinity and 
+ * busy polling are applied on a best-effort basis. 
+ *
+ * Options take effect the next time the data channel is enabled (see GoSensor_EnableData).
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   options     Low-latency options.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoSensor_SetDataLowLatency(GoSensor sensor, const GoLowLatencyOptions* options);
+
+/**
+ * Gets the low-latency receive options for the sensor's data channel.
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   options     Receives low-latency options.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoSensor_DataLowLatency(GoSensor sensor, GoLowLatencyOptions* options);
+
+/**
+ * Configures buffer sizing for the sensor's data channel.
+ *
+ * By default, the data channel requests a 16 MB socket buffer before connecting (operating systems 
+ * may limit this; e.g., net.core.rmem_max on Linux), and sizes its stream buffer from the observed 
+ * message sizes and bandwidth, starting at 64 KB and ranging from 16 KB to 1 MB; reads of 64 KB or 
+ * more (e.g., surface and image payloads) bypass the stream buffer. When adaptive sizing is disabled, 
+ * fixed 64 KB buffers are used.
+ *
+ * Options take effect the next time the data channel is enabled (see GoSensor_EnableData).
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   options     Buffer options.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoSensor_SetDataBuffers(GoSensor sensor, const GoAdaptiveBufferOptions* options);
+
+/**
+ * Gets the buffer options for the sensor's data channel.
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   options     Receives buffer options.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoSensor_DataBuffers(GoSensor sensor, GoAdaptiveBufferOptions* options);
+
+/**
+ * Reports the current socket and stream buffer sizes of the data channel.
+ *
+ * The data channel must be enabled. Socket buffer sizes are reported as requested; the operating 
+ * system may limit them (e.g., net.core.rmem_max on Linux).
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   socketSize  Receives the socket read buffer size, in bytes.
+ * @param   streamSize  Receives the stream read buffer size, in bytes.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoSensor_DataBufferSizes(GoSensor sensor, kSSize* socketSize, kSSize* streamSize);
+
+/**
+ * Reports the socket-to-queue latency of the data channel since it was last enabled.
+ *
+ * Each sample measures the time from the first bytes of a dataset being available from the 
+ * socket until the dataset has been delivered to the data handler or queue.
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   stats       Receives latency statistics (in nanoseconds).
+ * @return              Operation status (kERROR_STATE if data is not enabled).
+ */
+GoFx(kStatus) GoSensor_DataLatencyStats(GoSensor sensor, GoLatencyStats* stats);
+
+/**
+ * Reports data channel counters accumulated since the sensor was added to the system.
+ *
+ * Counters are updated by the data thread without locking and can be polled frequently 
+ * (e.g. at 10 Hz) without delaying data delivery. Deserialization times and jitter are 
+ * reported in nanoseconds. Queue fields describe the system data queue, which is shared by 
+ * all sensors, and are only meaningful if no custom data set handler is installed.
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   stats       Receives data statistics.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoSensor_DataStats(GoSensor sensor, GoDataStats* stats);
+
 /**
  * Starts the sensor.
  *
@@ -291,6 +400,25 @@ GoFx(kStatus) GoSensor_Stop(GoSensor sensor);
  */
 GoFx(kStatus) GoSensor_Snapshot(GoSensor sensor);
 
+/**
+ * Performs a sensor snapshot and waits for the resulting dataset.
+ *
+ * The most recent data stamp is recorded before the snapshot is triggered; the first 
+ * dataset received afterwards with a newer stamp is returned to the caller instead of 
+ * being delivered to the system data handler or queue. Data must be enabled 
+ * (see GoSensor_EnableData or GoSystem_EnableData).
+ *
+ * The returned dataset must be destroyed after use.
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   result      Receives the snapshot dataset.
+ * @param   timeout     Time to wait for the dataset after the snapshot command completes (us).
+ * @return              Operation status (kERROR_TIMEOUT if no matching dataset arrived).
+ */
+GoFx(kStatus) GoSensor_SnapshotAndReceive(GoSensor sensor, GoDataSet* result, k64u timeout);
+
 /**
  * Perform alignment using the configured alignment type and target.
  *
@@ -468,6 +596,79 @@ GoFx(kStatus) GoSensor_Encoder(GoSensor sensor, k64s* encoder);
  */
 GoFx(kStatus) GoSensor_Trigger(GoSensor sensor);
 
+/**
+ * Asynchronously reports the current states of the sensor.
+ *
+ * Asynchronous commands are sent on a dedicated control connection and are pipelined:
+ * several commands can be outstanding at once, and they complete in the order in which
+ * they were issued. The connection is established by the first asynchronous command.
+ * Output storage must remain valid until the future completes.
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   states      Receives the states on completion.
+ * @param   future      Future that is completed with the command status.
+ * @return              Operation status (of issuing the command).
+ * @see                 GoSensor_States, GoFuture
+ */
+GoFx(kStatus) GoSensor_StatesAsync(GoSensor sensor, GoStates* states, GoFuture future);
+
+/**
+ * Asynchronously gets the current time stamp.
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   time        Receives the current time stamp (us) on completion.
+ * @param   future      Future that is completed with the command status.
+ * @return              Operation status (of issuing the command).
+ * @see                 GoSensor_Timestamp, GoSensor_StatesAsync
+ */
+GoFx(kStatus) GoSensor_TimestampAsync(GoSensor sensor, k64u* time, GoFuture future);
+
+/**
+ * Asynchronously gets the current encoder count.
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   encoder     Receives the encoder count (ticks) on completion.
+ * @param   future      Future that is completed with the command status.
+ * @return              Operation status (of issuing the command).
+ * @see                 GoSensor_Encoder, GoSensor_StatesAsync
+ */
+GoFx(kStatus) GoSensor_EncoderAsync(GoSensor sensor, k64s* encoder, GoFuture future);
+
+/**
+ * Asynchronously sends a software trigger to the sensor.
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   future      Future that is completed with the command status.
+ * @return              Operation status (of issuing the command).
+ * @see                 GoSensor_Trigger, GoSensor_StatesAsync
+ */
+GoFx(kStatus) GoSensor_TriggerAsync(GoSensor sensor, GoFuture future);
+
+/**
+ * Asynchronously reads the list of files stored on the sensor.
+ *
+ * Unlike GoSensor_FileCount and GoSensor_FileNameAt, this function does not update
+ * the sensor's cached file list.
+ *
+ * @public              @memberof GoSensor
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   sensor      GoSensor object.
+ * @param   files       Receives file names (kArrayList<kText64>) on completion.
+ * @param   extension   File extension filter (or kNULL for all files).
+ * @param   future      Future that is completed with the command status.
+ * @return              Operation status (of issuing the command).
+ * @see                 GoSensor_StatesAsync
+ */
+GoFx(kStatus) GoSensor_ReadFileListAsync(GoSensor sensor, kArrayList files, const kChar* extension, GoFuture future);
+
 /**
  * Schedules a digital output.
  *
@@ -546,6 +747,27 @@ GoFx(kStatus) GoSensor_FileNameAt(GoSensor sensor, kSize index, kChar* name, kSi
  */
 GoFx(kStatus) GoSensor_UploadFile(GoSensor sensor, const kChar* sourcePath, const kChar* destName);
 
+/**
+ * Uploads a file to the connected sensor, reporting transfer progress.
+ *
+ * The source file is read in fixed-size blocks on a background thread while previously read blocks
+ * are sent, so that memory usage remains constant regardless of file size.
+ *
+ * WARNING! This operation writes to flash storage.
+ * Review the user manual for implications.
+ *
+ * @public                  @memberof GoSensor
+ * @version                 Introduced in firmware 6.4.41.x
+ * @param   sensor          GoSensor object.
+ * @param   sourcePath      Source file system path for the file to be uploaded.
+ * @param   destName        Destination name for the uploaded file (maximum 63 characters).
+ * @param   progress        Optional progress callback (can be kNULL).
+ * @param   receiver        Receiver argument for progress callback.
+ * @return                  Operation status.
+ * @see                     GoSensor_UploadFile
+ */
+GoFx(kStatus) GoSensor_UploadFileEx(GoSensor sensor, const kChar* sourcePath, const kChar* destName, GoTransferFx progress, kPointer receiver);
+
 /**
  * Downloads a file from the connected sensor. The following is a list of
  * macros representing common files used in this operation:
@@ -555,6 +777,9 @@ GoFx(kStatus) GoSensor_UploadFile(GoSensor sensor, const kChar* sourcePath, cons
  *
  * File names of saved jobs may also be specified.
  *
+ * The file is received under a temporary name (destPath with a ".tmp" suffix) and moved to destPath
+ * once complete. If the download fails, an existing file at destPath is left unchanged.
+ *
  * @public                  @memberof GoSensor
  * @version                 Introduced in firmware 4.0.10.27
  * @param   sensor          GoSensor object.
@@ -564,6 +789,23 @@ GoFx(kStatus) GoSensor_UploadFile(GoSensor sensor, const kChar* sourcePath, cons
  */
 GoFx(kStatus) GoSensor_DownloadFile(GoSensor sensor, const kChar* sourceName, const kChar* destPath);
 
+/**
+ * Downloads a file from the connected sensor into a stream.
+ *
+ * File content is written to the stream in fixed-size chunks as it is received, so that memory
+ * usage remains constant regardless of file size.
+ *
+ * @public                  @memberof GoSensor
+ * @version                 Introduced in firmware 6.4.41.x
+ * @param   sensor          GoSensor object.
+ * @param   sourceName      Source name of the file to be downloaded.
+ * @param   stream          Destination stream (e.g., kFile, kMemory).
+ * @param   progress        Optional progress callback (can be kNULL).
+ * @param   receiver        Receiver argument for progress callback.
+ * @return                  Operation status.
+ */
+GoFx(kStatus) GoSensor_DownloadFileToStream(GoSensor sensor, const kChar* sourceName, kStream stream, GoTransferFx progress, kPointer receiver);
+
 /**
  * Copies a file within the connected sensor.
  *
@@ -676,6 +918,71 @@ GoFx(kStatus) GoSensor_DefaultJob(GoSensor sensor, kChar* fileName, kSize capaci
  */
 GoFx(kStatus) GoSensor_LoadedJob(GoSensor sensor, kChar* fileName, kSize capacity, kBool* changed);
 
+/**
+ * Enables a local, on-disk cache of the live job configuration.
+ *
+ * When the cache is enabled, the live configuration and part models are kept in the given
+ * directory, keyed by sensor id, loaded job name and firmware version. On a subsequent connection
+ * to a sensor that reports the same loaded job, unmodified since it was loaded (see GoSensor_LoadedJob),
+ * these files are read from the cache instead of being downloaded from the sensor. The cache is bypassed
+ * while the live job has unsaved changes.
+ *
+ * Cache entries for a job are discarded when the job file is copied, uploaded or deleted via this
+ * sensor object, and all entries for the sensor are discarded when the sensor is restored. Entries
+ * can become stale if a job file is overwritten by another client; delete the cache directory in
+ * that case.
+ *
+ * The cache is disabled by default. It should be enabled before connecting to the sensor.
+ *
+ * @public                  @memberof GoSensor
+ * @version                 Introduced in firmware 6.4.41.x
+ * @param   sensor          GoSensor object.
+ * @param   directory       Cache directory, created if necessary (kNULL or empty to disable the cache).
+ * @return                  Operation status.
+ */
+GoFx(kStatus) GoSensor_EnableConfigCache(GoSensor sensor, const kChar* directory);
+
+/**
+ * Reports whether the local configuration cache is enabled.
+ *
+ * @public                  @memberof GoSensor
+ * @param   sensor          GoSensor object.
+ * @return                  kTRUE if the cache is enabled; kFALSE otherwise.
+ * @see                     GoSensor_EnableConfigCache
+ */
+GoFx(kBool) GoSensor_ConfigCacheEnabled(GoSensor sensor);
+
+/**
+ * Enables retention of the local configuration after it is flushed to the sensor.
+ *
+ * By default, the configuration is read back from the sensor on next access after each upload,
+ * so that values that the sensor assigns, clamps or derives (e.g. ids of new tools, limits) are
+ * visible. With retention enabled, the local configuration is kept after an upload, avoiding the
+ * download; it is still read back if tools, measurements or feature outputs were added or removed.
+ * Otherwise, clamped values keep the value that was written and derived values keep their
+ * previous values until the configuration is next read (e.g. after GoSensor_Refresh).
+ *
+ * Retention is disabled by default.
+ *
+ * @public                  @memberof GoSensor
+ * @version                 Introduced in firmware 6.4.41.x
+ * @param   sensor          GoSensor object.
+ * @param   enable          kTRUE to retain the local configuration after an upload.
+ * @return                  Operation status.
+ */
+GoFx(kStatus) GoSensor_EnableConfigRetention(GoSensor sensor, kBool enable);
+
+/**
+ * Reports whether the local configuration is retained after it is flushed.
+ *
+ * @public                  @memberof GoSensor
+ * @version                 Introduced in firmware 6.4.41.x
+ * @param   sensor          GoSensor object.
+ * @return                  kTRUE if retention is enabled; kFALSE otherwise.
+ * @see                     GoSensor_EnableConfigRetention
+ */
+GoFx(kBool) GoSensor_ConfigRetentionEnabled(GoSensor sensor);
+
 /**
  * Logs into the sensor using the specified user name and password.
  *
@@ -734,6 +1041,9 @@ GoFx(kStatus) GoSensor_Upgrade(GoSensor sensor, const kChar* sourcePath, GoUpgra
 /**
  * Creates a backup of sensor files and downloads the backup to the specified location.
  *
+ * As with GoSensor_DownloadFile, the backup is received under a temporary name and moved to
+ * destPath once complete.
+ *
  * @public                  @memberof GoSensor
  * @version                 Introduced in firmware 4.0.10.27
  * @param   sensor          GoSensor object.
@@ -742,6 +1052,22 @@ GoFx(kStatus) GoSensor_Upgrade(GoSensor sensor, const kChar* sourcePath, GoUpgra
  */
 GoFx(kStatus) GoSensor_Backup(GoSensor sensor, const kChar* destPath);
 
+/**
+ * Creates a backup of sensor files and downloads the backup into a stream.
+ *
+ * Backup content is written to the stream in fixed-size chunks as it is received, so that memory
+ * usage remains constant regardless of backup size.
+ *
+ * @public                  @memberof GoSensor
+ * @version                 Introduced in firmware 6.4.41.x
+ * @param   sensor          GoSensor object.
+ * @param   stream          Destination stream (e.g., kFile, kMemory).
+ * @param   progress        Optional progress callback (can be kNULL).
+ * @param   receiver        Receiver argument for progress callback.
+ * @return                  Operation status.
+ */
+GoFx(kStatus) GoSensor_BackupToStream(GoSensor sensor, kStream stream, GoTransferFx progress, kPointer receiver);
+
 /**
  * Restores a backup of sensor files.
  * 
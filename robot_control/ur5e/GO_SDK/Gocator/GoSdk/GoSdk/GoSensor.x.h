@@ -15,7 +15,10 @@
 #include <GoSdk/GoReplay.h>
 #include <GoSdk/Tools/GoTools.h>
 #include <GoSdk/GoTransform.h>
+#include <GoSdk/Messages/GoDataTypes.h>
+#include <kApi/Threads/kAtomic.h>
 #include <kApi/Threads/kLock.h>
+#include <kApi/Threads/kSemaphore.h>
 #include <kApi/Data/kArrayList.h>
 
 #define GO_SENSOR_CONFIG_SCHEMA_VERSION             (101)
@@ -34,6 +37,11 @@
 #define GO_SENSOR_DATA_SOCKET_BUFFER                (65536)             //socket read buffer size for data connections
 #define GO_SENSOR_DATA_STREAM_BUFFER                (65536)             //client read buffer size for data connections
 
+#define GO_SENSOR_DATA_ADAPTIVE_SOCKET_BUFFER       (16777216)          //default socket read buffer size with adaptive sizing
+#define GO_SENSOR_DATA_MIN_STREAM_BUFFER            (16384)             //default lower bound of adaptive data client buffers
+#define GO_SENSOR_DATA_MAX_STREAM_BUFFER            (1048576)           //default upper bound of adaptive data client buffers
+#define GO_SENSOR_DATA_DIRECT_READ_THRESHOLD        (65536)             //default size of data reads that bypass the client buffer
+
 #define GO_SENSOR_HEALTH_SOCKET_BUFFER              (16384)             //socket read buffer size for health connections
 #define GO_SENSOR_HEALTH_STREAM_BUFFER              (16384)             //client read buffer size for health connections
 
@@ -45,6 +53,25 @@
 
 #define GO_FILE_GEOCAL                              "GeoCal.xml"
 
+#define GO_SENSOR_DATA_JITTER_GAIN                  (16)                //inter-arrival jitter smoothing divisor (as in RFC 3550)
+
+// Data connection counters. Writers make the sensor's dataStatsVersion odd while they update 
+// the counters (see GoSensor_LockDataCounters), so that readers can take consistent snapshots 
+// without blocking the data thread. 
+typedef struct GoSensorDataCounters
+{
+    k64u bytesReceived;                                         //bytes received
+    k64u streamBytes;                                           //bytes read from the current connection at the last update
+    k64u dataSetCount;                                          //datasets received
+    k64u messageCount[GO_DATA_STATS_MESSAGE_TYPE_COUNT];        //messages received, by type
+    k64u readMax;                                               //longest dataset read time (ns)
+    k64u readHistogram[GO_RECEIVER_LATENCY_BUCKET_COUNT];       //log-linear histogram of dataset read times (ns)
+    k64u reconnectCount;                                        //times the data connection was re-established
+    k64u lastArrival;                                           //arrival of the last dataset on this connection (ticks; k64U_NULL if none)
+    k64u lastInterval;                                          //last inter-arrival time (ns; k64U_NULL if none)
+    k64u jitter;                                                //smoothed inter-arrival variation (ns)
+} GoSensorDataCounters;
+
 // This structure contains information related to acceleration of sensor.
 // The fields require getting additional information about the
 // main controller/host that is not available from sensor discovery
@@ -112,6 +139,14 @@ typedef struct GoSensorDiscoveryInfo
     kText32     family;                         //sensor model family
 } GoSensorDiscoveryInfo;
 
+//forwards GoControl transfer progress to a caller-supplied callback, with the sensor as sender
+typedef struct GoSensorTransferContext
+{
+    GoSensor sensor;
+    GoTransferFx function;
+    kPointer receiver;
+} GoSensorTransferContext;
+
 typedef struct GoSensorClass
 {
     kObjectClass base;
@@ -130,6 +165,7 @@ typedef struct GoSensorClass
     k64u healthCheckCount;                      //health presence history count
     k64u healthMsgCount;                        //count of all health messages received from sensor
     k64u previousHealthMsgCount;                //count of all health messages at last health check
+    GoDataSet lastHealth;                       //most recent health message set (shared reference)
     k64u sensorInfoTime;                        //time of last foreground update of sensor info
     GoAddressInfo address;                      //current network address
     GoRole role;                                //sensor role, as reported via sensor info
@@ -156,9 +192,17 @@ typedef struct GoSensorClass
     kXml configXmlItem;                         //node reference from the last config retrieved.
     kBool configValid;                          //is config valid?
     kBool configModified;                       //has config been locally modified?
+    k64u configHash;                            //hash of the serialized config that was last uploaded
+    kBool configHashValid;                      //is configHash valid? (used to skip uploads of unchanged config)
+    k64u configStructure;                       //signature of the tools and measurements in the config read from the sensor
+    kBool configRetention;                      //retain the local config after an upload?
     kBool isSyncConfig;                         //is the config currently being synchronized?
     kBool isFlushConfig;                        //is the config currently being flushed? Note: disconnection flushes the config without syncing it which is why this is needed.
 
+    kText256 configCacheDirectory;              //local config cache directory (empty if disabled)
+    kText256 configCachePath;                   //cache entry directory for the live job (empty if the live job cannot be cached)
+    kBool configCachePathValid;                 //has the cache entry directory been determined for the live job?
+
     kXml transformXml;                          //the last transform retrieved. Used for forwards compatible transform writes.
     kXml transformXmlItem;                      //node reference from the last transform retrieved.
     kBool transformValid;                       //is transform valid?
@@ -176,6 +220,8 @@ typedef struct GoSensorClass
     GoControl control;                          //control/upgrade connection
     GoReceiver data;                            //data connection
     k32u dataPort;                              //data port
+    GoLowLatencyOptions dataLowLatency;         //low-latency receive options for the data connection
+    GoAdaptiveBufferOptions dataBuffers;        //adaptive buffer options for the data connection
     GoSensorDataSetFx onDataSet;                //callback to a custom data handling function
     kPointer onDataSetContext;                  //context to be passed into the onDataSet function
     GoReceiver health;                          //health connection
@@ -192,6 +238,21 @@ typedef struct GoSensorClass
 
     GoSensorAccelInfo accelInfo;                //sensor acceleration related information.
     GoSensorDiscoveryInfo discoveryInfo;        //sensor information learned via discovery. 
+    kBool isDirect;                             //was the sensor added by address? (presence is then tracked by health messages only)
+
+    k64u connectDuration;                       //duration of the last control connection (us)
+    k64u configReadDuration;                    //duration of the state/config/transform reads that completed the last connection (us)
+
+    kLock snapshotLock;                         //protects snapshot correlation state (data thread vs. caller)
+    kSemaphore snapshotSignal;                  //signalled when the awaited snapshot dataset arrives
+    kBool snapshotPending;                      //is a snapshot result awaited?
+    GoStamp snapshotStamp;                      //most recent stamp seen before the snapshot was triggered
+    GoDataSet snapshotResult;                   //snapshot dataset, handed to the waiting caller
+    GoStamp lastStamp;                          //most recent stamp seen on the data channel (frameIndex k64U_NULL if none)
+
+    kAtomic32s dataStatsVersion;                //sequence number for dataCounters (odd while an update is in progress)
+    GoSensorDataCounters dataCounters;          //data connection counters
+    kBool dataOpened;                           //has a data connection been opened before?
 } GoSensorClass;
 
 kDeclareClassEx(Go, GoSensor, kObject)
@@ -202,6 +263,10 @@ GoFx(kStatus) GoSensor_Construct(GoSensor* sensor, kPointer system, const GoDisc
 GoFx(kStatus) GoSensor_Init(GoSensor sensor, kType type, kPointer system, const GoDiscoveryInfo* discoveryInfo, kAlloc alloc);
 GoFx(kStatus) GoSensor_VRelease(GoSensor sensor);
 
+GoFx(kStatus) GoSensor_SetDirectAddress(GoSensor sensor, kIpAddress address);
+GoFx(kBool) GoSensor_IsDirect(GoSensor sensor);
+GoFx(kStatus) GoSensor_ConnectionTimes(GoSensor sensor, k64u* connect, k64u* configRead);
+
 GoFx(kStatus) GoSensor_SyncConfig(GoSensor sensor);
 GoFx(kStatus) GoSensor_SetConnected(GoSensor sensor, kBool isConnected, kBool isCompatible);
 
@@ -217,9 +282,17 @@ GoFx(kStatus) GoSensor_SetConfigModified(GoSensor sensor);
 GoFx(kBool) GoSensor_ConfigModified(GoSensor sensor);
 GoFx(kStatus) GoSensor_ReadConfig(GoSensor sensor);
 GoFx(kStatus) GoSensor_WriteConfig(GoSensor sensor);
+GoFx(kStatus) GoSensor_FormatConfig(GoSensor sensor, kXml* xml);
+GoFx(kStatus) GoSensor_ConfigStructure(GoSensor sensor, k64u* signature);
 GoFx(kStatus) GoSensor_GetLiveConfig(GoSensor sensor, kXml* xml, kAlloc allocator);
 GoFx(kStatus) GoSensor_SetLiveConfig(GoSensor sensor, kXml xml);
 
+GoFx(kStatus) GoSensor_ReadLiveFile(GoSensor sensor, const kChar* fileName, kByte** data, kSize* size, kAlloc allocator);
+GoFx(kStatus) GoSensor_CacheConfigPath(GoSensor sensor);
+GoFx(kStatus) GoSensor_InvalidateConfigCache(GoSensor sensor);
+GoFx(kStatus) GoSensor_PurgeConfigCache(GoSensor sensor, const kChar* jobName);
+GoFx(kStatus) GoSensor_ConfigCacheEntryName(const kChar* name, kChar* entry, kSize capacity);
+
 GoFx(kStatus) GoSensor_SyncTransform(GoSensor sensor);
 GoFx(kStatus) GoSensor_CacheTransform(GoSensor sensor);
 GoFx(kStatus) GoSensor_FlushTransform(GoSensor sensor);
@@ -274,6 +347,7 @@ GoFx(kBool) GoSensor_DataEnabled(GoSensor sensor);
 GoFx(kStatus) GoSensor_EnableHealth(GoSensor sensor, kBool enable);
 GoFx(kStatus) GoSensor_CheckHealth(GoSensor sensor);
 GoFx(kStatus) GoSensor_UpdateHealthInfo(GoSensor sensor, GoDataSet healthSet);
+GoFx(kStatus) GoSensor_LastHealth(GoSensor sensor, GoDataSet* healthSet);
 
 GoFx(kBool) GoSensor_IsDiscoveryOnline(GoSensor sensor);
 GoFx(kBool) GoSensor_IsHealthOnline(GoSensor sensor);
@@ -308,8 +382,21 @@ GoFx(kStatus) GoSensor_BeginExposureAutoSet(GoSensor sensor, GoRole role);
 GoFx(kStatus) GoSensor_EndExposureAutoSet(GoSensor sensor);
 
 GoFx(kStatus) GoSensor_OnData(GoSensor sensor, GoReceiver receiver, kSerializer reader);
+GoFx(kBool) GoSensor_MatchSnapshot(GoSensor sensor, GoDataSet dataSet);
+GoFx(const GoStamp*) GoSensor_FindStamp(GoDataSet dataSet);
+
+GoFx(void) GoSensor_LockDataCounters(GoSensor sensor);
+GoFx(void) GoSensor_UnlockDataCounters(GoSensor sensor);
+GoFx(kStatus) GoSensor_RecordData(GoSensor sensor, kSerializer reader, GoDataSet dataSet, k64u arrivalTicks, k64u readTime);
+GoFx(kStatus) GoSensor_AddDataCounters(GoSensor sensor, GoSensorDataCounters* total);
+GoFx(kStatus) GoSensor_FormatDataStats(const GoSensorDataCounters* counters, GoDataStats* stats);
+
+GoFx(kStatus) GoSensor_PrepareAsync(GoSensor sensor);
 GoFx(kStatus) GoSensor_OnHealth(GoSensor sensor, GoReceiver receiver, kSerializer reader);
 
+GoFx(kStatus) GoSensor_OnTransfer(kPointer context, kObject sender, GoTransferFxArgs* args);
+GoFx(kStatus) GoSensor_ReplaceFile(const kChar* sourcePath, const kChar* destPath);
+
 GoFx(kStatus) GoSensor_BeginUpgrade(GoSensor sensor, const kChar* sourcePath);
 GoFx(kStatus) GoSensor_EndUpgrade(GoSensor sensor);
 
@@ -0,0 +1,412 @@
+/**
+ * @file    GoSessionPool.c
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#include <GoSdk/GoSessionPool.h>
+#include <kApi/Io/kNetwork.h>
+
+kBeginValueEx(Go, GoSessionPoolEntry)
+kEndValueEx()
+
+kBeginClassEx(Go, GoSessionPool)
+    kAddVMethod(GoSessionPool, kObject, VRelease)
+kEndClassEx()
+
+GoFx(kStatus) GoSessionPool_Construct(GoSessionPool* pool, kAlloc allocator)
+{
+    kAlloc alloc = kAlloc_Fallback(allocator);
+    kStatus status;
+
+    kCheck(kAlloc_GetObject(alloc, kTypeOf(GoSessionPool), pool));
+
+    if (!kSuccess(status = GoSessionPool_Init(*pool, kTypeOf(GoSessionPool), alloc)))
+    {
+        kAlloc_FreeRef(alloc, pool);
+    }
+
+    return status;
+}
+
+GoFx(kStatus) GoSessionPool_Init(GoSessionPool pool, kType type, kAlloc alloc)
+{
+    kObjR(GoSessionPool, pool);
+    kStatus status;
+
+    kCheck(kObject_Init(pool, type, alloc));
+    obj->lock = kNULL;
+    obj->system = kNULL;
+    obj->sessions = kNULL;
+    obj->healthCheck = kNULL;
+    obj->reconnected = kNULL;
+    obj->reconnectWaiters = 0;
+    obj->dataEnabled = kFALSE;
+    obj->cacheDirectory[0] = 0;
+    obj->connectCount = 0;
+
+    kTry
+    {
+        kTest(kLock_Construct(&obj->lock, alloc));
+        kTest(kSemaphore_Construct(&obj->reconnected, 0, alloc));
+        kTest(kArrayList_Construct(&obj->sessions, kTypeOf(GoSessionPoolEntry), 0, alloc));
+
+        kTest(GoSystem_ConstructDirect(&obj->system, kNULL, 0, alloc));
+
+        kTest(kPeriodic_Construct(&obj->healthCheck, alloc));
+        kTest(kPeriodic_Start(obj->healthCheck, GO_SESSION_POOL_HEALTH_CHECK_PERIOD, GoSessionPool_OnHealthCheck, pool));
+    }
+    kCatch(&status)
+    {
+        GoSessionPool_VRelease(pool);
+        kEndCatch(status);
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSessionPool_VRelease(GoSessionPool pool)
+{
+    kObj(GoSessionPool, pool);
+
+    if (!kIsNull(obj->healthCheck))
+    {
+        kCheck(kPeriodic_Stop(obj->healthCheck));
+    }
+
+    kCheck(kDestroyRef(&obj->healthCheck));
+    kCheck(kDestroyRef(&obj->system));
+    kCheck(kDestroyRef(&obj->sessions));
+    kCheck(kDestroyRef(&obj->reconnected));
+    kCheck(kDestroyRef(&obj->lock));
+
+    return kObject_VRelease(pool);
+}
+
+GoFx(kStatus) GoSessionPool_Acquire(GoSessionPool pool, const kIpAddress* address, GoSensor* sensor)
+{
+    kObj(GoSessionPool, pool);
+    GoSessionPoolEntry* entry = kNULL;
+    GoSensor target = kNULL;
+    kStatus status;
+
+    // A session that is being reconnected by the health check isn't busy; wait for
+    // the reconnection to end and then take the session.
+    while (kIsNull(target))
+    {
+        kBool wait = kFALSE;
+
+        kLock_Enter(obj->lock);
+
+        kTry
+        {
+            entry = GoSessionPool_FindAddress(pool, address);
+
+            if (kIsNull(entry))
+            {
+                kTest(GoSessionPool_AddEntry(pool, address, &entry));
+            }
+
+            kTestTrue(!entry->inUse, kERROR_BUSY);
+
+            if (entry->reconnecting)
+            {
+                obj->reconnectWaiters++;
+                wait = kTRUE;
+            }
+            else
+            {
+                entry->inUse = kTRUE;
+                target = entry->sensor;
+            }
+        }
+        kFinally
+        {
+            kLock_Exit(obj->lock);
+            kEndFinally();
+        }
+
+        if (wait)
+        {
+            kCheck(kSemaphore_Wait(obj->reconnected, kINFINITE));
+        }
+    }
+
+    if (!GoSessionPool_IsReady(pool, target))
+    {
+        if (!kSuccess(status = GoSessionPool_Prepare(pool, target)))
+        {
+            GoSessionPool_SetInUse(pool, target, kFALSE);
+            return status;
+        }
+    }
+
+    *sensor = target;
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSessionPool_Release(GoSessionPool pool, GoSensor sensor)
+{
+    return GoSessionPool_SetInUse(pool, sensor, kFALSE);
+}
+
+GoFx(GoSystem) GoSessionPool_System(GoSessionPool pool)
+{
+    kObj(GoSessionPool, pool);
+
+    return obj->system;
+}
+
+GoFx(kStatus) GoSessionPool_EnableData(GoSessionPool pool, kBool enable)
+{
+    kObj(GoSessionPool, pool);
+
+    obj->dataEnabled = enable;
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSessionPool_EnableConfigCache(GoSessionPool pool, const kChar* directory)
+{
+    kObj(GoSessionPool, pool);
+    kSize i;
+
+    kLock_Enter(obj->lock);
+
+    kTry
+    {
+        if (kIsNull(directory))
+        {
+            obj->cacheDirectory[0] = 0;
+        }
+        else
+        {
+            kTest(kStrCopy(obj->cacheDirectory, kCountOf(obj->cacheDirectory), directory));
+        }
+
+        for (i = 0; i < kArrayList_Count(obj->sessions); ++i)
+        {
+            GoSessionPoolEntry* entry = kArrayList_AtT(obj->sessions, i, GoSessionPoolEntry);
+
+            kTest(GoSensor_EnableConfigCache(entry->sensor, obj->cacheDirectory));
+        }
+    }
+    kFinally
+    {
+        kLock_Exit(obj->lock);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+GoFx(k64u) GoSessionPool_ConnectCount(GoSessionPool pool)
+{
+    kObj(GoSessionPool, pool);
+    k64u count;
+
+    kLock_Enter(obj->lock);
+    {
+        count = obj->connectCount;
+    }
+    kLock_Exit(obj->lock);
+
+    return count;
+}
+
+GoFx(GoSessionPoolEntry*) GoSessionPool_FindEntry(GoSessionPool pool, GoSensor sensor)
+{
+    kObj(GoSessionPool, pool);
+    kSize i;
+
+    for (i = 0; i < kArrayList_Count(obj->sessions); ++i)
+    {
+        GoSessionPoolEntry* entry = kArrayList_AtT(obj->sessions, i, GoSessionPoolEntry);
+
+        if (entry->sensor == sensor)
+        {
+            return entry;
+        }
+    }
+
+    return kNULL;
+}
+
+GoFx(GoSessionPoolEntry*) GoSessionPool_FindAddress(GoSessionPool pool, const kIpAddress* address)
+{
+    kObj(GoSessionPool, pool);
+    kSize i;
+
+    for (i = 0; i < kArrayList_Count(obj->sessions); ++i)
+    {
+        GoSessionPoolEntry* entry = kArrayList_AtT(obj->sessions, i, GoSessionPoolEntry);
+
+        if (kIpAddress_Equals(entry->address, *address))
+        {
+            return entry;
+        }
+    }
+
+    return kNULL;
+}
+
+GoFx(kStatus) GoSessionPool_AddEntry(GoSessionPool pool, const kIpAddress* address, GoSessionPoolEntry** entry)
+{
+    kObj(GoSessionPool, pool);
+    GoSessionPoolEntry newEntry;
+
+    newEntry.address = *address;
+    newEntry.sensor = kNULL;
+    newEntry.inUse = kFALSE;
+    newEntry.reconnecting = kFALSE;
+
+    kCheck(GoSystem_AddDirectSensor(obj->system, *address));
+    kCheck(GoSystem_FindSensorByIpAddress(obj->system, address, &newEntry.sensor));
+
+    if (obj->cacheDirectory[0] != 0)
+    {
+        kCheck(GoSensor_EnableConfigCache(newEntry.sensor, obj->cacheDirectory));
+    }
+
+    kCheck(kArrayList_AddT(obj->sessions, &newEntry));
+
+    *entry = kArrayList_LastT(obj->sessions, GoSessionPoolEntry);
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSessionPool_SetInUse(GoSessionPool pool, GoSensor sensor, kBool inUse)
+{
+    kObj(GoSessionPool, pool);
+    GoSessionPoolEntry* entry;
+    kStatus status = kOK;
+
+    kLock_Enter(obj->lock);
+    {
+        entry = GoSessionPool_FindEntry(pool, sensor);
+
+        if (kIsNull(entry))
+        {
+            status = kERROR_NOT_FOUND;
+        }
+        else
+        {
+            entry->inUse = inUse;
+        }
+    }
+    kLock_Exit(obj->lock);
+
+    return status;
+}
+
+GoFx(kStatus) GoSessionPool_EndReconnect(GoSessionPool pool, GoSensor sensor)
+{
+    kObj(GoSessionPool, pool);
+    GoSessionPoolEntry* entry;
+    kStatus status = kOK;
+
+    kLock_Enter(obj->lock);
+    {
+        entry = GoSessionPool_FindEntry(pool, sensor);
+
+        if (kIsNull(entry))
+        {
+            status = kERROR_NOT_FOUND;
+        }
+        else
+        {
+            entry->reconnecting = kFALSE;
+        }
+
+        //waiters retry their acquisition, whatever the session they are waiting for
+        while (obj->reconnectWaiters > 0)
+        {
+            kSemaphore_Post(obj->reconnected);
+            obj->reconnectWaiters--;
+        }
+    }
+    kLock_Exit(obj->lock);
+
+    return status;
+}
+
+GoFx(kBool) GoSessionPool_IsReady(GoSessionPool pool, GoSensor sensor)
+{
+    kObj(GoSessionPool, pool);
+
+    return GoSensor_IsConnected(sensor)
+        && GoSensor_IsResponsive(sensor)
+        && (GoSensor_DataEnabled(sensor) == obj->dataEnabled);
+}
+
+// Connects (or reconnects) the sensor and brings its data connection in line with
+// the pool setting. Called without the pool lock; the session must be marked in use
+// or reconnecting.
+GoFx(kStatus) GoSessionPool_Prepare(GoSessionPool pool, GoSensor sensor)
+{
+    kObj(GoSessionPool, pool);
+
+    if (!GoSensor_IsConnected(sensor) || !GoSensor_IsResponsive(sensor))
+    {
+        if (GoSensor_IsConnected(sensor))
+        {
+            kCheck(GoSensor_Disconnect(sensor));
+        }
+
+        kCheck(GoSensor_Connect(sensor));
+
+        kLock_Enter(obj->lock);
+        {
+            obj->connectCount++;
+        }
+        kLock_Exit(obj->lock);
+    }
+
+    if (GoSensor_DataEnabled(sensor) != obj->dataEnabled)
+    {
+        kCheck(GoSensor_EnableData(sensor, obj->dataEnabled));
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSessionPool_OnHealthCheck(GoSessionPool pool, kPeriodic timer)
+{
+    kObj(GoSessionPool, pool);
+    kSize i = 0;
+
+    // Visit each idle session once; a session is marked as reconnecting while the
+    // reconnection is in progress, so that acquirers wait for it instead of failing.
+    for (;;)
+    {
+        GoSensor target = kNULL;
+
+        kLock_Enter(obj->lock);
+        {
+            while (kIsNull(target) && (i < kArrayList_Count(obj->sessions)))
+            {
+                GoSessionPoolEntry* entry = kArrayList_AtT(obj->sessions, i++, GoSessionPoolEntry);
+
+                if (!entry->inUse && !GoSessionPool_IsReady(pool, entry->sensor))
+                {
+                    entry->reconnecting = kTRUE;
+                    target = entry->sensor;
+                }
+            }
+        }
+        kLock_Exit(obj->lock);
+
+        if (kIsNull(target))
+        {
+            break;
+        }
+
+        GoSessionPool_Prepare(pool, target);
+        GoSessionPool_EndReconnect(pool, target);
+    }
+
+    return kOK;
+}
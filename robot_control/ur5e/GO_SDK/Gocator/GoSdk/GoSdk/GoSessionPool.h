@@ -0,0 +1,151 @@
+/**
+ * @file    GoSessionPool.h
+ * @brief   Declares the GoSessionPool class.
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef GO_SDK_SESSION_POOL_H
+#define GO_SDK_SESSION_POOL_H
+
+#include <GoSdk/GoSdkDef.h>
+#include <GoSdk/GoSystem.h>
+#include <GoSdk/GoSensor.h>
+
+/**
+ * @class   GoSessionPool
+ * @extends kObject
+ * @ingroup GoSdk
+ * @brief   Keeps sensor sessions connected across short-lived acquire/release cycles.
+ *
+ * Applications that handle one part at a time often construct the SDK, a GoSystem
+ * and a sensor connection for every part. A session pool holds a GoSystem and one
+ * connected GoSensor per address, so that GoSessionPool_Acquire returns a ready
+ * sensor without discovery, connection or configuration download.
+ *
+ * The pool periodically checks idle sessions and reconnects sensors that have been
+ * disconnected or stopped sending health messages. A sensor is reconnected on
+ * acquire if the background check has not yet done so.
+ *
+ * Typical usage:
+ *
+ *    GoSdk_Construct(&assembly);
+ *    GoSessionPool_Construct(&pool, kNULL);
+ *    GoSessionPool_EnableData(pool, kTRUE);
+ *    GoSystem_SetDataHandler(GoSessionPool_System(pool), onData, context);
+ *
+ *    for (each part)
+ *    {
+ *        GoSessionPool_Acquire(pool, &address, &sensor);
+ *        GoSensor_Snapshot(sensor);
+ *        ...
+ *        GoSessionPool_Release(pool, sensor);
+ *    }
+ *
+ *    GoDestroy(pool);
+ *    GoDestroy(assembly);
+ *
+ * The GoSdk assembly should be constructed once, before the pool, and destroyed after
+ * the pool; constructing it per cycle repeats type registration.
+ */
+typedef kObject GoSessionPool;
+
+/**
+ * Constructs a GoSessionPool object.
+ *
+ * @public              @memberof GoSessionPool
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   pool        Receives constructed session pool.
+ * @param   allocator   Memory allocator (or kNULL for default)
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoSessionPool_Construct(GoSessionPool* pool, kAlloc allocator);
+
+/**
+ * Acquires a connected sensor session for the given address.
+ *
+ * The first acquisition for an address connects the sensor; subsequent acquisitions
+ * return the existing connection. A session can be held by one caller at a time.
+ * If the background check is reconnecting the session, this function waits for the
+ * reconnection to finish.
+ *
+ * @public              @memberof GoSessionPool
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   pool        GoSessionPool object.
+ * @param   address     Sensor IP address.
+ * @param   sensor      Receives connected sensor.
+ * @return              Operation status (kERROR_BUSY if the session is already acquired).
+ */
+GoFx(kStatus) GoSessionPool_Acquire(GoSessionPool pool, const kIpAddress* address, GoSensor* sensor);
+
+/**
+ * Returns a sensor session to the pool.
+ *
+ * The sensor remains connected. The sensor is not stopped; callers that start the
+ * sensor should stop it before release if required.
+ *
+ * @public              @memberof GoSessionPool
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   pool        GoSessionPool object.
+ * @param   sensor      Sensor obtained from GoSessionPool_Acquire.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoSessionPool_Release(GoSessionPool pool, GoSensor sensor);
+
+/**
+ * Gets the system object that owns the pooled sensors.
+ *
+ * The system can be used to register data and health handlers. Sensors should be
+ * added to or removed from the pool only through GoSessionPool_Acquire.
+ *
+ * @public              @memberof GoSessionPool
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   pool        GoSessionPool object.
+ * @return              System object.
+ */
+GoFx(GoSystem) GoSessionPool_System(GoSessionPool pool);
+
+/**
+ * Enables or disables data connections for pooled sensors.
+ *
+ * When enabled, data connections are opened on connect and reopened after
+ * reconnection.
+ *
+ * @public              @memberof GoSessionPool
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   pool        GoSessionPool object.
+ * @param   enable      kTRUE to enable data connections.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoSessionPool_EnableData(GoSessionPool pool, kBool enable);
+
+/**
+ * Enables the on-disk configuration cache for pooled sensors.
+ *
+ * @public              @memberof GoSessionPool
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   pool        GoSessionPool object.
+ * @param   directory   Cache directory, or kNULL to disable.
+ * @return              Operation status.
+ * @see                 GoSensor_EnableConfigCache
+ */
+GoFx(kStatus) GoSessionPool_EnableConfigCache(GoSessionPool pool, const kChar* directory);
+
+/**
+ * Reports the number of sensor connections established by the pool.
+ *
+ * The count includes the first connection to each address; any excess over the
+ * number of pooled addresses indicates reconnections.
+ *
+ * @public              @memberof GoSessionPool
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   pool        GoSessionPool object.
+ * @return              Connection count.
+ */
+GoFx(k64u) GoSessionPool_ConnectCount(GoSessionPool pool);
+
+#include <GoSdk/GoSessionPool.x.h>
+
+#endif
@@ -0,0 +1,58 @@
+/**
+ * @file    GoSessionPool.x.h
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef GO_SDK_SESSION_POOL_X_H
+#define GO_SDK_SESSION_POOL_X_H
+
+#include <kApi/Data/kArrayList.h>
+#include <kApi/Threads/kLock.h>
+#include <kApi/Threads/kPeriodic.h>
+#include <kApi/Threads/kSemaphore.h>
+
+#define GO_SESSION_POOL_HEALTH_CHECK_PERIOD         (1000000)           //period of background session check (us)
+
+typedef struct GoSessionPoolEntry
+{
+    kIpAddress address;                         //sensor address
+    GoSensor sensor;                            //pooled sensor (owned by system)
+    kBool inUse;                                //session is currently acquired
+    kBool reconnecting;                         //session is being reconnected by the health check
+} GoSessionPoolEntry;
+
+kDeclareValueEx(Go, GoSessionPoolEntry, kValue)
+
+typedef struct GoSessionPoolClass
+{
+    kObjectClass base;
+
+    kLock lock;                                 //protects session list
+    GoSystem system;                            //system owning pooled sensors
+    kArrayList sessions;                        //list of sessions (kArrayList<GoSessionPoolEntry>)
+    kPeriodic healthCheck;                      //periodically reconnects idle sessions
+    kSemaphore reconnected;                     //posted for each waiter when a reconnection ends
+    kSize reconnectWaiters;                     //count of acquirers waiting for a reconnection
+    kBool dataEnabled;                          //open data connections for pooled sensors
+    kText256 cacheDirectory;                    //configuration cache directory (empty if disabled)
+    k64u connectCount;                          //count of connections established
+} GoSessionPoolClass;
+
+kDeclareClassEx(Go, GoSessionPool, kObject)
+
+GoFx(kStatus) GoSessionPool_Init(GoSessionPool pool, kType type, kAlloc alloc);
+GoFx(kStatus) GoSessionPool_VRelease(GoSessionPool pool);
+
+GoFx(GoSessionPoolEntry*) GoSessionPool_FindEntry(GoSessionPool pool, GoSensor sensor);
+GoFx(GoSessionPoolEntry*) GoSessionPool_FindAddress(GoSessionPool pool, const kIpAddress* address);
+GoFx(kStatus) GoSessionPool_AddEntry(GoSessionPool pool, const kIpAddress* address, GoSessionPoolEntry** entry);
+GoFx(kStatus) GoSessionPool_SetInUse(GoSessionPool pool, GoSensor sensor, kBool inUse);
+GoFx(kStatus) GoSessionPool_EndReconnect(GoSessionPool pool, GoSensor sensor);
+GoFx(kBool) GoSessionPool_IsReady(GoSessionPool pool, GoSensor sensor);
+GoFx(kStatus) GoSessionPool_Prepare(GoSessionPool pool, GoSensor sensor);
+GoFx(kStatus) GoSessionPool_OnHealthCheck(GoSessionPool pool, kPeriodic timer);
+
+#endif
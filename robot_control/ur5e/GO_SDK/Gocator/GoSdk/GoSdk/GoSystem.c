@@ -7,6 +7,7 @@
  * Redistributed files must retain the above copyright notice.
  */
 #include <GoSdk/GoSystem.h>
+#include <kApi/Utils/kTrace.h>
 #include <kApi/Utils/kUtils.h>
 
 kBeginClassEx(Go, GoSystem)
@@ -23,6 +24,88 @@ GoFx(kStatus) GoSystem_ConstructEx(GoSystem* system, kAlloc allocator)
     return(GoSystem_ConstructHelper(system, kFALSE, allocator));
 }
 
+GoFx(kStatus) GoSystem_ConstructDirect(GoSystem* system, const kIpAddress* addresses, kSize count, kAlloc allocator)
+{
+    kStatus status;
+    kSize i;
+
+    kCheckArgs(!kIsNull(addresses) || (count == 0));
+
+    kCheck(GoSystem_ConstructHelper(system, kFALSE, allocator));
+
+    kTry
+    {
+        kObjN(GoSystem, obj, *system);
+
+        obj->discoveryDeferred = kTRUE;
+
+        for (i = 0; i < count; ++i)
+        {
+            kTest(GoSystem_AddDirectSensor(*system, addresses[i]));
+        }
+    }
+    kCatch(&status)
+    {
+        kDestroyRef(system);
+        kEndCatch(status);
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSystem_AddDirectSensor(GoSystem system, kIpAddress address)
+{
+    kObj(GoSystem, system);
+    GoSensor sensor = kNULL;
+    GoSensor added = kNULL;
+
+    if (kSuccess(GoSystem_FindSensorByIpAddress(system, &address, &sensor)))
+    {
+        return kOK;
+    }
+
+    kLock_Enter(obj->stateLock);
+
+    kTry
+    {
+        kTest(GoSensor_Construct(&sensor, system, kNULL, kObject_Alloc(system)));
+        kTest(GoSensor_SetDirectAddress(sensor, address));
+
+        kTest(kArrayList_AddT(obj->allSensors, &sensor));
+        added = sensor;
+        sensor = kNULL;
+
+        kTest(kArrayList_AddT(obj->onlineSensors, &added));
+    }
+    kFinally
+    {
+        kObject_Destroy(sensor);
+        kLock_Exit(obj->stateLock);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSystem_Dispatcher(GoSystem system, GoControlDispatcher* dispatcher)
+{
+    kObj(GoSystem, system);
+    kStatus status = kOK;
+
+    kLock_Enter(obj->stateLock);
+    {
+        if (kIsNull(obj->dispatcher))
+        {
+            status = GoControlDispatcher_Construct(&obj->dispatcher, kObject_Alloc(system));
+        }
+
+        *dispatcher = obj->dispatcher;
+    }
+    kLock_Exit(obj->stateLock);
+
+    return status;
+}
+
 GoFx(kStatus) GoSystem_ConstructHelper(GoSystem* system, kBool enableAutoDiscovery, kAlloc allocator)
 {
     kAlloc alloc = kAlloc_Fallback(allocator);
@@ -47,10 +130,14 @@ GoFx(kStatus) GoSystem_Init(GoSystem system, kType type, kBool enableAutoDiscove
     kZero(obj->stateLock);
     kZero(obj->timer);
     obj->discovery = kNULL;
+    obj->discoveryDeferred = kFALSE;
+    obj->discoveryDuration = 0;
     kZero(obj->healthCheck);
     kZero(obj->allSensors);
     kZero(obj->onlineSensors);
     kZero(obj->tempList);
+    obj->sensorPool = kNULL;
+    obj->dispatcher = kNULL;
     obj->dataQuit = kFALSE;
     kZero(obj->dataQueue);
     kZero(obj->dataThread);
@@ -61,11 +148,13 @@ GoFx(kStatus) GoSystem_Init(GoSystem system, kType type, kBool enableAutoDiscove
     kZero(obj->healthThread);
     obj->onHealth.function = kNULL;
     obj->onHealth.receiver = kNULL;
+    obj->healthTable = kNULL;
     kZero(obj->bankList);
 
     kTry
     {
         kTest(kLock_Construct(&obj->stateLock, alloc));
+        kTest(kLock_SetName(obj->stateLock, "GoSystem.stateLock"));
         kTest(kTimer_Construct(&obj->timer, alloc));
 
         kTest(GoDiscovery_Construct(&obj->discovery, enableAutoDiscovery, alloc));
@@ -82,16 +171,23 @@ GoFx(kStatus) GoSystem_Init(GoSystem system, kType type, kBool enableAutoDiscove
         kTest(kArrayList_Construct(&obj->tempList, kTypeOf(GoSensor), 0, alloc));
 
         kTest(kMsgQueue_Construct(&obj->dataQueue, kTypeOf(GoDataSet), alloc));
+        kTest(kMsgQueue_SetName(obj->dataQueue, "GoSystem.dataQueue"));
         kTest(kMsgQueue_SetMaxSize(obj->dataQueue, GO_SYSTEM_DEFAULT_DATA_CAPACITY));
         kTest(kMsgQueue_Construct(&obj->healthQueue, kTypeOf(GoDataSet), alloc));
+        kTest(kMsgQueue_SetName(obj->healthQueue, "GoSystem.healthQueue"));
         kTest(kMsgQueue_SetMaxSize(obj->healthQueue, GO_SYSTEM_DEFAULT_HEALTH_CAPACITY));
+        kTest(GoHealthTable_Construct(&obj->healthTable, system, alloc));
 
         kTest(kPeriodic_Start(obj->healthCheck, GO_SYSTEM_HEALTH_CHECK_PERIOD, GoSystem_OnHealthCheck, system));
 
         if (enableAutoDiscovery)
         {
+            k64u startTime = kTimer_Now();
+
             kTest(GoDiscovery_StartEnum(obj->discovery, kTRUE));
             kTest(GoSystem_Refresh(system));
+
+            obj->discoveryDuration = kTimer_Now() - startTime;
         }
     }
     kCatch(&status)
@@ -118,16 +214,19 @@ GoFx(kStatus) GoSystem_VRelease(GoSystem system)
     kCheck(kDestroyRef(&obj->healthCheck));
     kCheck(GoDiscovery_StopEnum(obj->discovery));
     kCheck(kDestroyRef(&obj->discovery));
+    kCheck(kDestroyRef(&obj->sensorPool));
 
     kCheck(kDestroyRef(&obj->onlineSensors)); //under normal circumstances, kDisposeRef would be called
                                                 //on these allSensors and onlineSensors lists, but they share
                                                 //GoSensor objects
     kCheck(kDisposeRef(&obj->allSensors));
+    kCheck(kDestroyRef(&obj->dispatcher));      //after sensors, which unregister from the dispatcher on release
     kCheck(kDestroyRef(&obj->tempList));
     kCheck(kDestroyRef(&obj->bankList));
 
     kCheck(kDisposeRef(&obj->dataQueue));
     kCheck(kDisposeRef(&obj->healthQueue));
+    kCheck(kDestroyRef(&obj->healthTable));
 
     kCheck(kDestroyRef(&obj->timer));
     kCheck(kDestroyRef(&obj->stateLock));
@@ -159,9 +258,11 @@ GoFx(kStatus) GoSystem_OnDiscovery(GoSystem system, GoDiscovery discovery, kArra
         for (i = 0; i < incomingCount; ++i)
         {
             GoDiscoveryInfo* discInfo = kArrayList_AtT(list, i, GoDiscoveryInfo);
+            GoAddressInfo address = GoDiscoveryInfo_Address(discInfo);
             GoSensor sensor = kNULL;
 
-            if (!kSuccess(GoSystem_FindSensorAll(system, discInfo->id, &sensor)))
+            if (!kSuccess(GoSystem_FindSensorAll(system, discInfo->id, &sensor)) &&
+                !kSuccess(GoSystem_FindDirectSensor(system, &address.address, &sensor)))
             {
                 kTest(GoSensor_Construct(&newSensor, system, discInfo, kObject_Alloc(system)));
                 kTest(kArrayList_AddT(obj->allSensors, &newSensor));
@@ -245,38 +346,138 @@ GoFx(kBool) GoSystem_HasChanges(GoSystem system)
     return hasChanges;
 }
 
-GoFx(kStatus) GoSystem_SensorRefreshAll(GoSystem system)
+GoFx(kStatus) GoSystem_SensorRefreshAll(GoSystem system, kArrayList results)
 {
     kObj(GoSystem, system);
-    kSize i = 0;
 
-    for (i = 0; i < kArrayList_Count(obj->allSensors); ++i)
+    kLock_Enter(obj->stateLock);
     {
-        kCheck(GoSensor_Refresh(kArrayList_AsT(obj->allSensors, i, GoSensor)));
+        kArrayList_Assign(obj->tempList, obj->allSensors);
     }
+    kLock_Exit(obj->stateLock);
+
+    kCheck(GoSystem_ForEachSensor(system, obj->tempList, GoSensor_Refresh, results));
 
     return kOK;
 }
 
-GoFx(kStatus) GoSystem_Refresh(GoSystem system)
+GoFx(kStatus) GoSystem_ForEachSensor(GoSystem system, kArrayList sensors, GoSystemSensorFx function, kArrayList results)
 {
     kObj(GoSystem, system);
-    kArrayList infoList = kNULL;
+    kAlloc alloc = kObject_Alloc(system);
+    kSize count = kArrayList_Count(sensors);
+    GoSystemSensorTask* tasks = kNULL;
+    kSize scheduled = 0;
+    kStatus result = kOK;
+    kSize i;
+
+    if (!kIsNull(results))
+    {
+        kCheck(kArrayList_Allocate(results, kTypeOf(GoSensorResult), count));
+    }
+
+    if (count == 0)
+    {
+        return kOK;
+    }
+
+    //sensor operations mostly wait on control round trips, so the pool is sized to run all of them at once
+    if (kIsNull(obj->sensorPool) || (kThreadPool_Count(obj->sensorPool) < count))
+    {
+        kCheck(kDestroyRef(&obj->sensorPool));
+        kCheck(kThreadPool_Construct(&obj->sensorPool, count, alloc));
+    }
+
+    kCheck(kAlloc_GetZero(alloc, count*sizeof(GoSystemSensorTask), &tasks));
 
     kTry
     {
-        kTest(kArrayList_Construct(&infoList, kTypeOf(GoDiscoveryInfo), 10, kNULL));
+        for (i = 0; i < count; ++i)
+        {
+            GoSystemSensorTask* task = &tasks[i];
 
-        kTest(GoDiscovery_Enumerate(obj->discovery, infoList));
-        kTest(GoSystem_OnDiscovery(system, obj->discovery, infoList));
+            task->sensor = kArrayList_AsT(sensors, i, GoSensor);
+            task->function = function;
+            task->status = kERROR_ABORT;
+
+            kTest(kThreadPool_BeginExecute(obj->sensorPool, GoSystem_SensorTaskEntry, task, &task->transaction));
+            scheduled++;
+        }
     }
     kFinally
     {
-        kCheck(kObject_Destroy(infoList));
+        for (i = 0; i < scheduled; ++i)
+        {
+            kThreadPool_EndExecute(obj->sensorPool, tasks[i].transaction, kINFINITE, kNULL);
+        }
+
+        for (i = 0; i < count; ++i)
+        {
+            GoSystemSensorTask* task = &tasks[i];
+
+            if (!kIsNull(results))
+            {
+                GoSensorResult item;
+
+                item.id = GoSensor_Id(task->sensor);
+                item.status = task->status;
+                item.duration = task->duration;
+
+                kArrayList_AddT(results, &item);
+            }
+
+            if (kSuccess(result) && !kSuccess(task->status))
+            {
+                result = task->status;
+            }
+        }
+
+        kAlloc_Free(alloc, tasks);
+
         kEndFinally();
     }
 
-    kCheck(GoSystem_SensorRefreshAll(system));
+    return result;
+}
+
+GoFx(kStatus) GoSystem_SensorTaskEntry(kPointer context)
+{
+    GoSystemSensorTask* task = context;
+    k64u startTime = kTimer_Now();
+
+    task->status = task->function(task->sensor);
+    task->duration = kTimer_Now() - startTime;
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSystem_Refresh(GoSystem system)
+{
+    return GoSystem_RefreshEx(system, kNULL);
+}
+
+GoFx(kStatus) GoSystem_RefreshEx(GoSystem system, kArrayList results)
+{
+    kObj(GoSystem, system);
+    kArrayList infoList = kNULL;
+
+    if (!obj->discoveryDeferred)
+    {
+        kTry
+        {
+            kTest(kArrayList_Construct(&infoList, kTypeOf(GoDiscoveryInfo), 10, kNULL));
+
+            kTest(GoDiscovery_Enumerate(obj->discovery, infoList));
+            kTest(GoSystem_OnDiscovery(system, obj->discovery, infoList));
+        }
+        kFinally
+        {
+            kCheck(kObject_Destroy(infoList));
+            kEndFinally();
+        }
+    }
+
+    kCheck(GoSystem_SensorRefreshAll(system, results));
 
     kCheck(GoSystem_RefreshSensorList(system));
 
@@ -301,6 +502,7 @@ GoFx(kStatus) GoSystem_RefreshSensorList(GoSystem system)
 
             if (state == GO_STATE_OFFLINE)
             {
+                kTest(GoHealthTable_RemoveSensor(obj->healthTable, (k32u)GoSensor_Id(sensor)));
                 kTest(kArrayList_Discard(obj->allSensors, i));
                 kTest(kObject_Destroy(sensor));
             }
@@ -321,13 +523,42 @@ GoFx(kStatus) GoSystem_RefreshSensorList(GoSystem system)
 }
 
 GoFx(kStatus) GoSystem_Connect(GoSystem system)
+{
+    return GoSystem_ConnectEx(system, kNULL);
+}
+
+GoFx(kStatus) GoSystem_ConnectEx(GoSystem system, kArrayList results)
 {
     kObj(GoSystem, system);
-    kSize i;
 
-    for (i = 0; i < kArrayList_Count(obj->onlineSensors); ++i)
+    kCheck(kArrayList_Assign(obj->tempList, obj->onlineSensors));
+
+    kCheck(GoSystem_ForEachSensor(system, obj->tempList, GoSensor_Connect, results));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSystem_Flush(GoSystem system)
+{
+    return GoSystem_FlushEx(system, kNULL);
+}
+
+GoFx(kStatus) GoSystem_FlushEx(GoSystem system, kArrayList results)
+{
+    kObj(GoSystem, system);
+
+    kCheck(kArrayList_Assign(obj->tempList, obj->onlineSensors));
+
+    kCheck(GoSystem_ForEachSensor(system, obj->tempList, GoSystem_FlushSensor, results));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSystem_FlushSensor(GoSensor sensor)
+{
+    if (GoSensor_IsConnected(sensor) && GoSensor_IsConfigurable(sensor))
     {
-        kCheck(GoSensor_Connect(kArrayList_AsT(obj->onlineSensors, i, GoSensor)));
+        kCheck(GoSensor_Flush(sensor));
     }
 
     return kOK;
@@ -501,29 +732,27 @@ GoFx(kStatus) GoSystem_StartExposureAutoSet(GoSystem system)
 }
 
 GoFx(kStatus) GoSystem_Stop(GoSystem system)
+{
+    return GoSystem_StopEx(system, kNULL);
+}
+
+GoFx(kStatus) GoSystem_StopEx(GoSystem system, kArrayList results)
 {
     kObj(GoSystem, system);
-    kSize i;
 
-    kCheck(kArrayList_Allocate(obj->tempList, kTypeOf(GoSensor), 0));
+    kCheck(kArrayList_Assign(obj->tempList, obj->onlineSensors));
 
-    for (i = 0; i < kArrayList_Count(obj->onlineSensors); ++i)
-    {
-        GoSensor sensor = kArrayList_AsT(obj->onlineSensors, i, GoSensor);
+    kCheck(GoSystem_ForEachSensor(system, obj->tempList, GoSystem_StopSensor, results));
 
-        if (GoSensor_IsConnected(sensor)
-            && GoSensor_IsResponsive(sensor))
-        {
-            kCheck(GoSensor_BeginStop(sensor));
-            kCheck(kArrayList_AddT(obj->tempList, &sensor));
-        }
-    }
+    return kOK;
+}
 
-    for (i = 0; i < kArrayList_Count(obj->tempList); ++i)
+GoFx(kStatus) GoSystem_StopSensor(GoSensor sensor)
+{
+    if (GoSensor_IsConnected(sensor)
+        && GoSensor_IsResponsive(sensor))
     {
-        GoSensor sensor = kArrayList_AsT(obj->tempList, i, GoSensor);
-
-        kCheck(GoSensor_EndStop(sensor));
+        kCheck(GoSensor_Stop(sensor));
     }
 
     return kOK;
@@ -575,6 +804,70 @@ GoFx(kStatus) GoSystem_Cancel(GoSystem system)
     return kOK;
 }
 
+GoFx(kStatus) GoSystem_UploadFile(GoSystem system, const GoSensor* sensors, kSize count, const kChar* sourcePath, const kChar* destName,
+                                  kStatus* results, GoTransferFx progress, kPointer receiver)
+{
+    kAlloc alloc = kObject_Alloc(system);
+    GoSystemUploadJob* jobs = kNULL;
+    kStatus result = kOK;
+    kSize i;
+
+    kCheckArgs(!kIsNull(sensors) || (count == 0));
+
+    kCheck(kAlloc_GetZero(alloc, kMax_(count, 1)*sizeof(GoSystemUploadJob), &jobs));
+
+    kTry
+    {
+        for (i = 0; i < count; ++i)
+        {
+            GoSystemUploadJob* job = &jobs[i];
+
+            job->sensor = sensors[i];
+            job->sourcePath = sourcePath;
+            job->destName = destName;
+            job->progress = progress;
+            job->receiver = receiver;
+            job->status = kERROR_ABORT;
+
+            kTest(kThread_Construct(&job->thread, alloc));
+            kTest(kThread_Start(job->thread, GoSystem_UploadThreadEntry, job));
+        }
+    }
+    kFinally
+    {
+        //threads release only after their uploads complete
+        for (i = 0; i < count; ++i)
+        {
+            kDestroyRef(&jobs[i].thread);
+
+            if (!kIsNull(results))
+            {
+                results[i] = jobs[i].status;
+            }
+
+            if (kSuccess(result) && !kSuccess(jobs[i].status))
+            {
+                result = jobs[i].status;
+            }
+        }
+
+        kAlloc_Free(alloc, jobs);
+
+        kEndFinally();
+    }
+
+    return result;
+}
+
+GoFx(kStatus) GoSystem_UploadThreadEntry(kPointer context)
+{
+    GoSystemUploadJob* job = context;
+
+    job->status = GoSensor_UploadFileEx(job->sensor, job->sourcePath, job->destName, job->progress, job->receiver);
+
+    return kOK;
+}
+
 GoFx(kSize) GoSystem_SensorCount(GoSystem system)
 {
     kObj(GoSystem, system);
@@ -650,6 +943,27 @@ GoFx(kStatus) GoSystem_FindSensorAll(GoSystem system, kSize id, GoSensor* sensor
     return kERROR_NOT_FOUND;
 }
 
+// Finds a sensor that was added by address and whose id is not yet known.
+GoFx(kStatus) GoSystem_FindDirectSensor(GoSystem system, const kIpAddress* address, GoSensor* sensor)
+{
+    kObj(GoSystem, system);
+    kSize i;
+
+    for (i = 0; i < kArrayList_Count(obj->allSensors); ++i)
+    {
+        GoSensor sensorAt = kArrayList_AsT(obj->allSensors, i, GoSensor);
+
+        if (GoSensor_IsDirect(sensorAt) && (GoSensor_Id(sensorAt) == 0) &&
+            kIpAddress_Equals(GoSensor_AddressInfo(sensorAt)->address, *address))
+        {
+            *sensor = sensorAt;
+            return kOK;
+        }
+    }
+
+    return kERROR_NOT_FOUND;
+}
+
 GoFx(kStatus) GoSystem_Timestamp(GoSystem system, k64u* time)
 {
     kObj(GoSystem, system);
@@ -794,8 +1108,13 @@ GoFx(kStatus) GoSystem_ClearData(GoSystem system)
 GoFx(kStatus) GoSystem_ReceiveData(GoSystem system, GoDataSet* data, k64u timeout)
 {
     kObj(GoSystem, system);
+    kStatus status;
+
+    kTrace_Begin("GoSystem.ReceiveData");
+    status = kMsgQueue_RemoveT(obj->dataQueue, data, timeout);
+    kTrace_End("GoSystem.ReceiveData");
 
-    return kMsgQueue_RemoveT(obj->dataQueue, data, timeout);
+    return status;
 }
 
 GoFx(kStatus) GoSystem_DataThreadEntry(GoSystem system)
@@ -808,7 +1127,11 @@ GoFx(kStatus) GoSystem_DataThreadEntry(GoSystem system)
     {
         if (kSuccess(status = kMsgQueue_RemoveT(obj->dataQueue, &data, GO_SYSTEM_QUIT_QUERY_INTERVAL)))
         {
-            kCheck(obj->onData.function(obj->onData.receiver, system, data));
+            kTrace_Begin("GoSystem.DataHandler");
+            status = obj->onData.function(obj->onData.receiver, system, data);
+            kTrace_End("GoSystem.DataHandler");
+
+            kCheck(status);
         }
         else if (status != kERROR_TIMEOUT)
         {
@@ -820,10 +1143,52 @@ GoFx(kStatus) GoSystem_DataThreadEntry(GoSystem system)
 }
 
 GoFx(kStatus) GoSystem_OnData(GoSystem system, GoSensor sensor, GoDataSet data)
+{
+    kObj(GoSystem, system);
+    kStatus status;
+
+    kTrace_Begin("GoSystem.OnData");
+    status = kMsgQueue_AddT(obj->dataQueue, &data);
+    kTrace_End("GoSystem.OnData");
+
+    return status;
+}
+
+GoFx(kStatus) GoSystem_DataQueueStats(GoSystem system, GoDataStats* stats)
 {
     kObj(GoSystem, system);
 
-    kCheck(kMsgQueue_AddT(obj->dataQueue, &data));
+    stats->queueHighWatermark = kMsgQueue_HighWatermark(obj->dataQueue);
+    stats->dropCount = kMsgQueue_DropCount(obj->dataQueue);
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSystem_DataStats(GoSystem system, GoDataStats* stats)
+{
+    kObj(GoSystem, system);
+    GoSensorDataCounters total;
+    kSize i;
+
+    kZero(total);
+
+    kLock_Enter(obj->stateLock);
+
+    kTry
+    {
+        for (i = 0; i < kArrayList_Count(obj->allSensors); ++i)
+        {
+            kTest(GoSensor_AddDataCounters(kArrayList_AsT(obj->allSensors, i, GoSensor), &total));
+        }
+    }
+    kFinally
+    {
+        kLock_Exit(obj->stateLock);
+        kEndFinally();
+    }
+
+    kCheck(GoSensor_FormatDataStats(&total, stats));
+    kCheck(GoSystem_DataQueueStats(system, stats));
 
     return kOK;
 }
@@ -883,6 +1248,34 @@ GoFx(kStatus) GoSystem_ClearHealth(GoSystem system)
     return kOK;
 }
 
+GoFx(kStatus) GoSystem_HealthValue(GoSystem system, k32u sensorId, k32u id, k32u instance, k64s* value)
+{
+    kObj(GoSystem, system);
+
+    return GoHealthTable_Value(obj->healthTable, sensorId, id, instance, value);
+}
+
+GoFx(kStatus) GoSystem_HealthDelta(GoSystem system, k32u sensorId, k32u id, k32u instance, k64s* delta)
+{
+    kObj(GoSystem, system);
+
+    return GoHealthTable_Delta(obj->healthTable, sensorId, id, instance, delta);
+}
+
+GoFx(kStatus) GoSystem_AddHealthWatch(GoSystem system, k32u sensorId, k32u id, k32u instance, k64s threshold, GoHealthCrossingFx function, kPointer receiver)
+{
+    kObj(GoSystem, system);
+
+    return GoHealthTable_AddWatch(obj->healthTable, sensorId, id, instance, threshold, function, receiver);
+}
+
+GoFx(kStatus) GoSystem_RemoveHealthWatch(GoSystem system, GoHealthCrossingFx function, kPointer receiver)
+{
+    kObj(GoSystem, system);
+
+    return GoHealthTable_RemoveWatch(obj->healthTable, function, receiver);
+}
+
 GoFx(kStatus) GoSystem_HealthThreadEntry(GoSystem system)
 {
     kObj(GoSystem, system);
@@ -907,10 +1300,14 @@ GoFx(kStatus) GoSystem_HealthThreadEntry(GoSystem system)
 GoFx(kStatus) GoSystem_OnHealth(GoSystem system, GoSensor sensor, GoDataSet health)
 {
     kObj(GoSystem, system);
+    kStatus status;
+
+    //the table must be updated before the message set is handed over to the application
+    status = GoHealthTable_Update(obj->healthTable, GoSensor_Id(sensor), health);
 
     kCheck(kMsgQueue_AddT(obj->healthQueue, &health));
 
-    return kOK;
+    return status;
 }
 
 GoFx(kSize) GoSystem_MultiplexBankCount(GoSystem system)
@@ -1251,15 +1648,59 @@ GoFx(kBool) GoSystem_DiscoveryCompatibilityEnabled(GoSystem system)
     return GoDiscovery_CompatModeEnabled(obj->discovery);
 }
 
+GoFx(kStatus) GoSystem_EnableDiscoveryCache(GoSystem system, const kChar* path)
+{
+    kObj(GoSystem, system);
+
+    return GoDiscovery_EnableCache(obj->discovery, path);
+}
+
 GoFx(kStatus) GoSystem_StartDiscovery(GoSystem system)
 {
     kObj(GoSystem, system);
+    k64u startTime = kTimer_Now();
+
+    obj->discoveryDeferred = kFALSE;
 
     kCheck(GoDiscovery_StartEnum(obj->discovery, kTRUE));
 
-    kCheck(GoSystem_SensorRefreshAll(system));
+    kCheck(GoSystem_SensorRefreshAll(system, kNULL));
 
     kCheck(GoSystem_RefreshSensorList(system));
 
+    obj->discoveryDuration = kTimer_Now() - startTime;
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSystem_StartBackgroundDiscovery(GoSystem system)
+{
+    kObj(GoSystem, system);
+
+    obj->discoveryDeferred = kFALSE;
+
+    kCheck(GoDiscovery_StartEnum(obj->discovery, kFALSE));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoSystem_StartupTimes(GoSystem system, GoStartupTimes* times)
+{
+    kObj(GoSystem, system);
+    k64u connect, configRead;
+    kSize i;
+
+    times->discovery = obj->discoveryDuration;
+    times->connect = 0;
+    times->configRead = 0;
+
+    for (i = 0; i < kArrayList_Count(obj->onlineSensors); ++i)
+    {
+        kCheck(GoSensor_ConnectionTimes(kArrayList_AsT(obj->onlineSensors, i, GoSensor), &connect, &configRead));
+
+        times->connect = kMax_(times->connect, connect);
+        times->configRead = kMax_(times->configRead, configRead);
+    }
+
     return kOK;
 }
@@ -95,12 +95,39 @@ GoFx(kStatus) GoSystem_Construct(GoSystem* system, kAlloc allocator);
 */
 GoFx(kStatus) GoSystem_ConstructEx(GoSystem* system, kAlloc allocator);
 
+/**
+* Constructs a GoSystem object for sensors at known addresses.
+*
+* No discovery broadcast is sent and construction does not wait for discovery replies; 
+* one sensor object is created per address and can be connected immediately with 
+* GoSystem_Connect. While connected, sensor presence is tracked using health messages. 
+* 
+* Discovery can be started later with GoSystem_StartDiscovery or 
+* GoSystem_StartBackgroundDiscovery. Discovery replies are matched to direct sensors 
+* by address until the sensor id is known, so no duplicate sensor entries are created.
+* While discovery runs, a direct sensor that has been reached before (by connection or 
+* by discovery) but neither replies to discovery nor has a responsive connection is 
+* reported as offline after a few discovery cycles, and is removed by the next 
+* GoSystem_Refresh. Direct sensors that have never been reached are kept.
+*
+* @public              @memberof GoSystem
+* @version             Introduced in firmware 6.4.41.x
+* @param   system      Receives constructed system object.
+* @param   addresses   Array of sensor IP addresses.
+* @param   count       Count of addresses.
+* @param   allocator   Memory allocator (or kNULL for default)
+* @return              Operation status.
+*/
+GoFx(kStatus) GoSystem_ConstructDirect(GoSystem* system, const kIpAddress* addresses, kSize count, kAlloc allocator);
+
 /**
  * Establishes control connections to all sensors.
  *
  * A control connection is required before calling any sensor function except GoSensor_State,
  * GoSensor_Address, or GoSensor_SetAddress.
  *
+ * Sensors are connected concurrently; see GoSystem_ConnectEx.
+ *
  * @public              @memberof GoSystem
  * @version             Introduced in firmware 4.0.10.27
  * @param   system      GoSystem object.
@@ -108,6 +135,22 @@ GoFx(kStatus) GoSystem_ConstructEx(GoSystem* system, kAlloc allocator);
  */
 GoFx(kStatus) GoSystem_Connect(GoSystem system);
 
+/**
+ * Establishes control connections to all sensors and reports the outcome for each sensor.
+ *
+ * Sensors are connected concurrently, so that the total connection time is governed by the slowest
+ * sensor rather than by the sum over all sensors. A connection is attempted for every sensor, even
+ * if another sensor fails to connect.
+ *
+ * @public              @memberof GoSystem
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   system      GoSystem object.
+ * @param   results     Optionally receives one entry per sensor (kArrayList<GoSensorResult>; can be kNULL).
+ * @return              Operation status; the first failed connection status, if any.
+ * @see                 GoSystem_Connect
+ */
+GoFx(kStatus) GoSystem_ConnectEx(GoSystem system, kArrayList results);
+
 /**
  * Terminates control connections to all sensors.
  *
@@ -171,6 +214,48 @@ GoFx(kBool) GoSystem_HasChanges(GoSystem system);
  */
 GoFx(kStatus) GoSystem_Refresh(GoSystem system);
 
+/**
+ * Updates client state to reflect any changes that have occurred in the sensor network, and
+ * reports the outcome of refreshing each sensor.
+ *
+ * Sensors are refreshed concurrently. The results list describes the sensors that were known
+ * before the refresh; sensors that are found to be offline are subsequently removed from the system.
+ *
+ * @public              @memberof GoSystem
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   system      GoSystem object.
+ * @param   results     Optionally receives one entry per sensor (kArrayList<GoSensorResult>; can be kNULL).
+ * @return              Operation status.
+ * @see                 GoSystem_Refresh
+ */
+GoFx(kStatus) GoSystem_RefreshEx(GoSystem system, kArrayList results);
+
+/**
+ * Writes any locally modified configuration to all connected sensors.
+ *
+ * Sensor configuration changes are normally written to a sensor on demand, before the next operation
+ * that depends on them. This function flushes the changes for all sensors concurrently, which can
+ * shorten the time taken by a subsequent GoSystem_Start in multi-sensor systems.
+ *
+ * @public              @memberof GoSystem
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   system      GoSystem object.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoSystem_Flush(GoSystem system);
+
+/**
+ * Writes any locally modified configuration to all connected sensors and reports the outcome for each sensor.
+ *
+ * @public              @memberof GoSystem
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   system      GoSystem object.
+ * @param   results     Optionally receives one entry per sensor (kArrayList<GoSensorResult>; can be kNULL).
+ * @return              Operation status; the first failed flush status, if any.
+ * @see                 GoSystem_Flush
+ */
+GoFx(kStatus) GoSystem_FlushEx(GoSystem system, kArrayList results);
+
 /**
  * Reports the Gocator Protocol version implemented by this library.
  *
@@ -360,6 +445,87 @@ GoFx(kStatus) GoSystem_ReceiveHealth(GoSystem system, GoDataSet* data, k64u time
  */
 GoFx(kStatus) GoSystem_ClearHealth(GoSystem system);
 
+/**
+ * Gets the most recent value of a sensor health indicator.
+ *
+ * The system keeps the latest value of every health indicator reported by its sensors, updated
+ * as health messages arrive. This function reads that table directly, so health messages do not
+ * need to be received and searched with GoHealthMsg_Find to monitor individual indicators.
+ *
+ * @public              @memberof GoSystem
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   system      GoSystem object.
+ * @param   sensorId    Serial number of the sensor.
+ * @param   id          Indicator ID (e.g. GO_HEALTH_CPU_USED).
+ * @param   instance    Indicator instance.
+ * @param   value       Receives the indicator value.
+ * @return              Operation status (kERROR_NOT_FOUND if the indicator has not been reported).
+ * @see                 GoSystem_HealthDelta, GoSystem_AddHealthWatch
+ */
+GoFx(kStatus) GoSystem_HealthValue(GoSystem system, k32u sensorId, k32u id, k32u instance, k64s* value);
+
+/**
+ * Gets the change in a sensor health indicator since the previous call to this function for
+ * the same indicator.
+ *
+ * The first call for an indicator reports the change since the indicator was first reported.
+ * This is typically used with counters, such as GO_HEALTH_PROCESSING_DROPS.
+ *
+ * @public              @memberof GoSystem
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   system      GoSystem object.
+ * @param   sensorId    Serial number of the sensor.
+ * @param   id          Indicator ID (e.g. GO_HEALTH_PROCESSING_DROPS).
+ * @param   instance    Indicator instance.
+ * @param   delta       Receives the change in the indicator value.
+ * @return              Operation status (kERROR_NOT_FOUND if the indicator has not been reported).
+ * @see                 GoSystem_HealthValue
+ */
+GoFx(kStatus) GoSystem_HealthDelta(GoSystem system, k32u sensorId, k32u id, k32u instance, k64s* delta);
+
+/**
+ * Registers a callback function to be invoked when a sensor health indicator crosses a threshold.
+ *
+ * The callback is invoked when the indicator rises from below the threshold to a value at or above
+ * it, or falls from at or above the threshold to a value below it. If the first reported value of
+ * the indicator is at or above the threshold, this is also reported as a rising crossing.
+ *
+ * Callbacks are invoked on the health receiver thread of the reporting sensor.
+ *
+ * The most recent indicator values of a sensor are dropped when GoSystem_Refresh removes the
+ * sensor. Watches are kept, so that they apply again if the sensor returns.
+ *
+ * @public              @memberof GoSystem
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   system      GoSystem object.
+ * @param   sensorId    Serial number of the sensor.
+ * @param   id          Indicator ID (e.g. GO_HEALTH_TEMPERATURE).
+ * @param   instance    Indicator instance.
+ * @param   threshold   Threshold value.
+ * @param   function    Callback function.
+ * @param   receiver    Receiver argument, passed to callback.
+ * @return              Operation status.
+ * @see                 GoHealthCrossingFx, GoSystem_RemoveHealthWatch
+ */
+GoFx(kStatus) GoSystem_AddHealthWatch(GoSystem system, k32u sensorId, k32u id, k32u instance, k64s threshold, GoHealthCrossingFx function, kPointer receiver);
+
+/**
+ * Unregisters all health threshold callbacks that match the given function and receiver.
+ *
+ * If a matching callback is running on another thread, this function waits for it to return;
+ * after this function returns, the callbacks are not invoked again. The function can be called
+ * from within a callback. It must not be called while holding a lock that callbacks acquire.
+ *
+ * @public              @memberof GoSystem
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   system      GoSystem object.
+ * @param   function    Callback function.
+ * @param   receiver    Receiver argument.
+ * @return              Operation status.
+ * @see                 GoSystem_AddHealthWatch
+ */
+GoFx(kStatus) GoSystem_RemoveHealthWatch(GoSystem system, GoHealthCrossingFx function, kPointer receiver);
+
 /**
  * Starts all sensors that are currently in the <em>ready</em> state.
  *
@@ -437,6 +603,21 @@ GoFx(kStatus) GoSystem_StartExposureAutoSet(GoSystem system);
  */
 GoFx(kStatus) GoSystem_Stop(GoSystem system);
 
+/**
+ * Stops all connected sensors and reports the outcome for each sensor.
+ *
+ * Sensors are stopped concurrently. Sensors that are not connected, or that are not responsive,
+ * are skipped and reported with status kOK.
+ *
+ * @public              @memberof GoSystem
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   system      GoSystem object.
+ * @param   results     Optionally receives one entry per sensor (kArrayList<GoSensorResult>; can be kNULL).
+ * @return              Operation status; the first failed stop status, if any.
+ * @see                 GoSystem_Stop
+ */
+GoFx(kStatus) GoSystem_StopEx(GoSystem system, kArrayList results);
+
 
 /**
  * Reboots all connected sensors.
@@ -465,6 +646,31 @@ GoFx(kStatus) GoSystem_Reset(GoSystem system, kBool wait);
  */
 GoFx(kStatus) GoSystem_Cancel(GoSystem system);
 
+/**
+ * Uploads the same file to several sensors concurrently.
+ *
+ * Each sensor is served by its own thread, using the bounded-memory streaming upload
+ * described in GoSensor_UploadFileEx. The progress callback receives the sensor as sender
+ * and may be invoked concurrently from several threads.
+ *
+ * WARNING! This operation writes to flash storage.
+ * Review the user manual for implications.
+ *
+ * @public                  @memberof GoSystem
+ * @version                 Introduced in firmware 6.4.41.x
+ * @param   system          GoSystem object.
+ * @param   sensors         Array of sensors to receive the file.
+ * @param   count           Count of sensors in the array.
+ * @param   sourcePath      Source file system path for the file to be uploaded.
+ * @param   destName        Destination name for the uploaded file (maximum 63 characters).
+ * @param   results         Optionally receives the status of each upload (can be kNULL).
+ * @param   progress        Optional progress callback (can be kNULL).
+ * @param   receiver        Receiver argument for progress callback.
+ * @return                  Operation status; the first failed upload status, if any.
+ */
+GoFx(kStatus) GoSystem_UploadFile(GoSystem system, const GoSensor* sensors, kSize count, const kChar* sourcePath, const kChar* destName,
+                                  kStatus* results, GoTransferFx progress, kPointer receiver);
+
 /**
  * Gets the Discovery channel information for the given device ID (if the device is present and the command is supported)
  *
@@ -719,6 +925,25 @@ GoFx(kStatus) GoSystem_EnableDiscoveryCompatibility(GoSystem system, kBool enabl
 */
 GoFx(kBool) GoSystem_DiscoveryCompatibilityEnabled(GoSystem system);
 
+/**
+* Enables a file-based cache of the sensors found by discovery.
+*
+* Each discovery cycle collects replies for up to 0.5 seconds, but ends early once all sensors
+* found by the previous cycle have replied with unchanged information, and no other replies arrive
+* for a short quiet period (at least as long as those sensors took to reply). A sensor that replies
+* after that period is found by the next cycle. The cache persists that sensor list across sessions, 
+* so that the first discovery cycle can also end early. To benefit at startup, construct the system 
+* with GoSystem_ConstructEx and enable the cache before calling GoSystem_StartDiscovery.
+*
+* @public              @memberof GoSystem
+* @version             Introduced in firmware 6.4.41.x
+* @param   system      GoSystem object.
+* @param   path        Cache file path (kNULL or empty to disable the cache).
+* @return              Operation status.
+* @see                 GoSystem_StartDiscovery, GoSystem_ConstructEx
+*/
+GoFx(kStatus) GoSystem_EnableDiscoveryCache(GoSystem system, const kChar* path);
+
 /**
 * Start running the Gocator Discovery Protocol to discover sensors. The protocol
 * will run over the interfaces which have enabled to run the protocol.
@@ -730,6 +955,45 @@ GoFx(kBool) GoSystem_DiscoveryCompatibilityEnabled(GoSystem system);
 */
 GoFx(kStatus) GoSystem_StartDiscovery(GoSystem system);
 
+/**
+* Starts the Gocator Discovery Protocol without waiting for the first enumeration 
+* to complete. Discovered sensors appear in the sensor list as replies arrive.
+*
+* @public              @memberof GoSystem
+* @version             Introduced in firmware 6.4.41.x
+* @param   system      GoSystem object.
+* @return              Operation status.
+*/
+GoFx(kStatus) GoSystem_StartBackgroundDiscovery(GoSystem system);
+
+/**
+* Reports how long the system spent in each startup phase.
+*
+* The connect and configuration read durations are the longest among online sensors. 
+* The discovery duration is zero if discovery has not been run synchronously.
+*
+* @public              @memberof GoSystem
+* @version             Introduced in firmware 6.4.41.x
+* @param   system      GoSystem object.
+* @param   times       Receives startup phase durations (us).
+* @return              Operation status.
+*/
+GoFx(kStatus) GoSystem_StartupTimes(GoSystem system, GoStartupTimes* times);
+
+/**
+* Reports data channel counters, combined over all sensors in the system.
+*
+* Counts are summed over sensors; the maximum deserialization time and the jitter are the 
+* largest among sensors. See GoSensor_DataStats for details.
+*
+* @public              @memberof GoSystem
+* @version             Introduced in firmware 6.4.41.x
+* @param   system      GoSystem object.
+* @param   stats       Receives data statistics.
+* @return              Operation status.
+*/
+GoFx(kStatus) GoSystem_DataStats(GoSystem system, GoDataStats* stats);
+
 /**
 * Lock the system state to ensure thread safety while reading/modifying the GoSystem
 * class's list of sensors. Call this to lock the state before retrieving and using
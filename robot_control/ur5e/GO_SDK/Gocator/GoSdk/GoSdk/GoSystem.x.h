@@ -11,9 +11,12 @@
 
 #include <GoSdk/GoSystem.h>
 #include <GoSdk/Internal/GoDiscovery.h>
+#include <GoSdk/Internal/GoControlDispatcher.h>
+#include <GoSdk/Internal/GoHealthTable.h>
 #include <kApi/Threads/kLock.h>
 #include <kApi/Threads/kMsgQueue.h>
 #include <kApi/Threads/kPeriodic.h>
+#include <kApi/Threads/kThreadPool.h>
 
 #define GO_SYSTEM_DISCOVERY_PERIOD                  (2000000)           //period of background discovery check (us)
 #define GO_SYSTEM_HEALTH_CHECK_PERIOD               (2000000)           //period of background health check (us)
@@ -28,6 +31,28 @@
 #define GO_SYSTEM_RESET_TIMEOUT                     (90000000)          //total timeout for reset operation (us)
 #define GO_SYSTEM_RESET_INCOMPLETE_TIMEOUT          (15000000)          //timeout for incomplete status to resolve after reset reconnection (us)
 
+typedef struct GoSystemUploadJob
+{
+    GoSensor sensor;                            //destination sensor
+    const kChar* sourcePath;                    //local source path
+    const kChar* destName;                      //remote file name
+    GoTransferFx progress;                      //progress callback
+    kPointer receiver;                          //progress callback receiver
+    kThread thread;                             //upload thread
+    kStatus status;                             //upload result
+} GoSystemUploadJob;
+
+typedef kStatus (kCall* GoSystemSensorFx)(GoSensor sensor);
+
+typedef struct GoSystemSensorTask
+{
+    GoSensor sensor;                            //target sensor
+    GoSystemSensorFx function;                  //operation to perform
+    kThreadPoolTransaction transaction;         //pool transaction
+    kStatus status;                             //operation result
+    k64u duration;                              //operation duration (us)
+} GoSystemSensorTask;
+
 typedef struct GoSystemClass
 {
     kObjectClass base;
@@ -36,11 +61,15 @@ typedef struct GoSystemClass
     kTimer timer;                               //utilty timer (resets, etc.)
 
     GoDiscovery discovery;                      //periodically discovers sensors in background thread
+    kBool discoveryDeferred;                    //sensors were added by address; discovery runs only on request
+    k64u discoveryDuration;                     //time spent waiting for the first discovery enumeration (us)
     kPeriodic healthCheck;                      //periodically verifies continuity of health messages in background thread
 
     kArrayList allSensors;                      //list of all sensors (kArrayList<GoSensor>)
     kArrayList onlineSensors;                   //list of all published sensors (kArrayList<GoSensor>)
     kArrayList tempList;                        //temp list used in some methods
+    kThreadPool sensorPool;                     //runs per-sensor operations concurrently (created on first use)
+    GoControlDispatcher dispatcher;             //services asynchronous sensor commands (created on first use)
 
     volatile kBool dataQuit;                    //flag to exit data dispatch thread
     kMsgQueue dataQueue;                        //queue of received data messages
@@ -51,6 +80,7 @@ typedef struct GoSystemClass
     kMsgQueue healthQueue;                      //queue of received health messages
     kThread healthThread;                       //health dispatch thread
     kCallback onHealth;                         //health callback
+    GoHealthTable healthTable;                  //most recent health indicator values, updated as messages arrive
 
     kArrayList bankList;                        //list of all multiplexing banks
 } GoSystemClass;
@@ -67,15 +97,26 @@ GoFx(kStatus) GoSystem_OnHealthCheck(GoSystem system, kPeriodic timer);
 GoFx(kStatus) GoSystem_RefreshSensorList(GoSystem system);
 
 GoFx(kStatus) GoSystem_FindSensorAll(GoSystem system, kSize id, GoSensor* sensor);
+GoFx(kStatus) GoSystem_FindDirectSensor(GoSystem system, const kIpAddress* address, GoSensor* sensor);
 
 GoFx(kStatus) GoSystem_DataThreadEntry(GoSystem system);
 GoFx(kStatus) GoSystem_OnData(GoSystem system, GoSensor sensor, GoDataSet data);
+GoFx(kStatus) GoSystem_DataQueueStats(GoSystem system, GoDataStats* stats);
 
 GoFx(kStatus) GoSystem_SetHealthCapacity(GoSystem system, kSize bytes);
 GoFx(kSize) GoSystem_HealthCapacity(GoSystem system);
 GoFx(kStatus) GoSystem_HealthThreadEntry(GoSystem system);
 GoFx(kStatus) GoSystem_OnHealth(GoSystem system, GoSensor sensor, GoDataSet health);
 
-GoFx(kStatus) GoSystem_SensorRefreshAll(GoSystem system);
+GoFx(kStatus) GoSystem_SensorRefreshAll(GoSystem system, kArrayList results);
+GoFx(kStatus) GoSystem_AddDirectSensor(GoSystem system, kIpAddress address);
+GoFx(kStatus) GoSystem_Dispatcher(GoSystem system, GoControlDispatcher* dispatcher);
+
+GoFx(kStatus) GoSystem_ForEachSensor(GoSystem system, kArrayList sensors, GoSystemSensorFx function, kArrayList results);
+GoFx(kStatus) GoSystem_SensorTaskEntry(kPointer context);
+GoFx(kStatus) GoSystem_StopSensor(GoSensor sensor);
+GoFx(kStatus) GoSystem_FlushSensor(GoSensor sensor);
+
+GoFx(kStatus) GoSystem_UploadThreadEntry(kPointer context);
 
 #endif
@@ -471,6 +471,21 @@ GoFx(kStatus) GoUtils_XmlMerge(kXml srcXml, kXmlItem srcItem, kXml dstXml, kXmlI
 }
 
 
+GoFx(k64u) GoUtils_Hash64(const void* data, kSize size)
+{
+    const kByte* bytes = (const kByte*)data;
+    k64u hash = k64U(14695981039346656037);
+    kSize i;
+
+    for (i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= k64U(1099511628211);
+    }
+
+    return hash;
+}
+
 GoFx(kStatus) GoConfig_WriteRangeElement64f( kXml xml, kXmlItem item, const kChar* elementName, GoElement64f element )
 {
     kXmlItem newItem = kNULL;
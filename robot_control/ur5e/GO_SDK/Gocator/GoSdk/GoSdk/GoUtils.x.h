@@ -83,4 +83,14 @@ GoFx(kStatus) GoConfig_ReadStringOptional(kXml xml, kXmlItem item, const kChar*
  */
 GoFx(kStatus) GoUtils_XmlMerge(kXml srcXml, kXmlItem srcItem, kXml dstXml, kXmlItem dstItem);  
 
+/** 
+ * Computes a 64-bit FNV-1a hash of a block of bytes.
+ *
+ * @public                  @memberof GoUtils
+ * @param    data           Pointer to data.
+ * @param    size           Size of data, in bytes.
+ * @return   Hash value.            
+ */
+GoFx(k64u) GoUtils_Hash64(const void* data, kSize size);
+
 #endif
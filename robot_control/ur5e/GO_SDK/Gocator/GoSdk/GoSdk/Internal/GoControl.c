@@ -7,10 +7,14 @@
  * Redistributed files must retain the above copyright notice.
  */
 #include <GoSdk/Internal/GoControl.h>
+#include <GoSdk/Internal/GoControlDispatcher.h>
 #include <kApi/Utils/kUtils.h>
 #include <kApi/Data/kImage.h>
 #include <kApi/Io/kDat6Serializer.h>
 
+kBeginValueEx(Go, GoControlAsyncCommand)
+kEndValueEx()
+
 kBeginClassEx(Go, GoControl)
     kAddVMethod(GoControl, kObject, VRelease)
 kEndClassEx()
@@ -33,6 +37,7 @@ GoFx(kStatus) GoControl_Construct(GoControl* control, kAlloc allocator)
 GoFx(kStatus) GoControl_Init(GoControl control, kType type, kAlloc alloc)
 {
     kObjR(GoControl, control);
+    kStatus status;
 
     kCheck(kObject_Init(control, type, alloc));
     obj->onCancel.function = kNULL;
@@ -54,13 +59,36 @@ GoFx(kStatus) GoControl_Init(GoControl control, kType type, kAlloc alloc)
     obj->upgrade->port = GO_CONTROL_PORT_UPGRADE;
     obj->upgrade->parent = control;
 
+    kZero(obj->async);
+    obj->async.parent = control;
+    obj->asyncLock = kNULL;
+    obj->asyncInFlight = kNULL;
+    obj->dispatcher = kNULL;
+    obj->asyncRegistered = kFALSE;
+
+    kTry
+    {
+        kTest(kLock_Construct(&obj->asyncLock, alloc));
+        kTest(kArrayList_Construct(&obj->asyncInFlight, kTypeOf(GoControlAsyncCommand), 0, alloc));
+    }
+    kCatch(&status)
+    {
+        GoControl_VRelease(control);
+        kEndCatch(status);
+    }
+
     return kOK;
 }
 
 GoFx(kStatus) GoControl_VRelease(GoControl control)
 {
+    kObj(GoControl, control);
+
     kCheck(GoControl_Close(control));
 
+    kCheck(kDestroyRef(&obj->asyncInFlight));
+    kCheck(kDestroyRef(&obj->asyncLock));
+
     kCheck(kObject_VRelease(control));
 
     return kOK;
@@ -231,6 +259,8 @@ GoFx(kStatus) GoControl_Close(GoControl control)
     kObj(GoControl, control);
     k32u i;
 
+    kCheck(GoControl_CloseAsync(control));
+
     for (i = 0; i < GO_CONTROL_CHANNEL_COUNT; ++i)
     {
         GoControlChannel* channel = &obj->channels[i];
@@ -276,6 +306,43 @@ GoFx(kStatus) GoControl_ConnectChannel(GoControl control, GoControlChannel* chan
     return kOK;
 }
 
+// Abandons a partially sent message. Dropping the channel's connection causes the sensor to discard
+// the message; the control channel is then reconnected, so that other channels and the sensor's
+// connection state are unaffected. If the control channel cannot be reconnected, all channels are
+// closed.
+GoFx(kStatus) GoControl_ResetChannel(GoControl control, GoControlChannel* channel)
+{
+    kObj(GoControl, control);
+    kStatus status;
+
+    kCheck(kDestroyRef(&channel->timer));
+    kCheck(kDestroyRef(&channel->serializer));
+    kCheck(kDestroyRef(&channel->client));
+
+    channel->isConnected = kFALSE;
+
+    if (channel != obj->control)
+    {
+        // other channels are connected on demand
+        return kOK;
+    }
+
+    obj->busy = kFALSE;
+
+    kTry
+    {
+        kTest(GoControl_InitChannel(control, channel));
+        kTest(GoControl_ConnectChannel(control, channel));
+    }
+    kCatch(&status)
+    {
+        GoControl_Close(control);
+        kEndCatch(status);
+    }
+
+    return kOK;
+}
+
 GoFx(kStatus) GoControl_BeginLegacyCommand(GoControl control, GoControlChannel* channel, k16u commandId, k64u timeout)
 {
     kObj(GoControl, control);
@@ -314,6 +381,58 @@ GoFx(kStatus) GoControl_BeginCommand(GoControl control, GoControlChannel* channe
     return kOK;
 }
 
+GoFx(kStatus) GoControl_BeginSizedCommand(GoControl control, GoControlChannel* channel, k16u commandId, k64u timeout, k64u contentSize)
+{
+    kObj(GoControl, control);
+    k64u messageSize = sizeof(k32u) + sizeof(k16u) + contentSize;
+
+    kCheckArgs(messageSize <= k32U_MAX);
+
+    if (obj->busy)
+    {
+        kCheck(GoControl_Receive(control, channel));
+        kCheck(GoControl_EndResponse(control, channel));
+    }
+
+    channel->commandId = commandId;
+
+    kCheck(kTimer_Start(channel->timer, timeout));
+
+    kCheck(kSerializer_Reset(channel->serializer));
+
+    //the message size is written up front (rather than patched by kSerializer_EndWrite), so that
+    //large content can be passed through to the socket without being buffered in the serializer
+    kCheck(kSerializer_Write32u(channel->serializer, (k32u)messageSize));
+    kCheck(kSerializer_Write16u(channel->serializer, commandId));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_BeginSizedLegacyCommand(GoControl control, GoControlChannel* channel, k16u commandId, k64u timeout, k64u contentSize)
+{
+    channel->commandId = commandId;
+
+    kCheck(kTimer_Start(channel->timer, timeout));
+
+    kCheck(kSerializer_Reset(channel->serializer));
+
+    kCheck(kSerializer_Write64u(channel->serializer, 2*sizeof(k64u) + contentSize));
+    kCheck(kSerializer_Write64u(channel->serializer, commandId));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_SendSized(GoControl control, GoControlChannel* channel)
+{
+    kObj(GoControl, control);
+
+    kCheck(kSerializer_Flush(channel->serializer));
+
+    obj->busy = kTRUE;
+
+    return kOK;
+}
+
 GoFx(kStatus) GoControl_CancelHandler(kPointer channel, kObject sender, kPointer args)
 {
     GoControlChannel* channelObj = channel;
@@ -594,6 +713,43 @@ GoFx(kStatus) GoControl_BeginUpgrade(GoControl control, void* data, kSize size)
     return kOK;
 }
 
+GoFx(kStatus) GoControl_BeginUpgradeFromStream(GoControl control, kStream source, k64u size, GoTransferFx progress, kPointer receiver)
+{
+    kObj(GoControl, control);
+    GoControlChannel* channel = obj->upgrade;
+    GoTransferFxArgs transfer = { 0 };
+    kStatus status;
+
+    // upgrade channel is connected on demand
+    if (!(channel->isConnected) && kIsNull(channel->client))
+    {
+        kCheck(GoControl_InitChannel(control, channel));
+    }
+
+    kCheck(GoControl_ConnectChannel(control, channel));
+    kCheck(GoControl_BeginSizedLegacyCommand(control, channel, GO_CONTROL_BEGIN_UPGRADE, GO_CONTROL_BEGIN_UPGRADE_TIMEOUT, sizeof(k64s) + size));
+
+    transfer.total = size;
+
+    kTry
+    {
+        kTest(kSerializer_Write64s(channel->serializer, (k64s) size));
+        kTest(GoControl_WriteContent(control, channel, source, size, GO_CONTROL_BEGIN_UPGRADE_TIMEOUT, progress, receiver, &transfer));
+        kTest(GoControl_SendSized(control, channel));
+    }
+    kCatch(&status)
+    {
+        //a partially sent message cannot be completed
+        GoControl_ResetChannel(control, channel);
+        kEndCatch(status);
+    }
+
+    kCheck(GoControl_LegacyReceive(control, channel));
+    kCheck(GoControl_EndResponse(control, channel));
+
+    return kOK;
+}
+
 GoFx(kStatus) GoControl_GetUpgradeStatus(GoControl control, kBool* complete, kBool* succeeded, k32s* progress)
 {
     kObj(GoControl, control);
@@ -850,10 +1006,7 @@ GoFx(kStatus) GoControl_ReadFileList(GoControl control, kArrayList files, const
 {
     kObj(GoControl, control);
     GoControlChannel* channel = obj->control;
-    k32u count;
     kText64 filter = { 0 };
-    kText64 name = { 0 };
-    k32u i;
 
     kCheckState(obj->isCompatible);
 
@@ -868,17 +1021,27 @@ GoFx(kStatus) GoControl_ReadFileList(GoControl control, kArrayList files, const
     kCheck(kSerializer_WriteCharArray(channel->serializer, filter, kCountOf(filter)));
 
     kCheck(GoControl_SendAndReceive(control, channel));
-    kCheck(kSerializer_Read32u(channel->serializer, &count));
+    kCheck(GoControl_ReadFileListContent(control, channel->serializer, files));
+
+    kCheck(GoControl_EndResponse(control, channel));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_ReadFileListContent(GoControl control, kSerializer serializer, kArrayList files)
+{
+    kText64 name = { 0 };
+    k32u count;
+    k32u i;
+
+    kCheck(kSerializer_Read32u(serializer, &count));
 
     for (i = 0; i < count; ++i)
     {
-        kCheck(kSerializer_ReadCharArray(channel->serializer, name, kCountOf(name)));
+        kCheck(kSerializer_ReadCharArray(serializer, name, kCountOf(name)));
         kCheck(kArrayList_AddT(files, &name));
     }
 
-    kCheck(GoControl_EndResponse(control, channel));
-
-
     return kOK;
 }
 
@@ -925,139 +1088,412 @@ GoFx(kStatus) GoControl_ReadFile(GoControl control, const kChar* fileName, kByte
     return kOK;
 }
 
-GoFx(kStatus) GoControl_ClearLog(GoControl control)
-{
-    kObj(GoControl, control);
-    GoControlChannel* channel = obj->control;
-
-    kCheckState(obj->isCompatible);
-
-    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_CLEAR_LOG, GO_CONTROL_DEFAULT_TIMEOUT));
-
-    kCheck(GoControl_Send(control, channel));
-
-    return kOK;
-}
-
-GoFx(kStatus) GoControl_WriteFile(GoControl control, const kChar* fileName, const kByte* data, kSize size)
+GoFx(kStatus) GoControl_ReadFileToStream(GoControl control, const kChar* fileName, kStream stream, GoTransferFx progress, kPointer receiver)
 {
     kObj(GoControl, control);
     GoControlChannel* channel = obj->control;
     kText64 name = { 0 };
+    GoTransferFxArgs transfer = { 0 };
+    k32u fileSize;
 
     kCheckState(obj->isCompatible);
 
     kCheck(kStrCopy(name, kCountOf(name), fileName));
 
-    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_WRITE_FILE, GO_CONTROL_WRITE_FILE_TIMEOUT));
+    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_READ_FILE, GO_CONTROL_READ_FILE_TIMEOUT));
     kCheck(kSerializer_WriteCharArray(channel->serializer, name, kCountOf(name)));
-    kCheck(kSerializer_Write32u(channel->serializer, (k32u)size));
-    kCheck(kSerializer_WriteByteArray(channel->serializer, data, size));
 
     kCheck(GoControl_SendAndReceive(control, channel));
 
+    kCheck(kSerializer_Read32u(channel->serializer, &fileSize));
+
+    transfer.total = fileSize;
+
+    kCheck(GoControl_ReadContent(control, channel, stream, fileSize, GO_CONTROL_READ_FILE_TIMEOUT, progress, receiver, &transfer));
+
     kCheck(GoControl_EndResponse(control, channel));
 
     return kOK;
 }
 
-GoFx(kStatus) GoControl_CopyFile(GoControl control, const kChar* source, const kChar* destination)
+GoFx(kStatus) GoControl_ReadContent(GoControl control, GoControlChannel* channel, kStream stream, k64u size, k64u timeout, GoTransferFx progress, kPointer receiver, GoTransferFxArgs* transfer)
 {
-    kObj(GoControl, control);
-    GoControlChannel* channel = obj->control;
-    kText64 srcName = { 0 };
-    kText64 destName = { 0 };
+    kAlloc alloc = kObject_Alloc(control);
+    kSize capacity = (kSize)kMin_(size, GO_CONTROL_TRANSFER_CHUNK_SIZE);
+    kByte* buffer = kNULL;
+    k64u remaining = size;
+    kStatus result = kOK;
 
-    kCheckState(obj->isCompatible);
+    if (size == 0)
+    {
+        return kOK;
+    }
 
-    kCheck(kStrCopy(srcName, kCountOf(srcName), source));
-    kCheck(kStrCopy(destName, kCountOf(destName), destination));
+    kCheck(kAlloc_Get(alloc, capacity, &buffer));
 
-    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_COPY_FILE, GO_CONTROL_COPY_FILE_TIMEOUT));
-    kCheck(kSerializer_WriteCharArray(channel->serializer, srcName, kCountOf(srcName)));
-    kCheck(kSerializer_WriteCharArray(channel->serializer, destName, kCountOf(destName)));
+    kTry
+    {
+        while (remaining > 0)
+        {
+            kSize chunkSize = (kSize)kMin_(remaining, capacity);
 
-    kCheck(GoControl_SendAndReceive(control, channel));
+            //the command timeout applies to each chunk, rather than to the transfer as a whole
+            kTest(kTimer_Start(channel->timer, timeout));
+            kTest(kSerializer_ReadByteArray(channel->serializer, buffer, chunkSize));
 
-    kCheck(GoControl_EndResponse(control, channel));
+            remaining -= chunkSize;
+            transfer->completed += chunkSize;
+
+            //after a local failure, the remaining content is still consumed to keep the channel usable
+            if (kSuccess(result) && !kIsNull(stream) && kSuccess(result = kStream_Write(stream, buffer, chunkSize)))
+            {
+                result = GoControl_ReportTransfer(control, progress, receiver, transfer);
+            }
+        }
+    }
+    kFinally
+    {
+        kAlloc_Free(alloc, buffer);
+        kEndFinally();
+    }
+
+    return result;
+}
+
+GoFx(kStatus) GoControl_ReportTransfer(GoControl control, GoTransferFx progress, kPointer receiver, GoTransferFxArgs* transfer)
+{
+    if (!kIsNull(progress))
+    {
+        return progress(receiver, control, transfer);
+    }
 
     return kOK;
 }
 
-GoFx(kStatus) GoControl_DeleteFile(GoControl control, const kChar* fileName)
+GoFx(kStatus) GoControl_WriteContent(GoControl control, GoControlChannel* channel, kStream source, k64u size, k64u timeout, GoTransferFx progress, kPointer receiver, GoTransferFxArgs* transfer)
 {
-    kObj(GoControl, control);
-    GoControlChannel* channel = obj->control;
-    kText64 name = { 0 };
+    GoControlReadAhead readAhead;
+    const kByte* buffer = kNULL;
+    kSize bufferSize = 0;
+    k64u remaining = size;
 
-    kCheckState(obj->isCompatible);
+    kCheck(GoControl_BeginReadAhead(control, &readAhead, source, size));
 
-    kCheck(kStrCopy(name, kCountOf(name), fileName));
+    kTry
+    {
+        while (remaining > 0)
+        {
+            kTest(GoControl_AcquireReadAhead(control, &readAhead, &buffer, &bufferSize));
 
-    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_DELETE_FILE, GO_CONTROL_DELETE_FILE_TIMEOUT));
-    kCheck(kSerializer_WriteCharArray(channel->serializer, name, kCountOf(name)));
+            //the command timeout applies to each buffer, rather than to the transfer as a whole
+            kTest(kTimer_Start(channel->timer, timeout));
+            kTest(kSerializer_WriteByteArray(channel->serializer, buffer, bufferSize));
 
-    kCheck(GoControl_SendAndReceive(control, channel));
+            kTest(GoControl_ReleaseReadAhead(control, &readAhead));
 
-    kCheck(GoControl_EndResponse(control, channel));
+            remaining -= bufferSize;
+            transfer->completed += bufferSize;
+
+            kTest(GoControl_ReportTransfer(control, progress, receiver, transfer));
+        }
+    }
+    kFinally
+    {
+        GoControl_EndReadAhead(control, &readAhead);
+        kEndFinally();
+    }
 
     return kOK;
 }
 
-GoFx(kStatus) GoControl_GetUserStorageFree(GoControl control, k64u* spaceAvailable)
+GoFx(kStatus) GoControl_BeginReadAhead(GoControl control, GoControlReadAhead* readAhead, kStream source, k64u size)
 {
-    kObj(GoControl, control);
-    GoControlChannel* channel = obj->control;
-    k64u temp = 0;
+    kSize bufferSize = (kSize)kMin_(size, GO_CONTROL_UPLOAD_BUFFER_SIZE);
+    kStatus status;
+    kSize i;
 
-    kCheckState(obj->isCompatible);
+    kZero(*readAhead);
 
-    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_USER_STORAGE_FREE, GO_CONTROL_USER_STORAGE_FREE_TIMEOUT));
+    readAhead->alloc = kObject_Alloc(control);
+    readAhead->source = source;
+    readAhead->remaining = size;
+    readAhead->readStatus = kOK;
+    kAtomic32s_Init(&readAhead->quit, kFALSE);
 
-    kCheck(GoControl_SendAndReceive(control, channel));
+    if (size == 0)
+    {
+        return kOK;
+    }
 
-    kCheck(kSerializer_Read64u(channel->serializer, &temp));
-    *spaceAvailable = temp;
+    kTry
+    {
+        for (i = 0; i < GO_CONTROL_UPLOAD_BUFFER_COUNT; ++i)
+        {
+            kTest(kAlloc_Get(readAhead->alloc, bufferSize, &readAhead->buffers[i]));
+        }
 
-    kCheck(GoControl_EndResponse(control, channel));
+        kTest(kSemaphore_Construct(&readAhead->filled, 0, readAhead->alloc));
+        kTest(kSemaphore_Construct(&readAhead->empty, GO_CONTROL_UPLOAD_BUFFER_COUNT, readAhead->alloc));
+
+        kTest(kThread_Construct(&readAhead->thread, readAhead->alloc));
+        kTest(kThread_Start(readAhead->thread, GoControl_ReadAheadThreadEntry, readAhead));
+    }
+    kCatch(&status)
+    {
+        GoControl_EndReadAhead(control, readAhead);
+        kEndCatch(status);
+    }
 
     return kOK;
 }
 
-GoFx(kStatus) GoControl_GetUserStorageUsed(GoControl control, k64u* spaceUsed)
+GoFx(kStatus) GoControl_EndReadAhead(GoControl control, GoControlReadAhead* readAhead)
 {
-    kObj(GoControl, control);
-    GoControlChannel* channel = obj->control;
-    k64u temp = 0;
-
-    kCheckState(obj->isCompatible);
-
-    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_USER_STORAGE_USED, GO_CONTROL_USER_STORAGE_USED_TIMEOUT));
+    kSize i;
 
-    kCheck(GoControl_SendAndReceive(control, channel));
+    if (!kIsNull(readAhead->thread))
+    {
+        kAtomic32s_Exchange(&readAhead->quit, kTRUE);
+        kCheck(kDestroyRef(&readAhead->thread));
+    }
 
-    kCheck(kSerializer_Read64u(channel->serializer, &temp));
-    *spaceUsed = temp;
+    kCheck(kDestroyRef(&readAhead->filled));
+    kCheck(kDestroyRef(&readAhead->empty));
 
-    kCheck(GoControl_EndResponse(control, channel));
+    for (i = 0; i < GO_CONTROL_UPLOAD_BUFFER_COUNT; ++i)
+    {
+        kCheck(kAlloc_FreeRef(readAhead->alloc, &readAhead->buffers[i]));
+    }
 
     return kOK;
 }
 
-GoFx(kStatus) GoControl_GetDefaultJob(GoControl control, kChar* fileName, kSize capacity)
+GoFx(kStatus) GoControl_ReadAheadThreadEntry(kPointer context)
 {
-    kObj(GoControl, control);
-    GoControlChannel* channel = obj->control;
-    kText64 name = { 0 };
+    GoControlReadAhead* readAhead = context;
+    kSize index = 0;
 
-    kCheckState(obj->isCompatible);
+    while (readAhead->remaining > 0)
+    {
+        kSize size = (kSize)kMin_(readAhead->remaining, GO_CONTROL_UPLOAD_BUFFER_SIZE);
 
-    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_GET_DEFAULT_JOB, GO_CONTROL_GET_DEFAULT_JOB_TIMEOUT));
+        //wait for the consumer to release a buffer, checking periodically for an early exit request
+        while (!kSuccess(kSemaphore_Wait(readAhead->empty, GO_CONTROL_CANCEL_QUERY_INTERVAL)))
+        {
+            if (kAtomic32s_Get(&readAhead->quit))
+            {
+                return kOK;
+            }
+        }
 
-    kCheck(GoControl_SendAndReceive(control, channel));
+        readAhead->readStatus = kStream_Read(readAhead->source, readAhead->buffers[index], size);
+        readAhead->sizes[index] = size;
+        readAhead->remaining -= size;
 
-    kCheck(kSerializer_ReadCharArray(channel->serializer, name, kCountOf(name)));
-    kCheck(kStrCopy(fileName, capacity, name));
+        kCheck(kSemaphore_Post(readAhead->filled));
+
+        if (!kSuccess(readAhead->readStatus))
+        {
+            break;
+        }
+
+        index = (index + 1) % GO_CONTROL_UPLOAD_BUFFER_COUNT;
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_AcquireReadAhead(GoControl control, GoControlReadAhead* readAhead, const kByte** buffer, kSize* size)
+{
+    kCheck(kSemaphore_Wait(readAhead->filled, kINFINITE));
+
+    kCheck(readAhead->readStatus);
+
+    *buffer = readAhead->buffers[readAhead->next];
+    *size = readAhead->sizes[readAhead->next];
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_ReleaseReadAhead(GoControl control, GoControlReadAhead* readAhead)
+{
+    readAhead->next = (readAhead->next + 1) % GO_CONTROL_UPLOAD_BUFFER_COUNT;
+
+    kCheck(kSemaphore_Post(readAhead->empty));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_ClearLog(GoControl control)
+{
+    kObj(GoControl, control);
+    GoControlChannel* channel = obj->control;
+
+    kCheckState(obj->isCompatible);
+
+    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_CLEAR_LOG, GO_CONTROL_DEFAULT_TIMEOUT));
+
+    kCheck(GoControl_Send(control, channel));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_WriteFile(GoControl control, const kChar* fileName, const kByte* data, kSize size)
+{
+    kObj(GoControl, control);
+    GoControlChannel* channel = obj->control;
+    kText64 name = { 0 };
+
+    kCheckState(obj->isCompatible);
+
+    kCheck(kStrCopy(name, kCountOf(name), fileName));
+
+    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_WRITE_FILE, GO_CONTROL_WRITE_FILE_TIMEOUT));
+    kCheck(kSerializer_WriteCharArray(channel->serializer, name, kCountOf(name)));
+    kCheck(kSerializer_Write32u(channel->serializer, (k32u)size));
+    kCheck(kSerializer_WriteByteArray(channel->serializer, data, size));
+
+    kCheck(GoControl_SendAndReceive(control, channel));
+
+    kCheck(GoControl_EndResponse(control, channel));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_WriteFileFromStream(GoControl control, const kChar* fileName, kStream source, k64u size, GoTransferFx progress, kPointer receiver)
+{
+    kObj(GoControl, control);
+    GoControlChannel* channel = obj->control;
+    kText64 name = { 0 };
+    GoTransferFxArgs transfer = { 0 };
+    kStatus status;
+
+    kCheckState(obj->isCompatible);
+    kCheckArgs(size <= k32U_MAX);
+
+    kCheck(kStrCopy(name, kCountOf(name), fileName));
+
+    kCheck(GoControl_BeginSizedCommand(control, channel, GO_CONTROL_WRITE_FILE, GO_CONTROL_WRITE_FILE_TIMEOUT, sizeof(name) + sizeof(k32u) + size));
+
+    transfer.total = size;
+
+    kTry
+    {
+        kTest(kSerializer_WriteCharArray(channel->serializer, name, kCountOf(name)));
+        kTest(kSerializer_Write32u(channel->serializer, (k32u)size));
+        kTest(GoControl_WriteContent(control, channel, source, size, GO_CONTROL_WRITE_FILE_TIMEOUT, progress, receiver, &transfer));
+        kTest(GoControl_SendSized(control, channel));
+    }
+    kCatch(&status)
+    {
+        //a partially sent message cannot be completed
+        GoControl_ResetChannel(control, channel);
+        kEndCatch(status);
+    }
+
+    kCheck(GoControl_Receive(control, channel));
+    kCheck(GoControl_EndResponse(control, channel));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_CopyFile(GoControl control, const kChar* source, const kChar* destination)
+{
+    kObj(GoControl, control);
+    GoControlChannel* channel = obj->control;
+    kText64 srcName = { 0 };
+    kText64 destName = { 0 };
+
+    kCheckState(obj->isCompatible);
+
+    kCheck(kStrCopy(srcName, kCountOf(srcName), source));
+    kCheck(kStrCopy(destName, kCountOf(destName), destination));
+
+    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_COPY_FILE, GO_CONTROL_COPY_FILE_TIMEOUT));
+    kCheck(kSerializer_WriteCharArray(channel->serializer, srcName, kCountOf(srcName)));
+    kCheck(kSerializer_WriteCharArray(channel->serializer, destName, kCountOf(destName)));
+
+    kCheck(GoControl_SendAndReceive(control, channel));
+
+    kCheck(GoControl_EndResponse(control, channel));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_DeleteFile(GoControl control, const kChar* fileName)
+{
+    kObj(GoControl, control);
+    GoControlChannel* channel = obj->control;
+    kText64 name = { 0 };
+
+    kCheckState(obj->isCompatible);
+
+    kCheck(kStrCopy(name, kCountOf(name), fileName));
+
+    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_DELETE_FILE, GO_CONTROL_DELETE_FILE_TIMEOUT));
+    kCheck(kSerializer_WriteCharArray(channel->serializer, name, kCountOf(name)));
+
+    kCheck(GoControl_SendAndReceive(control, channel));
+
+    kCheck(GoControl_EndResponse(control, channel));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_GetUserStorageFree(GoControl control, k64u* spaceAvailable)
+{
+    kObj(GoControl, control);
+    GoControlChannel* channel = obj->control;
+    k64u temp = 0;
+
+    kCheckState(obj->isCompatible);
+
+    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_USER_STORAGE_FREE, GO_CONTROL_USER_STORAGE_FREE_TIMEOUT));
+
+    kCheck(GoControl_SendAndReceive(control, channel));
+
+    kCheck(kSerializer_Read64u(channel->serializer, &temp));
+    *spaceAvailable = temp;
+
+    kCheck(GoControl_EndResponse(control, channel));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_GetUserStorageUsed(GoControl control, k64u* spaceUsed)
+{
+    kObj(GoControl, control);
+    GoControlChannel* channel = obj->control;
+    k64u temp = 0;
+
+    kCheckState(obj->isCompatible);
+
+    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_USER_STORAGE_USED, GO_CONTROL_USER_STORAGE_USED_TIMEOUT));
+
+    kCheck(GoControl_SendAndReceive(control, channel));
+
+    kCheck(kSerializer_Read64u(channel->serializer, &temp));
+    *spaceUsed = temp;
+
+    kCheck(GoControl_EndResponse(control, channel));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_GetDefaultJob(GoControl control, kChar* fileName, kSize capacity)
+{
+    kObj(GoControl, control);
+    GoControlChannel* channel = obj->control;
+    kText64 name = { 0 };
+
+    kCheckState(obj->isCompatible);
+
+    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_GET_DEFAULT_JOB, GO_CONTROL_GET_DEFAULT_JOB_TIMEOUT));
+
+    kCheck(GoControl_SendAndReceive(control, channel));
+
+    kCheck(kSerializer_ReadCharArray(channel->serializer, name, kCountOf(name)));
+    kCheck(kStrCopy(fileName, capacity, name));
 
     kCheck(GoControl_EndResponse(control, channel));
 
@@ -1234,8 +1670,6 @@ GoFx(kStatus) GoControl_GetStates(GoControl control, GoStates* states)
 {
     kObj(GoControl, control);
     GoControlChannel* channel = obj->control;
-    k32u itemCount;
-    k32u temp32u;
 
     kCheckState(obj->isCompatible);
 
@@ -1246,60 +1680,70 @@ GoFx(kStatus) GoControl_GetStates(GoControl control, GoStates* states)
 
     kCheck(GoControl_SendAndReceive(control, channel));
 
+    kCheck(GoControl_ReadStates(control, channel->serializer, states));
+
+    kCheck(GoControl_EndResponse(control, channel));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_ReadStates(GoControl control, kSerializer serializer, GoStates* states)
+{
+    k32u itemCount;
+    k32u temp32u;
+
     //read states
-    kCheck(kSerializer_Read32u(channel->serializer, &itemCount));     //item count
-    kCheck(kSerializer_Read32s(channel->serializer, &states->sensorState));
-    kCheck(kSerializer_Read32s(channel->serializer, &states->loginType));
-    kCheck(kSerializer_Read32s(channel->serializer, &states->alignmentReference));
-    kCheck(kSerializer_Read32s(channel->serializer, &states->alignmentState));
-    kCheck(kSerializer_Read32s(channel->serializer, &states->recordingEnabled));
-    kCheck(kSerializer_Read32s(channel->serializer, &states->playbackSource));
-    kCheck(kSerializer_Read32u(channel->serializer, &states->uptimeSec));
-    kCheck(kSerializer_Read32u(channel->serializer, &states->uptimeMicrosec));
-    kCheck(kSerializer_Read32u(channel->serializer, &states->playbackPos));
-    kCheck(kSerializer_Read32u(channel->serializer, &states->playbackCount));
-
-    kCheck(kSerializer_Read32u(channel->serializer, &temp32u));
+    kCheck(kSerializer_Read32u(serializer, &itemCount));     //item count
+    kCheck(kSerializer_Read32s(serializer, &states->sensorState));
+    kCheck(kSerializer_Read32s(serializer, &states->loginType));
+    kCheck(kSerializer_Read32s(serializer, &states->alignmentReference));
+    kCheck(kSerializer_Read32s(serializer, &states->alignmentState));
+    kCheck(kSerializer_Read32s(serializer, &states->recordingEnabled));
+    kCheck(kSerializer_Read32s(serializer, &states->playbackSource));
+    kCheck(kSerializer_Read32u(serializer, &states->uptimeSec));
+    kCheck(kSerializer_Read32u(serializer, &states->uptimeMicrosec));
+    kCheck(kSerializer_Read32u(serializer, &states->playbackPos));
+    kCheck(kSerializer_Read32u(serializer, &states->playbackCount));
+
+    kCheck(kSerializer_Read32u(serializer, &temp32u));
     states->autoStartEnabled = (kBool)temp32u;
 
     if (itemCount > 11) // backwards compatibility support
     {
-        kCheck(kSerializer_Read32u(channel->serializer, &temp32u));
+        kCheck(kSerializer_Read32u(serializer, &temp32u));
         states->isAccelerator = (kBool)temp32u;
     }
 
     if (itemCount > 12) // backwards compatibility support
     {
-        kCheck(kSerializer_Read32u(channel->serializer, &temp32u));
+        kCheck(kSerializer_Read32u(serializer, &temp32u));
         states->voltage = (GoVoltageSetting)temp32u;
     }
 
     if (itemCount > 13) // backwards compatibility support
     {
-        kCheck(kSerializer_Read32u(channel->serializer, &temp32u));
+        kCheck(kSerializer_Read32u(serializer, &temp32u));
         states->cableLength = temp32u;
     }
 
     if (itemCount > 14) // Backwards compatibility for quickedit state
     {
-        kCheck(kSerializer_Read32u(channel->serializer, &temp32u));
+        kCheck(kSerializer_Read32u(serializer, &temp32u));
         states->quickEditEnabled = (kBool)temp32u;
     }
 
     if (itemCount > 15) // Backwards compatibility for security state
     {
-        kCheck(kSerializer_Read32u(channel->serializer, &temp32u));
+        kCheck(kSerializer_Read32u(serializer, &temp32u));
         states->security = (k32s)temp32u;
     }
 
     if (itemCount > 16) // Backwards compatibility for branding type
     {
-        kCheck(kSerializer_Read32u(channel->serializer, &temp32u));
+        kCheck(kSerializer_Read32u(serializer, &temp32u));
         states->brandingType = (k32s)temp32u;
     }
 
-    kCheck(GoControl_EndResponse(control, channel));
-
     return kOK;
 }
 
@@ -1508,6 +1952,29 @@ GoFx(kStatus) GoControl_Backup(GoControl control, kByte** fileData, kSize* size,
     return kOK;
 }
 
+GoFx(kStatus) GoControl_BackupToStream(GoControl control, kStream stream, GoTransferFx progress, kPointer receiver)
+{
+    kObj(GoControl, control);
+    GoControlChannel* channel = obj->control;
+    GoTransferFxArgs transfer = { 0 };
+    k32u fileSize;
+
+    kCheckState(obj->isCompatible);
+
+    kCheck(GoControl_BeginCommand(control, channel, GO_CONTROL_BACKUP, GO_CONTROL_BACKUP_TIMEOUT));
+    kCheck(GoControl_SendAndReceive(control, channel));
+
+    kCheck(kSerializer_Read32u(channel->serializer, &fileSize));
+
+    transfer.total = fileSize;
+
+    kCheck(GoControl_ReadContent(control, channel, stream, fileSize, GO_CONTROL_BACKUP_TIMEOUT, progress, receiver, &transfer));
+
+    kCheck(GoControl_EndResponse(control, channel));
+
+    return kOK;
+}
+
 GoFx(kStatus) GoControl_Restore(GoControl control, const kByte* fileData, kSize size)
 {
     kObj(GoControl, control);
@@ -1755,77 +2222,78 @@ GoFx(kStatus) GoControl_PlaybackPosition(GoControl control, kSize* position, kSi
 }
 
 GoFx(kStatus) GoControl_ReadChunkedData(GoControl control, const kChar* dstFileName)
+{
+    kFile file = kNULL;
+    kStatus status;
+
+    kTry
+    {
+        kTest(kFile_Construct(&file, dstFileName, kFILE_MODE_WRITE, kObject_Alloc(control)));
+        kTest(GoControl_ReadChunkedDataToStream(control, file, kNULL, kNULL));
+        kTest(kFile_Close(file));
+        kTest(kDestroyRef(&file));
+    }
+    kCatch(&status)
+    {
+        //don't leave a truncated file behind
+        if (!kIsNull(file))
+        {
+            kDestroyRef(&file);
+            kFile_Delete(dstFileName);
+        }
+
+        kEndCatch(status);
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_ReadChunkedDataToStream(GoControl control, kStream stream, GoTransferFx progress, kPointer receiver)
 {
     kObj(GoControl, control);
     GoControlChannel* channel = obj->control;
-    kMemory outputBuffer = kNULL;
-    kByte* currentChunkData = kNULL;
+    GoTransferFxArgs transfer = { 0 };
     k32u temp, currentProgress;
-    kSize chunkDataSize = 0;
     k32u chunkSize;
     k16u chunkType;
     k32s chunkStatus;
     k32u dataSize;
-    kBool bufferInitialized = kFALSE;
-    kFile file = kNULL;
     kBool done = kFALSE;
+    kStatus result = kOK;
+    kStatus chunkResult;
 
-    kTry
+    while (!done)
     {
-        kTest(kMemory_Construct(&outputBuffer, kObject_Alloc(control)));
+        //each chunk, header included, must arrive within the file read timeout
+        kCheck(kTimer_Start(channel->timer, GO_CONTROL_READ_FILE_TIMEOUT));
 
-        while (!done)
-        {
-            kTest(kSerializer_Read32u(channel->serializer, &chunkSize));
-            kTest(kSerializer_Read16u(channel->serializer, &chunkType));
-            kTest(kSerializer_Read32s(channel->serializer, &chunkStatus));
-            kTest(kSerializer_Read32u(channel->serializer, &temp));
-            kTest(kSerializer_Read32u(channel->serializer, &currentProgress));
-            kTest(kSerializer_Read32u(channel->serializer, &dataSize));
+        kCheck(kSerializer_Read32u(channel->serializer, &chunkSize));
+        kCheck(kSerializer_Read16u(channel->serializer, &chunkType));
+        kCheck(kSerializer_Read32s(channel->serializer, &chunkStatus));
+        kCheck(kSerializer_Read32u(channel->serializer, &temp));
+        kCheck(kSerializer_Read32u(channel->serializer, &currentProgress));
+        kCheck(kSerializer_Read32u(channel->serializer, &dataSize));
 
-            kTestArgs(chunkType == GO_CONTROL_CONTINUE && chunkStatus == kOK);
+        kCheckArgs(chunkType == GO_CONTROL_CONTINUE && chunkStatus == kOK);
 
-            if (dataSize == 0)
-            {
-                done = kTRUE;
-                kTest(kAlloc_FreeRef(kObject_Alloc(control), &currentChunkData));
-            }
-            else
+        if (dataSize == 0)
+        {
+            done = kTRUE;
+        }
+        else
+        {
+            //chunks are copied straight into the destination; once a local error occurs, the remaining chunks are discarded
+            chunkResult = GoControl_ReadContent(control, channel, kSuccess(result) ? stream : kNULL, dataSize,
+                GO_CONTROL_READ_FILE_TIMEOUT, kSuccess(result) ? progress : kNULL, receiver, &transfer);
+
+            if (kSuccess(result))
             {
-                if (!bufferInitialized)
-                {
-                    chunkDataSize = (kSize)dataSize;
-                    kTest(kMemory_Allocate(outputBuffer, chunkDataSize));
-                    kTest(kAlloc_Get(kObject_Alloc(control), chunkDataSize, &currentChunkData));
-
-                    bufferInitialized = kTRUE;
-                }
-
-                if (chunkDataSize != (kSize)dataSize)
-                {
-                    kTest(kAlloc_FreeRef(kObject_Alloc(control), &currentChunkData));
-                    chunkDataSize = (kSize)dataSize;
-                    kTest(kAlloc_Get(kObject_Alloc(control), chunkDataSize, &currentChunkData));
-                }
-
-                kTest(kSerializer_ReadByteArray(channel->serializer, currentChunkData, chunkDataSize));
-                kTest(kStream_Write(outputBuffer, currentChunkData, chunkDataSize));
+                result = chunkResult;
             }
         }
-
-        kTest(kFile_Construct(&file, dstFileName, kFILE_MODE_WRITE, kObject_Alloc(control)));
-        kTest(kStream_Write(file, kMemory_At(outputBuffer, 0), (kSize)kMemory_Length(outputBuffer)));
-        kTest(kFile_Close(file));
-    }
-    kFinally
-    {
-        kAlloc_FreeRef(kObject_Alloc(control), &currentChunkData);
-        kDestroyRef(&file);
-        kDestroyRef(&outputBuffer);
-        kEndFinally();
     }
 
-    return kOK;
+    return result;
 }
 
 GoFx(kStatus) GoControl_ReadChunkedDataStream(kPointer context)
@@ -1988,7 +2456,7 @@ GoFx(kStatus) GoControl_ExportBitmap(GoControl control,
     return kOK;
 }
 
-GoFx(kStatus) GoControl_ReadFileStreamed(GoControl control, const kChar* srcFileName, const kChar* dstFileName, kBool continuous)
+GoFx(kStatus) GoControl_BeginReadFileStreamed(GoControl control, const kChar* srcFileName)
 {
     kObj(GoControl, control);
     GoControlChannel* channel = obj->control;
@@ -2007,6 +2475,13 @@ GoFx(kStatus) GoControl_ReadFileStreamed(GoControl control, const kChar* srcFile
 
     kCheck(GoControl_EndResponse(control, channel));
 
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_ReadFileStreamed(GoControl control, const kChar* srcFileName, const kChar* dstFileName, kBool continuous)
+{
+    kCheck(GoControl_BeginReadFileStreamed(control, srcFileName));
+
     if (continuous)
     {
         kCheck(GoControl_StartStreamingChunkedData(control, dstFileName));
@@ -2019,6 +2494,14 @@ GoFx(kStatus) GoControl_ReadFileStreamed(GoControl control, const kChar* srcFile
     return kOK;
 }
 
+GoFx(kStatus) GoControl_ReadFileStreamedToStream(GoControl control, const kChar* srcFileName, kStream stream, GoTransferFx progress, kPointer receiver)
+{
+    kCheck(GoControl_BeginReadFileStreamed(control, srcFileName));
+    kCheck(GoControl_ReadChunkedDataToStream(control, stream, progress, receiver));
+
+    return kOK;
+}
+
 GoFx(kStatus) GoControl_ExportCsv(GoControl control, const kChar* dstFileName)
 {
     kObj(GoControl, control);
@@ -2666,4 +3149,395 @@ GoFx(kStatus) GoControl_LockOutLaser(GoControl control, kBool shouldLock)
     kCheck(GoControl_EndResponse(control, channel));
 
     return kOK;
-}
\ No newline at end of file
+}
+GoFx(kStatus) GoControl_SetDispatcher(GoControl control, kObject dispatcher)
+{
+    kObj(GoControl, control);
+
+    obj->dispatcher = dispatcher;
+
+    return kOK;
+}
+
+GoFx(kObject) GoControl_Dispatcher(GoControl control)
+{
+    kObj(GoControl, control);
+
+    return obj->dispatcher;
+}
+
+GoFx(kStatus) GoControl_GetStatesAsync(GoControl control, GoStates* states, GoFuture future)
+{
+    GoControlAsyncCommand command = { 0 };
+
+    // Important to zero because some fields may be skipped due to compat logic.
+    kCheck(kMemZero(states, sizeof(GoStates)));
+
+    command.commandId = GO_CONTROL_GET_STATES;
+    command.timeout = GO_CONTROL_GET_STATES_TIMEOUT;
+    command.readResponse = GoControl_ReadStatesResponse;
+    command.output = states;
+    command.future = future;
+
+    return GoControl_SubmitAsync(control, &command);
+}
+
+GoFx(kStatus) GoControl_GetTimestampAsync(GoControl control, k64u* time, GoFuture future)
+{
+    GoControlAsyncCommand command = { 0 };
+
+    command.commandId = GO_CONTROL_GET_TIME_STAMP;
+    command.timeout = GO_CONTROL_GET_TIME_STAMP_TIMEOUT;
+    command.readResponse = GoControl_ReadTimestampResponse;
+    command.output = time;
+    command.future = future;
+
+    return GoControl_SubmitAsync(control, &command);
+}
+
+GoFx(kStatus) GoControl_GetEncoderAsync(GoControl control, k64s* encoder, GoFuture future)
+{
+    GoControlAsyncCommand command = { 0 };
+
+    command.commandId = GO_CONTROL_GET_ENCODER;
+    command.timeout = GO_CONTROL_GET_ENCODER_TIMEOUT;
+    command.readResponse = GoControl_ReadEncoderResponse;
+    command.output = encoder;
+    command.future = future;
+
+    return GoControl_SubmitAsync(control, &command);
+}
+
+GoFx(kStatus) GoControl_TriggerAsync(GoControl control, GoFuture future)
+{
+    GoControlAsyncCommand command = { 0 };
+
+    command.commandId = GO_CONTROL_TRIGGER;
+    command.timeout = GO_CONTROL_TRIGGER_TIMEOUT;
+    command.future = future;
+
+    return GoControl_SubmitAsync(control, &command);
+}
+
+GoFx(kStatus) GoControl_ReadFileListAsync(GoControl control, kArrayList files, const kChar* extensionFilter, GoFuture future)
+{
+    GoControlAsyncCommand command = { 0 };
+
+    kCheck(kArrayList_Allocate(files, kTypeOf(kText64), 0));
+
+    if (extensionFilter)
+    {
+        kCheck(kStrCopy(command.text, kCountOf(command.text), extensionFilter));
+    }
+
+    command.commandId = GO_CONTROL_GET_FILE_LIST;
+    command.timeout = GO_CONTROL_GET_FILE_LIST_TIMEOUT;
+    command.writeRequest = GoControl_WriteFileListRequest;
+    command.readResponse = GoControl_ReadFileListResponse;
+    command.output = files;
+    command.future = future;
+
+    return GoControl_SubmitAsync(control, &command);
+}
+
+GoFx(kStatus) GoControl_ReadStatesResponse(GoControl control, kSerializer serializer, GoControlAsyncCommand* command)
+{
+    return GoControl_ReadStates(control, serializer, command->output);
+}
+
+GoFx(kStatus) GoControl_ReadTimestampResponse(GoControl control, kSerializer serializer, GoControlAsyncCommand* command)
+{
+    return kSerializer_Read64u(serializer, command->output);
+}
+
+GoFx(kStatus) GoControl_ReadEncoderResponse(GoControl control, kSerializer serializer, GoControlAsyncCommand* command)
+{
+    return kSerializer_Read64s(serializer, command->output);
+}
+
+GoFx(kStatus) GoControl_WriteFileListRequest(GoControl control, kSerializer serializer, GoControlAsyncCommand* command)
+{
+    return kSerializer_WriteCharArray(serializer, command->text, kCountOf(command->text));
+}
+
+GoFx(kStatus) GoControl_ReadFileListResponse(GoControl control, kSerializer serializer, GoControlAsyncCommand* command)
+{
+    return GoControl_ReadFileListContent(control, serializer, command->output);
+}
+
+// Writes a command on the async connection; the dispatcher thread reads the response.
+// The async connection is established by the first command.
+GoFx(kStatus) GoControl_SubmitAsync(GoControl control, GoControlAsyncCommand* command)
+{
+    kObj(GoControl, control);
+    kBool wasRegistered = kTRUE;
+    kBool wasIdle = kFALSE;
+    kBool isShared = kFALSE;
+    kStatus exception;
+
+    kCheckState(obj->isCompatible && obj->control->isConnected && !kIsNull(obj->dispatcher));
+
+    kCheck(GoFuture_Begin(command->future));
+
+    kLock_Enter(obj->asyncLock);
+
+    kTry
+    {
+        if (!obj->async.isConnected)
+        {
+            kTest(GoControl_OpenAsyncChannel(control));
+        }
+
+        kTest(kObject_Share(command->future));
+        isShared = kTRUE;
+
+        if (!kSuccess(exception = GoControl_TransmitAsync(control, command)))
+        {
+            //a partially written command leaves the connection unusable
+            GoControl_FailAsync(control, exception);
+            GoControl_CloseAsyncChannel(control);
+            kThrow(exception);
+        }
+
+        wasIdle = (kArrayList_Count(obj->asyncInFlight) == 0);
+
+        kTest(kArrayList_AddT(obj->asyncInFlight, command));
+        isShared = kFALSE;
+
+        wasRegistered = obj->asyncRegistered;
+        obj->asyncRegistered = kTRUE;
+    }
+    kCatchEx(&exception)
+    {
+        if (isShared)
+        {
+            kObject_Destroy(command->future);
+        }
+
+        GoFuture_Cancel(command->future, exception);
+
+        kEndCatchEx(exception);
+    }
+    kFinallyEx
+    {
+        kLock_Exit(obj->asyncLock);
+        kEndFinallyEx();
+    }
+
+    //the dispatcher is not called under the async lock; the dispatcher thread acquires these locks in the opposite order
+    if (!wasRegistered)
+    {
+        kCheck(GoControlDispatcher_Add(obj->dispatcher, control));
+    }
+
+    //the dispatcher only needs a wake-up to begin waiting on this connection
+    if (wasIdle)
+    {
+        kCheck(GoControlDispatcher_Wake(obj->dispatcher));
+    }
+
+    return kOK;
+}
+
+// Called on the dispatcher thread: reads any responses that have arrived and enforces
+// response timeouts.
+GoFx(kStatus) GoControl_ServiceAsync(GoControl control)
+{
+    kObj(GoControl, control);
+    kStatus exception;
+    kSize i;
+
+    kLock_Enter(obj->asyncLock);
+
+    kTry
+    {
+        //completion handlers run within this loop, and may disconnect the sensor (closing the channel)
+        while (obj->async.isConnected && (kArrayList_Count(obj->asyncInFlight) > 0) && kSuccess(kTcpClient_Wait(obj->async.client, 0)))
+        {
+            kTest(GoControl_ReceiveAsync(control));
+        }
+
+        for (i = 0; i < kArrayList_Count(obj->asyncInFlight); ++i)
+        {
+            kTestTrue(kTimer_Now() < kArrayList_AtT(obj->asyncInFlight, i, GoControlAsyncCommand)->deadline, kERROR_TIMEOUT);
+        }
+    }
+    kCatchEx(&exception)
+    {
+        //later responses can no longer be matched to their commands; reconnect on next use
+        GoControl_FailAsync(control, exception);
+        GoControl_CloseAsyncChannel(control);
+
+        kEndCatchEx(exception);
+    }
+    kFinallyEx
+    {
+        kLock_Exit(obj->asyncLock);
+        kEndFinallyEx();
+    }
+
+    return kOK;
+}
+
+// Provides the async socket, if responses are outstanding.
+GoFx(kStatus) GoControl_AsyncSocket(GoControl control, kSocket* socket)
+{
+    kObj(GoControl, control);
+    kStatus status = kERROR_NOT_FOUND;
+
+    kLock_Enter(obj->asyncLock);
+    {
+        if (obj->async.isConnected && (kArrayList_Count(obj->asyncInFlight) > 0))
+        {
+            *socket = kTcpClient_Socket(obj->async.client);
+            status = kSocket_SetEvents(*socket, kSOCKET_EVENT_READ);
+        }
+    }
+    kLock_Exit(obj->asyncLock);
+
+    return status;
+}
+
+GoFx(kStatus) GoControl_CloseAsync(GoControl control)
+{
+    kObj(GoControl, control);
+
+    if (!kIsNull(obj->dispatcher))
+    {
+        kCheck(GoControlDispatcher_Remove(obj->dispatcher, control));
+    }
+
+    if (!kIsNull(obj->asyncLock))
+    {
+        kLock_Enter(obj->asyncLock);
+        {
+            GoControl_FailAsync(control, kERROR_CLOSED);
+            GoControl_CloseAsyncChannel(control);
+
+            obj->asyncRegistered = kFALSE;
+        }
+        kLock_Exit(obj->asyncLock);
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_OpenAsyncChannel(GoControl control)
+{
+    kObj(GoControl, control);
+    GoControlChannel* channel = &obj->async;
+    kStatus exception;
+
+    kCheck(GoControl_CloseAsyncChannel(control));
+
+    kTry
+    {
+        channel->port = obj->control->port;
+
+        kTest(kTcpClient_Construct(&channel->client, kIP_VERSION_4, kObject_Alloc(control)));
+        kTest(kTcpClient_SetReadBuffers(channel->client, -1, 4096));
+        kTest(kTcpClient_SetReadTimeout(channel->client, GO_CONTROL_ASYNC_IO_TIMEOUT));
+        kTest(kTcpClient_SetWriteTimeout(channel->client, GO_CONTROL_ASYNC_IO_TIMEOUT));
+        kTest(kTcpClient_SetNoDelay(channel->client, kTRUE));
+        kTest(kSerializer_Construct(&channel->serializer, channel->client, kTypeOf(kDat6Serializer), kObject_Alloc(control)));
+
+        kTest(kTcpClient_Connect(channel->client, obj->remoteAddress, channel->port, GO_CONTROL_CONNECT_TIMEOUT));
+        channel->isConnected = kTRUE;
+    }
+    kCatch(&exception)
+    {
+        GoControl_CloseAsyncChannel(control);
+        kEndCatch(exception);
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_CloseAsyncChannel(GoControl control)
+{
+    kObj(GoControl, control);
+    GoControlChannel* channel = &obj->async;
+
+    kCheck(kDestroyRef(&channel->serializer));
+    kCheck(kDestroyRef(&channel->client));
+
+    channel->isConnected = kFALSE;
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_TransmitAsync(GoControl control, GoControlAsyncCommand* command)
+{
+    kObj(GoControl, control);
+    kSerializer serializer = obj->async.serializer;
+
+    kCheck(kSerializer_BeginWrite(serializer, kTypeOf(k32u), kTRUE));
+    kCheck(kSerializer_Write16u(serializer, command->commandId));
+
+    if (!kIsNull(command->writeRequest))
+    {
+        kCheck(command->writeRequest(control, serializer, command));
+    }
+
+    kCheck(kSerializer_EndWrite(serializer));
+    kCheck(kSerializer_Flush(serializer));
+
+    command->deadline = kTimer_Now() + command->timeout;
+
+    return kOK;
+}
+
+// Reads one response; responses arrive in the order in which commands were sent.
+GoFx(kStatus) GoControl_ReceiveAsync(GoControl control)
+{
+    kObj(GoControl, control);
+    kSerializer serializer = obj->async.serializer;
+    GoControlAsyncCommand command = *kArrayList_AtT(obj->asyncInFlight, 0, GoControlAsyncCommand);
+    k16u responseId;
+    k32s responseStatus;
+
+    kCheck(kSerializer_BeginRead(serializer, kTypeOf(k32u), kTRUE));
+
+    kCheck(kSerializer_Read16u(serializer, &responseId));
+    kCheck(kSerializer_Read32s(serializer, &responseStatus));
+
+    kCheckTrue(responseId == command.commandId, kERROR_COMMAND);
+
+    if (kSuccess(responseStatus) && !kIsNull(command.readResponse))
+    {
+        kCheck(command.readResponse(control, serializer, &command));
+    }
+
+    kCheck(kSerializer_EndRead(serializer));
+
+    kCheck(kArrayList_Remove(obj->asyncInFlight, 0, kNULL));
+
+    kCheck(GoControl_CompleteAsync(control, &command, responseStatus));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControl_CompleteAsync(GoControl control, GoControlAsyncCommand* command, kStatus status)
+{
+    GoFuture future = command->future;
+
+    GoFuture_Complete(future, status);
+
+    //release the reference taken at submission
+    return kObject_Destroy(future);
+}
+
+GoFx(kStatus) GoControl_FailAsync(GoControl control, kStatus status)
+{
+    kObj(GoControl, control);
+    GoControlAsyncCommand command;
+
+    //completion handlers may issue new commands; those are failed too
+    while (kArrayList_Count(obj->asyncInFlight) > 0)
+    {
+        kCheck(kArrayList_Remove(obj->asyncInFlight, 0, &command));
+        kCheck(GoControl_CompleteAsync(control, &command, status));
+    }
+
+    return kOK;
+}
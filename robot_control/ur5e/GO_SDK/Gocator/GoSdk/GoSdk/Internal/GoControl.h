@@ -432,6 +432,23 @@ GoFx(kStatus) GoControl_ReadFileList(GoControl control, kArrayList files, const
  */
 GoFx(kStatus) GoControl_ReadFile(GoControl control, const kChar* fileName, kByte** data, kSize* size, kAlloc allocator);
 
+/**
+ * Reads a file from the connected sensor into a stream.
+ *
+ * File content is copied to the stream in fixed-size chunks as it arrives, so that memory usage
+ * does not depend on file size.
+ *
+ * @public              @memberof GoControl
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   control     GoControl object.
+ * @param   fileName    Name of remote file to be read.
+ * @param   stream      Destination stream (e.g., kFile, kMemory).
+ * @param   progress    Optional progress callback (can be kNULL).
+ * @param   receiver    Receiver argument for progress callback.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoControl_ReadFileToStream(GoControl control, const kChar* fileName, kStream stream, GoTransferFx progress, kPointer receiver);
+
 /**
  * Clears the sensor log file.
  *
@@ -455,6 +472,25 @@ GoFx(kStatus) GoControl_ClearLog(GoControl control);
  */
 GoFx(kStatus) GoControl_WriteFile(GoControl control, const kChar* fileName, const kByte* data, kSize size);
 
+/**
+ * Writes a file to the connected sensor from a stream.
+ *
+ * Content is read from the source stream on a background thread while previously read content
+ * is sent, using a bounded number of fixed-size buffers. If the transfer fails part-way, the
+ * connection is closed, because a partially sent command cannot be completed.
+ *
+ * @public              @memberof GoControl
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   control     GoControl object.
+ * @param   fileName    Name of remote file to be written.
+ * @param   source      Source stream (e.g., kFile); must provide at least size bytes.
+ * @param   size        Size of the file.
+ * @param   progress    Optional progress callback (can be kNULL).
+ * @param   receiver    Receiver argument for progress callback.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoControl_WriteFileFromStream(GoControl control, const kChar* fileName, kStream source, k64u size, GoTransferFx progress, kPointer receiver);
+
 /**
  * Copies a file within the connected sensor.
  *
@@ -584,6 +620,24 @@ GoFx(kStatus) GoControl_ResetEncoder(GoControl control);
  */
 GoFx(kStatus) GoControl_BeginUpgrade(GoControl control, void* data, kSize size);
 
+/**
+ * Begins a sensor firmware upgrade, reading the upgrade file from a stream.
+ *
+ * Content is read from the source stream on a background thread while previously read content
+ * is sent, using a bounded number of fixed-size buffers.
+ *
+ * @public              @memberof GoControl
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   control     GoControl object.
+ * @param   source      Source stream (e.g., kFile); must provide at least size bytes.
+ * @param   size        Size of upgrade file.
+ * @param   progress    Optional progress callback for the file transfer (can be kNULL).
+ * @param   receiver    Receiver argument for progress callback.
+ * @return              Operation status.
+ * @see                 GoControl_GetUpgradeStatus
+ */
+GoFx(kStatus) GoControl_BeginUpgradeFromStream(GoControl control, kStream source, k64u size, GoTransferFx progress, kPointer receiver);
+
 /**
  * Polls for upgrade status.
  *
@@ -642,6 +696,22 @@ GoFx(kStatus) GoControl_Trigger(GoControl control);
  */
 GoFx(kStatus) GoControl_Backup(GoControl control, kByte** fileData, kSize* size, kAlloc allocator);
 
+/**
+ * Creates a backup of sensor files and downloads it into a stream.
+ *
+ * Backup content is copied to the stream in fixed-size chunks as it arrives, so that memory usage
+ * does not depend on backup size.
+ *
+ * @public              @memberof GoControl
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   control     GoControl object.
+ * @param   stream      Destination stream (e.g., kFile, kMemory).
+ * @param   progress    Optional progress callback (can be kNULL).
+ * @param   receiver    Receiver argument for progress callback.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoControl_BackupToStream(GoControl control, kStream stream, GoTransferFx progress, kPointer receiver);
+
 /**
  * Restores a backup of sensor files.
  *
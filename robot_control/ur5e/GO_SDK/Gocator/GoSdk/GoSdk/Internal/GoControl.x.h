@@ -16,6 +16,9 @@
 #include <kApi/Io/kSerializer.h>
 #include <kApi/Threads/kTimer.h>
 #include <kApi/Threads/kThread.h>
+#include <kApi/Threads/kSemaphore.h>
+#include <kApi/Threads/kLock.h>
+#include <GoSdk/GoFuture.h>
 #include <kApi/Io/kPath.h>
 #include <kApi/Utils/kDateTime.h>
 
@@ -26,6 +29,12 @@
 #define GO_CONTROL_CONNECT_TIMEOUT                  (5000000)
 #define GO_CONTROL_CANCEL_QUERY_INTERVAL            (100000)
 
+#define GO_CONTROL_TRANSFER_CHUNK_SIZE              (65536)         //bytes copied per step when streaming file content
+#define GO_CONTROL_UPLOAD_BUFFER_SIZE               (1048576)       //size of each read-ahead buffer used for uploads
+#define GO_CONTROL_UPLOAD_BUFFER_COUNT              (4)             //number of read-ahead buffers used for uploads
+
+#define GO_CONTROL_ASYNC_IO_TIMEOUT                 (1000000)       //max time to complete a partially transferred async message (us)
+
 
 #define GO_CONTROL_BEGIN_UPGRADE                    (0x0000)
 #define GO_CONTROL_BEGIN_UPGRADE_TIMEOUT            (40000000)
@@ -299,6 +308,22 @@ typedef struct GoControlChunkedDataStreamInfo
 
 } GoControlChunkedDataStreamInfo;
 
+//reads upload content from a stream on a background thread, while the caller writes to the socket
+typedef struct GoControlReadAhead
+{
+    kAlloc alloc;
+    kStream source;                                         //source stream
+    k64u remaining;                                         //bytes yet to be read from the source stream
+    kByte* buffers[GO_CONTROL_UPLOAD_BUFFER_COUNT];         //ring of read-ahead buffers
+    kSize sizes[GO_CONTROL_UPLOAD_BUFFER_COUNT];            //valid bytes in each buffer
+    kSize next;                                             //next buffer to be consumed
+    kSemaphore filled;                                      //counts buffers ready to be consumed
+    kSemaphore empty;                                       //counts buffers ready to be filled
+    kThread thread;                                         //reader thread
+    kAtomic32s quit;                                        //requests early exit of reader thread
+    kStatus readStatus;                                     //reader thread error, if any
+} GoControlReadAhead;
+
 typedef struct GoControlChannel
 {
     GoControl parent;
@@ -312,6 +337,26 @@ typedef struct GoControlChannel
     kTimer timer;
 } GoControlChannel;
 
+struct GoControlAsyncCommand;
+
+//writes request content or reads response content for an asynchronous command
+typedef kStatus (kCall* GoControlAsyncFx)(GoControl control, kSerializer serializer, struct GoControlAsyncCommand* command);
+
+//asynchronous command awaiting its response
+typedef struct GoControlAsyncCommand
+{
+    k16u commandId;
+    k64u timeout;                                           //response timeout (us)
+    k64u deadline;                                          //time by which the response must arrive (kTimer_Now)
+    GoControlAsyncFx writeRequest;                          //writes request content (or kNULL)
+    GoControlAsyncFx readResponse;                          //reads response content (or kNULL)
+    kPointer output;                                        //caller-supplied output storage
+    kText64 text;                                           //text request argument
+    GoFuture future;                                        //completion (shared reference)
+} GoControlAsyncCommand;
+
+kDeclareValueEx(Go, GoControlAsyncCommand, kValue)
+
 typedef struct GoControlClass
 {
     kObjectClass base;
@@ -332,6 +377,13 @@ typedef struct GoControlClass
     kThread streamThread;
     kAtomic32s streamIsCancelled;
 
+    //asynchronous commands are pipelined on a dedicated connection; responses are read by the dispatcher thread
+    GoControlChannel async;
+    kLock asyncLock;                                        //protects async channel and in-flight list
+    kArrayList asyncInFlight;                               //commands awaiting responses, in order (kArrayList<GoControlAsyncCommand>)
+    kObject dispatcher;                                     //I/O thread servicing this object (GoControlDispatcher)
+    kBool asyncRegistered;                                  //has been added to dispatcher
+
 } GoControlClass;
 
 kDeclareClassEx(Go, GoControl, kObject)
@@ -344,6 +396,7 @@ GoFx(kStatus) GoControl_DetectProtocolVersion(GoControl control, kVersion* versi
 
 GoFx(kStatus) GoControl_InitChannel(GoControl control, GoControlChannel* channel);
 GoFx(kStatus) GoControl_ConnectChannel(GoControl control, GoControlChannel* channel);
+GoFx(kStatus) GoControl_ResetChannel(GoControl control, GoControlChannel* channel);
 
 GoFx(kStatus) GoControl_CancelHandler(kPointer channel, kObject sender, kPointer args);
 
@@ -363,7 +416,25 @@ GoFx(kStatus) GoControl_GetProtocolVersion(GoControl control, kVersion* version)
 
 GoFx(kStatus) GoControl_ReadFileStreamed(GoControl control, const kChar* srcFileName, const kChar* dstFileName, kBool continuous);
 
+GoFx(kStatus) GoControl_BeginReadFileStreamed(GoControl control, const kChar* srcFileName);
+GoFx(kStatus) GoControl_ReadFileStreamedToStream(GoControl control, const kChar* srcFileName, kStream stream, GoTransferFx progress, kPointer receiver);
+
+GoFx(kStatus) GoControl_ReadContent(GoControl control, GoControlChannel* channel, kStream stream, k64u size, k64u timeout, GoTransferFx progress, kPointer receiver, GoTransferFxArgs* transfer);
+GoFx(kStatus) GoControl_ReportTransfer(GoControl control, GoTransferFx progress, kPointer receiver, GoTransferFxArgs* transfer);
+
+GoFx(kStatus) GoControl_BeginSizedCommand(GoControl control, GoControlChannel* channel, k16u commandId, k64u timeout, k64u contentSize);
+GoFx(kStatus) GoControl_BeginSizedLegacyCommand(GoControl control, GoControlChannel* channel, k16u commandId, k64u timeout, k64u contentSize);
+GoFx(kStatus) GoControl_SendSized(GoControl control, GoControlChannel* channel);
+GoFx(kStatus) GoControl_WriteContent(GoControl control, GoControlChannel* channel, kStream source, k64u size, k64u timeout, GoTransferFx progress, kPointer receiver, GoTransferFxArgs* transfer);
+
+GoFx(kStatus) GoControl_BeginReadAhead(GoControl control, GoControlReadAhead* readAhead, kStream source, k64u size);
+GoFx(kStatus) GoControl_EndReadAhead(GoControl control, GoControlReadAhead* readAhead);
+GoFx(kStatus) GoControl_ReadAheadThreadEntry(kPointer context);
+GoFx(kStatus) GoControl_AcquireReadAhead(GoControl control, GoControlReadAhead* readAhead, const kByte** buffer, kSize* size);
+GoFx(kStatus) GoControl_ReleaseReadAhead(GoControl control, GoControlReadAhead* readAhead);
+
 GoFx(kStatus) GoControl_ReadChunkedData(GoControl control, const kChar* dstFileName);
+GoFx(kStatus) GoControl_ReadChunkedDataToStream(GoControl control, kStream stream, GoTransferFx progress, kPointer receiver);
 GoFx(kStatus) GoControl_ReadChunkedDataStream(kPointer context);
 
 GoFx(kStatus) GoControl_StartStreamingChunkedData(GoControl control, const kChar* dstFileName);
@@ -411,4 +482,34 @@ GoFx(kStatus) GoControl_SetLaserState(GoControl control, k8u enable);
 GoFx(kStatus) GoControl_Shutdown(GoControl control);
 GoFx(kStatus) GoControl_LockOutLaser(GoControl control, kBool shouldLock);
 
+GoFx(kStatus) GoControl_ReadStates(GoControl control, kSerializer serializer, GoStates* states);
+GoFx(kStatus) GoControl_ReadFileListContent(GoControl control, kSerializer serializer, kArrayList files);
+
+GoFx(kStatus) GoControl_SetDispatcher(GoControl control, kObject dispatcher);
+GoFx(kObject) GoControl_Dispatcher(GoControl control);
+
+GoFx(kStatus) GoControl_GetStatesAsync(GoControl control, GoStates* states, GoFuture future);
+GoFx(kStatus) GoControl_GetTimestampAsync(GoControl control, k64u* time, GoFuture future);
+GoFx(kStatus) GoControl_GetEncoderAsync(GoControl control, k64s* encoder, GoFuture future);
+GoFx(kStatus) GoControl_TriggerAsync(GoControl control, GoFuture future);
+GoFx(kStatus) GoControl_ReadFileListAsync(GoControl control, kArrayList files, const kChar* extensionFilter, GoFuture future);
+
+GoFx(kStatus) GoControl_SubmitAsync(GoControl control, GoControlAsyncCommand* command);
+GoFx(kStatus) GoControl_ServiceAsync(GoControl control);
+GoFx(kStatus) GoControl_AsyncSocket(GoControl control, kSocket* socket);
+GoFx(kStatus) GoControl_CloseAsync(GoControl control);
+
+GoFx(kStatus) GoControl_OpenAsyncChannel(GoControl control);
+GoFx(kStatus) GoControl_CloseAsyncChannel(GoControl control);
+GoFx(kStatus) GoControl_TransmitAsync(GoControl control, GoControlAsyncCommand* command);
+GoFx(kStatus) GoControl_ReceiveAsync(GoControl control);
+GoFx(kStatus) GoControl_CompleteAsync(GoControl control, GoControlAsyncCommand* command, kStatus status);
+GoFx(kStatus) GoControl_FailAsync(GoControl control, kStatus status);
+
+GoFx(kStatus) GoControl_ReadStatesResponse(GoControl control, kSerializer serializer, GoControlAsyncCommand* command);
+GoFx(kStatus) GoControl_ReadTimestampResponse(GoControl control, kSerializer serializer, GoControlAsyncCommand* command);
+GoFx(kStatus) GoControl_ReadEncoderResponse(GoControl control, kSerializer serializer, GoControlAsyncCommand* command);
+GoFx(kStatus) GoControl_WriteFileListRequest(GoControl control, kSerializer serializer, GoControlAsyncCommand* command);
+GoFx(kStatus) GoControl_ReadFileListResponse(GoControl control, kSerializer serializer, GoControlAsyncCommand* command);
+
 #endif
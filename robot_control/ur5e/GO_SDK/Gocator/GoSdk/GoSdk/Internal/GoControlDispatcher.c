@@ -0,0 +1,191 @@
+/**
+ * @file    GoControlDispatcher.c
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#include <GoSdk/Internal/GoControlDispatcher.h>
+
+kBeginClassEx(Go, GoControlDispatcher)
+    kAddVMethod(GoControlDispatcher, kObject, VRelease)
+kEndClassEx()
+
+GoFx(kStatus) GoControlDispatcher_Construct(GoControlDispatcher* dispatcher, kAlloc allocator)
+{
+    kAlloc alloc = kAlloc_Fallback(allocator);
+    kStatus status;
+
+    kCheck(kAlloc_GetObject(alloc, kTypeOf(GoControlDispatcher), dispatcher));
+
+    if (!kSuccess(status = GoControlDispatcher_Init(*dispatcher, kTypeOf(GoControlDispatcher), alloc)))
+    {
+        kAlloc_FreeRef(alloc, dispatcher);
+    }
+
+    return status;
+}
+
+GoFx(kStatus) GoControlDispatcher_Init(GoControlDispatcher dispatcher, kType type, kAlloc alloc)
+{
+    kObjR(GoControlDispatcher, dispatcher);
+    kStatus status;
+
+    kCheck(kObject_Init(dispatcher, type, alloc));
+    obj->lock = kNULL;
+    obj->controls = kNULL;
+    obj->sockets = kNULL;
+    obj->wake = kNULL;
+    obj->thread = kNULL;
+    kAtomic32s_Init(&obj->quit, kFALSE);
+
+    kTry
+    {
+        kTest(kLock_Construct(&obj->lock, alloc));
+        kTest(kArrayList_Construct(&obj->controls, kTypeOf(GoControl), 0, alloc));
+        kTest(kArrayList_Construct(&obj->sockets, kTypeOf(kSocket), 0, alloc));
+        kTest(kSemaphore_Construct(&obj->wake, 0, alloc));
+
+        kTest(kThread_Construct(&obj->thread, alloc));
+        kTest(kThread_Start(obj->thread, GoControlDispatcher_ThreadEntry, dispatcher));
+    }
+    kCatch(&status)
+    {
+        GoControlDispatcher_VRelease(dispatcher);
+        kEndCatch(status);
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControlDispatcher_VRelease(GoControlDispatcher dispatcher)
+{
+    kObj(GoControlDispatcher, dispatcher);
+
+    if (!kIsNull(obj->thread))
+    {
+        kAtomic32s_Exchange(&obj->quit, kTRUE);
+        kCheck(kSemaphore_Post(obj->wake));
+
+        kCheck(kThread_Join(obj->thread, kINFINITE, kNULL));
+    }
+
+    kCheck(kDestroyRef(&obj->thread));
+    kCheck(kDestroyRef(&obj->wake));
+    kCheck(kDestroyRef(&obj->sockets));
+    kCheck(kDestroyRef(&obj->controls));
+    kCheck(kDestroyRef(&obj->lock));
+
+    return kObject_VRelease(dispatcher);
+}
+
+GoFx(kStatus) GoControlDispatcher_Add(GoControlDispatcher dispatcher, GoControl control)
+{
+    kObj(GoControlDispatcher, dispatcher);
+    kStatus status = kOK;
+    kSize i;
+
+    kLock_Enter(obj->lock);
+    {
+        for (i = 0; i < kArrayList_Count(obj->controls); ++i)
+        {
+            if (kArrayList_AsT(obj->controls, i, GoControl) == control)
+            {
+                break;
+            }
+        }
+
+        if (i == kArrayList_Count(obj->controls))
+        {
+            status = kArrayList_AddT(obj->controls, &control);
+        }
+    }
+    kLock_Exit(obj->lock);
+
+    return status;
+}
+
+GoFx(kStatus) GoControlDispatcher_Remove(GoControlDispatcher dispatcher, GoControl control)
+{
+    kObj(GoControlDispatcher, dispatcher);
+    kSize i;
+
+    kLock_Enter(obj->lock);
+    {
+        for (i = 0; i < kArrayList_Count(obj->controls); ++i)
+        {
+            if (kArrayList_AsT(obj->controls, i, GoControl) == control)
+            {
+                kArrayList_Discard(obj->controls, i);
+                break;
+            }
+        }
+    }
+    kLock_Exit(obj->lock);
+
+    return kOK;
+}
+
+GoFx(kStatus) GoControlDispatcher_Wake(GoControlDispatcher dispatcher)
+{
+    kObj(GoControlDispatcher, dispatcher);
+
+    return kSemaphore_Post(obj->wake);
+}
+
+GoFx(kStatus) GoControlDispatcher_ThreadEntry(GoControlDispatcher dispatcher)
+{
+    kObj(GoControlDispatcher, dispatcher);
+    kSize i;
+
+    while (!kAtomic32s_Get(&obj->quit))
+    {
+        kBool outstanding;
+
+        // The lock is held while waiting on sockets, so that a control object cannot be
+        // closed (or its sockets destroyed) while in use by this thread.
+        kLock_Enter(obj->lock);
+        {
+            kArrayList_Clear(obj->sockets);
+
+            i = 0;
+
+            while (i < kArrayList_Count(obj->controls))
+            {
+                GoControl control = kArrayList_AsT(obj->controls, i, GoControl);
+                kSocket socket = kNULL;
+
+                GoControl_ServiceAsync(control);
+
+                //a completion handler may have closed the control, removing it from the list
+                if ((i >= kArrayList_Count(obj->controls)) || (kArrayList_AsT(obj->controls, i, GoControl) != control))
+                {
+                    continue;
+                }
+
+                if (kSuccess(GoControl_AsyncSocket(control, &socket)))
+                {
+                    kArrayList_AddT(obj->sockets, &socket);
+                }
+
+                ++i;
+            }
+
+            outstanding = (kArrayList_Count(obj->sockets) > 0);
+
+            if (outstanding)
+            {
+                kSocket_WaitAny(kArrayList_DataT(obj->sockets, kSocket), kArrayList_Count(obj->sockets), GO_CONTROL_DISPATCHER_POLL_INTERVAL);
+            }
+        }
+        kLock_Exit(obj->lock);
+
+        if (!outstanding)
+        {
+            kSemaphore_Wait(obj->wake, GO_CONTROL_DISPATCHER_IDLE_INTERVAL);
+        }
+    }
+
+    return kOK;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file    GoControlDispatcher.h
+ * @brief   Declares the GoControlDispatcher class.
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef GO_SDK_CONTROL_DISPATCHER_H
+#define GO_SDK_CONTROL_DISPATCHER_H
+
+#include <GoSdk/GoSdkDef.h>
+#include <GoSdk/Internal/GoControl.h>
+
+/**
+ * @class   GoControlDispatcher
+ * @extends kObject
+ * @ingroup GoSdk-Internal
+ * @brief   Services asynchronous control commands for a set of sensors on a single I/O thread.
+ *
+ * Commands are written by the calling thread; the dispatcher thread reads responses as
+ * they arrive and completes the associated futures. One dispatcher is shared by all sensors
+ * in a system.
+ */
+typedef kObject GoControlDispatcher;
+
+/**
+ * Constructs a GoControlDispatcher object and starts its I/O thread.
+ *
+ * @public              @memberof GoControlDispatcher
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   dispatcher  Receives constructed dispatcher object.
+ * @param   allocator   Memory allocator (or kNULL for default)
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoControlDispatcher_Construct(GoControlDispatcher* dispatcher, kAlloc allocator);
+
+/**
+ * Adds a control object to the set serviced by the dispatcher.
+ *
+ * Has no effect if the control object has already been added.
+ *
+ * @public              @memberof GoControlDispatcher
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   dispatcher  Dispatcher object.
+ * @param   control     Control object.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoControlDispatcher_Add(GoControlDispatcher dispatcher, GoControl control);
+
+/**
+ * Removes a control object from the set serviced by the dispatcher.
+ *
+ * On return, the dispatcher thread is guaranteed not to be using the control object.
+ *
+ * @public              @memberof GoControlDispatcher
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   dispatcher  Dispatcher object.
+ * @param   control     Control object.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoControlDispatcher_Remove(GoControlDispatcher dispatcher, GoControl control);
+
+/**
+ * Wakes the dispatcher thread, so that it begins waiting for responses to newly issued commands.
+ *
+ * @public              @memberof GoControlDispatcher
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   dispatcher  Dispatcher object.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoControlDispatcher_Wake(GoControlDispatcher dispatcher);
+
+#include <GoSdk/Internal/GoControlDispatcher.x.h>
+
+#endif
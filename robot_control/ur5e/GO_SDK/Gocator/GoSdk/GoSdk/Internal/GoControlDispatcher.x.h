@@ -0,0 +1,41 @@
+/**
+ * @file    GoControlDispatcher.x.h
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef GO_SDK_CONTROL_DISPATCHER_X_H
+#define GO_SDK_CONTROL_DISPATCHER_X_H
+
+#include <kApi/Data/kArrayList.h>
+#include <kApi/Io/kSocket.h>
+#include <kApi/Threads/kAtomic.h>
+#include <kApi/Threads/kLock.h>
+#include <kApi/Threads/kSemaphore.h>
+#include <kApi/Threads/kThread.h>
+
+#define GO_CONTROL_DISPATCHER_IDLE_INTERVAL         (100000)        //max wait while no responses are outstanding (us)
+#define GO_CONTROL_DISPATCHER_POLL_INTERVAL         (1000)          //max socket wait while responses are outstanding; bounds pickup of newly active controls (us)
+
+typedef struct GoControlDispatcherClass
+{
+    kObjectClass base;
+
+    kLock lock;                                 //protects control list; held while servicing
+    kArrayList controls;                        //serviced control objects (kArrayList<GoControl>)
+    kArrayList sockets;                         //sockets with outstanding responses (kArrayList<kSocket>)
+    kSemaphore wake;                            //signalled when a control object becomes active
+    kThread thread;                             //I/O thread
+    kAtomic32s quit;                            //requests exit of I/O thread
+} GoControlDispatcherClass;
+
+kDeclareClassEx(Go, GoControlDispatcher, kObject)
+
+GoFx(kStatus) GoControlDispatcher_Init(GoControlDispatcher dispatcher, kType type, kAlloc alloc);
+GoFx(kStatus) GoControlDispatcher_VRelease(GoControlDispatcher dispatcher);
+
+GoFx(kStatus) GoControlDispatcher_ThreadEntry(GoControlDispatcher dispatcher);
+
+#endif
@@ -8,6 +8,7 @@
  */
 #include <GoSdk/Internal/GoDiscovery.h>
 #include <kApi/Utils/kUtils.h>
+#include <kApi/Io/kFile.h>
 
 kBeginValueEx(Go, GoDiscoveryInfo)
 kEndValueEx()
@@ -175,16 +176,25 @@ GoFx(kStatus) GoDiscovery_Init(GoDiscovery discovery, kType type, kBool enableAu
     kZero(obj->readerBuffer);
     kZero(obj->reader);
     kZero(obj->eventTimer);
-    kZero(obj->stopwatch);
-    obj->enumPending = kFALSE;
     kZero(obj->enumLock);
+    kZero(obj->sendLock);
+    kZero(obj->replyThread);
+    kAtomic32s_Init(&obj->replyQuit, kFALSE);
+    kZero(obj->replyLock);
+    kZero(obj->waiters);
+    obj->enumActive = kFALSE;
+    kZero(obj->enumSignal);
     kZero(obj->sensorInfoMap);
+    kZero(obj->addressCache);
+    obj->cachePath[0] = 0;
 
     kTry
     {
         kAtomic32s_Exchange(&obj->compatEnabled, 0);
 
         kTest(kMap_Construct(&obj->sensorInfoMap, kTypeOf(k32u), kTypeOf(GoDiscoveryInfo), 0, alloc));
+        kTest(kMap_Construct(&obj->addressCache, kTypeOf(k32u), kTypeOf(GoDiscoveryInfo), 0, alloc));
+        kTest(kArrayList_Construct(&obj->waiters, kTypeOf(kPointer), 0, alloc));
         kTest(kArrayList_Construct(&obj->infoList, kTypeOf(GoDiscoveryInfo), 0, alloc));
         kTest(kArrayList_Construct(&obj->interfaces, kTypeOf(GoDiscoveryInterface), 0, alloc));
 
@@ -209,9 +219,11 @@ GoFx(kStatus) GoDiscovery_Init(GoDiscovery discovery, kType type, kBool enableAu
         kTest(kSerializer_Construct(&obj->reader, obj->readerBuffer, kNULL, alloc));
 
         kTest(kPeriodic_Construct(&obj->eventTimer, alloc));
-        kTest(kTimer_Construct(&obj->stopwatch, alloc));
 
         kTest(kLock_Construct(&obj->enumLock, alloc));
+        kTest(kLock_Construct(&obj->sendLock, alloc));
+        kTest(kLock_Construct(&obj->replyLock, alloc));
+        kTest(kSemaphore_Construct(&obj->enumSignal, 0, alloc));
 
         kTest(kArrayList_Construct(&addresses, kTypeOf(kIpEntry), 0, alloc));
         kTest(kNetwork_LocalIpInterfaces(addresses));
@@ -253,6 +265,9 @@ GoFx(kStatus) GoDiscovery_Init(GoDiscovery discovery, kType type, kBool enableAu
                 kDestroyRef(&iface.client);
             }
         }
+
+        kTest(kThread_Construct(&obj->replyThread, alloc));
+        kTest(kThread_Start(obj->replyThread, GoDiscovery_ReplyThreadEntry, discovery));
     }
     kCatchEx(&status)
     {
@@ -280,8 +295,19 @@ GoFx(kStatus) GoDiscovery_VRelease(GoDiscovery discovery)
         kCheck(GoDiscovery_StopEnum(discovery));
     }
 
+    if (!kIsNull(obj->replyThread))
+    {
+        kAtomic32s_Exchange(&obj->replyQuit, kTRUE);
+
+        kCheck(kThread_Join(obj->replyThread, kINFINITE, kNULL));
+    }
+
+    kCheck(kDestroyRef(&obj->replyThread));
+
     kCheck(kDisposeRef(&obj->infoList));
     kCheck(kDisposeRef(&obj->sensorInfoMap));
+    kCheck(kDisposeRef(&obj->addressCache));
+    kCheck(kDisposeRef(&obj->waiters));
 
     if (!kIsNull(obj->interfaces))
     {
@@ -296,6 +322,9 @@ GoFx(kStatus) GoDiscovery_VRelease(GoDiscovery discovery)
         kCheck(kDisposeRef(&obj->interfaces));
     }
 
+    kCheck(kDestroyRef(&obj->enumSignal));
+    kCheck(kDestroyRef(&obj->replyLock));
+    kCheck(kDestroyRef(&obj->sendLock));
     kCheck(kDestroyRef(&obj->enumLock));
 
     kCheck(kDestroyRef(&obj->reader));
@@ -303,7 +332,6 @@ GoFx(kStatus) GoDiscovery_VRelease(GoDiscovery discovery)
     kCheck(kDestroyRef(&obj->receiver));
 
     kCheck(kDestroyRef(&obj->eventTimer));
-    kCheck(kDestroyRef(&obj->stopwatch));
 
     return kObject_VRelease(discovery);
 }
@@ -357,7 +385,7 @@ GoFx(kStatus) GoDiscovery_Enumerate(GoDiscovery discovery, kArrayList infoList)
     kTry
     {
         kTest(GoDiscovery_BeginEnum(discovery));
-        kTest(kThread_Sleep(GO_DISCOVERY_GET_ADDRESS_TIMEOUT));
+        kTest(GoDiscovery_WaitEnum(discovery, GO_DISCOVERY_GET_ADDRESS_TIMEOUT));
         kTest(GoDiscovery_EndEnum(discovery, infoList));
     }
     kFinally
@@ -372,247 +400,313 @@ GoFx(kStatus) GoDiscovery_Enumerate(GoDiscovery discovery, kArrayList infoList)
 
 GoFx(kStatus) GoDiscovery_GetAddress(GoDiscovery discovery, k32u deviceId, GoAddressInfo* address)
 {
-    kObj(GoDiscovery, discovery);
-    GoDiscoveryInfo info;
-    kIpEndPoint remoteEndPoint;
-    kSize i;
-    kStatus sendStatus = kERROR_NETWORK;
-    kStatus recvStatus = kERROR_NOT_FOUND;
+    GoDiscoveryWaiter waiter;
+
+    kCheck(GoDiscovery_BeginWait(discovery, &waiter, GO_DISCOVERY_GET_ADDRESS_REPLY, deviceId, kNULL));
 
-    kCheck(kLock_Enter(obj->enumLock));
     kTry
     {
-        for (i = 0; i < kArrayList_Count(obj->interfaces); ++i)
-        {
-            GoDiscoveryInterface* iface = kArrayList_AtT(obj->interfaces, i, GoDiscoveryInterface);
+        kTest(GoDiscovery_Transmit(discovery, GoDiscovery_WriteGetAddress, deviceId, kNULL, GO_DISCOVERY_GET_ADDRESS_TIMEOUT));
+        kTest(GoDiscovery_Wait(discovery, &waiter, GO_DISCOVERY_GET_ADDRESS_TIMEOUT));
 
-            if (iface->enabled)
-            {
-                kTest(kSerializer_Write64s(iface->writer, GO_DISCOVERY_GET_ADDRESS_SIZE));
-                kTest(kSerializer_Write64s(iface->writer, GO_DISCOVERY_GET_ADDRESS));
-                kTest(kSerializer_Write64s(iface->writer, GO_DISOVERY_SIGNATURE));
-                kTest(kSerializer_Write64s(iface->writer, deviceId));
+        DEBUG_PRINT("%s: sensor %u remote end point\n", __FUNCTION__, deviceId);
 
-                kTest(kSerializer_Flush(iface->writer));
+        *address = waiter.info.address;
+    }
+    kFinally
+    {
+        GoDiscovery_EndWait(discovery, &waiter);
 
-                if (kSuccess(kUdpClient_Send(iface->client, kIpAddress_BroadcastV4(), GO_DISCOVERY_PORT, GO_DISCOVERY_GET_ADDRESS_TIMEOUT, kTRUE)))
-                {
-                    sendStatus = kOK;
-                }
-            }
-        }
+        kEndFinally();
+    }
 
-        kTest(sendStatus);
-        kTest(kTimer_Start(obj->stopwatch, GO_DISCOVERY_GET_ADDRESS_TIMEOUT));
+    return kOK;
+}
 
-        do
-        {
-            if (kSuccess(GoDiscovery_ReceiveReply(discovery, &remoteEndPoint, kTimer_Remaining(obj->stopwatch)))
-                && remoteEndPoint.port == GO_DISCOVERY_PORT
-                && kSuccess(GoDiscovery_ParseGetAddressReply(discovery, &info, &remoteEndPoint))
-                && info.id == deviceId)
-            {
-                *address = info.address;
-                recvStatus = kOK;
+GoFx(kStatus) GoDiscovery_SetAddress(GoDiscovery discovery, k32u deviceId, const GoAddressInfo* address)
+{
+    GoDiscoveryWaiter waiter;
 
-                DEBUG_PRINT("%s: sensor %u remote end point\n", __FUNCTION__, deviceId);
-                DEBUG_PRINT_ENDPOINT(&remoteEndPoint);
+    kCheck(GoDiscovery_BeginWait(discovery, &waiter, GO_DISCOVERY_SET_ADDRESS_REPLY, deviceId, kNULL));
 
-                break;
-            }
-        } while (!kTimer_IsExpired(obj->stopwatch));
+    kTry
+    {
+        kTest(GoDiscovery_Transmit(discovery, GoDiscovery_WriteSetAddress, deviceId, address, GO_DISCOVERY_SET_ADDRESS_TIMEOUT));
+        kTest(GoDiscovery_Wait(discovery, &waiter, GO_DISCOVERY_SET_ADDRESS_TIMEOUT));
     }
     kFinally
     {
-        kLock_Exit(obj->enumLock);
+        GoDiscovery_EndWait(discovery, &waiter);
 
         kEndFinally();
     }
 
-    return recvStatus;
+    return kOK;
 }
 
-GoFx(kStatus) GoDiscovery_SetAddress(GoDiscovery discovery, k32u deviceId, const GoAddressInfo* address)
+GoFx(kStatus) GoDiscovery_SetAddressTest(GoDiscovery discovery, k32u deviceId, const GoAddressInfo* address)
 {
-    kObj(GoDiscovery, discovery);
-    k32u responseDeviceId;
-    kIpEndPoint remoteEndPoint;
-    kIpAddress zero;
-    kSize i;
-    kStatus sendStatus = kERROR_NETWORK;
+    GoDiscoveryWaiter waiter;
 
-    for (i = 0; i < 16; i++)
+    kCheck(GoDiscovery_BeginWait(discovery, &waiter, GO_DISCOVERY_SET_ADDRESS_TEST_REPLY, deviceId, kNULL));
+
+    kTry
     {
-        zero.address[i] = 0;
+        kTest(GoDiscovery_SendSetAddressTest(discovery, deviceId, address));
+        kTest(GoDiscovery_Wait(discovery, &waiter, GO_DISCOVERY_SET_ADDRESS_TEST_TIMEOUT));
     }
-
-    for (i = 0; i < kArrayList_Count(obj->interfaces); ++i)
+    kFinally
     {
-        GoDiscoveryInterface* iface = kArrayList_AtT(obj->interfaces, i, GoDiscoveryInterface);
+        GoDiscovery_EndWait(discovery, &waiter);
+
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoDiscovery_SendSetAddressTest(GoDiscovery discovery, k32u deviceId, const GoAddressInfo* address)
+{
+    kObj(GoDiscovery, discovery);
+    kSize i;
 
-        if (iface->enabled)
+    kCheck(kLock_Enter(obj->sendLock));
+
+    kTry
+    {
+        for (i = 0; i < kArrayList_Count(obj->interfaces); ++i)
         {
-            kCheck(kSerializer_Write64s(iface->writer, GO_DISCOVERY_SET_ADDRESS_SIZE));
-            kCheck(kSerializer_Write64s(iface->writer, GO_DISCOVERY_SET_ADDRESS));
-            kCheck(kSerializer_Write64s(iface->writer, GO_DISOVERY_SIGNATURE));
-            kCheck(kSerializer_Write64s(iface->writer, deviceId));
-            kCheck(kSerializer_Write64s(iface->writer, address->useDhcp));
-
-            kCheck(GoDiscovery_WriteIpAddress(iface->writer, (address->useDhcp) ? kIpAddress_AnyV4() : address->address));
-            kCheck(GoDiscovery_WriteIpAddress(iface->writer, (address->useDhcp) ? kIpAddress_AnyV4() : address->mask));
-            kCheck(GoDiscovery_WriteIpAddress(iface->writer, (address->useDhcp) ? kIpAddress_AnyV4() : address->gateway));
-            kCheck(GoDiscovery_WriteIpAddress(iface->writer, (address->useDhcp) ? kIpAddress_AnyV4() : zero));
-
-            kCheck(kSerializer_Flush(iface->writer));
-            if (kSuccess(kUdpClient_Send(iface->client, kIpAddress_BroadcastV4(), GO_DISCOVERY_PORT, GO_DISCOVERY_SET_ADDRESS_TIMEOUT, kTRUE)))
+            GoDiscoveryInterface* iface = kArrayList_AtT(obj->interfaces, i, GoDiscoveryInterface);
+
+            if (iface->enabled)
             {
-                sendStatus = kOK;
+                kTest(kSocket_Connect(kUdpClient_Socket(iface->client), kIpAddress_BroadcastV4(), GO_DISCOVERY_PORT, 1000000));
+
+                kTest(GoDiscovery_WriteSetAddressTest(iface->writer, deviceId, address));
+
+                kTest(kSerializer_Flush(iface->writer));
+                kTest(kUdpClient_Send(iface->client, kIpAddress_BroadcastV4(), GO_DISCOVERY_PORT, GO_DISCOVERY_SET_ADDRESS_TIMEOUT, kTRUE));
             }
         }
     }
+    kFinally
+    {
+        kLock_Exit(obj->sendLock);
+
+        kEndFinally();
+    }
 
-    kCheck(sendStatus);
-    kCheck(kTimer_Start(obj->stopwatch, GO_DISCOVERY_SET_ADDRESS_TIMEOUT));
+    return kOK;
+}
 
-    do
+GoFx(kStatus) GoDiscovery_GetExtendedInfo(GoDiscovery discovery, k32u deviceId, GoDiscoveryExtInfo* info, kAlloc allocator)
+{
+    GoDiscoveryWaiter waiter;
+
+    kCheck(GoDiscovery_BeginWait(discovery, &waiter, GO_DISCOVERY_GET_INFO_REPLY, deviceId, kAlloc_Fallback(allocator)));
+
+    kTry
     {
-        if (kSuccess(GoDiscovery_ReceiveReply(discovery, &remoteEndPoint, kTimer_Remaining(obj->stopwatch)))
-            && remoteEndPoint.port == GO_DISCOVERY_PORT
-            && kSuccess(GoDiscovery_ParseSetAddressReply(discovery, &responseDeviceId))
-            && responseDeviceId == deviceId)
-        {
-            return kOK;
-        }
-    } while (!kTimer_IsExpired(obj->stopwatch));
+        kTest(GoDiscovery_Transmit(discovery, GoDiscovery_WriteGetInfo, deviceId, kNULL, GO_DISCOVERY_GET_INFO_TIMEOUT));
+        kTest(GoDiscovery_Wait(discovery, &waiter, GO_DISCOVERY_GET_INFO_TIMEOUT));
+
+        DEBUG_PRINT("%s: sensor %u remote end point\n", __FUNCTION__, deviceId);
+
+        *info = waiter.extInfo;
+        waiter.extInfo = kNULL;
+    }
+    kFinally
+    {
+        GoDiscovery_EndWait(discovery, &waiter);
 
-    return kERROR_NOT_FOUND;
+        kEndFinally();
+    }
+
+    return kOK;
 }
 
-GoFx(kStatus) GoDiscovery_SetAddressTest(GoDiscovery discovery, k32u deviceId, const GoAddressInfo* address)
+// Registers interest in a reply. Must be called before the request is sent, so that
+// a prompt reply cannot be missed; each call must be paired with GoDiscovery_EndWait.
+GoFx(kStatus) GoDiscovery_BeginWait(GoDiscovery discovery, GoDiscoveryWaiter* waiter, k64s replyId, k32u deviceId, kAlloc allocator)
 {
     kObj(GoDiscovery, discovery);
-    k32u responseDeviceId;
-    kIpEndPoint remoteEndPoint;
-    kIpAddress zero;
-    kSize i;
+    kStatus status;
 
-    for (i = 0; i < 16; i++)
+    waiter->replyId = replyId;
+    waiter->deviceId = deviceId;
+    waiter->allocator = allocator;
+    waiter->extInfo = kNULL;
+    waiter->signal = kNULL;
+
+    kCheck(GoDiscoveryInfo_Init(&waiter->info));
+    kCheck(kSemaphore_Construct(&waiter->signal, 0, kObject_Alloc(discovery)));
+
+    kLock_Enter(obj->replyLock);
     {
-        zero.address[i] = 0;
+        status = kArrayList_AddT(obj->waiters, &waiter);
     }
+    kLock_Exit(obj->replyLock);
 
-    for (i = 0; i < kArrayList_Count(obj->interfaces); ++i)
+    if (!kSuccess(status))
     {
-        GoDiscoveryInterface* iface = kArrayList_AtT(obj->interfaces, i, GoDiscoveryInterface);
-
-        if (iface->enabled)
-        {
-            kCheck(kSocket_Connect(kUdpClient_Socket(iface->client), kIpAddress_BroadcastV4(), GO_DISCOVERY_PORT, 1000000));
-
-            kCheck(kSerializer_Write64s(iface->writer, GO_DISCOVERY_SET_ADDRESS_SIZE));
-            kCheck(kSerializer_Write64s(iface->writer, GO_DISCOVERY_SET_ADDRESS_TEST));
-            kCheck(kSerializer_Write64s(iface->writer, GO_DISOVERY_SIGNATURE));
-            kCheck(kSerializer_Write64s(iface->writer, deviceId));
-            kCheck(kSerializer_Write64s(iface->writer, address->useDhcp));
+        kDestroyRef(&waiter->signal);
+    }
 
-            kCheck(GoDiscovery_WriteIpAddress(iface->writer, (address->useDhcp) ? kIpAddress_AnyV4() : address->address));
-            kCheck(GoDiscovery_WriteIpAddress(iface->writer, (address->useDhcp) ? kIpAddress_AnyV4() : address->mask));
-            kCheck(GoDiscovery_WriteIpAddress(iface->writer, (address->useDhcp) ? kIpAddress_AnyV4() : address->gateway));
-            kCheck(GoDiscovery_WriteIpAddress(iface->writer, (address->useDhcp) ? kIpAddress_AnyV4() : zero));
+    return status;
+}
 
-            kCheck(kSerializer_Flush(iface->writer));
-            kCheck(kUdpClient_Send(iface->client, kIpAddress_BroadcastV4(), GO_DISCOVERY_PORT, GO_DISCOVERY_SET_ADDRESS_TIMEOUT, kTRUE));
-        }
-    }
+GoFx(kStatus) GoDiscovery_Wait(GoDiscovery discovery, GoDiscoveryWaiter* waiter, k64u timeout)
+{
+    return kSuccess(kSemaphore_Wait(waiter->signal, timeout)) ? kOK : kERROR_NOT_FOUND;
+}
 
-    kCheck(kTimer_Start(obj->stopwatch, GO_DISCOVERY_SET_ADDRESS_TIMEOUT));
+GoFx(kStatus) GoDiscovery_EndWait(GoDiscovery discovery, GoDiscoveryWaiter* waiter)
+{
+    kObj(GoDiscovery, discovery);
+    kSize i;
 
-    do
+    kLock_Enter(obj->replyLock);
     {
-        if (kSuccess(GoDiscovery_ReceiveReply(discovery, &remoteEndPoint, kTimer_Remaining(obj->stopwatch)))
-            && remoteEndPoint.port == GO_DISCOVERY_PORT
-            && kSuccess(GoDiscovery_ParseSetTestReply(discovery, &responseDeviceId))
-            && responseDeviceId == deviceId)
+        for (i = 0; i < kArrayList_Count(obj->waiters); ++i)
         {
-            return kOK;
+            if (kArrayList_AsT(obj->waiters, i, GoDiscoveryWaiter*) == waiter)
+            {
+                kArrayList_Discard(obj->waiters, i);
+                break;
+            }
         }
-    } while (!kTimer_IsExpired(obj->stopwatch));
+    }
+    kLock_Exit(obj->replyLock);
+
+    // A reply can be accepted after the wait has timed out; discard it.
+    kCheck(kDisposeRef(&waiter->extInfo));
+    kCheck(kDestroyRef(&waiter->signal));
 
-    return kERROR_NOT_FOUND;
+    return kOK;
 }
 
-GoFx(kStatus) GoDiscovery_GetExtendedInfo(GoDiscovery discovery, k32u deviceId, GoDiscoveryExtInfo* info, kAlloc allocator)
+// Sends a request on every enabled interface. Succeeds if the request could be sent on at least one interface.
+GoFx(kStatus) GoDiscovery_Transmit(GoDiscovery discovery, GoDiscoveryWriteFx write, k32u deviceId, const GoAddressInfo* address, k64u timeout)
 {
     kObj(GoDiscovery, discovery);
-    kIpEndPoint remoteEndPoint;
-    kSize i;
     kStatus sendStatus = kERROR_NETWORK;
-    kStatus recvStatus = kERROR_NOT_FOUND;
-
-    allocator = kAlloc_Fallback(allocator);
+    kSize i;
 
-    kCheck(kLock_Enter(obj->enumLock));
+    kCheck(kLock_Enter(obj->sendLock));
 
     kTry
     {
-
         for (i = 0; i < kArrayList_Count(obj->interfaces); ++i)
         {
             GoDiscoveryInterface* iface = kArrayList_AtT(obj->interfaces, i, GoDiscoveryInterface);
 
             if (iface->enabled)
             {
-                kTest(kSerializer_Write32u(iface->writer, GO_DISCOVERY_GET_INFO_SIZE));
-                kTest(kSerializer_Write32u(iface->writer, 0));
-                kTest(kSerializer_Write32u(iface->writer, GO_DISCOVERY_GET_INFO));
-                kTest(kSerializer_Write32u(iface->writer, 0));
-                kTest(kSerializer_Write64u(iface->writer, GO_DISOVERY_SIGNATURE));
-                kTest(kSerializer_Write32u(iface->writer, deviceId));
-                kTest(kSerializer_Write32u(iface->writer, 0));
-
+                kTest(write(iface->writer, deviceId, address));
                 kTest(kSerializer_Flush(iface->writer));
 
-                if (kSuccess(kUdpClient_Send(iface->client, kIpAddress_BroadcastV4(), GO_DISCOVERY_PORT, GO_DISCOVERY_GET_INFO_TIMEOUT, kTRUE)))
+                if (kSuccess(kUdpClient_Send(iface->client, kIpAddress_BroadcastV4(), GO_DISCOVERY_PORT, timeout, kTRUE)))
                 {
                     sendStatus = kOK;
                 }
             }
         }
+    }
+    kFinally
+    {
+        kLock_Exit(obj->sendLock);
 
-        kTest(sendStatus);
-        kTest(kTimer_Start(obj->stopwatch, GO_DISCOVERY_GET_INFO_TIMEOUT));
+        kEndFinally();
+    }
 
-        do
-        {
-            if (kSuccess(GoDiscovery_ReceiveReply(discovery, &remoteEndPoint, kTimer_Remaining(obj->stopwatch)))
-                && remoteEndPoint.port == GO_DISCOVERY_PORT
-                && kSuccess(GoDiscovery_ParseGetInfoReply(discovery, info, allocator))
-                && GoDiscoveryExtInfo_Id(*info) == deviceId)
-            {
-                DEBUG_PRINT("%s: sensor %u remote end point\n", __FUNCTION__, deviceId);
-                DEBUG_PRINT_ENDPOINT(&remoteEndPoint);
+    return sendStatus;
+}
 
-                recvStatus = kOK;
-                break;
-            }
-            else
-            {
-                if (!kIsNull(*info))
-                {
-                    kDisposeRef(info);
-                }
-            }
-        } while (!kTimer_IsExpired(obj->stopwatch));
+GoFx(kStatus) GoDiscovery_WriteGetAddress(kSerializer writer, k32u deviceId, const GoAddressInfo* address)
+{
+    kCheck(kSerializer_Write64s(writer, GO_DISCOVERY_GET_ADDRESS_SIZE));
+    kCheck(kSerializer_Write64s(writer, GO_DISCOVERY_GET_ADDRESS));
+    kCheck(kSerializer_Write64s(writer, GO_DISOVERY_SIGNATURE));
+    kCheck(kSerializer_Write64s(writer, deviceId));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoDiscovery_WriteGetInfo(kSerializer writer, k32u deviceId, const GoAddressInfo* address)
+{
+    kCheck(kSerializer_Write64s(writer, GO_DISCOVERY_GET_INFO_SIZE));
+    kCheck(kSerializer_Write64s(writer, GO_DISCOVERY_GET_INFO));
+    kCheck(kSerializer_Write64s(writer, GO_DISOVERY_SIGNATURE));
+    kCheck(kSerializer_Write64s(writer, deviceId));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoDiscovery_WriteSetAddress(kSerializer writer, k32u deviceId, const GoAddressInfo* address)
+{
+    return GoDiscovery_WriteSetAddressCommon(writer, GO_DISCOVERY_SET_ADDRESS, deviceId, address);
+}
+
+GoFx(kStatus) GoDiscovery_WriteSetAddressTest(kSerializer writer, k32u deviceId, const GoAddressInfo* address)
+{
+    return GoDiscovery_WriteSetAddressCommon(writer, GO_DISCOVERY_SET_ADDRESS_TEST, deviceId, address);
+}
 
+GoFx(kStatus) GoDiscovery_WriteSetAddressCommon(kSerializer writer, k64s msgId, k32u deviceId, const GoAddressInfo* address)
+{
+    kIpAddress zero;
+    kSize i;
+
+    for (i = 0; i < 16; i++)
+    {
+        zero.address[i] = 0;
     }
-    kFinally
+
+    kCheck(kSerializer_Write64s(writer, GO_DISCOVERY_SET_ADDRESS_SIZE));
+    kCheck(kSerializer_Write64s(writer, msgId));
+    kCheck(kSerializer_Write64s(writer, GO_DISOVERY_SIGNATURE));
+    kCheck(kSerializer_Write64s(writer, deviceId));
+    kCheck(kSerializer_Write64s(writer, address->useDhcp));
+
+    kCheck(GoDiscovery_WriteIpAddress(writer, (address->useDhcp) ? kIpAddress_AnyV4() : address->address));
+    kCheck(GoDiscovery_WriteIpAddress(writer, (address->useDhcp) ? kIpAddress_AnyV4() : address->mask));
+    kCheck(GoDiscovery_WriteIpAddress(writer, (address->useDhcp) ? kIpAddress_AnyV4() : address->gateway));
+    kCheck(GoDiscovery_WriteIpAddress(writer, (address->useDhcp) ? kIpAddress_AnyV4() : zero));
+
+    return kOK;
+}
+
+GoFx(kStatus) GoDiscovery_ReplyThreadEntry(GoDiscovery discovery)
+{
+    kObj(GoDiscovery, discovery);
+    kSocket socket = kUdpClient_Socket(obj->receiver);
+    kIpEndPoint remoteEndPoint;
+    kStatus status;
+
+    while (!kAtomic32s_Get(&obj->replyQuit))
     {
-        kLock_Exit(obj->enumLock);
+        status = kSocket_Wait(socket, GO_DISCOVERY_REPLY_POLL_INTERVAL);
 
-        kEndFinally();
+        if (kSuccess(status))
+        {
+            kLock_Enter(obj->replyLock);
+            {
+                if (kSuccess(GoDiscovery_ReceiveReply(discovery, &remoteEndPoint, GO_DISCOVERY_REPLY_POLL_INTERVAL))
+                    && (remoteEndPoint.port == GO_DISCOVERY_PORT))
+                {
+                    GoDiscovery_DispatchReply(discovery, &remoteEndPoint);
+                }
+            }
+            kLock_Exit(obj->replyLock);
+        }
+        else if (status != kERROR_TIMEOUT)
+        {
+            // Avoid spinning if the socket is unusable.
+            kThread_Sleep(GO_DISCOVERY_REPLY_POLL_INTERVAL);
+        }
     }
 
-    return recvStatus;
+    return kOK;
 }
 
 GoFx(kStatus) GoDiscovery_ReceiveReply(GoDiscovery discovery, kIpEndPoint* endPoint, k64u timeout)
@@ -809,71 +903,148 @@ GoFx(kStatus) GoDiscovery_StopEnum(GoDiscovery discovery)
 GoFx(kStatus) GoDiscovery_BeginEnum(GoDiscovery discovery)
 {
     kObj(GoDiscovery, discovery);
+    kStatus status = kOK;
     kSize i;
 
-    for (i = 0; i < kArrayList_Count(obj->interfaces); ++i)
+    kLock_Enter(obj->replyLock);
     {
-        GoDiscoveryInterface* iface = kArrayList_AtT(obj->interfaces, i, GoDiscoveryInterface);
+        status = kMap_Clear(obj->sensorInfoMap);
+        obj->enumActive = kTRUE;
+
+        // Discard signals left by late replies to a previous enumeration.
+        while (kSuccess(kSemaphore_Wait(obj->enumSignal, 0)))
+        {}
+    }
+    kLock_Exit(obj->replyLock);
+
+    kCheck(status);
 
-        if (iface->enabled)
+    kCheck(kLock_Enter(obj->sendLock));
+
+    kTry
+    {
+        for (i = 0; i < kArrayList_Count(obj->interfaces); ++i)
         {
-            if (kAtomic32s_Get(&obj->compatEnabled) == 1)
+            GoDiscoveryInterface* iface = kArrayList_AtT(obj->interfaces, i, GoDiscoveryInterface);
+
+            if (iface->enabled)
             {
-                kCheck(GoDiscovery_SendGetAddress(discovery, iface));
+                if (kAtomic32s_Get(&obj->compatEnabled) == 1)
+                {
+                    kTest(GoDiscovery_SendGetAddress(discovery, iface));
+                }
+
+                kTest(GoDiscovery_SendGetExtendedInfo(discovery, iface));
             }
+        }
+    }
+    kFinally
+    {
+        kLock_Exit(obj->sendLock);
+
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+// Waits for enumeration replies. The wait ends early once every device found by the
+// previous enumeration has replied with the information it gave then, and no further
+// replies arrive for a quiet period: the settle time, or as long as the known devices
+// took to reply, if longer, so that other devices on a slow network can still be heard.
+GoFx(kStatus) GoDiscovery_WaitEnum(GoDiscovery discovery, k64u timeout)
+{
+    kObj(GoDiscovery, discovery);
+    k64u start = kTimer_Now();
+    k64u deadline = start + timeout;
+    k64u quiet = GO_DISCOVERY_ENUM_SETTLE_TIME;
+    kBool settled = kFALSE;
+    k64u now;
 
-            kCheck(GoDiscovery_SendGetExtendedInfo(discovery, iface));
+    while ((now = kTimer_Now()) < deadline)
+    {
+        if (kSemaphore_Wait(obj->enumSignal, kMin_(deadline - now, quiet)) == kERROR_TIMEOUT)
+        {
+            if (settled && GoDiscovery_EnumSettled(discovery))
+            {
+                break;
+            }
+        }
+        else if (!settled && GoDiscovery_EnumSettled(discovery))
+        {
+            settled = kTRUE;
+            quiet = kMax_(quiet, kTimer_Now() - start);
         }
     }
 
     return kOK;
 }
 
-// This function must pull every receive message out of the socket and
-// process them all, even if one or more of them fail to parse correctly.
-// Only when there are no more messages in the socket then this function
-// should return.
-// Do not return prematurely because of parsing related errors (GOC-13024)
-// except for socket errors that prevent reading replies from the socket.
+// Reports whether every cached device has replied to the current enumeration with the same
+// information. In compatibility mode, a device may answer both the GetAddress and the
+// GetExtendedInfo request; matching the cached entry ensures that the reply it gave last time
+// (normally the extended one) has been received.
+GoFx(kBool) GoDiscovery_EnumSettled(GoDiscovery discovery)
+{
+    kObj(GoDiscovery, discovery);
+    kMapItem item;
+    kMapItem reply;
+    kBool settled;
+
+    kLock_Enter(obj->replyLock);
+    {
+        settled = (kMap_Count(obj->addressCache) > 0);
+
+        for (item = kMap_First(obj->addressCache); settled && !kIsNull(item); item = kMap_Next(obj->addressCache, item))
+        {
+            settled = kSuccess(kMap_FindItem(obj->sensorInfoMap, kMap_Key(obj->addressCache, item), &reply))
+                && kMemEquals(kMap_Value(obj->sensorInfoMap, reply), kMap_Value(obj->addressCache, item), sizeof(GoDiscoveryInfo));
+        }
+    }
+    kLock_Exit(obj->replyLock);
+
+    return settled;
+}
+
+// Ends reply collection and reports the devices that replied. The reply thread
+// has already processed every reply, including those that failed to parse (GOC-13024).
 GoFx(kStatus) GoDiscovery_EndEnum(GoDiscovery discovery, kArrayList list)
 {
     kObj(GoDiscovery, discovery);
     kMapItem mapItem;
 
-    // Clear map in anticipation of processing enumeration replies.
-    kCheck(kMap_Clear(obj->sensorInfoMap));
+    kCheck(kLock_Enter(obj->replyLock));
 
     kTry
     {
-        while (kSuccess(kSocket_Wait(kUdpClient_Socket(obj->receiver), 0)))
+        obj->enumActive = kFALSE;
+
+        kTest(kArrayList_Clear(list));
+
+        for (mapItem = kMap_First(obj->sensorInfoMap);
+            mapItem != kNULL;
+            mapItem = kMap_Next(obj->sensorInfoMap, mapItem))
         {
-            kIpEndPoint remoteEndPoint;
+            kTest(kArrayList_Add(list, kMap_Value(obj->sensorInfoMap, mapItem)));
+        }
 
-            // If can't receive a pending reply, then it is a serious enough
-            // error to not bother trying to empty the socket. So bail out on error.
-            kTest(GoDiscovery_ReceiveReply(discovery, &remoteEndPoint, 1000000));
+        // The devices found by this enumeration are expected to reply to the next one.
+        if (!GoDiscovery_CacheMatchesEnum(discovery))
+        {
+            kTest(kMap_Assign(obj->addressCache, obj->sensorInfoMap));
 
-            if (remoteEndPoint.port == GO_DISCOVERY_PORT)
+            if (obj->cachePath[0] != 0)
             {
-                // Don't stop processing replies on an error. Instead, keep
-                // processing replies until the socket is empty.
-                GoDiscovery_ParseReceivedEnumReply(discovery, &remoteEndPoint);
+                // A cache that cannot be saved only costs time at the next startup.
+                GoDiscovery_SaveCache(discovery);
             }
         }
     }
     kFinally
     {
-        kEndFinally();
-    }
-
-    // Do this only if the enumeration reply parsed successfully.
-    kCheck(kArrayList_Clear(list));
+        kLock_Exit(obj->replyLock);
 
-    for (mapItem = kMap_First(obj->sensorInfoMap);
-        mapItem != kNULL;
-        mapItem = kMap_Next(obj->sensorInfoMap, mapItem))
-    {
-        kCheck(kArrayList_Add(list, kMap_Value(obj->sensorInfoMap, mapItem)));
+        kEndFinally();
     }
 
     return kOK;
@@ -925,11 +1096,7 @@ GoFx(kStatus) GoDiscovery_ProcessGetExtendedInfoReply(GoDiscovery discovery, GoD
 
 GoFx(kStatus) GoDiscovery_SendGetAddress(GoDiscovery discovery, GoDiscoveryInterface* iface)
 {
-    kCheck(kSerializer_Write64s(iface->writer, GO_DISCOVERY_GET_ADDRESS_SIZE));
-    kCheck(kSerializer_Write64s(iface->writer, GO_DISCOVERY_GET_ADDRESS));
-    kCheck(kSerializer_Write64s(iface->writer, GO_DISOVERY_SIGNATURE));
-    kCheck(kSerializer_Write64s(iface->writer, 0));
-
+    kCheck(GoDiscovery_WriteGetAddress(iface->writer, 0, kNULL));
     kCheck(kSerializer_Flush(iface->writer));
 
     // Don't care about errors; some interfaces may not allow sending.
@@ -940,11 +1107,7 @@ GoFx(kStatus) GoDiscovery_SendGetAddress(GoDiscovery discovery, GoDiscoveryInter
 
 GoFx(kStatus) GoDiscovery_SendGetExtendedInfo(GoDiscovery discovery, GoDiscoveryInterface* iface)
 {
-    kCheck(kSerializer_Write64s(iface->writer, GO_DISCOVERY_GET_INFO_SIZE));
-    kCheck(kSerializer_Write64s(iface->writer, GO_DISCOVERY_GET_INFO));
-    kCheck(kSerializer_Write64s(iface->writer, GO_DISOVERY_SIGNATURE));
-    kCheck(kSerializer_Write64s(iface->writer, 0));
-
+    kCheck(GoDiscovery_WriteGetInfo(iface->writer, 0, kNULL));
     kCheck(kSerializer_Flush(iface->writer));
 
     // Don't care about errors; some interfaces may not allow sending.
@@ -956,49 +1119,18 @@ GoFx(kStatus) GoDiscovery_SendGetExtendedInfo(GoDiscovery discovery, GoDiscovery
 GoFx(kStatus) GoDiscovery_OnEnumElapsed(GoDiscovery discovery, kPeriodic timer)
 {
     kObj(GoDiscovery, discovery);
-
-    if (!obj->enumPending)
-    {
-        kStatus status = kOK;
-
-        kCheck(kLock_Enter(obj->enumLock));
-
-        kTry
-        {
-            kTest(kTimer_Start(obj->stopwatch, obj->enumPeriod));
-            kTest(GoDiscovery_BeginEnum(discovery));
-            obj->enumPending = kTRUE;
-
-            kTest(kPeriodic_Start(obj->eventTimer, GO_DISCOVERY_GET_ADDRESS_TIMEOUT, GoDiscovery_OnEnumElapsed, discovery));
-        }
-        kCatch(&status)
-        {
-            kLock_Exit(obj->enumLock);
-
-            kEndCatch(status);
-        }
-    }
-    else
-    {
-        kCheck(GoDiscovery_OnEnumElapsedRecv(discovery, timer));
-    }
-
-    return kOK;
-}
-
-GoFx(kStatus) GoDiscovery_OnEnumElapsedRecv(GoDiscovery discovery, kPeriodic timer)
-{
-    kObj(GoDiscovery, discovery);
+    k64u startTime = kTimer_Now();
+    k64u elapsed;
     kStatus exception;
 
     kTry
     {
-        kTest(GoDiscovery_EndEnum(discovery, obj->infoList));
+        kTest(GoDiscovery_Enumerate(discovery, obj->infoList));
         kTest(obj->onEnumerate.function(obj->onEnumerate.receiver, discovery, obj->infoList));
     }
     kCatchEx(&exception)
     {
-        DEBUG_PRINT("%s: error %d processing enumeration end", __FUNCTION__, exception);
+        DEBUG_PRINT("%s: error %d processing enumeration", __FUNCTION__, exception);
 
         // The periodic enumeration cycle must never stop because of errors so
         // ignore the error.
@@ -1006,13 +1138,11 @@ GoFx(kStatus) GoDiscovery_OnEnumElapsedRecv(GoDiscovery discovery, kPeriodic tim
     }
     kFinallyEx
     {
-        // Must always clear the enumPending flag and schedule enumeration
-        // to start again on the next enumeration interval.
+        // Must always schedule enumeration to start again on the next enumeration interval.
         // Don't check for return errors as there is no recovery action possible.
-        obj->enumPending = kFALSE;
-        kPeriodic_Start(obj->eventTimer, kTimer_Remaining(obj->stopwatch), GoDiscovery_OnEnumElapsed, discovery);
+        elapsed = kTimer_Now() - startTime;
 
-        kLock_Exit(obj->enumLock);
+        kPeriodic_Start(obj->eventTimer, (elapsed < obj->enumPeriod) ? (obj->enumPeriod - elapsed) : 0, GoDiscovery_OnEnumElapsed, discovery);
 
         kEndFinallyEx();
     }
@@ -1069,6 +1199,134 @@ GoFx(kBool) GoDiscovery_CompatModeEnabled(GoDiscovery discovery)
     return kAtomic32s_Get(&obj->compatEnabled) == 1;
 }
 
+GoFx(kStatus) GoDiscovery_EnableCache(GoDiscovery discovery, const kChar* path)
+{
+    kObj(GoDiscovery, discovery);
+    kStatus status = kOK;
+
+    kLock_Enter(obj->replyLock);
+    {
+        if (kIsNull(path) || (path[0] == 0))
+        {
+            obj->cachePath[0] = 0;
+        }
+        else if (kSuccess(status = kStrCopy(obj->cachePath, kCountOf(obj->cachePath), path)) && kFile_Exists(path))
+        {
+            // An unreadable cache is not an error; it is rewritten after the next enumeration.
+            GoDiscovery_LoadCache(discovery);
+        }
+    }
+    kLock_Exit(obj->replyLock);
+
+    return status;
+}
+
+GoFx(kBool) GoDiscovery_CacheMatchesEnum(GoDiscovery discovery)
+{
+    kObj(GoDiscovery, discovery);
+    kMapItem item;
+    kMapItem cached;
+
+    if (kMap_Count(obj->addressCache) != kMap_Count(obj->sensorInfoMap))
+    {
+        return kFALSE;
+    }
+
+    for (item = kMap_First(obj->sensorInfoMap); !kIsNull(item); item = kMap_Next(obj->sensorInfoMap, item))
+    {
+        if (!kSuccess(kMap_FindItem(obj->addressCache, kMap_Key(obj->sensorInfoMap, item), &cached))
+            || !kMemEquals(kMap_Value(obj->sensorInfoMap, item), kMap_Value(obj->addressCache, cached), sizeof(GoDiscoveryInfo)))
+        {
+            return kFALSE;
+        }
+    }
+
+    return kTRUE;
+}
+
+// The cache file holds a header (signature, version, entry size, entry count)
+// followed by GoDiscoveryInfo entries. It is only meaningful to the same SDK build.
+GoFx(kStatus) GoDiscovery_LoadCache(GoDiscovery discovery)
+{
+    kObj(GoDiscovery, discovery);
+    kAlloc alloc = kObject_Alloc(discovery);
+    kByte* data = kNULL;
+    kSize size = 0;
+    const k32u* header = kNULL;
+    const GoDiscoveryInfo* entries = kNULL;
+    k32u i;
+
+    kTry
+    {
+        kTest(kFile_Load(obj->cachePath, &data, &size, alloc));
+        kTestTrue(size >= GO_DISCOVERY_CACHE_HEADER_SIZE, kERROR_FORMAT);
+
+        header = (const k32u*) data;
+
+        kTestTrue(header[0] == GO_DISCOVERY_CACHE_SIGNATURE, kERROR_FORMAT);
+        kTestTrue(header[1] == GO_DISCOVERY_CACHE_VERSION, kERROR_VERSION);
+        kTestTrue(header[2] == sizeof(GoDiscoveryInfo), kERROR_FORMAT);
+        kTestTrue(size == GO_DISCOVERY_CACHE_HEADER_SIZE + header[3] * sizeof(GoDiscoveryInfo), kERROR_FORMAT);
+
+        entries = (const GoDiscoveryInfo*) (data + GO_DISCOVERY_CACHE_HEADER_SIZE);
+
+        kTest(kMap_Clear(obj->addressCache));
+
+        for (i = 0; i < header[3]; ++i)
+        {
+            kTest(kMap_Replace(obj->addressCache, &entries[i].id, &entries[i]));
+        }
+    }
+    kFinally
+    {
+        kAlloc_Free(alloc, data);
+
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoDiscovery_SaveCache(GoDiscovery discovery)
+{
+    kObj(GoDiscovery, discovery);
+    kAlloc alloc = kObject_Alloc(discovery);
+    kSize count = kMap_Count(obj->addressCache);
+    kSize size = GO_DISCOVERY_CACHE_HEADER_SIZE + count * sizeof(GoDiscoveryInfo);
+    kByte* data = kNULL;
+    k32u* header = kNULL;
+    GoDiscoveryInfo* entry = kNULL;
+    kMapItem item;
+
+    kCheck(kAlloc_Get(alloc, size, &data));
+
+    kTry
+    {
+        header = (k32u*) data;
+        header[0] = GO_DISCOVERY_CACHE_SIGNATURE;
+        header[1] = GO_DISCOVERY_CACHE_VERSION;
+        header[2] = (k32u) sizeof(GoDiscoveryInfo);
+        header[3] = (k32u) count;
+
+        entry = (GoDiscoveryInfo*) (data + GO_DISCOVERY_CACHE_HEADER_SIZE);
+
+        for (item = kMap_First(obj->addressCache); !kIsNull(item); item = kMap_Next(obj->addressCache, item))
+        {
+            *entry++ = *(const GoDiscoveryInfo*) kMap_Value(obj->addressCache, item);
+        }
+
+        kTest(kFile_Save(obj->cachePath, data, size));
+    }
+    kFinally
+    {
+        kAlloc_Free(alloc, data);
+
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
 // This function reads the response id from the received reply in the
 // serializer input.
 GoFx(kStatus) GoDiscovery_GetReceivedResponseId(GoDiscovery discovery, k64s* responseId)
@@ -1114,12 +1372,15 @@ GoFx(kStatus) GoDiscovery_GetReceivedResponseId(GoDiscovery discovery, k64s* res
     return kOK;
 }
 
-GoFx(void) GoDiscovery_ParseReceivedEnumReply(GoDiscovery discovery, kIpEndPoint* remoteEndPoint)
+// Processes a reply received by the reply thread (with the reply lock held): adds it to the
+// current enumeration, if any, and completes the requests that are waiting for it.
+GoFx(void) GoDiscovery_DispatchReply(GoDiscovery discovery, kIpEndPoint* remoteEndPoint)
 {
     kObj(GoDiscovery, discovery);
     k64s responseId;
     GoDiscoveryExtInfo extInfo = kNULL;
     GoDiscoveryInfo info;
+    k32u deviceId;
     kStatus status;
 
     if (kSuccess(GoDiscovery_GetReceivedResponseId(discovery, &responseId)))
@@ -1136,50 +1397,110 @@ GoFx(void) GoDiscovery_ParseReceivedEnumReply(GoDiscovery discovery, kIpEndPoint
 
             if (kSuccess(GoDiscovery_ParseGetAddressReply(discovery, &info, remoteEndPoint)))
             {
-                status = GoDiscovery_ProcessGetAddressReply(discovery, &info);
-                if (kSuccess(status))
-                {
-                    DEBUG_PRINT("%s: sensor %u GetAddressReply remote end point\n", __FUNCTION__, info.id);
-                    DEBUG_PRINT_ENDPOINT(remoteEndPoint);
-                }
-                else
+                if (obj->enumActive)
                 {
-                    // Log error but keep processing all the received messages.
-                    DEBUG_PRINT("%s: error %d processing get address reply for sensor %u\n", __FUNCTION__, status, info.id);
+                    status = GoDiscovery_ProcessGetAddressReply(discovery, &info);
+                    if (kSuccess(status))
+                    {
+                        DEBUG_PRINT("%s: sensor %u GetAddressReply remote end point\n", __FUNCTION__, info.id);
+                        DEBUG_PRINT_ENDPOINT(remoteEndPoint);
+                    }
+                    else
+                    {
+                        // Log error but keep processing all the received messages.
+                        DEBUG_PRINT("%s: error %d processing get address reply for sensor %u\n", __FUNCTION__, status, info.id);
+                    }
+
+                    kSemaphore_Post(obj->enumSignal);
                 }
+
+                GoDiscovery_CompleteWaiters(discovery, responseId, info.id, &info);
             }
         }
         else if (responseId == GO_DISCOVERY_GET_INFO_REPLY)
         {
             if (kSuccess(GoDiscovery_ParseGetInfoReply(discovery, &extInfo, kObject_Alloc(discovery))))
             {
-                status = GoDiscovery_ProcessGetExtendedInfoReply(discovery, extInfo, remoteEndPoint);
-                if (kSuccess(status))
-                {
-                    DEBUG_PRINT("%s: sensor %u ExtInfoReply remote end point\n", __FUNCTION__, GoDiscoveryExtInfo_Id(extInfo));
-                    DEBUG_PRINT_ENDPOINT(remoteEndPoint);
-                }
-                else
+                deviceId = GoDiscoveryExtInfo_Id(extInfo);
+
+                if (obj->enumActive)
                 {
-                    // Log error but keep processing all the received messages.
-                    DEBUG_PRINT("%s: error %d processing extended info reply for sensor %u\n", __FUNCTION__, status, GoDiscoveryExtInfo_Id(extInfo));
+                    status = GoDiscovery_ProcessGetExtendedInfoReply(discovery, extInfo, remoteEndPoint);
+                    if (kSuccess(status))
+                    {
+                        DEBUG_PRINT("%s: sensor %u ExtInfoReply remote end point\n", __FUNCTION__, deviceId);
+                        DEBUG_PRINT_ENDPOINT(remoteEndPoint);
+                    }
+                    else
+                    {
+                        // Log error but keep processing all the received messages.
+                        DEBUG_PRINT("%s: error %d processing extended info reply for sensor %u\n", __FUNCTION__, status, deviceId);
+                    }
+
+                    kSemaphore_Post(obj->enumSignal);
                 }
+
+                GoDiscovery_CompleteWaiters(discovery, responseId, deviceId, kNULL);
             }
 
             // Ignore error and continue on to the next reply message in the socket.
             (void) kDisposeRef(&extInfo);
         }
+        else if ((responseId == GO_DISCOVERY_SET_ADDRESS_REPLY) || (responseId == GO_DISCOVERY_SET_ADDRESS_TEST_REPLY))
+        {
+            if (kSuccess(GoDiscovery_ParseSetAddressReplyCommon(discovery, responseId, &deviceId)))
+            {
+                GoDiscovery_CompleteWaiters(discovery, responseId, deviceId, kNULL);
+            }
+        }
+        else
+        {
+            DEBUG_PRINT("%s: received unexpected response id %#x\n", __FUNCTION__, responseId);
+        }
+    }
+}
+
+// Completes the requests waiting for the received reply. Called with the reply lock held.
+GoFx(void) GoDiscovery_CompleteWaiters(GoDiscovery discovery, k64s replyId, k32u deviceId, const GoDiscoveryInfo* info)
+{
+    kObj(GoDiscovery, discovery);
+    kSize i = 0;
+
+    while (i < kArrayList_Count(obj->waiters))
+    {
+        GoDiscoveryWaiter* waiter = kArrayList_AsT(obj->waiters, i, GoDiscoveryWaiter*);
+        kBool accepted = kFALSE;
+
+        if ((waiter->replyId == replyId) && (waiter->deviceId == deviceId))
+        {
+            accepted = kTRUE;
+
+            if (!kIsNull(info))
+            {
+                waiter->info = *info;
+            }
+
+            if (replyId == GO_DISCOVERY_GET_INFO_REPLY)
+            {
+                // Each requester receives its own info object, constructed with its allocator.
+                kStream_Seek(obj->readerBuffer, 0, kSEEK_ORIGIN_BEGIN);
+
+                if (!kSuccess(GoDiscovery_ParseGetInfoReply(discovery, &waiter->extInfo, waiter->allocator)))
+                {
+                    kDisposeRef(&waiter->extInfo);
+                    accepted = kFALSE;
+                }
+            }
+        }
+
+        if (accepted)
+        {
+            kArrayList_Discard(obj->waiters, i);
+            kSemaphore_Post(waiter->signal);
+        }
         else
         {
-            // Probably got a response for a request sent by a different client thread.
-            // The enumeration code should be lenient on what it receives because
-            // the network socket is shared with other discovery request APIs
-            // (probably not a good idea to begin with. Is there a backwards
-            // compatibility reason for not changing that since the APIs are all
-            // internal APIs).
-            // Enumeration runs periodically so if one run doesn't get what it
-            // is expecting, it can try again next time.
-            DEBUG_PRINT("%s: received unexpected response id %#x for enumeration\n", __FUNCTION__, responseId);
+            ++i;
         }
     }
 }
@@ -78,6 +78,9 @@ GoFx(kStatus) GoDiscovery_Construct(GoDiscovery* discovery, kBool enableAutoDisc
 /**
  * Enumerates sensors present in the network.
  *
+ * Replies are collected for up to 0.5 seconds. Enumeration ends sooner once every sensor
+ * found by the previous enumeration (or loaded from the address cache) has replied.
+ *
  * @public              @memberof GoDiscovery
  * @version             Introduced in firmware 4.0.10.27
  * @param   discovery   Discovery object.
@@ -224,6 +227,21 @@ GoFx(kStatus) GoDiscovery_EnableCompatMode(GoDiscovery discovery, kBool enable);
 */
 GoFx(kBool) GoDiscovery_CompatModeEnabled(GoDiscovery discovery);
 
+/**
+* Enables a file-based cache of the sensors found by enumeration.
+*
+* If the file exists, its contents are loaded immediately, so that the first enumeration
+* can end as soon as the cached sensors reply. The file is rewritten whenever an
+* enumeration finds a different set of sensors or addresses.
+*
+* @public              @memberof GoDiscovery
+* @version             Introduced in firmware 6.4.41.x
+* @param   discovery   Discovery object.
+* @param   path        Cache file path (kNULL or empty to disable).
+* @return              Operation status.
+*/
+GoFx(kStatus) GoDiscovery_EnableCache(GoDiscovery discovery, const kChar* path);
+
 #include <GoSdk/Internal/GoDiscovery.x.h>
 
 #endif
@@ -18,6 +18,8 @@
 #include <kApi/Data/kArrayList.h>
 #include <kApi/Threads/kTimer.h>
 #include <kApi/Threads/kLock.h>
+#include <kApi/Threads/kSemaphore.h>
+#include <kApi/Threads/kAtomic.h>
 #include <kApi/Io/kUdpClient.h>
 #include <kApi/Data/kMap.h>
 #include <kApi/Io/kUdpClient.h>
@@ -69,6 +71,24 @@ kDeclareValueEx(Go, GoDiscoveryInterface, kValue)
 #define GO_DISCOVERY_GET_INFO_REPLY_ATTR_SIZE       (65)
 #define GO_DISCOVERY_GET_INFO_TIMEOUT               (5000000)
 
+#define GO_DISCOVERY_REPLY_POLL_INTERVAL            (100000)        //reply thread quit check interval (us)
+#define GO_DISCOVERY_ENUM_SETTLE_TIME               (20000)         //quiet period that ends an enumeration once all known devices have replied (us)
+
+#define GO_DISCOVERY_CACHE_SIGNATURE                (0x43444F47)    //"GODC"
+#define GO_DISCOVERY_CACHE_VERSION                  (1)
+#define GO_DISCOVERY_CACHE_HEADER_SIZE              (4 * sizeof(k32u))
+
+typedef kStatus (kCall* GoDiscoveryWriteFx)(kSerializer writer, k32u deviceId, const GoAddressInfo* address);
+
+typedef struct GoDiscoveryWaiter
+{
+    k64s replyId;                               //expected reply message id
+    k32u deviceId;                              //expected device id
+    kAlloc allocator;                           //allocator for extended info
+    GoDiscoveryInfo info;                       //received address info (GET ADDRESS replies)
+    GoDiscoveryExtInfo extInfo;                 //received extended info (GET INFO replies)
+    kSemaphore signal;                          //posted when a matching reply is received
+} GoDiscoveryWaiter;
 
 typedef struct GoDiscoveryClass
 {
@@ -88,11 +108,19 @@ typedef struct GoDiscoveryClass
     kSerializer reader;
 
     kPeriodic eventTimer;
-    kTimer stopwatch;
-    kBool enumPending;
-    kLock enumLock;
+    kLock enumLock;                             //serializes enumerations
+    kLock sendLock;                             //serializes requests on the interface writers
+
+    kThread replyThread;                        //processes replies as they arrive
+    kAtomic32s replyQuit;                       //reply thread quit flag
+    kLock replyLock;                            //protects reply processing state (below)
+    kArrayList waiters;                         //requests awaiting a reply (kArrayList<GoDiscoveryWaiter*>)
+    kBool enumActive;                           //is an enumeration collecting replies?
+    kSemaphore enumSignal;                      //posted for each enumeration reply
 
     kMap sensorInfoMap; // <k32u, GoDiscoveryInfo>. Used for sorting replies.
+    kMap addressCache;                          //<k32u, GoDiscoveryInfo>; devices found by the last enumeration
+    kText256 cachePath;                         //file used to persist the address cache (empty if disabled)
 } GoDiscoveryClass;
 
 kDeclareClassEx(Go, GoDiscovery, kObject)
@@ -120,7 +148,8 @@ GoFx(kStatus) GoDiscovery_ReadIpAddress(kSerializer serializer, kIpAddress* addr
 GoFx(kStatus) GoDiscovery_ReceiveReply(GoDiscovery discovery, kIpEndPoint* endPoint, k64u timeout);
 
 GoFx(kStatus) GoDiscovery_GetReceivedResponseId(GoDiscovery discovery, k64s* responseId);
-GoFx(void) GoDiscovery_ParseReceivedEnumReply(GoDiscovery discovery, kIpEndPoint* remoteEndPoint);
+GoFx(void) GoDiscovery_DispatchReply(GoDiscovery discovery, kIpEndPoint* remoteEndPoint);
+GoFx(void) GoDiscovery_CompleteWaiters(GoDiscovery discovery, k64s replyId, k32u deviceId, const GoDiscoveryInfo* info);
 
 GoFx(kStatus) GoDiscovery_ParseGetAddressReply(GoDiscovery discovery, GoDiscoveryInfo* info, kIpEndPoint* remoteEndPoint);
 GoFx(kStatus) GoDiscovery_ParseSetAddressReply(GoDiscovery discovery, k32u* deviceId);
@@ -128,17 +157,36 @@ GoFx(kStatus) GoDiscovery_ParseSetTestReply(GoDiscovery discovery, k32u* deviceI
 GoFx(kStatus) GoDiscovery_ParseGetInfoReply(GoDiscovery discovery, GoDiscoveryExtInfo* info, kAlloc allocator);
 
 GoFx(kStatus) GoDiscovery_BeginEnum(GoDiscovery discovery);
+GoFx(kStatus) GoDiscovery_WaitEnum(GoDiscovery discovery, k64u timeout);
+GoFx(kBool) GoDiscovery_EnumSettled(GoDiscovery discovery);
 GoFx(kStatus) GoDiscovery_EndEnum(GoDiscovery discovery, kArrayList list);
 
+GoFx(kStatus) GoDiscovery_ReplyThreadEntry(GoDiscovery discovery);
+
+GoFx(kStatus) GoDiscovery_BeginWait(GoDiscovery discovery, GoDiscoveryWaiter* waiter, k64s replyId, k32u deviceId, kAlloc allocator);
+GoFx(kStatus) GoDiscovery_Wait(GoDiscovery discovery, GoDiscoveryWaiter* waiter, k64u timeout);
+GoFx(kStatus) GoDiscovery_EndWait(GoDiscovery discovery, GoDiscoveryWaiter* waiter);
+
+GoFx(kStatus) GoDiscovery_Transmit(GoDiscovery discovery, GoDiscoveryWriteFx write, k32u deviceId, const GoAddressInfo* address, k64u timeout);
+GoFx(kStatus) GoDiscovery_WriteGetAddress(kSerializer writer, k32u deviceId, const GoAddressInfo* address);
+GoFx(kStatus) GoDiscovery_WriteGetInfo(kSerializer writer, k32u deviceId, const GoAddressInfo* address);
+GoFx(kStatus) GoDiscovery_WriteSetAddress(kSerializer writer, k32u deviceId, const GoAddressInfo* address);
+GoFx(kStatus) GoDiscovery_WriteSetAddressTest(kSerializer writer, k32u deviceId, const GoAddressInfo* address);
+GoFx(kStatus) GoDiscovery_WriteSetAddressCommon(kSerializer writer, k64s msgId, k32u deviceId, const GoAddressInfo* address);
+
 GoFx(kStatus) GoDiscovery_SendGetAddress(GoDiscovery discovery, GoDiscoveryInterface* iface);
 GoFx(kStatus) GoDiscovery_SendGetExtendedInfo(GoDiscovery discovery, GoDiscoveryInterface* iface);
 GoFx(kStatus) GoDiscovery_ProcessGetAddressReply(GoDiscovery discovery, const GoDiscoveryInfo* info);
 GoFx(kStatus) GoDiscovery_ProcessGetExtendedInfoReply(GoDiscovery discovery, GoDiscoveryExtInfo extInfo, kIpEndPoint* remoteEndPoint);
 
 GoFx(kStatus) GoDiscovery_OnEnumElapsed(GoDiscovery discovery, kPeriodic timer);
-GoFx(kStatus) GoDiscovery_OnEnumElapsedRecv(GoDiscovery discovery, kPeriodic timer);
 
 GoFx(kStatus) GoDiscovery_SetAddressTest(GoDiscovery discovery, k32u deviceId, const GoAddressInfo* address);
+GoFx(kStatus) GoDiscovery_SendSetAddressTest(GoDiscovery discovery, k32u deviceId, const GoAddressInfo* address);
 GoFx(kStatus) GoDiscovery_ParseSetAddressReplyCommon(GoDiscovery discovery, k64s replyMsgId, k32u* deviceId);
 
+GoFx(kBool) GoDiscovery_CacheMatchesEnum(GoDiscovery discovery);
+GoFx(kStatus) GoDiscovery_LoadCache(GoDiscovery discovery);
+GoFx(kStatus) GoDiscovery_SaveCache(GoDiscovery discovery);
+
 #endif
@@ -0,0 +1,521 @@
+/**
+ * @file    GoHealthTable.c
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#include <GoSdk/Internal/GoHealthTable.h>
+
+kBeginValueEx(Go, GoHealthKey)
+    kAddField(GoHealthKey, k32u, sensorId)
+    kAddField(GoHealthKey, k32u, id)
+    kAddField(GoHealthKey, k32u, instance)
+kEndValueEx()
+
+kBeginValueEx(Go, GoHealthEntry)
+    kAddField(GoHealthEntry, GoHealthKey, key)
+    kAddField(GoHealthEntry, kBool, hasValue)
+    kAddField(GoHealthEntry, k64s, value)
+    kAddField(GoHealthEntry, k64s, deltaBase)
+    kAddField(GoHealthEntry, k32u, watchCount)
+kEndValueEx()
+
+kBeginValueEx(Go, GoHealthWatch)
+kEndValueEx()
+
+kBeginValueEx(Go, GoHealthCrossing)
+kEndValueEx()
+
+kBeginClassEx(Go, GoHealthTable)
+    kAddVMethod(GoHealthTable, kObject, VRelease)
+kEndClassEx()
+
+GoFx(kStatus) GoHealthTable_Construct(GoHealthTable* table, kObject sender, kAlloc allocator)
+{
+    kAlloc alloc = kAlloc_Fallback(allocator);
+    kStatus status;
+
+    kCheck(kAlloc_GetObject(alloc, kTypeOf(GoHealthTable), table));
+
+    if (!kSuccess(status = GoHealthTable_Init(*table, kTypeOf(GoHealthTable), sender, alloc)))
+    {
+        kAlloc_FreeRef(alloc, table);
+    }
+
+    return status;
+}
+
+GoFx(kStatus) GoHealthTable_Init(GoHealthTable table, kType type, kObject sender, kAlloc alloc)
+{
+    kObjR(GoHealthTable, table);
+    kStatus status;
+
+    kCheck(kObject_Init(table, type, alloc));
+    obj->sender = sender;
+    obj->notifyLock = kNULL;
+    obj->lock = kNULL;
+    obj->entries = kNULL;
+    obj->slots = kNULL;
+    obj->layouts = kNULL;
+    obj->watches = kNULL;
+
+    kTry
+    {
+        kTest(kLock_Construct(&obj->notifyLock, alloc));
+        kTest(kLock_Construct(&obj->lock, alloc));
+        kTest(kArrayList_Construct(&obj->entries, kTypeOf(GoHealthEntry), 0, alloc));
+        kTest(kMap_Construct(&obj->slots, kTypeOf(GoHealthKey), kTypeOf(kSize), 0, alloc));
+        kTest(kMap_Construct(&obj->layouts, kTypeOf(k32u), kTypeOf(kArrayList), 0, alloc));
+        kTest(kArrayList_Construct(&obj->watches, kTypeOf(GoHealthWatch), 0, alloc));
+    }
+    kCatch(&status)
+    {
+        GoHealthTable_VRelease(table);
+        kEndCatch(status);
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoHealthTable_VRelease(GoHealthTable table)
+{
+    kObj(GoHealthTable, table);
+
+    kCheck(kDestroyRef(&obj->watches));
+    kCheck(kDisposeRef(&obj->layouts));
+    kCheck(kDestroyRef(&obj->slots));
+    kCheck(kDestroyRef(&obj->entries));
+    kCheck(kDestroyRef(&obj->lock));
+    kCheck(kDestroyRef(&obj->notifyLock));
+
+    return kObject_VRelease(table);
+}
+
+GoFx(kStatus) GoHealthTable_Update(GoHealthTable table, k32u sensorId, GoDataSet healthSet)
+{
+    kObj(GoHealthTable, table);
+    kArrayList crossings = kNULL;
+    kArrayList layout = kNULL;
+    kSize position = 0;
+    kSize i;
+
+    kLock_Enter(obj->lock);
+
+    kTry
+    {
+        if (!kSuccess(kMap_FindT(obj->layouts, &sensorId, &layout)))
+        {
+            kTest(kArrayList_Construct(&layout, kTypeOf(kSize), 0, kObject_Alloc(table)));
+
+            if (!kSuccess(kMap_AddT(obj->layouts, &sensorId, &layout)))
+            {
+                kDestroyRef(&layout);
+                kThrow(kERROR_MEMORY);
+            }
+        }
+
+        for (i = 0; i < GoDataSet_Count(healthSet); ++i)
+        {
+            GoHealthMsg msg = GoDataSet_At(healthSet, i);
+
+            if (kObject_Is(msg, kTypeOf(GoHealthMsg)))
+            {
+                kTest(GoHealthTable_UpdateMsg(table, sensorId, msg, layout, &position, &crossings));
+            }
+        }
+    }
+    kFinally
+    {
+        kLock_Exit(obj->lock);
+
+        //callbacks are invoked without holding the lock, so that they can read the table
+        if (!kIsNull(crossings))
+        {
+            GoHealthTable_Notify(table, crossings);
+            kObject_Destroy(crossings);
+        }
+
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoHealthTable_UpdateMsg(GoHealthTable table, k32u sensorId, GoHealthMsg msg, kArrayList layout, kSize* position, kArrayList* crossings)
+{
+    kObj(GoHealthTable, table);
+    kSize count = GoHealthMsg_Count(msg);
+    kSize i;
+
+    for (i = 0; i < count; ++i, ++(*position))
+    {
+        const GoIndicator* indicator = GoHealthMsg_At(msg, i);
+        GoHealthEntry* entry = kNULL;
+        kSize slot;
+
+        //fast path: the same indicator as at this position in the previous message
+        if (*position < kArrayList_Count(layout))
+        {
+            slot = kArrayList_AsT(layout, *position, kSize);
+            entry = kArrayList_AtT(obj->entries, slot, GoHealthEntry);
+
+            if ((entry->key.id != indicator->id) || (entry->key.instance != indicator->instance))
+            {
+                entry = kNULL;
+            }
+        }
+
+        if (kIsNull(entry))
+        {
+            kCheck(GoHealthTable_FindSlot(table, sensorId, indicator->id, indicator->instance, kTRUE, &slot));
+
+            if (*position < kArrayList_Count(layout))
+            {
+                kArrayList_SetAsT(layout, *position, slot, kSize);
+            }
+            else
+            {
+                kCheck(kArrayList_AddT(layout, &slot));
+            }
+
+            entry = kArrayList_AtT(obj->entries, slot, GoHealthEntry);
+        }
+
+        if (entry->watchCount > 0)
+        {
+            kCheck(GoHealthTable_CheckWatches(table, slot, indicator->value, crossings));
+        }
+
+        if (!entry->hasValue)
+        {
+            entry->deltaBase = indicator->value;
+            entry->hasValue = kTRUE;
+        }
+
+        entry->value = indicator->value;
+    }
+
+    return kOK;
+}
+
+// Finds the entry for an indicator, optionally adding an (empty) entry if none exists.
+GoFx(kStatus) GoHealthTable_FindSlot(GoHealthTable table, k32u sensorId, k32u id, k32u instance, kBool create, kSize* slot)
+{
+    kObj(GoHealthTable, table);
+    GoHealthEntry entry;
+
+    kZero(entry);
+    entry.key.sensorId = sensorId;
+    entry.key.id = id;
+    entry.key.instance = instance;
+
+    if (kSuccess(kMap_FindT(obj->slots, &entry.key, slot)))
+    {
+        return kOK;
+    }
+    else if (!create)
+    {
+        return kERROR_NOT_FOUND;
+    }
+
+    *slot = kArrayList_Count(obj->entries);
+
+    kCheck(kArrayList_AddT(obj->entries, &entry));
+
+    if (!kSuccess(kMap_AddT(obj->slots, &entry.key, slot)))
+    {
+        kArrayList_Remove(obj->entries, *slot, kNULL);
+        return kERROR_MEMORY;
+    }
+
+    return kOK;
+}
+
+// Records a crossing for each watch on the given entry whose threshold lies between the
+// previous and the new value.
+GoFx(kStatus) GoHealthTable_CheckWatches(GoHealthTable table, kSize slot, k64s value, kArrayList* crossings)
+{
+    kObj(GoHealthTable, table);
+    const GoHealthEntry* entry = kArrayList_AtT(obj->entries, slot, GoHealthEntry);
+    k64s previous = entry->hasValue ? entry->value : value;
+    kSize i;
+
+    for (i = 0; i < kArrayList_Count(obj->watches); ++i)
+    {
+        const GoHealthWatch* watch = kArrayList_AtT(obj->watches, i, GoHealthWatch);
+        kBool wasAbove = entry->hasValue && (previous >= watch->threshold);
+        kBool isAbove = (value >= watch->threshold);
+
+        //the first report of an indicator counts as a crossing only if it is at or above the threshold
+        if ((watch->slot == slot) && (wasAbove != isAbove) && (entry->hasValue || isAbove))
+        {
+            GoHealthCrossing crossing;
+
+            if (kIsNull(*crossings))
+            {
+                kCheck(kArrayList_Construct(crossings, kTypeOf(GoHealthCrossing), 0, kObject_Alloc(table)));
+            }
+
+            crossing.function = watch->function;
+            crossing.receiver = watch->receiver;
+            crossing.args.sensorId = entry->key.sensorId;
+            crossing.args.id = entry->key.id;
+            crossing.args.instance = entry->key.instance;
+            crossing.args.threshold = watch->threshold;
+            crossing.args.previous = previous;
+            crossing.args.value = value;
+            crossing.args.rising = isAbove;
+
+            kCheck(kArrayList_AddT(*crossings, &crossing));
+        }
+    }
+
+    return kOK;
+}
+
+// Invokes the callbacks for recorded crossings. Callbacks run under the notify lock, which
+// RemoveWatch acquires to wait for callbacks in progress; a watch that was removed after its
+// crossing was recorded is skipped.
+GoFx(kStatus) GoHealthTable_Notify(GoHealthTable table, kArrayList crossings)
+{
+    kObj(GoHealthTable, table);
+    kSize i;
+
+    kLock_Enter(obj->notifyLock);
+    {
+        for (i = 0; i < kArrayList_Count(crossings); ++i)
+        {
+            GoHealthCrossing* crossing = kArrayList_AtT(crossings, i, GoHealthCrossing);
+
+            if (GoHealthTable_IsWatched(table, crossing->function, crossing->receiver))
+            {
+                crossing->function(crossing->receiver, obj->sender, &crossing->args);
+            }
+        }
+    }
+    kLock_Exit(obj->notifyLock);
+
+    return kOK;
+}
+
+GoFx(kBool) GoHealthTable_IsWatched(GoHealthTable table, GoHealthCrossingFx function, kPointer receiver)
+{
+    kObj(GoHealthTable, table);
+    kBool watched = kFALSE;
+    kSize i;
+
+    kLock_Enter(obj->lock);
+    {
+        for (i = 0; (i < kArrayList_Count(obj->watches)) && !watched; ++i)
+        {
+            const GoHealthWatch* watch = kArrayList_AtT(obj->watches, i, GoHealthWatch);
+
+            watched = (watch->function == function) && (watch->receiver == receiver);
+        }
+    }
+    kLock_Exit(obj->lock);
+
+    return watched;
+}
+
+GoFx(kStatus) GoHealthTable_Value(GoHealthTable table, k32u sensorId, k32u id, k32u instance, k64s* value)
+{
+    kObj(GoHealthTable, table);
+    kStatus status;
+    kSize slot;
+
+    kLock_Enter(obj->lock);
+    {
+        if (kSuccess(status = GoHealthTable_FindSlot(table, sensorId, id, instance, kFALSE, &slot)))
+        {
+            const GoHealthEntry* entry = kArrayList_AtT(obj->entries, slot, GoHealthEntry);
+
+            if (entry->hasValue)
+            {
+                *value = entry->value;
+            }
+            else
+            {
+                status = kERROR_NOT_FOUND;
+            }
+        }
+    }
+    kLock_Exit(obj->lock);
+
+    return status;
+}
+
+GoFx(kStatus) GoHealthTable_Delta(GoHealthTable table, k32u sensorId, k32u id, k32u instance, k64s* delta)
+{
+    kObj(GoHealthTable, table);
+    kStatus status;
+    kSize slot;
+
+    kLock_Enter(obj->lock);
+    {
+        if (kSuccess(status = GoHealthTable_FindSlot(table, sensorId, id, instance, kFALSE, &slot)))
+        {
+            GoHealthEntry* entry = kArrayList_AtT(obj->entries, slot, GoHealthEntry);
+
+            if (entry->hasValue)
+            {
+                *delta = entry->value - entry->deltaBase;
+                entry->deltaBase = entry->value;
+            }
+            else
+            {
+                status = kERROR_NOT_FOUND;
+            }
+        }
+    }
+    kLock_Exit(obj->lock);
+
+    return status;
+}
+
+GoFx(kStatus) GoHealthTable_AddWatch(GoHealthTable table, k32u sensorId, k32u id, k32u instance, k64s threshold, GoHealthCrossingFx function, kPointer receiver)
+{
+    kObj(GoHealthTable, table);
+    GoHealthWatch watch;
+    kStatus status;
+
+    kCheckArgs(!kIsNull(function));
+
+    watch.threshold = threshold;
+    watch.function = function;
+    watch.receiver = receiver;
+
+    kLock_Enter(obj->lock);
+
+    kTry
+    {
+        //the entry is created up front, so that the first report of the indicator is checked
+        kTest(GoHealthTable_FindSlot(table, sensorId, id, instance, kTRUE, &watch.slot));
+        kTest(kArrayList_AddT(obj->watches, &watch));
+
+        kArrayList_AtT(obj->entries, watch.slot, GoHealthEntry)->watchCount++;
+    }
+    kFinally
+    {
+        kLock_Exit(obj->lock);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+GoFx(kStatus) GoHealthTable_RemoveWatch(GoHealthTable table, GoHealthCrossingFx function, kPointer receiver)
+{
+    kObj(GoHealthTable, table);
+    kSize i = 0;
+
+    kLock_Enter(obj->lock);
+    {
+        while (i < kArrayList_Count(obj->watches))
+        {
+            const GoHealthWatch* watch = kArrayList_AtT(obj->watches, i, GoHealthWatch);
+
+            if ((watch->function == function) && (watch->receiver == receiver))
+            {
+                kArrayList_AtT(obj->entries, watch->slot, GoHealthEntry)->watchCount--;
+                kArrayList_Remove(obj->watches, i, kNULL);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+    kLock_Exit(obj->lock);
+
+    //wait for callbacks in progress on other threads (the lock is recursive, so a callback can
+    //remove its own watch)
+    kLock_Enter(obj->notifyLock);
+    kLock_Exit(obj->notifyLock);
+
+    return kOK;
+}
+
+GoFx(kStatus) GoHealthTable_RemoveSensor(GoHealthTable table, k32u sensorId)
+{
+    kObj(GoHealthTable, table);
+    kAlloc alloc = kObject_Alloc(table);
+    kSize* remap = kNULL;
+    kArrayList layout = kNULL;
+    kSize count, kept = 0;
+    kMapItem it;
+    kSize i;
+
+    kLock_Enter(obj->lock);
+
+    kTry
+    {
+        if (kSuccess(kMap_FindT(obj->layouts, &sensorId, &layout)))
+        {
+            kTest(kMap_Remove(obj->layouts, &sensorId, kNULL, kNULL));
+            kTest(kDestroyRef(&layout));
+        }
+
+        count = kArrayList_Count(obj->entries);
+
+        kTest(kAlloc_Get(alloc, kMax_(count, 1)*sizeof(kSize), &remap));
+
+        //compact the entry list; entries of the sensor are dropped unless they are watched, in
+        //which case only their values are forgotten
+        kTest(kMap_Clear(obj->slots));
+
+        for (i = 0; i < count; ++i)
+        {
+            GoHealthEntry* entry = kArrayList_AtT(obj->entries, i, GoHealthEntry);
+
+            if (entry->key.sensorId != sensorId)
+            {
+                remap[i] = kept;
+            }
+            else if (entry->watchCount > 0)
+            {
+                entry->hasValue = kFALSE;
+                remap[i] = kept;
+            }
+            else
+            {
+                remap[i] = kSIZE_NULL;
+                continue;
+            }
+
+            *kArrayList_AtT(obj->entries, kept, GoHealthEntry) = *entry;
+            kTest(kMap_AddT(obj->slots, &kArrayList_AtT(obj->entries, kept, GoHealthEntry)->key, &kept));
+            kept++;
+        }
+
+        kTest(kArrayList_Resize(obj->entries, kept));
+
+        //entry indices held by the layouts of other sensors and by watches refer to kept entries
+        for (it = kMap_First(obj->layouts); !kIsNull(it); it = kMap_Next(obj->layouts, it))
+        {
+            kArrayList otherLayout = kMap_ValueAsT(obj->layouts, it, kArrayList);
+
+            for (i = 0; i < kArrayList_Count(otherLayout); ++i)
+            {
+                kArrayList_SetAsT(otherLayout, i, remap[kArrayList_AsT(otherLayout, i, kSize)], kSize);
+            }
+        }
+
+        for (i = 0; i < kArrayList_Count(obj->watches); ++i)
+        {
+            GoHealthWatch* watch = kArrayList_AtT(obj->watches, i, GoHealthWatch);
+
+            watch->slot = remap[watch->slot];
+        }
+    }
+    kFinally
+    {
+        kAlloc_Free(alloc, remap);
+        kLock_Exit(obj->lock);
+        kEndFinally();
+    }
+
+    return kOK;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file    GoHealthTable.h
+ * @brief   Declares the GoHealthTable class.
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef GO_SDK_HEALTH_TABLE_H
+#define GO_SDK_HEALTH_TABLE_H
+
+#include <GoSdk/GoSdkDef.h>
+#include <GoSdk/Messages/GoDataSet.h>
+
+/**
+ * @class   GoHealthTable
+ * @extends kObject
+ * @ingroup GoSdk-Internal
+ * @brief   Holds the most recent value of each health indicator reported by a set of sensors.
+ *
+ * Indicator values are kept in a dense array that is updated in place as health messages
+ * arrive. Sensors report their indicators in the same order from one message to the next,
+ * so each sensor's message layout is remembered and an indicator is located by position;
+ * the (sensor, indicator, instance) index is only consulted when the layout changes.
+ */
+typedef kObject GoHealthTable;
+
+/**
+ * Constructs a GoHealthTable object.
+ *
+ * @public              @memberof GoHealthTable
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   table       Receives constructed table object.
+ * @param   sender      Object reported as the sender of threshold callbacks.
+ * @param   allocator   Memory allocator (or kNULL for default)
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoHealthTable_Construct(GoHealthTable* table, kObject sender, kAlloc allocator);
+
+/**
+ * Updates the table from a set of health messages, and reports any threshold crossings.
+ *
+ * Threshold callbacks are invoked after the table has been updated, from the calling thread.
+ *
+ * @public              @memberof GoHealthTable
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   table       Table object.
+ * @param   sensorId    Serial number of the reporting sensor.
+ * @param   healthSet   Set of health messages.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoHealthTable_Update(GoHealthTable table, k32u sensorId, GoDataSet healthSet);
+
+/**
+ * Gets the most recent value of a health indicator.
+ *
+ * @public              @memberof GoHealthTable
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   table       Table object.
+ * @param   sensorId    Sensor serial number.
+ * @param   id          Indicator ID.
+ * @param   instance    Indicator instance.
+ * @param   value       Receives the indicator value.
+ * @return              Operation status (kERROR_NOT_FOUND if the indicator has not been reported).
+ */
+GoFx(kStatus) GoHealthTable_Value(GoHealthTable table, k32u sensorId, k32u id, k32u instance, k64s* value);
+
+/**
+ * Gets the change in a health indicator since the previous call for the same indicator.
+ *
+ * The first call for an indicator reports the change since the indicator was first reported.
+ *
+ * @public              @memberof GoHealthTable
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   table       Table object.
+ * @param   sensorId    Sensor serial number.
+ * @param   id          Indicator ID.
+ * @param   instance    Indicator instance.
+ * @param   delta       Receives the change in the indicator value.
+ * @return              Operation status (kERROR_NOT_FOUND if the indicator has not been reported).
+ */
+GoFx(kStatus) GoHealthTable_Delta(GoHealthTable table, k32u sensorId, k32u id, k32u instance, k64s* delta);
+
+/**
+ * Registers a callback to be invoked when a health indicator crosses a threshold.
+ *
+ * @public              @memberof GoHealthTable
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   table       Table object.
+ * @param   sensorId    Sensor serial number.
+ * @param   id          Indicator ID.
+ * @param   instance    Indicator instance.
+ * @param   threshold   Threshold value.
+ * @param   function    Callback function.
+ * @param   receiver    Receiver argument, passed to callback.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoHealthTable_AddWatch(GoHealthTable table, k32u sensorId, k32u id, k32u instance, k64s threshold, GoHealthCrossingFx function, kPointer receiver);
+
+/**
+ * Unregisters all threshold callbacks that match the given function and receiver.
+ *
+ * Waits for callbacks that are in progress on other threads to return.
+ *
+ * @public              @memberof GoHealthTable
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   table       Table object.
+ * @param   function    Callback function.
+ * @param   receiver    Receiver argument.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoHealthTable_RemoveWatch(GoHealthTable table, GoHealthCrossingFx function, kPointer receiver);
+
+/**
+ * Removes the indicator values reported by a sensor.
+ *
+ * Indicators that are watched keep their watches, so that they are checked again if the
+ * sensor returns.
+ *
+ * @public              @memberof GoHealthTable
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   table       Table object.
+ * @param   sensorId    Sensor serial number.
+ * @return              Operation status.
+ */
+GoFx(kStatus) GoHealthTable_RemoveSensor(GoHealthTable table, k32u sensorId);
+
+#include <GoSdk/Internal/GoHealthTable.x.h>
+
+#endif
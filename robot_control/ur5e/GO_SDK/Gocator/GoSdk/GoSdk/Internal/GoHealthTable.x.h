@@ -0,0 +1,80 @@
+/**
+ * @file    GoHealthTable.x.h
+ *
+ * @internal
+ * Copyright (C) 2016-2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef GO_SDK_HEALTH_TABLE_X_H
+#define GO_SDK_HEALTH_TABLE_X_H
+
+#include <GoSdk/Messages/GoHealth.h>
+#include <kApi/Data/kArrayList.h>
+#include <kApi/Data/kMap.h>
+#include <kApi/Threads/kLock.h>
+
+typedef struct GoHealthKey
+{
+    k32u sensorId;
+    k32u id;
+    k32u instance;
+} GoHealthKey;
+
+kDeclareValueEx(Go, GoHealthKey, kValue)
+
+typedef struct GoHealthEntry
+{
+    GoHealthKey key;
+    kBool hasValue;                             //has the indicator been reported?
+    k64s value;                                 //most recent value
+    k64s deltaBase;                             //value at the time of the last delta read
+    k32u watchCount;                            //count of threshold watches on this entry
+} GoHealthEntry;
+
+kDeclareValueEx(Go, GoHealthEntry, kValue)
+
+typedef struct GoHealthWatch
+{
+    kSize slot;                                 //index of the watched entry
+    k64s threshold;
+    GoHealthCrossingFx function;
+    kPointer receiver;
+} GoHealthWatch;
+
+kDeclareValueEx(Go, GoHealthWatch, kValue)
+
+typedef struct GoHealthCrossing
+{
+    GoHealthCrossingFx function;
+    kPointer receiver;
+    GoHealthCrossingFxArgs args;
+} GoHealthCrossing;
+
+kDeclareValueEx(Go, GoHealthCrossing, kValue)
+
+typedef struct GoHealthTableClass
+{
+    kObjectClass base;
+
+    kObject sender;                             //sender argument for threshold callbacks
+    kLock notifyLock;                           //held while threshold callbacks run
+    kLock lock;                                 //protects all fields below
+    kArrayList entries;                         //indicator values (kArrayList<GoHealthEntry>)
+    kMap slots;                                 //entry index by key (kMap<GoHealthKey, kSize>)
+    kMap layouts;                               //entry index by message position, per sensor (kMap<k32u, kArrayList<kSize>>)
+    kArrayList watches;                         //threshold watches (kArrayList<GoHealthWatch>)
+} GoHealthTableClass;
+
+kDeclareClassEx(Go, GoHealthTable, kObject)
+
+GoFx(kStatus) GoHealthTable_Init(GoHealthTable table, kType type, kObject sender, kAlloc alloc);
+GoFx(kStatus) GoHealthTable_VRelease(GoHealthTable table);
+
+GoFx(kStatus) GoHealthTable_UpdateMsg(GoHealthTable table, k32u sensorId, GoHealthMsg msg, kArrayList layout, kSize* position, kArrayList* crossings);
+GoFx(kStatus) GoHealthTable_FindSlot(GoHealthTable table, k32u sensorId, k32u id, k32u instance, kBool create, kSize* slot);
+GoFx(kStatus) GoHealthTable_CheckWatches(GoHealthTable table, kSize slot, k64s value, kArrayList* crossings);
+GoFx(kStatus) GoHealthTable_Notify(GoHealthTable table, kArrayList crossings);
+GoFx(kBool) GoHealthTable_IsWatched(GoHealthTable table, GoHealthCrossingFx function, kPointer receiver);
+
+#endif
@@ -8,6 +8,10 @@
  */
 #include <GoSdk/Internal/GoReceiver.h>
 #include <GoSdk/Internal/GoSerializer.h>
+#include <kApi/Data/kBitArray.h>
+#include <kApi/Io/kSocket.h>
+#include <kApi/Threads/kTimer.h>
+#include <kApi/Utils/kTrace.h>
 #include <kApi/Utils/kUtils.h>
 
 kBeginClassEx(Go, GoReceiver)
@@ -46,6 +50,17 @@ GoFx(kStatus) GoReceiver_Init(GoReceiver receiver, kType type, kAlloc alloc)
     obj->socketBufferSize = -1; 
     obj->clientBufferSize = -1; 
 
+    obj->lowLatency.enabled = kFALSE; 
+    obj->lowLatency.cpu = -1; 
+    obj->lowLatency.priorityClass = kTHREAD_PRIORITY_CLASS_NORMAL; 
+    obj->lowLatency.busyPollTime = 0; 
+
+    kZero(obj->adaptive); 
+    obj->currentSocketSize = -1; 
+    obj->currentClientSize = -1; 
+
+    kCheck(GoReceiver_ClearLatency(receiver)); 
+
     return kOK; 
 }
 
@@ -70,6 +85,39 @@ GoFx(kStatus) GoReceiver_SetBuffers(GoReceiver receiver, kSSize socketSize, kSSi
     return kOK; 
 }
 
+GoFx(kStatus) GoReceiver_SetAdaptiveBuffers(GoReceiver receiver, const GoAdaptiveBufferOptions* options)
+{
+    kObj(GoReceiver, receiver); 
+
+    kCheckState(!GoReceiver_IsOpen(receiver)); 
+    kCheckArgs(!options->enabled || ((options->minStreamSize > 0) && (options->minStreamSize <= options->maxStreamSize))); 
+
+    obj->adaptive = *options; 
+
+    return kOK; 
+}
+
+GoFx(kStatus) GoReceiver_BufferSizes(GoReceiver receiver, kSSize* socketSize, kSSize* clientSize)
+{
+    kObj(GoReceiver, receiver); 
+
+    *socketSize = obj->currentSocketSize; 
+    *clientSize = obj->currentClientSize; 
+
+    return kOK; 
+}
+
+GoFx(kStatus) GoReceiver_SetLowLatency(GoReceiver receiver, const GoLowLatencyOptions* options)
+{
+    kObj(GoReceiver, receiver); 
+
+    kCheckState(!GoReceiver_IsOpen(receiver)); 
+
+    obj->lowLatency = *options; 
+
+    return kOK; 
+}
+
 GoFx(kStatus) GoReceiver_SetCancelHandler(GoReceiver receiver, kCallbackFx function, kPointer context)
 {
     kObj(GoReceiver, receiver); 
@@ -118,20 +166,43 @@ GoFx(kStatus) GoReceiver_Open(GoReceiver receiver, kIpAddress address, k32u port
     kCheck(GoReceiver_Close(receiver)); 
 
     kCheckState(!kIsNull(obj->onMessage)); 
+    kCheckState(!obj->lowLatency.enabled || (obj->clientBufferSize > 0) || obj->adaptive.enabled); 
 
     obj->quit = kFALSE; 
 
+    kCheck(GoReceiver_ClearLatency(receiver)); 
+
     kTry
     {
         kTest(kTcpClient_Construct(&obj->client, kIP_VERSION_4, kObject_Alloc(receiver))); 
         kTest(kTcpClient_SetCancelHandler(obj->client, GoReceiver_CancelHandler, receiver)); 
-        kTest(kTcpClient_SetReadBuffers(obj->client, obj->socketBufferSize, obj->clientBufferSize)); 
+        kTest(GoReceiver_OpenBuffers(receiver)); 
         kTest(kTcpClient_Connect(obj->client, address, port, GO_RECEIVER_CONNECT_TIMEOUT)); 
 
+        if (obj->lowLatency.enabled)
+        {
+            kTest(kTcpClient_EnableBlockingRead(obj->client, kTRUE)); 
+
+            //busy polling is best-effort (it is Linux-only and may require elevated privileges)
+            if (obj->lowLatency.busyPollTime > 0)
+            {
+                kSocket_SetBusyPoll(kTcpClient_Socket(obj->client), obj->lowLatency.busyPollTime); 
+            }
+        }
+
         kTest(kSerializer_Construct(&obj->reader, obj->client, kTypeOf(GoSerializer), kObject_Alloc(receiver))); 
 
         kTest(kThread_Construct(&obj->thread, kObject_Alloc(receiver))); 
-        kTest(kThread_Start(obj->thread, GoReceiver_ThreadEntry, receiver)); 
+
+        if (obj->lowLatency.enabled)
+        {
+            kTest(GoReceiver_ConfigureThread(receiver)); 
+            kTest(kThread_Start(obj->thread, GoReceiver_LowLatencyThreadEntry, receiver)); 
+        }
+        else
+        {
+            kTest(kThread_Start(obj->thread, GoReceiver_ThreadEntry, receiver)); 
+        }
     }
     kCatch(&status)
     {
@@ -148,6 +219,13 @@ GoFx(kStatus) GoReceiver_Close(GoReceiver receiver)
     kObj(GoReceiver, receiver); 
 
     obj->quit = kTRUE; 
+
+    //a low-latency receiver thread blocks in the socket read; shutdown unblocks it without 
+    //waiting for the next cancellation query
+    if (obj->lowLatency.enabled && !kIsNull(obj->client))
+    {
+        kCheck(kTcpClient_Shutdown(obj->client)); 
+    }
     
     kCheck(kDestroyRef(&obj->thread)); 
     kCheck(kDestroyRef(&obj->reader)); 
@@ -163,9 +241,26 @@ GoFx(kStatus) GoReceiver_ThreadEntry(GoReceiver receiver)
 
     while (!obj->quit)
     {
-        if (kSuccess(status = kTcpClient_Wait(obj->client, GO_RECEIVER_QUIT_QUERY_INTERVAL)))
+        kTrace_Begin("GoReceiver.Wait"); 
+        status = kTcpClient_Wait(obj->client, GO_RECEIVER_QUIT_QUERY_INTERVAL); 
+        kTrace_End("GoReceiver.Wait"); 
+
+        if (kSuccess(status))
         {
-            kCheck(obj->onMessage(obj->onMessageContext, receiver, obj->reader));    
+            k64u startTicks = kTimer_Ticks(); 
+            k64u startBytes = kStream_BytesRead(obj->client); 
+
+            kTrace_Begin("GoReceiver.Message"); 
+            status = obj->onMessage(obj->onMessageContext, receiver, obj->reader); 
+            kTrace_End("GoReceiver.Message"); 
+
+            kCheck(status);    
+            kCheck(GoReceiver_RecordLatency(receiver, startTicks)); 
+
+            if (obj->adaptive.enabled)
+            {
+                kCheck(GoReceiver_AdaptBuffers(receiver, (kSize)(kStream_BytesRead(obj->client) - startBytes))); 
+            }
         }      
         else if (status != kERROR_TIMEOUT)
         {
@@ -176,6 +271,297 @@ GoFx(kStatus) GoReceiver_ThreadEntry(GoReceiver receiver)
     return kOK; 
 }
 
+GoFx(kStatus) GoReceiver_LowLatencyThreadEntry(GoReceiver receiver)
+{
+    kObj(GoReceiver, receiver); 
+    kStatus status; 
+
+    while (!obj->quit)
+    {
+        //blocks in the socket read until the next message begins to arrive
+        kTrace_Begin("GoReceiver.Wait"); 
+        status = kStream_Fill(obj->client); 
+        kTrace_End("GoReceiver.Wait"); 
+
+        if (kSuccess(status))
+        {
+            k64u startTicks = kTimer_Ticks(); 
+            k64u startBytes = kStream_BytesRead(obj->client); 
+
+            kTrace_Begin("GoReceiver.Message"); 
+            status = obj->onMessage(obj->onMessageContext, receiver, obj->reader); 
+            kTrace_End("GoReceiver.Message"); 
+
+            if (kSuccess(status))
+            {
+                status = GoReceiver_RecordLatency(receiver, startTicks); 
+            }
+
+            if (kSuccess(status) && obj->adaptive.enabled)
+            {
+                status = GoReceiver_AdaptBuffers(receiver, (kSize)(kStream_BytesRead(obj->client) - startBytes)); 
+            }
+        }
+
+        if (!kSuccess(status))
+        {
+            //errors caused by the shutdown in GoReceiver_Close are expected
+            return obj->quit ? kOK : status; 
+        }
+    }
+
+    return kOK; 
+}
+
+GoFx(kStatus) GoReceiver_ConfigureThread(GoReceiver receiver)
+{
+    kObj(GoReceiver, receiver); 
+    kBitArray affinity = kNULL; 
+
+    kCheck(kThread_SetPriority(obj->thread, obj->lowLatency.priorityClass, 0)); 
+
+    if (obj->lowLatency.cpu >= 0)
+    {
+        kCheckArgs((kSize)obj->lowLatency.cpu < kThread_ProcessorCount()); 
+
+        kTry
+        {
+            kTest(kBitArray_Construct(&affinity, kThread_ProcessorCount(), kObject_Alloc(receiver))); 
+            kTest(kBitArray_SetItem(affinity, (kSize)obj->lowLatency.cpu, kTRUE)); 
+
+            kTest(kThread_SetAffinity(obj->thread, affinity)); 
+        }
+        kFinally
+        {
+            kObject_Destroy(affinity); 
+            kEndFinally(); 
+        }
+    }
+
+    return kOK; 
+}
+
+// Applies initial buffer sizes to a new connection; called before connecting. With adaptive sizing, 
+// the socket buffer is given its final size here: Linux derives the TCP window scale from the socket 
+// buffer size at connection time, so a buffer that grows later can't widen the receive window. The 
+// client buffer starts from the configured size, brought within the adaptive bounds. 
+GoFx(kStatus) GoReceiver_OpenBuffers(GoReceiver receiver)
+{
+    kObj(GoReceiver, receiver); 
+    const GoAdaptiveBufferOptions* options = &obj->adaptive; 
+    kSSize socketSize = obj->socketBufferSize; 
+    kSSize clientSize = obj->clientBufferSize; 
+
+    if (options->enabled)
+    {
+        socketSize = (options->socketSize > 0) ? (kSSize)options->socketSize : -1; 
+        clientSize = (kSSize)kClamp_((kSize)kMax_(clientSize, 0), options->minStreamSize, options->maxStreamSize); 
+
+        obj->adaptStart = kTimer_Now(); 
+        obj->adaptBytes = 0; 
+        obj->adaptCount = 0; 
+        obj->bandwidth = 0; 
+        obj->pendingClientSize = (kSize)clientSize; 
+
+        if (options->directReadThreshold > 0)
+        {
+            kCheck(kTcpClient_SetDirectReadThreshold(obj->client, options->directReadThreshold)); 
+        }
+    }
+
+    kCheck(kTcpClient_SetReadBuffers(obj->client, socketSize, clientSize)); 
+
+    obj->currentSocketSize = socketSize; 
+    obj->currentClientSize = clientSize; 
+
+    return kOK; 
+}
+
+// Called on the receiver thread after each message. The client buffer size is re-evaluated at the 
+// end of each interval; it grows immediately, but shrinks only when much larger than needed, so that 
+// sizes do not oscillate. The socket buffer keeps the size it was given before connecting. 
+GoFx(kStatus) GoReceiver_AdaptBuffers(GoReceiver receiver, kSize messageSize)
+{
+    kObj(GoReceiver, receiver); 
+    const GoAdaptiveBufferOptions* options = &obj->adaptive; 
+    kSize clientSize = (kSize)obj->currentClientSize; 
+    k64u now = kTimer_Now(); 
+    k64u elapsed = now - obj->adaptStart; 
+    kSize clientTarget, average; 
+
+    obj->adaptBytes += messageSize; 
+    obj->adaptCount++; 
+
+    if (elapsed >= GO_RECEIVER_ADAPT_INTERVAL)
+    {
+        obj->bandwidth = obj->adaptBytes * 1000000 / elapsed; 
+
+        average = (kSize)(obj->adaptBytes / obj->adaptCount); 
+
+        //large payloads bypass the client buffer, which then only needs to hold message headers; 
+        //otherwise, batch several messages per socket read
+        if ((options->directReadThreshold > 0) && (average >= options->directReadThreshold))
+        {
+            clientTarget = options->minStreamSize; 
+        }
+        else
+        {
+            clientTarget = GoReceiver_AdaptSize(kMax_(GO_RECEIVER_ADAPT_STREAM_MESSAGES * (k64u)average, obj->bandwidth * GO_RECEIVER_ADAPT_STREAM_TIME / 1000000), 
+                options->minStreamSize, options->maxStreamSize); 
+        }
+
+        if ((clientTarget > clientSize) || ((clientTarget * GO_RECEIVER_ADAPT_SHRINK_RATIO) <= clientSize))
+        {
+            obj->pendingClientSize = clientTarget; 
+        }
+        else
+        {
+            obj->pendingClientSize = clientSize; 
+        }
+
+        obj->adaptStart = now; 
+        obj->adaptBytes = 0; 
+        obj->adaptCount = 0; 
+    }
+
+    //the client buffer can only be replaced while it holds no unread bytes
+    if ((obj->pendingClientSize != clientSize) && (kTcpClient_Available(obj->client) == 0))
+    {
+        kCheck(kTcpClient_SetReadBuffers(obj->client, -1, (kSSize)obj->pendingClientSize)); 
+        obj->currentClientSize = (kSSize)obj->pendingClientSize; 
+    }
+
+    return kOK; 
+}
+
+// Rounds a buffer size up to a power of two, within bounds. 
+GoFx(kSize) GoReceiver_AdaptSize(k64u size, kSize minSize, kSize maxSize)
+{
+    k64u rounded = 1; 
+
+    while ((rounded < size) && (rounded < maxSize))
+    {
+        rounded <<= 1; 
+    }
+
+    return (kSize)kClamp_(rounded, (k64u)minSize, (k64u)maxSize); 
+}
+
+// Called while the receiver thread is not running. 
+GoFx(kStatus) GoReceiver_ClearLatency(GoReceiver receiver)
+{
+    kObj(GoReceiver, receiver); 
+    kSize i; 
+
+    obj->latencyMax = 0; 
+
+    for (i = 0; i < kCountOf(obj->latencyHistogram); ++i)
+    {
+        obj->latencyHistogram[i] = 0; 
+    }
+
+    return kOK; 
+}
+
+// Called on the receiver thread, the only writer of latency statistics; no lock is taken, so 
+// that recording costs no more than a few stores per message. 
+GoFx(kStatus) GoReceiver_RecordLatency(GoReceiver receiver, k64u startTicks)
+{
+    kObj(GoReceiver, receiver); 
+    k64u latency = kTimer_FromTicks(1000 * (kTimer_Ticks() - startTicks)); 
+    kSize bucket = GoReceiver_LatencyBucket(latency); 
+
+    obj->latencyHistogram[bucket]++; 
+
+    if (latency > obj->latencyMax)
+    {
+        obj->latencyMax = latency; 
+    }
+
+    return kOK; 
+}
+
+// Maps a latency to a log-linear histogram bucket: values below 16 have their own bucket; 
+// larger values are split into 8 buckets per power of two. 
+GoFx(kSize) GoReceiver_LatencyBucket(k64u latency)
+{
+    kSize exponent = 0; 
+
+    while ((latency >> exponent) >= 2*GO_RECEIVER_LATENCY_SUB_BUCKETS)
+    {
+        exponent++; 
+    }
+
+    return exponent*GO_RECEIVER_LATENCY_SUB_BUCKETS + (kSize)(latency >> exponent); 
+}
+
+// Returns the midpoint of the range of values mapped to a histogram bucket.
+GoFx(k64u) GoReceiver_LatencyBucketValue(kSize bucket)
+{
+    kSize exponent = (bucket < 2*GO_RECEIVER_LATENCY_SUB_BUCKETS) ? 0 : (bucket / GO_RECEIVER_LATENCY_SUB_BUCKETS - 1); 
+    k64u mantissa = bucket - exponent*GO_RECEIVER_LATENCY_SUB_BUCKETS; 
+
+    return (mantissa << exponent) + (((k64u)1 << exponent) >> 1); 
+}
+
+// Estimates a percentile of a log-linear histogram, expressed in parts per thousand. 
+GoFx(k64u) GoReceiver_HistogramPercentile(const k64u* histogram, k64u count, k64u max, k32u perMille)
+{
+    k64u rank = kMax_(1, (count * perMille + 999) / 1000); 
+    k64u total = 0; 
+    kSize i; 
+
+    if (count == 0)
+    {
+        return 0; 
+    }
+
+    for (i = 0; i < GO_RECEIVER_LATENCY_BUCKET_COUNT; ++i)
+    {
+        total += histogram[i]; 
+
+        if (total >= rank)
+        {
+            return kMin_(GoReceiver_LatencyBucketValue(i), max); 
+        }
+    }
+
+    return max; 
+}
+
+GoFx(kStatus) GoReceiver_HistogramStats(const k64u* histogram, k64u count, k64u max, GoLatencyStats* stats)
+{
+    stats->count = count; 
+    stats->p50 = GoReceiver_HistogramPercentile(histogram, count, max, 500); 
+    stats->p99 = GoReceiver_HistogramPercentile(histogram, count, max, 990); 
+    stats->p999 = GoReceiver_HistogramPercentile(histogram, count, max, 999); 
+    stats->max = max; 
+
+    return kOK; 
+}
+
+// Statistics are copied while the receiver thread may be recording; the sample count is taken 
+// from the copy, so that percentiles are consistent with it. A sample recorded during the copy 
+// may be missed until the next call. 
+GoFx(kStatus) GoReceiver_LatencyStats(GoReceiver receiver, GoLatencyStats* stats)
+{
+    kObj(GoReceiver, receiver); 
+    k64u histogram[GO_RECEIVER_LATENCY_BUCKET_COUNT]; 
+    k64u count = 0; 
+    k64u max = obj->latencyMax; 
+    kSize i; 
+
+    for (i = 0; i < kCountOf(histogram); ++i)
+    {
+        histogram[i] = obj->latencyHistogram[i]; 
+        count += histogram[i]; 
+    }
+
+    kCheck(GoReceiver_HistogramStats(histogram, count, max, stats)); 
+
+    return kOK; 
+}
+
 GoFx(kBool) GoReceiver_IsOpen(GoReceiver receiver)
 {
     kObj(GoReceiver, receiver); 
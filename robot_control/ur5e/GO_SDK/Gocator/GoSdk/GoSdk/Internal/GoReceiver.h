@@ -50,6 +50,72 @@ GoFx(kStatus) GoReceiver_Construct(GoReceiver* receiver, kAlloc allocator);
  */
 GoFx(kStatus) GoReceiver_SetBuffers(GoReceiver receiver, kSSize socketSize, kSSize clientSize);
 
+/** 
+ * Configures adaptive buffer sizing.
+ *
+ * When enabled, the socket buffer is set to the given size before connecting, and the receiver thread 
+ * resizes its client buffer from the sizes of received messages and the observed bandwidth, within the 
+ * given bounds. The client size set with GoReceiver_SetBuffers is used as the initial size. Client 
+ * buffers are resized between messages, when no unread bytes are buffered. Reads of at least the direct 
+ * read threshold bypass the client buffer. 
+ * 
+ * Call this function before calling GoReceiver_Open. 
+ * 
+ * @public              @memberof GoReceiver
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   receiver    Receiver object. 
+ * @param   options     Adaptive buffer options.
+ * @return              Operation status. 
+ */
+GoFx(kStatus) GoReceiver_SetAdaptiveBuffers(GoReceiver receiver, const GoAdaptiveBufferOptions* options);
+
+/** 
+ * Reports the current sizes of the buffers used for receiving data.
+ *
+ * Socket buffer sizes are reported as requested; the operating system may limit or adjust them.
+ * 
+ * @public              @memberof GoReceiver
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   receiver    Receiver object. 
+ * @param   socketSize  Receives the size of the socket read buffer (-1 if the system default is used).
+ * @param   clientSize  Receives the size of the client read buffer (-1 if the default is used).
+ * @return              Operation status. 
+ */
+GoFx(kStatus) GoReceiver_BufferSizes(GoReceiver receiver, kSSize* socketSize, kSSize* clientSize);
+
+/** 
+ * Configures low-latency receive options.
+ *
+ * In low-latency mode, the receiver thread blocks directly in the socket read rather than waiting 
+ * for data to become readable. The read still wakes at intervals while no data arrives, so the 
+ * cancellation handler continues to be polled; GoReceiver_Close also shuts down the socket to 
+ * unblock the thread immediately. Blocking reads are not used on Windows. A client read buffer 
+ * is required (see GoReceiver_SetBuffers).
+ * 
+ * Call this function before calling GoReceiver_Open. 
+ * 
+ * @public              @memberof GoReceiver
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   receiver    Receiver object. 
+ * @param   options     Low-latency options.
+ * @return              Operation status. 
+ */
+GoFx(kStatus) GoReceiver_SetLowLatency(GoReceiver receiver, const GoLowLatencyOptions* options);
+
+/** 
+ * Reports the distribution of the time taken to process messages since the receiver was opened.
+ *
+ * Each sample measures the time from the first bytes of a message being available from the socket 
+ * until the message handler returns (i.e., the message has been queued). 
+ * 
+ * @public              @memberof GoReceiver
+ * @version             Introduced in firmware 6.4.41.x
+ * @param   receiver    Receiver object. 
+ * @param   stats       Receives latency statistics.
+ * @return              Operation status. 
+ */
+GoFx(kStatus) GoReceiver_LatencyStats(GoReceiver receiver, GoLatencyStats* stats);
+
 /** 
  * Sets an I/O cancellation query handler for this receiver object. 
  * 
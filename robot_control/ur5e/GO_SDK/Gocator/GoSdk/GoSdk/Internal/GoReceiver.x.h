@@ -10,6 +10,7 @@
 #define GO_SDK_RECEIVER_X_H
 
 #include <GoSdk/Internal/GoReceiver.h>
+#include <kApi/Threads/kLock.h>
 #include <kApi/Threads/kThread.h>
 #include <kApi/Io/kTcpClient.h>
 #include <kApi/Io/kSerializer.h>
@@ -17,6 +18,14 @@
 #define GO_RECEIVER_CONNECT_TIMEOUT             (1000000)
 #define GO_RECEIVER_QUIT_QUERY_INTERVAL         (100000)
 
+#define GO_RECEIVER_LATENCY_SUB_BUCKETS         (8)         //histogram buckets per power of two (12.5% resolution)
+#define GO_RECEIVER_LATENCY_BUCKET_COUNT        (496)       //enough buckets for any k64u value
+
+#define GO_RECEIVER_ADAPT_INTERVAL              (250000)    //interval over which bandwidth is measured for buffer sizing (us)
+#define GO_RECEIVER_ADAPT_SHRINK_RATIO          (4)         //buffers shrink only when this many times larger than needed
+#define GO_RECEIVER_ADAPT_STREAM_MESSAGES       (4)         //small messages batched per client buffer fill
+#define GO_RECEIVER_ADAPT_STREAM_TIME           (1000)      //client buffer holds at least this much data at the observed bandwidth (us)
+
 typedef struct GoReceiverClass
 {
     kObjectClass base; 
@@ -34,6 +43,20 @@ typedef struct GoReceiverClass
 
     kSSize socketBufferSize; 
     kSSize clientBufferSize; 
+
+    GoLowLatencyOptions lowLatency; 
+
+    GoAdaptiveBufferOptions adaptive;                           //adaptive buffer sizing options
+    k64u adaptStart;                                            //start of the current sizing interval (us)
+    k64u adaptBytes;                                            //bytes received in the current sizing interval
+    k64u adaptCount;                                            //messages received in the current sizing interval
+    k64u bandwidth;                                             //most recent bandwidth measurement (bytes/s)
+    kSize pendingClientSize;                                    //client buffer size to apply once the buffer is empty
+    kSSize currentSocketSize;                                   //socket buffer size applied when opened
+    volatile kSSize currentClientSize;                          //current client buffer size (written by receiver thread)
+
+    volatile k64u latencyMax;                                   //maximum latency sample (ns; written by receiver thread)
+    volatile k64u latencyHistogram[GO_RECEIVER_LATENCY_BUCKET_COUNT]; //log-linear latency histogram (ns; written by receiver thread)
 } GoReceiverClass; 
 
 kDeclareClassEx(Go, GoReceiver, kObject)
@@ -43,6 +66,20 @@ GoFx(kStatus) GoReceiver_VRelease(GoReceiver receiver);
 
 GoFx(kStatus) GoReceiver_CancelHandler(GoReceiver receiver, kObject sender, kPointer args); 
 
+GoFx(kStatus) GoReceiver_ConfigureThread(GoReceiver receiver); 
+
 GoFx(kStatus) GoReceiver_ThreadEntry(GoReceiver receiver); 
+GoFx(kStatus) GoReceiver_LowLatencyThreadEntry(GoReceiver receiver); 
+
+GoFx(kStatus) GoReceiver_OpenBuffers(GoReceiver receiver); 
+GoFx(kStatus) GoReceiver_AdaptBuffers(GoReceiver receiver, kSize messageSize); 
+GoFx(kSize) GoReceiver_AdaptSize(k64u size, kSize minSize, kSize maxSize); 
+
+GoFx(kStatus) GoReceiver_ClearLatency(GoReceiver receiver); 
+GoFx(kStatus) GoReceiver_RecordLatency(GoReceiver receiver, k64u startTicks); 
+GoFx(kSize) GoReceiver_LatencyBucket(k64u latency); 
+GoFx(k64u) GoReceiver_LatencyBucketValue(kSize bucket); 
+GoFx(k64u) GoReceiver_HistogramPercentile(const k64u* histogram, k64u count, k64u max, k32u perMille); 
+GoFx(kStatus) GoReceiver_HistogramStats(const k64u* histogram, k64u count, k64u max, GoLatencyStats* stats); 
 
 #endif
@@ -17,12 +17,35 @@ kBeginValueEx(Go, GoSerializerTypeInfo)
     kAddField(GoSerializerTypeInfo, k16u, id)
 kEndValueEx()
 
-kBeginClassEx(Go, GoSerializer)
+kBeginFullClassEx(Go, GoSerializer)
     kAddVMethod(GoSerializer, kObject, VRelease)
     kAddVMethod(GoSerializer, kSerializer, VInit)
     kAddVMethod(GoSerializer, kSerializer, VWriteObject)
     kAddVMethod(GoSerializer, kSerializer, VReadObject)
-kEndClassEx()
+kEndFullClassEx()
+
+GoFx(kStatus) xGoSerializer_InitStatic()
+{
+    kStaticObj(GoSerializer);
+
+    kCheck(kLock_Construct(&sobj->lock, kNULL));
+    kAtomic32s_Init(&sobj->isDispatchReady, kFALSE);
+    sobj->dispatchTable = kNULL;
+    sobj->dispatchCount = 0;
+    sobj->initDuration = 0;
+
+    return kOK;
+}
+
+GoFx(kStatus) xGoSerializer_ReleaseStatic()
+{
+    kStaticObj(GoSerializer);
+
+    kCheck(kMemFreeRef(&sobj->dispatchTable));
+    kCheck(kDestroyRef(&sobj->lock));
+
+    return kOK;
+}
 
 GoFx(kStatus) GoSerializer_Construct(GoSerializer* serializer, kStream stream, kAlloc allocator)
 {
@@ -47,7 +70,8 @@ GoFx(kStatus) GoSerializer_VInit(GoSerializer serializer, kType type, kStream st
     kCheck(kSerializer_VInit(serializer, type, stream, allocator));
 
     obj->typeToInfo = kNULL;
-    obj->idToType = kNULL;
+    obj->dispatchTable = kNULL;
+    obj->dispatchCount = 0;
 
     kTry
     {
@@ -55,9 +79,8 @@ GoFx(kStatus) GoSerializer_VInit(GoSerializer serializer, kType type, kStream st
         kTest(kSerializer_SetVersion(serializer, kNULL, GoSdk_ProtocolVersion()));
 
         kTest(kMap_Construct(&obj->typeToInfo, kTypeOf(kType), kTypeOf(GoSerializerTypeInfo), 0, allocator));
-        kTest(kMap_Construct(&obj->idToType, kTypeOf(k16u), kTypeOf(GoSerializerTypeInfo), 0, allocator));
 
-        kTest(GoSerializer_BuildIdToTypeMap(serializer));
+        kTest(GoSerializer_EnsureDispatchTable(&obj->dispatchTable, &obj->dispatchCount));
     }
     kCatch(&status)
     {
@@ -73,7 +96,6 @@ GoFx(kStatus) GoSerializer_VRelease(GoSerializer serializer)
     kObj(GoSerializer, serializer);
 
     kCheck(kObject_Destroy(obj->typeToInfo));
-    kCheck(kObject_Destroy(obj->idToType));
 
     kCheck(kSerializer_VRelease(serializer));
 
@@ -168,19 +190,24 @@ GoFx(kStatus) GoSerializer_WriteTypeId(GoSerializer serializer, kType type, kBoo
 GoFx(kStatus) GoSerializer_ReadTypeId(GoSerializer serializer, kType* type, kBool* isLast, kSerializerObjectDeserializeFx* fx)
 {
     kObj(GoSerializer, serializer);
-    GoSerializerTypeInfo info;
+    const GoSerializerDispatchEntry* entry;
     k16u typeId;
     k16u id;
 
     kCheck(kSerializer_Read16u(serializer, &typeId));
 
-    id = typeId & 0x7FFF;
+    id = typeId & GO_SERIALIZER_TYPE_ID_MASK;
     *isLast = (typeId >> 15);
 
-    kCheck(kMap_FindT(obj->idToType, &id, &info));
+    // Direct lookup; the table holds the deserialization function, so no type version query is needed.
+    kCheckTrue(id < obj->dispatchCount, kERROR_NOT_FOUND);
+
+    entry = &obj->dispatchTable[id];
 
-    *type = info.type;
-    *fx = (kSerializerObjectDeserializeFx) kType_VersionDeserializeFx(info.type, info.version);
+    kCheckTrue(!kIsNull(entry->type), kERROR_NOT_FOUND);
+
+    *type = entry->type;
+    *fx = entry->deserialize;
 
     return kOK;
 }
@@ -199,38 +226,109 @@ GoFx(kStatus) GoSerializer_ConstructItem(GoSerializer serializer, kObject* item,
     return status;
 }
 
-GoFx(kStatus) GoSerializer_BuildIdToTypeMap(GoSerializer serializer)
+// The dispatch table depends only on the types registered in the GoSdk assembly, so it is
+// built once (when the first serializer is constructed) and shared by all serializers.
+GoFx(kStatus) GoSerializer_EnsureDispatchTable(const GoSerializerDispatchEntry** table, kSize* count)
 {
-    kObj(GoSerializer, serializer);
-    kAssembly assembly = kAssemblyOf(GoSdk);
-    kSize typeCount = kAssembly_TypeCount(assembly);
-    GoSerializerTypeInfo info;
-    kSize i, j;
-
-    kCheck(kMap_Clear(obj->idToType));
+    kStaticObj(GoSerializer);
+    GoSerializerDispatchEntry* newTable = kNULL;
+    kSize newCount = 0;
+    k64u startTime;
 
-    for (i = 0; i < typeCount; ++i)
+    if (!kAtomic32s_Get(&sobj->isDispatchReady))
     {
-        kType type = kAssembly_TypeAt(assembly, i);
-        kSize versionCount = kType_VersionCount(type);
+        kLock_Enter(sobj->lock);
+
+        kTry
+        {
+            if (!kAtomic32s_Get(&sobj->isDispatchReady))
+            {
+                startTime = kTimer_Now();
 
-        for (j = 0; j < versionCount; ++j)
+                kTest(GoSerializer_BuildDispatchTable(&newTable, &newCount));
+
+                sobj->dispatchTable = newTable;
+                sobj->dispatchCount = newCount;
+                sobj->initDuration = kTimer_Now() - startTime;
+                newTable = kNULL;
+
+                kAtomic32s_Exchange(&sobj->isDispatchReady, kTRUE);
+            }
+        }
+        kFinally
         {
-           kTypeVersion version = kType_VersionAt(type, j);
+            kMemFree(newTable);
+            kLock_Exit(sobj->lock);
+
+            kEndFinally();
+        }
+    }
+
+    *table = sobj->dispatchTable;
+    *count = sobj->dispatchCount;
+
+    return kOK;
+}
+
+GoFx(k64u) GoSerializer_SharedInitDuration(void)
+{
+    kStaticObj(GoSerializer);
 
-           if (kStrEquals(kType_VersionFormat(type, version), GO_SERIALIZATION_FORMAT_NAME))
-           {
-               const kChar* guid = kType_VersionGuid(type, version);
+    return sobj->initDuration;
+}
 
-               info.type = type;
-               info.version = version;
-               info.id = (k16u) atoi(guid);
+GoFx(kStatus) GoSerializer_BuildDispatchTable(GoSerializerDispatchEntry** table, kSize* count)
+{
+    kAssembly assembly = kAssemblyOf(GoSdk);
+    kSize typeCount = kAssembly_TypeCount(assembly);
+    GoSerializerDispatchEntry* output = kNULL;
+    kSize outputCount = 0;
+    kSize pass, i, j;
 
-               kCheck(kMap_AddT(obj->idToType, &info.id, &info));
-           }
+    // First pass sizes the table by the highest type id; second pass fills it in.
+    for (pass = 0; pass < 2; ++pass)
+    {
+        if (pass == 1)
+        {
+            kCheck(kMemAllocZero(outputCount * sizeof(GoSerializerDispatchEntry), &output));
+        }
+
+        for (i = 0; i < typeCount; ++i)
+        {
+            kType type = kAssembly_TypeAt(assembly, i);
+            kSize versionCount = kType_VersionCount(type);
+
+            for (j = 0; j < versionCount; ++j)
+            {
+                kTypeVersion version = kType_VersionAt(type, j);
+
+                if (kStrEquals(kType_VersionFormat(type, version), GO_SERIALIZATION_FORMAT_NAME))
+                {
+                    k16u id = (k16u) atoi(kType_VersionGuid(type, version));
+
+                    if (pass == 0)
+                    {
+                        outputCount = kMax_(outputCount, (kSize)id + 1);
+                    }
+                    else if (kIsNull(output[id].type))
+                    {
+                        output[id].type = type;
+                        output[id].version = version;
+                        output[id].deserialize = (kSerializerObjectDeserializeFx) kType_VersionDeserializeFx(type, version);
+                    }
+                    else
+                    {
+                        kMemFree(output);
+                        return kERROR_ALREADY_EXISTS;
+                    }
+                }
+            }
         }
     }
 
+    *table = output;
+    *count = outputCount;
+
     return kOK;
 }
 
@@ -10,6 +10,9 @@
 #define GO_SDK_SERIALIZER_X_H
 
 #include <kApi/Data/kMap.h>
+#include <kApi/Threads/kAtomic.h>
+#include <kApi/Threads/kLock.h>
+#include <kApi/Threads/kTimer.h>
 
 typedef struct GoSerializerTypeInfo
 {
@@ -20,14 +23,37 @@ typedef struct GoSerializerTypeInfo
 
 kDeclareValueEx(Go, GoSerializerTypeInfo, kValue)
 
+#define GO_SERIALIZER_TYPE_ID_MASK      (0x7FFF)        //type id bits in a message header (the top bit marks the last message)
+
+// Entry in the read-side dispatch table; the table is indexed by type id.
+typedef struct GoSerializerDispatchEntry
+{
+    kType type;                                 //type object (kNULL if the id is not used)
+    kTypeVersion version;                       //type object serialization version information
+    kSerializerObjectDeserializeFx deserialize; //deserialization function for this version
+} GoSerializerDispatchEntry;
+
 typedef struct GoSerializerClass
 {
     kSerializerClass base;
-    kMap typeToInfo;              //used by writer; maps type pointer to type version info (kMap<kType, GoSerializerTypeInfo>)
-    kMap idToType;                //used by reader; maps type id to type version info (kMap<k16u, GoSerializerTypeInfo>)
+    kMap typeToInfo;                                //used by writer; maps type pointer to type version info (kMap<kType, GoSerializerTypeInfo>)
+    const GoSerializerDispatchEntry* dispatchTable; //used by reader; shared dispatch table owned by the static class (read-only)
+    kSize dispatchCount;                            //count of dispatch table entries (highest type id + 1)
 } GoSerializerClass;
 
-kDeclareClassEx(Go, GoSerializer, kSerializer)
+typedef struct GoSerializerStatic
+{
+    kLock lock;                                 //guards creation of the shared dispatch table
+    kAtomic32s isDispatchReady;                 //shared dispatch table has been created (on first use)
+    GoSerializerDispatchEntry* dispatchTable;   //dispatch table, indexed by type id
+    kSize dispatchCount;                        //count of dispatch table entries
+    k64u initDuration;                          //time required to build the shared dispatch table (us)
+} GoSerializerStatic;
+
+kDeclareFullClassEx(Go, GoSerializer, kSerializer)
+
+GoFx(kStatus) xGoSerializer_InitStatic();
+GoFx(kStatus) xGoSerializer_ReleaseStatic();
 
 GoFx(kStatus) GoSerializer_VInit(GoSerializer serializer, kType type, kStream stream, kAlloc allocator);
 GoFx(kStatus) GoSerializer_VRelease(GoSerializer serializer);
@@ -41,6 +67,8 @@ GoFx(kStatus) GoSerializer_ReadTypeId(GoSerializer serializer, kType* type, kBoo
 
 GoFx(kStatus) GoSerializer_ConstructItem(GoSerializer serializer, kObject* item, kType type, kSerializerObjectDeserializeFx initializer, kAlloc alloc);
 
-GoFx(kStatus) GoSerializer_BuildIdToTypeMap(GoSerializer serializer);
+GoFx(kStatus) GoSerializer_BuildDispatchTable(GoSerializerDispatchEntry** table, kSize* count);
+GoFx(kStatus) GoSerializer_EnsureDispatchTable(const GoSerializerDispatchEntry** table, kSize* count);
+GoFx(k64u) GoSerializer_SharedInitDuration(void);
 
 #endif
@@ -19,8 +19,11 @@ GoFx(kStatus) xGoFeatures_InitStatic()
     kStaticObj(GoFeatures);
 
     kCheck(kArrayList_Construct(&sobj->nameTypeMapList, kTypeOf(GoFeaturesNameTypeMapping), 0, kNULL));
+    kCheck(kLock_Construct(&sobj->lock, kNULL));
+    kAtomic32s_Init(&sobj->isMapReady, kFALSE);
 
-    kCheck(GoFeatures_CreateNameTypeMap());
+    // The name table is only needed to parse or format tool configuration; it is created
+    // on first use (GoFeatures_EnsureNameTypeMap) to keep library construction fast.
 
     return kOK;
 
@@ -30,6 +33,7 @@ GoFx(kStatus) xGoFeatures_ReleaseStatic()
     kStaticObj(GoFeatures);
 
     kObject_Destroy(sobj->nameTypeMapList);
+    kObject_Destroy(sobj->lock);
 
     return kOK;
 }
@@ -175,12 +179,40 @@ GoFx(kStatus) GoFeatures_CreateNameTypeMap(void)
     return kOK;
 }
 
+GoFx(kStatus) GoFeatures_EnsureNameTypeMap(void)
+{
+    kStaticObj(GoFeatures);
+    kStatus status = kOK;
+
+    if (!kAtomic32s_Get(&sobj->isMapReady))
+    {
+        kLock_Enter(sobj->lock);
+        {
+            if (!kAtomic32s_Get(&sobj->isMapReady))
+            {
+                //discard any entries left by an earlier failed attempt
+                kArrayList_Clear(sobj->nameTypeMapList);
+
+                if (kSuccess(status = GoFeatures_CreateNameTypeMap()))
+                {
+                    kAtomic32s_Exchange(&sobj->isMapReady, kTRUE);
+                }
+            }
+        }
+        kLock_Exit(sobj->lock);
+    }
+
+    return status;
+}
+
 GoFx(kStatus) GoFeatures_ParseTypeHelper(const kChar* name, kType* type)
 {
     kStaticObj(GoFeatures);
     kSize i;
     GoFeaturesNameTypeMapping *map;
 
+    kCheck(GoFeatures_EnsureNameTypeMap());
+
     for (i = 0; i < kArrayList_Count(sobj->nameTypeMapList); ++i)
     {
         map = kArrayList_AtT(sobj->nameTypeMapList, i, GoFeaturesNameTypeMapping);
@@ -229,6 +261,8 @@ GoFx(kStatus) GoFeatures_FormatTypeHelper(kType feature, const kChar** outputPtr
     kSize i;
     GoFeaturesNameTypeMapping map;
 
+    kCheck(GoFeatures_EnsureNameTypeMap());
+
     for (i = 0; i < kArrayList_Count(sobj->nameTypeMapList); ++i)
     {
         map = *kArrayList_AtT(sobj->nameTypeMapList, i, GoFeaturesNameTypeMapping);
@@ -10,6 +10,8 @@
 #define GO_SDK_FEATURES_X_H
 
 #include <kApi/Data/kXml.h>
+#include <kApi/Threads/kAtomic.h>
+#include <kApi/Threads/kLock.h>
 #include <GoSdk/GoSdkDef.h>
 
 // Define the feature names, ordered alphabetically.
@@ -43,6 +45,8 @@ typedef kObject GoFeatures;
 typedef struct GoFeaturesStatic
 {
     kArrayList nameTypeMapList;
+    kLock lock;                 //guards creation of the name table
+    kAtomic32s isMapReady;      //name table has been created (on first use)
 } GoFeaturesStatic;
 
 kDeclareStaticClassEx(Go, GoFeatures)
@@ -54,6 +58,7 @@ GoFx(kStatus) GoFeatures_NameTypeMapAdd(const char* name, const char *featureNam
 GoFx(kStatus) GoFeatures_NameTypeMapInit(void);
 GoFx(kSize) GoFeatures_NameTypeMapEntryCount(void);
 GoFx(kStatus) GoFeatures_CreateNameTypeMap(void);
+GoFx(kStatus) GoFeatures_EnsureNameTypeMap(void);
 GoFx(kStatus) GoFeatures_ParseType(const kChar* toolName, const kChar* featureName, kType* type);
 GoFx(kStatus) GoFeatures_ParseTypeHelper(const kChar* name, kType* type);
 GoFx(kStatus) GoFeatures_FormatType(kType feature, kChar* featureName, kSize capacity);
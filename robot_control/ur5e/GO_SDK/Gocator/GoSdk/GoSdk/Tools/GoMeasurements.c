@@ -20,8 +20,11 @@ GoFx(kStatus) xGoMeasurements_InitStatic()
     kStaticObj(GoMeasurements);
 
     kCheck(kArrayList_Construct(&sobj->nameTypeMapList, kTypeOf(GoMeasurementsNameTypeMapping), 0, kNULL));
+    kCheck(kLock_Construct(&sobj->lock, kNULL));
+    kAtomic32s_Init(&sobj->isMapReady, kFALSE);
 
-    kCheck(GoMeasurements_CreateNameTypeMap());
+    // The name table is only needed to parse or format tool configuration; it is created
+    // on first use (GoMeasurements_EnsureNameTypeMap) to keep library construction fast.
 
     return kOK;
 
@@ -31,6 +34,7 @@ GoFx(kStatus) xGoMeasurements_ReleaseStatic()
     kStaticObj(GoMeasurements);
     
     kObject_Destroy(sobj->nameTypeMapList);
+    kObject_Destroy(sobj->lock);
 
     return kOK;
 }
@@ -308,6 +312,32 @@ GoFx(kStatus) GoMeasurements_CreateNameTypeMap(void)
     return kOK;
 }
 
+GoFx(kStatus) GoMeasurements_EnsureNameTypeMap(void)
+{
+    kStaticObj(GoMeasurements);
+    kStatus status = kOK;
+
+    if (!kAtomic32s_Get(&sobj->isMapReady))
+    {
+        kLock_Enter(sobj->lock);
+        {
+            if (!kAtomic32s_Get(&sobj->isMapReady))
+            {
+                //discard any entries left by an earlier failed attempt
+                kArrayList_Clear(sobj->nameTypeMapList);
+
+                if (kSuccess(status = GoMeasurements_CreateNameTypeMap()))
+                {
+                    kAtomic32s_Exchange(&sobj->isMapReady, kTRUE);
+                }
+            }
+        }
+        kLock_Exit(sobj->lock);
+    }
+
+    return status;
+}
+
 GoFx(kStatus) GoMeasurements_ParseTypeHelper(const kChar* name, kType* type)
 {
     kStaticObj(GoMeasurements);
@@ -315,6 +345,8 @@ GoFx(kStatus) GoMeasurements_ParseTypeHelper(const kChar* name, kType* type)
     GoMeasurementsNameTypeMapping *map;
     kStatus status = kERROR_PARAMETER;
 
+    kCheck(GoMeasurements_EnsureNameTypeMap());
+
     for (i = 0; i < kArrayList_Count(sobj->nameTypeMapList); ++i)
     {
         map = kArrayList_AtT(sobj->nameTypeMapList, i, GoMeasurementsNameTypeMapping);
@@ -364,6 +396,8 @@ GoFx(kStatus) GoMeasurements_FormatTypeHelper(kType measurement, const kChar** o
     kSize i;
     GoMeasurementsNameTypeMapping map;
 
+    kCheck(GoMeasurements_EnsureNameTypeMap());
+
     for (i = 0; i < kArrayList_Count(sobj->nameTypeMapList); ++i)
     {
         map = *kArrayList_AtT(sobj->nameTypeMapList, i, GoMeasurementsNameTypeMapping);
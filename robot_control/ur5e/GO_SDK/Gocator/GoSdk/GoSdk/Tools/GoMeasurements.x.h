@@ -10,6 +10,8 @@
 #define GO_SDK_MEASUREMENTS_X_H
 
 #include <kApi/Data/kXml.h>
+#include <kApi/Threads/kAtomic.h>
+#include <kApi/Threads/kLock.h>
 #include <GoSdk/Tools/GoExtMeasurement.h>
 
 // Define measurement names. Definitions are ordered alphabetically.
@@ -105,6 +107,8 @@ typedef kObject GoMeasurements;
 typedef struct GoMeasurementsStatic
 {
     kArrayList nameTypeMapList;
+    kLock lock;                 //guards creation of the name table
+    kAtomic32s isMapReady;      //name table has been created (on first use)
 } GoMeasurementsStatic;
 
 kDeclareStaticClassEx(Go, GoMeasurements)
@@ -116,6 +120,7 @@ GoFx(kStatus) GoMeasurements_NameTypeMapAdd(const char* name, const char *measur
 GoFx(kStatus) GoMeasurements_NameTypeMapInit(void);
 GoFx(kSize) GoMeasurements_NameTypeMapEntryCount(void);
 GoFx(kStatus) GoMeasurements_CreateNameTypeMap(void);
+GoFx(kStatus) GoMeasurements_EnsureNameTypeMap(void);
 GoFx(kStatus) GoMeasurements_ParseType(const kChar* toolName, const kChar* measurementName, kType* type);
 GoFx(kStatus) GoMeasurements_ParseTypeHelper(const kChar* name, kType* type);
 GoFx(kStatus) GoMeasurements_FormatType(kType measurement, kChar* measurementName, kSize capacity);
@@ -196,9 +196,11 @@ GoFx(kStatus) xGoTools_InitStatic()
 
     kCheck(kMap_Construct(&sobj->namekTypeMap, kTypeOf(GOTOOLS_NAME_TYPE), kTypeOf(kType), 0, kNULL));
     kCheck(kMap_Construct(&sobj->nameToolIdMap, kTypeOf(GOTOOLS_NAME_TYPE), kTypeOf(GoToolType), 0, kNULL));
+    kCheck(kLock_Construct(&sobj->lock, kNULL));
+    kAtomic32s_Init(&sobj->areMapsReady, kFALSE);
 
-    kCheck(GoTools_CreateNamekTypeMap());
-    kCheck(GoTools_CreateNameToolIdMap());
+    // The name maps are only needed to parse or format tool configuration; they are
+    // populated on first use (GoTools_EnsureNameMaps) to keep library construction fast.
 
     return kOK;
 }
@@ -209,6 +211,7 @@ GoFx(kStatus) xGoTools_ReleaseStatic()
     
     kObject_Destroy(sobj->namekTypeMap);
     kObject_Destroy(sobj->nameToolIdMap);
+    kObject_Destroy(sobj->lock);
     
     return kOK;
 }
@@ -1068,6 +1071,7 @@ GoFx(kStatus) GoTools_ParseToolTypeHelper(const kChar* toolName, kType* toolType
 
     kStrCopy(storage, kCountOf(storage), toolName);
 
+    kCheck(GoTools_EnsureNameMaps());
     kCheck(kMap_FindItemT(sobj->namekTypeMap, storage, &item));
 
     if (!kIsNull(item))
@@ -1095,6 +1099,8 @@ GoFx(kStatus) GoTools_FormatToolTypeHelper(kType toolType, const kChar** outputP
 
     kMapItem item = kNULL;
 
+    kCheck(GoTools_EnsureNameMaps());
+
     item = kMap_First(sobj->namekTypeMap);
 
     while (!kIsNull(item))
@@ -1310,11 +1316,43 @@ GoFx(kStatus) GoTools_CreateNameToolIdMap(void)
     return kOK;
 }
 
+GoFx(kStatus) GoTools_EnsureNameMaps(void)
+{
+    kStaticObj(GoTools);
+    kStatus status = kOK;
+
+    if (!kAtomic32s_Get(&sobj->areMapsReady))
+    {
+        kLock_Enter(sobj->lock);
+        {
+            if (!kAtomic32s_Get(&sobj->areMapsReady))
+            {
+                //discard any entries left by an earlier failed attempt
+                kMap_Clear(sobj->namekTypeMap);
+                kMap_Clear(sobj->nameToolIdMap);
+
+                if (kSuccess(status = GoTools_CreateNamekTypeMap()) && kSuccess(status = GoTools_CreateNameToolIdMap()))
+                {
+                    kAtomic32s_Exchange(&sobj->areMapsReady, kTRUE);
+                }
+            }
+        }
+        kLock_Exit(sobj->lock);
+    }
+
+    return status;
+}
+
 GoFx(const kChar*) GoTools_BuiltInToolDefineToString(GoToolType type)
 {
     kStaticObj(GoTools);
     kMapItem item = kNULL;
 
+    if (!kSuccess(GoTools_EnsureNameMaps()))
+    {
+        return "TOOL_UNKNOWN";
+    }
+
     item = kMap_First(sobj->nameToolIdMap);
 
     while (!kIsNull(item))
@@ -1350,6 +1388,11 @@ GoFx(GoToolType) GoTools_StringToBuiltInDefine(const kChar* name)
 
     kStrCopy(storage, kCountOf(storage), name);
 
+    if (!kSuccess(GoTools_EnsureNameMaps()))
+    {
+        return GO_TOOL_UNKNOWN;
+    }
+
     kCheck(kMap_FindItemT(sobj->nameToolIdMap, &storage, &item));
 
     if (!kIsNull(item))
@@ -10,6 +10,8 @@
 #define GO_TOOLS_X_H
 
 #include <kApi/Data/kXml.h>
+#include <kApi/Threads/kAtomic.h>
+#include <kApi/Threads/kLock.h>
 
 // Define the Script tool name.
 #define GO_TOOLS_NAME_SCRIPT "Script"
@@ -60,6 +62,8 @@ typedef struct GoToolsStatic
 {
     kMap namekTypeMap; //GOTOOLS_NAME_TYPE - kType
     kMap nameToolIdMap; //GOTOOLS_NAME_TYPE - GoToolType
+    kLock lock;         //guards creation of the name maps
+    kAtomic32s areMapsReady; //name maps have been created (on first use)
 } GoToolsStatic;
 
 kDeclareFullClassEx(Go, GoTools, kObject)
@@ -91,6 +95,7 @@ GoFx(kStatus) GoTools_NamekTypeMapAdd(const char* name, kType toolType);
 GoFx(kStatus) GoTools_NamekTypeMapInit(void);
 GoFx(kStatus) GoTools_CreateNamekTypeMap(void);
 GoFx(kStatus) GoTools_CreateNameToolIdMap(void);
+GoFx(kStatus) GoTools_EnsureNameMaps(void);
 GoFx(kStatus) GoTools_ParseToolType(const kChar* toolName, kType* type);
 GoFx(kStatus) GoTools_ParseToolTypeHelper(const kChar* toolName, kType* toolType);
 GoFx(kStatus) GoTools_FormatToolType(kType type, kChar* toolName, kSize capacity);
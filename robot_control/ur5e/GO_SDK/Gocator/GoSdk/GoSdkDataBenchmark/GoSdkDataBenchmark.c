@@ -0,0 +1,536 @@
+/*
+ * GoSdkDataBenchmark.c
+ *
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ *
+ * Licensed under The MIT License.
+ * Redistributions of files must retain the above copyright notice.
+ *
+ * Purpose: Measures GoSerializer deserialization throughput for each data message type.
+ *
+ * Usage: GoSdkDataBenchmark [-s megabytes] [-t type]
+ *
+ * One message of each type is populated at a representative size, wrapped in a data set and written
+ * repeatedly into a memory stream with GoSerializer (using the type's serialization writer). The data
+ * sets are then read back with kSerializer_ReadObject, as GoReceiver does for each frame. For each type,
+ * the benchmark reports the serialized size, read throughput, time per message and per item
+ * (profile point, surface pixel, mesh vertex, etc.) and the number of allocations per message.
+ *
+ * The -s option sets the approximate amount of serialized data read per type (default 64 MB);
+ * the -t option restricts the run to the message types whose name contains the given text.
+ */
+#include <GoSdk/GoSdk.h>
+#include <kApi/Io/kMemory.h>
+#include <kApi/Utils/kUserAlloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_DEFAULT_MEGABYTES             (64)
+#define BENCH_MIN_ITERATIONS                (16)
+#define BENCH_MAX_ITERATIONS                (200000)
+
+#define BENCH_PROFILE_WIDTH                 (1920)
+#define BENCH_SURFACE_LENGTH                (1000)
+#define BENCH_SURFACE_WIDTH                 (1920)
+#define BENCH_POINT_CLOUD_LENGTH            (500)
+#define BENCH_VIDEO_WIDTH                   (1920)
+#define BENCH_VIDEO_HEIGHT                  (1200)
+#define BENCH_MEASUREMENT_COUNT             (32)
+#define BENCH_MESH_VERTEX_COUNT             (50000)
+#define BENCH_MESH_FACET_COUNT              (100000)
+#define BENCH_GENERIC_SIZE                  (16384)
+
+typedef kStatus (*BenchCreateFx)(GoDataMsg* msg, kSize* itemCount);
+
+typedef struct BenchCase
+{
+    const kChar* name;
+    BenchCreateFx create;
+} BenchCase;
+
+typedef struct BenchAllocCounter
+{
+    kAlloc inner;
+    k64u count;
+} BenchAllocCounter;
+
+static kStatus kCall Bench_CountingAlloc(kPointer provider, kSize size, void* mem, kMemoryAlignment alignment)
+{
+    BenchAllocCounter* counter = (BenchAllocCounter*)provider;
+
+    counter->count++;
+
+    return xkAlloc_VTable(counter->inner)->VGet(counter->inner, size, mem, alignment);
+}
+
+static kStatus kCall Bench_CountingFree(kPointer provider, void* mem)
+{
+    BenchAllocCounter* counter = (BenchAllocCounter*)provider;
+
+    return kAlloc_Free(counter->inner, mem);
+}
+
+static kStatus Bench_CreateStamp(GoDataMsg* msg, kSize* itemCount)
+{
+    GoStampMsg output = kNULL;
+    GoStamp* stamp = kNULL;
+    kStatus status;
+
+    kCheck(GoStampMsg_Construct(&output, kNULL));
+
+    kTry
+    {
+        kTest(GoStampMsg_Allocate(output, 1));
+
+        stamp = GoStampMsg_At(output, 0);
+        stamp->frameIndex = 1000;
+        stamp->timestamp = 123456789;
+        stamp->encoder = 42;
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(output);
+        kEndCatch(status);
+    }
+
+    *msg = output;
+    *itemCount = 1;
+
+    return kOK;
+}
+
+static kStatus Bench_CreateMeasurement(GoDataMsg* msg, kSize* itemCount)
+{
+    GoMeasurementMsg output = kNULL;
+    GoMeasurementData* measurement = kNULL;
+    kSize i;
+    kStatus status;
+
+    kCheck(GoMeasurementMsg_Construct(&output, kNULL));
+
+    kTry
+    {
+        kTest(GoMeasurementMsg_Allocate(output, BENCH_MEASUREMENT_COUNT));
+
+        for (i = 0; i < BENCH_MEASUREMENT_COUNT; ++i)
+        {
+            measurement = GoMeasurementMsg_At(output, i);
+            measurement->value = 1.25 * (k64f)i;
+            measurement->decision = GO_DECISION_PASS;
+            measurement->decisionCode = GO_DECISION_CODE_OK;
+        }
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(output);
+        kEndCatch(status);
+    }
+
+    *msg = output;
+    *itemCount = BENCH_MEASUREMENT_COUNT;
+
+    return kOK;
+}
+
+static kStatus Bench_CreateUniformProfile(GoDataMsg* msg, kSize* itemCount)
+{
+    GoUniformProfileMsg output = kNULL;
+    kStatus status;
+
+    kCheck(GoUniformProfileMsg_Construct(&output, kNULL));
+
+    kTry
+    {
+        kTest(GoUniformProfileMsg_Allocate(output, 1, BENCH_PROFILE_WIDTH));
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(output);
+        kEndCatch(status);
+    }
+
+    *msg = output;
+    *itemCount = BENCH_PROFILE_WIDTH;
+
+    return kOK;
+}
+
+static kStatus Bench_CreateProfilePointCloud(GoDataMsg* msg, kSize* itemCount)
+{
+    GoProfilePointCloudMsg output = kNULL;
+    kStatus status;
+
+    kCheck(GoProfilePointCloudMsg_Construct(&output, kNULL));
+
+    kTry
+    {
+        kTest(GoProfilePointCloudMsg_Allocate(output, 1, BENCH_PROFILE_WIDTH));
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(output);
+        kEndCatch(status);
+    }
+
+    *msg = output;
+    *itemCount = BENCH_PROFILE_WIDTH;
+
+    return kOK;
+}
+
+static kStatus Bench_CreateProfileIntensity(GoDataMsg* msg, kSize* itemCount)
+{
+    GoProfileIntensityMsg output = kNULL;
+    kStatus status;
+
+    kCheck(GoProfileIntensityMsg_Construct(&output, kNULL));
+
+    kTry
+    {
+        kTest(GoProfileIntensityMsg_Allocate(output, 1, BENCH_PROFILE_WIDTH));
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(output);
+        kEndCatch(status);
+    }
+
+    *msg = output;
+    *itemCount = BENCH_PROFILE_WIDTH;
+
+    return kOK;
+}
+
+static kStatus Bench_CreateSection(GoDataMsg* msg, kSize* itemCount)
+{
+    GoSectionMsg output = kNULL;
+    kStatus status;
+
+    kCheck(GoSectionMsg_Construct(&output, kNULL));
+
+    kTry
+    {
+        kTest(GoSectionMsg_Allocate(output, 1, BENCH_PROFILE_WIDTH));
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(output);
+        kEndCatch(status);
+    }
+
+    *msg = output;
+    *itemCount = BENCH_PROFILE_WIDTH;
+
+    return kOK;
+}
+
+static kStatus Bench_CreateUniformSurface(GoDataMsg* msg, kSize* itemCount)
+{
+    GoUniformSurfaceMsg output = kNULL;
+    kStatus status;
+
+    kCheck(GoUniformSurfaceMsg_Construct(&output, kNULL));
+
+    kTry
+    {
+        kTest(GoUniformSurfaceMsg_Allocate(output, BENCH_SURFACE_LENGTH, BENCH_SURFACE_WIDTH));
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(output);
+        kEndCatch(status);
+    }
+
+    *msg = output;
+    *itemCount = BENCH_SURFACE_LENGTH * BENCH_SURFACE_WIDTH;
+
+    return kOK;
+}
+
+static kStatus Bench_CreateSurfacePointCloud(GoDataMsg* msg, kSize* itemCount)
+{
+    GoSurfacePointCloudMsg output = kNULL;
+    kStatus status;
+
+    kCheck(GoSurfacePointCloudMsg_Construct(&output, kNULL));
+
+    kTry
+    {
+        kTest(GoSurfacePointCloudMsg_Allocate(output, BENCH_POINT_CLOUD_LENGTH, BENCH_SURFACE_WIDTH));
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(output);
+        kEndCatch(status);
+    }
+
+    *msg = output;
+    *itemCount = BENCH_POINT_CLOUD_LENGTH * BENCH_SURFACE_WIDTH;
+
+    return kOK;
+}
+
+static kStatus Bench_CreateSurfaceIntensity(GoDataMsg* msg, kSize* itemCount)
+{
+    GoSurfaceIntensityMsg output = kNULL;
+    kStatus status;
+
+    kCheck(GoSurfaceIntensityMsg_Construct(&output, kNULL));
+
+    kTry
+    {
+        kTest(GoSurfaceIntensityMsg_Allocate(output, BENCH_SURFACE_LENGTH, BENCH_SURFACE_WIDTH));
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(output);
+        kEndCatch(status);
+    }
+
+    *msg = output;
+    *itemCount = BENCH_SURFACE_LENGTH * BENCH_SURFACE_WIDTH;
+
+    return kOK;
+}
+
+static kStatus Bench_CreateVideo(GoDataMsg* msg, kSize* itemCount)
+{
+    GoVideoMsg output = kNULL;
+    kStatus status;
+
+    kCheck(GoVideoMsg_Construct(&output, kNULL));
+
+    kTry
+    {
+        kTest(GoVideoMsg_Allocate(output, kTypeOf(k8u), BENCH_VIDEO_WIDTH, BENCH_VIDEO_HEIGHT));
+        kTest(kImage_SetPixelFormat(xGoVideoMsg_CastRaw(output)->content, kPIXEL_FORMAT_8BPP_GREYSCALE));
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(output);
+        kEndCatch(status);
+    }
+
+    *msg = output;
+    *itemCount = BENCH_VIDEO_WIDTH * BENCH_VIDEO_HEIGHT;
+
+    return kOK;
+}
+
+static kStatus Bench_CreateMesh(GoDataMsg* msg, kSize* itemCount)
+{
+    GoMeshMsg output = kNULL;
+    kStatus status;
+
+    kCheck(GoMeshMsg_Construct(&output, kNULL));
+
+    kTry
+    {
+        kTest(GoMeshMsg_AllocateChannelData(output, GO_MESH_MSG_CHANNEL_ID_SYSTEM_VERTEX, kTypeOf(kPoint3d32f), BENCH_MESH_VERTEX_COUNT, kNULL));
+        kTest(GoMeshMsg_SetUsedChannelDataCount(output, GO_MESH_MSG_CHANNEL_ID_SYSTEM_VERTEX, BENCH_MESH_VERTEX_COUNT));
+
+        kTest(GoMeshMsg_AllocateChannelData(output, GO_MESH_MSG_CHANNEL_ID_SYSTEM_FACET, kTypeOf(GoFacet32u), BENCH_MESH_FACET_COUNT, kNULL));
+        kTest(GoMeshMsg_SetUsedChannelDataCount(output, GO_MESH_MSG_CHANNEL_ID_SYSTEM_FACET, BENCH_MESH_FACET_COUNT));
+
+        kTest(GoMeshMsg_AllocateChannelData(output, GO_MESH_MSG_CHANNEL_ID_SYSTEM_VERTEX_NORMAL, kTypeOf(kPoint3d32f), BENCH_MESH_VERTEX_COUNT, kNULL));
+        kTest(GoMeshMsg_SetUsedChannelDataCount(output, GO_MESH_MSG_CHANNEL_ID_SYSTEM_VERTEX_NORMAL, BENCH_MESH_VERTEX_COUNT));
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(output);
+        kEndCatch(status);
+    }
+
+    *msg = output;
+    *itemCount = BENCH_MESH_VERTEX_COUNT;
+
+    return kOK;
+}
+
+static kStatus Bench_CreateGeneric(GoDataMsg* msg, kSize* itemCount)
+{
+    GoGenericMsg output = kNULL;
+    kStatus status;
+
+    kCheck(GoGenericMsg_Construct(&output, kNULL));
+
+    kTry
+    {
+        kTest(kArray1_Construct(&xGoGenericMsg_CastRaw(output)->buffer, kTypeOf(kByte), BENCH_GENERIC_SIZE, kNULL));
+        kTest(kArray1_Zero(xGoGenericMsg_CastRaw(output)->buffer));
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(output);
+        kEndCatch(status);
+    }
+
+    *msg = output;
+    *itemCount = BENCH_GENERIC_SIZE;
+
+    return kOK;
+}
+
+static const BenchCase Bench_cases[] =
+{
+    { "Stamp",              Bench_CreateStamp },
+    { "Measurement",        Bench_CreateMeasurement },
+    { "UniformProfile",     Bench_CreateUniformProfile },
+    { "ProfilePointCloud",  Bench_CreateProfilePointCloud },
+    { "ProfileIntensity",   Bench_CreateProfileIntensity },
+    { "Section",            Bench_CreateSection },
+    { "UniformSurface",     Bench_CreateUniformSurface },
+    { "SurfacePointCloud",  Bench_CreateSurfacePointCloud },
+    { "SurfaceIntensity",   Bench_CreateSurfaceIntensity },
+    { "Video",              Bench_CreateVideo },
+    { "Mesh",               Bench_CreateMesh },
+    { "Generic",            Bench_CreateGeneric },
+};
+
+static kStatus Bench_RunCase(const BenchCase* benchCase, kSize targetBytes, kAlloc countingAlloc, BenchAllocCounter* counter)
+{
+    kMemory memory = kNULL;
+    GoSerializer writer = kNULL;
+    GoSerializer reader = kNULL;
+    GoDataSet dataSet = kNULL;
+    GoDataMsg msg = kNULL;
+    GoDataSet received = kNULL;
+    kType msgType;
+    kSize itemCount = 0;
+    kSize messageSize, iterations;
+    k64u start, readTime = 0, allocCount;
+    kSize i;
+
+    kTry
+    {
+        kTest(benchCase->create(&msg, &itemCount));
+        msgType = kObject_Type(msg);
+
+        //GoSerializer transfers data sets; wrap the message as a single-message frame
+        kTest(GoDataSet_Construct(&dataSet, kNULL));
+        kTest(GoDataSet_Add(dataSet, msg));
+        msg = kNULL;
+
+        kTest(kMemory_Construct(&memory, kNULL));
+        kTest(GoSerializer_Construct(&writer, memory, kNULL));
+
+        //size one message, then write enough copies to cover the target amount of data
+        kTest(kSerializer_WriteObject(writer, dataSet));
+        kTest(kSerializer_Flush(writer));
+
+        messageSize = (kSize)kMemory_Length(memory);
+        iterations = kClamp_(targetBytes / kMax_(messageSize, 1), BENCH_MIN_ITERATIONS, BENCH_MAX_ITERATIONS);
+
+        for (i = 1; i < iterations; ++i)
+        {
+            kTest(kSerializer_WriteObject(writer, dataSet));
+        }
+        kTest(kSerializer_Flush(writer));
+
+        kTest(kStream_Seek(memory, 0, kSEEK_ORIGIN_BEGIN));
+        kTest(GoSerializer_Construct(&reader, memory, kNULL));
+
+        counter->count = 0;
+
+        for (i = 0; i < iterations; ++i)
+        {
+            start = kTimer_Now();
+            kTest(kSerializer_ReadObject(reader, &received, countingAlloc));
+            readTime += kTimer_Now() - start;
+
+            kTestTrue(GoDataSet_Count(received) == 1, kERROR);
+            kTestTrue(kObject_Type(GoDataSet_At(received, 0)) == msgType, kERROR);
+
+            kTest(kDisposeRef(&received));
+        }
+
+        allocCount = counter->count;
+        readTime = kMax_(readTime, 1);
+
+        printf("%-20s %10u %8u %10.1f %8.3f %9.1f %7.1f\n",
+            benchCase->name,
+            (k32u)messageSize,
+            (k32u)iterations,
+            readTime * 1000.0 / iterations,
+            readTime * 1000.0 / ((k64f)iterations * itemCount),
+            (k64f)messageSize * iterations / readTime,
+            (k64f)allocCount / iterations);
+    }
+    kFinally
+    {
+        kObject_Dispose(received);
+        kObject_Destroy(reader);
+        kObject_Destroy(writer);
+        kObject_Destroy(memory);
+        kObject_Dispose(dataSet);
+        kObject_Dispose(msg);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+kStatus BenchmarkMain(int argc, char** argv)
+{
+    kAssembly api = kNULL;
+    kUserAlloc countingAlloc = kNULL;
+    BenchAllocCounter counter;
+    kSize targetBytes = BENCH_DEFAULT_MEGABYTES * 1024 * 1024;
+    const kChar* filter = kNULL;
+    kSize i;
+    int arg;
+
+    kCheck(GoSdk_Construct(&api));
+
+    kTry
+    {
+        for (arg = 1; arg < argc; ++arg)
+        {
+            if (kStrEquals(argv[arg], "-s") && (arg + 1 < argc))
+            {
+                targetBytes = (kSize)kMax_(atoi(argv[arg + 1]), 1) * 1024 * 1024;
+                ++arg;
+            }
+            else if (kStrEquals(argv[arg], "-t") && (arg + 1 < argc))
+            {
+                filter = argv[arg + 1];
+                ++arg;
+            }
+        }
+
+        counter.inner = kAlloc_App();
+        counter.count = 0;
+
+        kTest(kUserAlloc_Construct(&countingAlloc, Bench_CountingAlloc, Bench_CountingFree, &counter, kNULL));
+
+        printf("%-20s %10s %8s %10s %8s %9s %7s\n", "message", "bytes/msg", "count", "ns/msg", "ns/item", "MB/s", "allocs");
+
+        for (i = 0; i < kCountOf(Bench_cases); ++i)
+        {
+            if (kIsNull(filter) || !kIsNull(kStrFindFirst(Bench_cases[i].name, filter)))
+            {
+                kTest(Bench_RunCase(&Bench_cases[i], targetBytes, countingAlloc, &counter));
+            }
+        }
+    }
+    kFinally
+    {
+        kObject_Destroy(countingAlloc);
+        kObject_Destroy(api);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+int main(int argc, char** argv)
+{
+    kStatus status = BenchmarkMain(argc, argv);
+
+    if (!kSuccess(status))
+    {
+        printf("Error: %d\n", status);
+    }
+
+    return kSuccess(status) ? 0 : -1;
+}
@@ -0,0 +1,534 @@
+/*
+ * GoSdkLoopbackBenchmark.c
+ *
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ *
+ * Licensed under The MIT License.
+ * Redistributions of files must retain the above copyright notice.
+ *
+ * Purpose: Measures end-to-end data throughput and latency of the GoReceiver/GoSystem pipeline over loopback.
+ *
+ * Usage: GoSdkLoopbackBenchmark [-k surface|profile|measurement] [-w width] [-l length] [-m count]
+ *                               [-r rate] [-d seconds] [-b socketBuffer] [-c streamBuffer] [-a 0|1]
+ *
+ * A sender thread accepts a connection on a local kTcpServer and writes data sets with GoSerializer, as a
+ * sensor does on its data port. A GoReceiver reads the data sets and passes them to GoSystem_OnData, as
+ * GoSensor does; the main thread takes them from the system with GoSystem_ReceiveData. Each data set starts
+ * with a stamp message whose timestamp holds the send time, in kTimer ticks.
+ *
+ * Data set content is selected with -k: a uniform surface of width x length (-w, -l; default 2048 x 2000),
+ * a uniform profile of the given width, or -m single-value measurement messages (default 8). The -r option
+ * limits the send rate, in data sets per second (default: unlimited). The -d option sets the measurement
+ * time (default 5 s), which follows a short warm-up.
+ *
+ * The -b and -c options set the receiver's socket and stream (client) buffer sizes, in bytes; they default to
+ * the sizes used by GoSensor. With -a 1 (default), the socket buffer defaults to GO_SENSOR_DATA_ADAPTIVE_SOCKET_BUFFER
+ * (-b 0 keeps the operating system default) and the stream buffer is sized adaptively within GoSensor's default
+ * bounds, starting from -c; with -a 0, GO_SENSOR_DATA_SOCKET_BUFFER and GO_SENSOR_DATA_STREAM_BUFFER are fixed.
+ *
+ * The benchmark reports sustained data sets per second, MB/s, process CPU time per MB received (excluding
+ * the sender thread, where thread CPU times are available), latency percentiles from send to
+ * GoSystem_ReceiveData, and data sets dropped by the system data queue.
+ */
+#include <GoSdk/GoSdk.h>
+#include <GoSdk/Internal/GoSerializer.h>
+#include <kApi/Io/kMemory.h>
+#include <kApi/Io/kTcpClient.h>
+#include <kApi/Io/kTcpServer.h>
+#include <kApi/Threads/kThread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_DEFAULT_SURFACE_WIDTH         (2048)
+#define BENCH_DEFAULT_SURFACE_LENGTH        (2000)
+#define BENCH_DEFAULT_PROFILE_WIDTH         (2048)
+#define BENCH_DEFAULT_MEASUREMENT_COUNT     (8)
+#define BENCH_DEFAULT_DURATION              (5)             //seconds
+#define BENCH_WARMUP_TIME                   (500000)        //us
+#define BENCH_ACCEPT_TIMEOUT                (5000000)       //us
+#define BENCH_RECEIVE_TIMEOUT               (100000)        //us
+
+typedef enum BenchKind
+{
+    BENCH_KIND_SURFACE,
+    BENCH_KIND_PROFILE,
+    BENCH_KIND_MEASUREMENT
+} BenchKind;
+
+typedef struct BenchConfig
+{
+    BenchKind kind;
+    kSize width;
+    kSize length;
+    kSize measurementCount;
+    k64f rate;                          //data sets per second (0: unlimited)
+    k64u duration;                      //us
+    kSSize socketBuffer;
+    kSSize streamBuffer;
+    kBool adaptive;                     //size buffers adaptively, as GoSensor does by default
+} BenchConfig;
+
+typedef struct BenchContext
+{
+    BenchConfig config;
+    GoSystem system;
+    kTcpServer server;
+    GoDataSet dataSet;                  //data set template, sent repeatedly
+    GoStamp* stamp;                     //stamp within the template
+    volatile kBool quit;
+    k64u sentCount;
+    k64f senderCpu;                     //sender thread CPU time (s), or 0 if unavailable
+    kStatus senderStatus;
+} BenchContext;
+
+static k64f Bench_ProcessCpu()
+{
+    return (k64f)clock() / CLOCKS_PER_SEC;
+}
+
+static k64f Bench_ThreadCpu()
+{
+#if defined(K_POSIX) && defined(CLOCK_THREAD_CPUTIME_ID)
+    struct timespec time;
+
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) == 0)
+    {
+        return (k64f)time.tv_sec + time.tv_nsec / 1e9;
+    }
+#endif
+
+    return 0;
+}
+
+static kStatus Bench_CreateDataSet(BenchContext* bench)
+{
+    const BenchConfig* config = &bench->config;
+    GoDataSet dataSet = kNULL;
+    GoStampMsg stampMsg = kNULL;
+    GoDataMsg msg = kNULL;
+    kSize i;
+    kStatus status;
+
+    kCheck(GoDataSet_Construct(&dataSet, kNULL));
+
+    kTry
+    {
+        kTest(GoStampMsg_Construct(&stampMsg, kNULL));
+        kTest(GoStampMsg_Allocate(stampMsg, 1));
+        kTest(GoDataSet_Add(dataSet, stampMsg));
+        bench->stamp = GoStampMsg_At(stampMsg, 0);
+        stampMsg = kNULL;
+
+        if (config->kind == BENCH_KIND_SURFACE)
+        {
+            kTest(GoUniformSurfaceMsg_Construct(&msg, kNULL));
+            kTest(GoUniformSurfaceMsg_Allocate(msg, config->length, config->width));
+            kTest(GoDataSet_Add(dataSet, msg));
+            msg = kNULL;
+        }
+        else if (config->kind == BENCH_KIND_PROFILE)
+        {
+            kTest(GoUniformProfileMsg_Construct(&msg, kNULL));
+            kTest(GoUniformProfileMsg_Allocate(msg, 1, config->width));
+            kTest(GoDataSet_Add(dataSet, msg));
+            msg = kNULL;
+        }
+        else
+        {
+            for (i = 0; i < config->measurementCount; ++i)
+            {
+                GoMeasurementData* measurement = kNULL;
+
+                kTest(GoMeasurementMsg_Construct(&msg, kNULL));
+                kTest(GoMeasurementMsg_Allocate(msg, 1));
+                kTest(GoMeasurementMsg_SetId_(msg, (k16u)i));
+
+                measurement = GoMeasurementMsg_At(msg, 0);
+                measurement->value = 1.25 * (k64f)i;
+                measurement->decision = GO_DECISION_PASS;
+                measurement->decisionCode = GO_DECISION_CODE_OK;
+
+                kTest(GoDataSet_Add(dataSet, msg));
+                msg = kNULL;
+            }
+        }
+    }
+    kCatch(&status)
+    {
+        kObject_Dispose(msg);
+        kObject_Dispose(stampMsg);
+        kObject_Dispose(dataSet);
+        kEndCatch(status);
+    }
+
+    bench->dataSet = dataSet;
+
+    return kOK;
+}
+
+// Measures the serialized size of the data set template, excluding one-time type information.
+static kStatus Bench_MessageSize(BenchContext* bench, kSize* size)
+{
+    kMemory memory = kNULL;
+    GoSerializer writer = kNULL;
+    k64u first;
+
+    kTry
+    {
+        kTest(kMemory_Construct(&memory, kNULL));
+        kTest(GoSerializer_Construct(&writer, memory, kNULL));
+
+        kTest(kSerializer_WriteObject(writer, bench->dataSet));
+        kTest(kSerializer_Flush(writer));
+        first = kMemory_Length(memory);
+
+        kTest(kSerializer_WriteObject(writer, bench->dataSet));
+        kTest(kSerializer_Flush(writer));
+
+        *size = (kSize)(kMemory_Length(memory) - first);
+    }
+    kFinally
+    {
+        kObject_Destroy(writer);
+        kObject_Destroy(memory);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+// Plays the part of a sensor's data channel: accepts one connection and streams data sets until asked to quit.
+static kStatus kCall Bench_SenderEntry(kPointer context)
+{
+    BenchContext* bench = (BenchContext*)context;
+    kTcpClient client = kNULL;
+    GoSerializer writer = kNULL;
+    k64f period = (bench->config.rate > 0) ? 1000000.0 / bench->config.rate : 0;
+    k64u start, due, now;
+    kStatus status = kOK;
+
+    kTry
+    {
+        kTest(kTcpServer_Accept(bench->server, BENCH_ACCEPT_TIMEOUT, &client, kNULL));
+        kTestTrue(!kIsNull(client), kERROR_TIMEOUT);
+
+        kTest(GoSerializer_Construct(&writer, client, kNULL));
+
+        start = kTimer_Now();
+
+        while (!bench->quit)
+        {
+            if (period > 0)
+            {
+                due = start + (k64u)(bench->sentCount * period);
+
+                while ((now = kTimer_Now()) < due)
+                {
+                    if ((due - now) > 2000)
+                    {
+                        kThread_Sleep(1000);
+                    }
+                }
+            }
+
+            bench->stamp->frameIndex = bench->sentCount;
+            bench->stamp->timestamp = kTimer_Ticks();
+
+            kTest(kSerializer_WriteObject(writer, bench->dataSet));
+            kTest(kSerializer_Flush(writer));
+
+            bench->sentCount++;
+        }
+    }
+    kCatch(&status)
+    {
+        bench->senderStatus = status;
+        kEndCatch(kOK);
+    }
+
+    bench->senderCpu = Bench_ThreadCpu();
+
+    kObject_Destroy(writer);
+    kObject_Destroy(client);
+
+    return kOK;
+}
+
+// Stands in for GoSensor_OnData: deserializes one data set and passes it to the system.
+static kStatus kCall Bench_OnMessage(kPointer context, GoReceiver receiver, kSerializer reader)
+{
+    BenchContext* bench = (BenchContext*)context;
+    GoDataSet dataSet = kNULL;
+    kStatus status;
+
+    kCheck(kSerializer_ReadObject(reader, &dataSet, kAlloc_App()));
+
+    if (!kSuccess(status = GoSystem_OnData(bench->system, kNULL, dataSet)))
+    {
+        kObject_Dispose(dataSet);
+    }
+
+    return status;
+}
+
+static const GoStamp* Bench_FindStamp(GoDataSet dataSet)
+{
+    GoDataMsg msg = (GoDataSet_Count(dataSet) > 0) ? GoDataSet_At(dataSet, 0) : kNULL;
+
+    if (!kIsNull(msg) && (GoDataMsg_Type(msg) == GO_DATA_MESSAGE_TYPE_STAMP) && (GoStampMsg_Count(msg) > 0))
+    {
+        return GoStampMsg_At(msg, 0);
+    }
+
+    return kNULL;
+}
+
+static kStatus Bench_Run(BenchContext* bench)
+{
+    const BenchConfig* config = &bench->config;
+    GoReceiver receiver = kNULL;
+    kThread sender = kNULL;
+    kIpEndPoint endPoint;
+    GoDataSet data = kNULL;
+    GoDataStats dataStats;
+    GoLatencyStats latency;
+    k64u* histogram = kNULL;
+    k64u received = 0, latencyMax = 0;
+    k64u start, elapsed, measureStart = 0;
+    k64f cpuStart = 0, cpu, megabytes;
+    kSize messageSize = 0;
+    kBool measuring = kFALSE;
+    kStatus status = kOK;
+
+    kTry
+    {
+        kTest(Bench_CreateDataSet(bench));
+        kTest(Bench_MessageSize(bench, &messageSize));
+
+        kTest(kAlloc_GetZero(kAlloc_App(), GO_RECEIVER_LATENCY_BUCKET_COUNT * sizeof(k64u), &histogram));
+
+        kTest(GoSystem_ConstructEx(&bench->system, kNULL));
+
+        kTest(kTcpServer_Construct(&bench->server, kIP_VERSION_4, kNULL));
+        kTest(kTcpServer_Listen(bench->server, kIpAddress_LoopbackV4(), 0, 1));
+        kTest(kTcpServer_LocalEndPoint(bench->server, &endPoint));
+
+        kTest(kThread_Construct(&sender, kNULL));
+        kTest(kThread_Start(sender, Bench_SenderEntry, bench));
+
+        kTest(GoReceiver_Construct(&receiver, kNULL));
+        kTest(GoReceiver_SetBuffers(receiver, config->socketBuffer, config->streamBuffer));
+
+        if (config->adaptive)
+        {
+            GoAdaptiveBufferOptions buffers;
+
+            buffers.enabled = kTRUE;
+            buffers.socketSize = (kSize)config->socketBuffer;
+            buffers.minStreamSize = GO_SENSOR_DATA_MIN_STREAM_BUFFER;
+            buffers.maxStreamSize = GO_SENSOR_DATA_MAX_STREAM_BUFFER;
+            buffers.directReadThreshold = GO_SENSOR_DATA_DIRECT_READ_THRESHOLD;
+
+            kTest(GoReceiver_SetAdaptiveBuffers(receiver, &buffers));
+        }
+
+        kTest(GoReceiver_SetMessageHandler(receiver, Bench_OnMessage, bench));
+        kTest(GoReceiver_Open(receiver, kIpAddress_LoopbackV4(), endPoint.port));
+
+        start = kTimer_Now();
+
+        while ((kTimer_Now() - start) < (BENCH_WARMUP_TIME + config->duration))
+        {
+            if (!measuring && ((kTimer_Now() - start) >= BENCH_WARMUP_TIME))
+            {
+                measuring = kTRUE;
+                measureStart = kTimer_Now();
+                cpuStart = Bench_ProcessCpu();
+                kTest(GoSystem_DataStats(bench->system, &dataStats));
+            }
+
+            status = GoSystem_ReceiveData(bench->system, &data, BENCH_RECEIVE_TIMEOUT);
+
+            if (kSuccess(status))
+            {
+                const GoStamp* stamp = Bench_FindStamp(data);
+
+                if (measuring && !kIsNull(stamp))
+                {
+                    k64u value = kTimer_FromTicks(1000 * (kTimer_Ticks() - stamp->timestamp));
+
+                    histogram[GoReceiver_LatencyBucket(value)]++;
+                    latencyMax = kMax_(latencyMax, value);
+                    received++;
+                }
+
+                kTest(GoDestroy(data));
+                data = kNULL;
+            }
+            else if (status != kERROR_TIMEOUT)
+            {
+                kThrow(status);
+            }
+
+            kTest(bench->senderStatus);
+        }
+
+        elapsed = kMax_(kTimer_Now() - measureStart, 1);
+        cpu = Bench_ProcessCpu() - cpuStart;
+
+        bench->quit = kTRUE;
+        kTest(kDestroyRef(&sender));
+        kTest(GoReceiver_Close(receiver));
+
+        //the sender's CPU time covers the warm-up, so scale it to the measurement interval
+        cpu -= bench->senderCpu * elapsed / (k64f)(elapsed + BENCH_WARMUP_TIME);
+
+        {
+            GoDataStats finalStats;
+
+            kTest(GoSystem_DataStats(bench->system, &finalStats));
+            dataStats.dropCount = finalStats.dropCount - dataStats.dropCount;
+            dataStats.queueHighWatermark = finalStats.queueHighWatermark;
+        }
+
+        kTest(GoReceiver_HistogramStats(histogram, received, latencyMax, &latency));
+
+        megabytes = (k64f)received * messageSize / (1024.0 * 1024.0);
+
+        printf("%10s %10s %10s %9s %9s %9s %9s %9s %9s %7s\n", "bytes/set", "sets", "sets/s", "MB/s", "cpu ms/MB",
+            "p50 us", "p99 us", "p99.9 us", "max us", "drops");
+
+        printf("%10u %10llu %10.1f %9.1f %9.3f %9.1f %9.1f %9.1f %9.1f %7llu\n",
+            (k32u)messageSize,
+            received,
+            received * 1000000.0 / elapsed,
+            megabytes * 1000000.0 / elapsed,
+            (megabytes > 0) ? cpu * 1000.0 / megabytes : 0.0,
+            latency.p50 / 1000.0,
+            latency.p99 / 1000.0,
+            latency.p999 / 1000.0,
+            latency.max / 1000.0,
+            dataStats.dropCount);
+
+        {
+            kSSize socketSize, streamSize;
+
+            kTest(GoReceiver_BufferSizes(receiver, &socketSize, &streamSize));
+            printf("final buffers: socket %lld, stream %lld\n", (k64s)socketSize, (k64s)streamSize);
+        }
+    }
+    kFinally
+    {
+        bench->quit = kTRUE;
+
+        kObject_Destroy(sender);
+        kObject_Destroy(receiver);
+        kObject_Dispose(data);
+        kObject_Destroy(bench->server);
+        kObject_Destroy(bench->system);
+        kObject_Dispose(bench->dataSet);
+        kAlloc_Free(kAlloc_App(), histogram);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+kStatus BenchmarkMain(int argc, char** argv)
+{
+    kAssembly api = kNULL;
+    BenchContext bench;
+    BenchConfig* config = &bench.config;
+    const kChar* kindName = "surface";
+    kBool widthSet = kFALSE;
+    int arg;
+
+    kZero(bench);
+    bench.senderStatus = kOK;
+
+    config->kind = BENCH_KIND_SURFACE;
+    config->width = BENCH_DEFAULT_SURFACE_WIDTH;
+    config->length = BENCH_DEFAULT_SURFACE_LENGTH;
+    config->measurementCount = BENCH_DEFAULT_MEASUREMENT_COUNT;
+    config->rate = 0;
+    config->duration = BENCH_DEFAULT_DURATION * 1000000ULL;
+    config->socketBuffer = -1;
+    config->streamBuffer = GO_SENSOR_DATA_STREAM_BUFFER;
+    config->adaptive = kTRUE;
+
+    for (arg = 1; arg + 1 < argc; arg += 2)
+    {
+        const kChar* value = argv[arg + 1];
+
+        if (kStrEquals(argv[arg], "-k"))
+        {
+            kindName = value;
+
+            if      (kStrEquals(value, "surface"))      config->kind = BENCH_KIND_SURFACE;
+            else if (kStrEquals(value, "profile"))      config->kind = BENCH_KIND_PROFILE;
+            else if (kStrEquals(value, "measurement"))  config->kind = BENCH_KIND_MEASUREMENT;
+            else                                        return kERROR_PARAMETER;
+        }
+        else if (kStrEquals(argv[arg], "-w"))
+        {
+            config->width = (kSize)kMax_(atoi(value), 1);
+            widthSet = kTRUE;
+        }
+        else if (kStrEquals(argv[arg], "-l"))   config->length = (kSize)kMax_(atoi(value), 1);
+        else if (kStrEquals(argv[arg], "-m"))   config->measurementCount = (kSize)kMax_(atoi(value), 1);
+        else if (kStrEquals(argv[arg], "-r"))   config->rate = kMax_(atof(value), 0);
+        else if (kStrEquals(argv[arg], "-d"))   config->duration = (k64u)(kMax_(atof(value), 0.1) * 1000000);
+        else if (kStrEquals(argv[arg], "-b"))   config->socketBuffer = (kSSize)atol(value);
+        else if (kStrEquals(argv[arg], "-c"))   config->streamBuffer = (kSSize)atol(value);
+        else if (kStrEquals(argv[arg], "-a"))   config->adaptive = (atoi(value) != 0);
+    }
+
+    if ((config->kind == BENCH_KIND_PROFILE) && !widthSet)
+    {
+        config->width = BENCH_DEFAULT_PROFILE_WIDTH;
+    }
+
+    if (config->socketBuffer < 0)
+    {
+        config->socketBuffer = config->adaptive ? GO_SENSOR_DATA_ADAPTIVE_SOCKET_BUFFER : GO_SENSOR_DATA_SOCKET_BUFFER;
+    }
+
+    kCheck(GoSdk_Construct(&api));
+
+    kTry
+    {
+        printf("data: %s", kindName);
+
+        if      (config->kind == BENCH_KIND_SURFACE)    printf(" %ux%u", (k32u)config->width, (k32u)config->length);
+        else if (config->kind == BENCH_KIND_PROFILE)    printf(" %u", (k32u)config->width);
+        else                                            printf(" x%u", (k32u)config->measurementCount);
+
+        printf(", rate: %s", (config->rate > 0) ? "" : "unlimited");
+        if (config->rate > 0) printf("%.0f/s", config->rate);
+
+        printf(", socket buffer: %lld, stream buffer: %lld%s\n", (k64s)config->socketBuffer, (k64s)config->streamBuffer,
+            config->adaptive ? " (adaptive)" : "");
+
+        kTest(Bench_Run(&bench));
+    }
+    kFinally
+    {
+        kObject_Destroy(api);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+int main(int argc, char** argv)
+{
+    kStatus status = BenchmarkMain(argc, argv);
+
+    if (!kSuccess(status))
+    {
+        printf("Error: %d\n", status);
+    }
+
+    return kSuccess(status) ? 0 : -1;
+}
@@ -0,0 +1,272 @@
+/*
+ * GoSdkSerializerBenchmark.c
+ *
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ *
+ * Licensed under The MIT License.
+ * Redistributions of files must retain the above copyright notice.
+ *
+ * Purpose: Measures GoSerializer message dispatch and deserialization cost for small datasets.
+ *
+ * Usage: GoSdkSerializerBenchmark [-i datasets] [-m measurementMessages]
+ *
+ * A measurement-only dataset (one stamp message followed by single-value measurement messages)
+ * is written repeatedly into a memory stream with GoSerializer and then read back, as GoReceiver
+ * does for each data frame. Type id dispatch is also timed on its own, using the shared dispatch
+ * table and, for comparison, a kMap keyed by type id with a type version query per lookup.
+ */
+#include <GoSdk/GoSdk.h>
+#include <GoSdk/Internal/GoSerializer.h>
+#include <kApi/Io/kMemory.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_DEFAULT_DATASETS              (100000)
+#define BENCH_DEFAULT_MEASUREMENT_MESSAGES  (4)
+#define BENCH_DISPATCH_ROUNDS               (1000000)
+
+static kStatus Bench_CreateDataSet(kSize measurementCount, GoDataSet* dataSet)
+{
+    GoDataSet output = kNULL;
+    GoStampMsg stampMsg = kNULL;
+    GoMeasurementMsg measurementMsg = kNULL;
+    GoStamp* stamp = kNULL;
+    GoMeasurementData* measurement = kNULL;
+    kSize i;
+
+    kTry
+    {
+        kTest(GoDataSet_Construct(&output, kNULL));
+
+        kTest(GoStampMsg_Construct(&stampMsg, kNULL));
+        kTest(GoStampMsg_Allocate(stampMsg, 1));
+
+        stamp = GoStampMsg_At(stampMsg, 0);
+        stamp->frameIndex = 1000;
+        stamp->timestamp = 123456789;
+        stamp->encoder = 42;
+
+        kTest(GoDataSet_Add(output, stampMsg));
+        stampMsg = kNULL;
+
+        for (i = 0; i < measurementCount; ++i)
+        {
+            kTest(GoMeasurementMsg_Construct(&measurementMsg, kNULL));
+            kTest(GoMeasurementMsg_Allocate(measurementMsg, 1));
+
+            xGoMeasurementMsg_CastRaw(measurementMsg)->id = (k16u)(i + 1);
+
+            measurement = GoMeasurementMsg_At(measurementMsg, 0);
+            measurement->value = 1.25 * (k64f)i;
+            measurement->decision = GO_DECISION_PASS;
+            measurement->decisionCode = GO_DECISION_CODE_OK;
+
+            kTest(GoDataSet_Add(output, measurementMsg));
+            measurementMsg = kNULL;
+        }
+
+        *dataSet = output;
+        output = kNULL;
+    }
+    kFinally
+    {
+        kObject_Dispose(measurementMsg);
+        kObject_Dispose(stampMsg);
+        kObject_Dispose(output);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+static kStatus Bench_RunDataSets(kSize datasetCount, kSize measurementCount)
+{
+    kMemory memory = kNULL;
+    GoSerializer writer = kNULL;
+    GoSerializer reader = kNULL;
+    GoDataSet dataSet = kNULL;
+    GoDataSet received = kNULL;
+    kSize messageCount = 0;
+    k64u start, readTime;
+    kSize i;
+
+    kTry
+    {
+        kTest(Bench_CreateDataSet(measurementCount, &dataSet));
+
+        kTest(kMemory_Construct(&memory, kNULL));
+        kTest(GoSerializer_Construct(&writer, memory, kNULL));
+
+        for (i = 0; i < datasetCount; ++i)
+        {
+            kTest(kSerializer_WriteObject(writer, dataSet));
+        }
+
+        kTest(kStream_Seek(memory, 0, kSEEK_ORIGIN_BEGIN));
+        kTest(GoSerializer_Construct(&reader, memory, kNULL));
+
+        start = kTimer_Now();
+        for (i = 0; i < datasetCount; ++i)
+        {
+            kTest(kSerializer_ReadObject(reader, &received, kNULL));
+
+            messageCount += GoDataSet_Count(received);
+
+            kTest(kDisposeRef(&received));
+        }
+        readTime = kTimer_Now() - start;
+
+        kTestTrue(messageCount == datasetCount * (measurementCount + 1), kERROR);
+
+        printf("dataset read (1 stamp + %u measurement messages)\n", (k32u)measurementCount);
+        printf("  size:        %u bytes/dataset\n", (k32u)(kMemory_Length(memory) / datasetCount));
+        printf("  read:        %.1f ns/dataset, %.1f ns/message\n", readTime * 1000.0 / datasetCount, readTime * 1000.0 / messageCount);
+    }
+    kFinally
+    {
+        kObject_Dispose(received);
+        kObject_Destroy(reader);
+        kObject_Destroy(writer);
+        kObject_Destroy(memory);
+        kObject_Dispose(dataSet);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+static kStatus Bench_RunDispatch()
+{
+    static const k16u ids[] = { GO_COMPACT_MESSAGE_STAMP, GO_COMPACT_MESSAGE_MEASUREMENT, GO_COMPACT_MESSAGE_MEASUREMENT, GO_COMPACT_MESSAGE_MEASUREMENT };
+    const GoSerializerDispatchEntry* table = kNULL;
+    kSize tableCount = 0;
+    kMap map = kNULL;
+    GoSerializerTypeInfo info;
+    kPointer sum = kNULL;
+    kSize found = 0;
+    k64u start, tableTime, mapTime;
+    kSize i, j;
+
+    kTry
+    {
+        kTest(GoSerializer_EnsureDispatchTable(&table, &tableCount));
+
+        //reference: lookup by kMap, then query the type version for its deserialization function
+        kTest(kMap_Construct(&map, kTypeOf(k16u), kTypeOf(GoSerializerTypeInfo), 0, kNULL));
+
+        for (i = 0; i < tableCount; ++i)
+        {
+            if (!kIsNull(table[i].type))
+            {
+                info.type = table[i].type;
+                info.version = table[i].version;
+                info.id = (k16u)i;
+
+                kTest(kMap_AddT(map, &info.id, &info));
+            }
+        }
+
+        start = kTimer_Now();
+        for (i = 0; i < BENCH_DISPATCH_ROUNDS; ++i)
+        {
+            for (j = 0; j < kCountOf(ids); ++j)
+            {
+                k16u id = ids[j] & GO_SERIALIZER_TYPE_ID_MASK;
+
+                if ((id < tableCount) && !kIsNull(table[id].type))
+                {
+                    sum = (kByte*)sum + (kSize)table[id].deserialize;
+                    found++;
+                }
+            }
+        }
+        tableTime = kTimer_Now() - start;
+
+        start = kTimer_Now();
+        for (i = 0; i < BENCH_DISPATCH_ROUNDS; ++i)
+        {
+            for (j = 0; j < kCountOf(ids); ++j)
+            {
+                k16u id = ids[j] & GO_SERIALIZER_TYPE_ID_MASK;
+
+                if (kSuccess(kMap_FindT(map, &id, &info)))
+                {
+                    sum = (kByte*)sum - (kSize)kType_VersionDeserializeFx(info.type, info.version);
+                    found++;
+                }
+            }
+        }
+        mapTime = kTimer_Now() - start;
+
+        kTestTrue(found == 2 * BENCH_DISPATCH_ROUNDS * kCountOf(ids), kERROR);
+
+        printf("type id dispatch (%u table entries)\n", (k32u)tableCount);
+        printf("  table:       %.2f ns/lookup\n", tableTime * 1000.0 / (BENCH_DISPATCH_ROUNDS * kCountOf(ids)));
+        printf("  map:         %.2f ns/lookup\n", mapTime * 1000.0 / (BENCH_DISPATCH_ROUNDS * kCountOf(ids)));
+        printf("  check:       %s\n", kIsNull(sum) ? "ok" : "mismatch");
+    }
+    kFinally
+    {
+        kObject_Destroy(map);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+kStatus BenchmarkMain(int argc, char** argv)
+{
+    kAssembly api = kNULL;
+    kSize datasetCount = BENCH_DEFAULT_DATASETS;
+    kSize measurementCount = BENCH_DEFAULT_MEASUREMENT_MESSAGES;
+    GoSdkStartupStats stats;
+    int i;
+
+    kCheck(GoSdk_Construct(&api));
+
+    kTry
+    {
+        for (i = 1; i < argc; ++i)
+        {
+            if (kStrEquals(argv[i], "-i") && (i + 1 < argc))
+            {
+                datasetCount = (kSize)kMax_(atoi(argv[i + 1]), 1);
+                ++i;
+            }
+            else if (kStrEquals(argv[i], "-m") && (i + 1 < argc))
+            {
+                measurementCount = (kSize)kMax_(atoi(argv[i + 1]), 0);
+                ++i;
+            }
+        }
+
+        kTest(Bench_RunDataSets(datasetCount, measurementCount));
+        kTest(Bench_RunDispatch());
+
+        kTest(GoSdk_StartupStats(&stats));
+
+        printf("startup\n");
+        printf("  kApi types:  %.3f ms\n", stats.apiInitTime / 1000.0);
+        printf("  GoSdk types: %.3f ms\n", stats.sdkInitTime / 1000.0);
+        printf("  dispatch:    %.3f ms\n", stats.serializerInitTime / 1000.0);
+    }
+    kFinally
+    {
+        kObject_Destroy(api);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+int main(int argc, char** argv)
+{
+    kStatus status = BenchmarkMain(argc, argv);
+
+    if (!kSuccess(status))
+    {
+        printf("Error: %d\n", status);
+    }
+
+    return kSuccess(status) ? 0 : -1;
+}
@@ -0,0 +1,370 @@
+/*
+ * GoSdkXmlBenchmark.c
+ *
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ *
+ * Licensed under The MIT License.
+ * Redistributions of files must retain the above copyright notice.
+ *
+ * Purpose: Measures kXml parsing and path lookup cost on job/configuration XML.
+ *
+ * Usage: GoSdkXmlBenchmark [-i iterations] [-t toolCount] [file.xml ...]
+ *
+ * Each file (e.g. a "_live.job" or "_live.cfg" file downloaded with GoSensor_DownloadFile) is
+ * loaded with kXml_LoadBytes, and every element is then looked up from its parent with kXml_Child,
+ * using the same "Name", "Name[n]" and "Name/Child" path forms that GoSetup and GoTools use when a
+ * configuration is read on connect. If no file is given, a synthetic multi-tool job is generated.
+ *
+ * The checksum of the re-serialized document is printed so that results from different builds
+ * can be confirmed to describe identical trees.
+ */
+#include <GoSdk/GoSdk.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_DEFAULT_ITERATIONS        (50)
+#define BENCH_DEFAULT_TOOL_COUNT        (64)
+#define BENCH_MEASUREMENTS_PER_TOOL     (12)
+#define BENCH_PARAMETERS_PER_TOOL       (40)
+
+typedef struct BenchLookup
+{
+    kXmlItem parent;
+    kText128 path;
+} BenchLookup;
+
+static k64u Bench_Checksum(const kByte* data, kSize size)
+{
+    k64u hash = 1469598103934665603ULL;
+    kSize i;
+
+    for (i = 0; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+static kStatus Bench_AddLeaf(kXml xml, kXmlItem parent, const kChar* name, const kChar* value, kBool options)
+{
+    kXmlItem item = kNULL;
+
+    kCheck(kXml_AddItem(xml, parent, name, &item));
+    kCheck(kXml_SetItemText(xml, item, value));
+
+    if (options)
+    {
+        kCheck(kXml_SetAttrText(xml, item, "used", "1"));
+        kCheck(kXml_SetAttrText(xml, item, "options", "0,1,2,3"));
+    }
+
+    return kOK;
+}
+
+static kStatus Bench_AddRegion(kXml xml, kXmlItem parent, const kChar* name)
+{
+    kXmlItem region = kNULL;
+
+    kCheck(kXml_AddItem(xml, parent, name, &region));
+    kCheck(Bench_AddLeaf(xml, region, "X", "-12.5", kFALSE));
+    kCheck(Bench_AddLeaf(xml, region, "Y", "-40", kFALSE));
+    kCheck(Bench_AddLeaf(xml, region, "Z", "3.25", kFALSE));
+    kCheck(Bench_AddLeaf(xml, region, "Width", "25", kFALSE));
+    kCheck(Bench_AddLeaf(xml, region, "Length", "80", kFALSE));
+    kCheck(Bench_AddLeaf(xml, region, "Height", "6.5", kFALSE));
+    kCheck(Bench_AddLeaf(xml, region, "ZAngle", "0", kFALSE));
+
+    return kOK;
+}
+
+static kStatus Bench_AddSetup(kXml xml, kXmlItem root)
+{
+    static const kChar* const groups[] = { "Device", "Exposure", "Spacing", "Material", "Filters", "Tracking", "Layout" };
+    kXmlItem setup = kNULL;
+    kXmlItem group = kNULL;
+    kText64 name;
+    kSize i, j;
+
+    kCheck(kXml_AddItem(xml, root, "Setup", &setup));
+    kCheck(Bench_AddLeaf(xml, setup, "TemperatureSafetyEnabled", "0", kTRUE));
+    kCheck(Bench_AddLeaf(xml, setup, "ScanMode", "3", kTRUE));
+    kCheck(Bench_AddLeaf(xml, setup, "OcclusionReductionEnabled", "1", kTRUE));
+    kCheck(Bench_AddLeaf(xml, setup, "FrameRate", "1000", kTRUE));
+    kCheck(Bench_AddRegion(xml, setup, "TransformedDataRegion"));
+
+    for (i = 0; i < kCountOf(groups); ++i)
+    {
+        kCheck(kXml_AddItem(xml, setup, groups[i], &group));
+
+        for (j = 0; j < 24; ++j)
+        {
+            kCheck(kStrPrintf(name, kCountOf(name), "%sParameter%u", groups[i], (k32u)j));
+            kCheck(Bench_AddLeaf(xml, group, name, "1.25", (j % 3) == 0));
+        }
+    }
+
+    return kOK;
+}
+
+static kStatus Bench_AddTool(kXml xml, kXmlItem tools, kSize index)
+{
+    kXmlItem tool = kNULL;
+    kXmlItem params = kNULL;
+    kXmlItem measurement = kNULL;
+    kText64 name;
+    kSize i;
+
+    kCheck(kXml_AddItem(xml, tools, (index % 2) ? "SurfaceBox" : "SurfacePlane", &tool));
+    kCheck(kXml_SetAttrText(xml, tool, "version", "3"));
+
+    kCheck(kStrPrintf(name, kCountOf(name), "Tool %u", (k32u)index));
+    kCheck(Bench_AddLeaf(xml, tool, "Name", name, kFALSE));
+    kCheck(Bench_AddLeaf(xml, tool, "Source", "0", kTRUE));
+    kCheck(Bench_AddLeaf(xml, tool, "Anchor", "", kFALSE));
+    kCheck(Bench_AddRegion(xml, tool, "Region"));
+    kCheck(Bench_AddRegion(xml, tool, "RefRegion"));
+
+    kCheck(kXml_AddItem(xml, tool, "Parameters", &params));
+
+    for (i = 0; i < BENCH_PARAMETERS_PER_TOOL; ++i)
+    {
+        kCheck(kStrPrintf(name, kCountOf(name), "Parameter%u", (k32u)i));
+        kCheck(Bench_AddLeaf(xml, params, name, "&lt;auto&gt;", (i % 4) == 0));
+    }
+
+    for (i = 0; i < BENCH_MEASUREMENTS_PER_TOOL; ++i)
+    {
+        kCheck(kStrPrintf(name, kCountOf(name), "Measurement%u", (k32u)i));
+        kCheck(kXml_AddItem(xml, tool, name, &measurement));
+        kCheck(kXml_SetAttrText(xml, measurement, "id", "-1"));
+
+        kCheck(Bench_AddLeaf(xml, measurement, "Name", name, kFALSE));
+        kCheck(Bench_AddLeaf(xml, measurement, "Enabled", "0", kFALSE));
+        kCheck(Bench_AddLeaf(xml, measurement, "HoldEnabled", "0", kFALSE));
+        kCheck(Bench_AddLeaf(xml, measurement, "SmoothingEnabled", "0", kFALSE));
+        kCheck(Bench_AddLeaf(xml, measurement, "SmoothingWindow", "1", kFALSE));
+        kCheck(Bench_AddLeaf(xml, measurement, "Scale", "1", kFALSE));
+        kCheck(Bench_AddLeaf(xml, measurement, "Offset", "0", kFALSE));
+        kCheck(Bench_AddLeaf(xml, measurement, "DecisionMin", "-1.7976931348623157e+308", kFALSE));
+        kCheck(Bench_AddLeaf(xml, measurement, "DecisionMax", "1.7976931348623157e+308", kFALSE));
+        kCheck(Bench_AddLeaf(xml, measurement, "Source", "0", kTRUE));
+    }
+
+    return kOK;
+}
+
+static kStatus Bench_Generate(kSize toolCount, kByte** data, kSize* size)
+{
+    kXml xml = kNULL;
+    kXmlItem root = kNULL;
+    kXmlItem tools = kNULL;
+    kSize i;
+
+    kTry
+    {
+        kTest(kXml_Construct(&xml, kNULL));
+        kTest(kXml_AddItem(xml, kNULL, "Configuration", &root));
+        kTest(kXml_SetAttrText(xml, root, "version", "101"));
+
+        kTest(Bench_AddSetup(xml, root));
+
+        kTest(kXml_AddItem(xml, root, "Tools", &tools));
+        kTest(kXml_SetAttrText(xml, tools, "options", "SurfaceBox,SurfacePlane,SurfaceHole,SurfaceEdge"));
+
+        for (i = 0; i < toolCount; ++i)
+        {
+            kTest(Bench_AddTool(xml, tools, i));
+        }
+
+        kTest(kXml_SetChildText(xml, root, "Output/Ethernet/Protocol", "0"));
+        kTest(kXml_SetChildText(xml, root, "Output/Ethernet/Ascii/Delimiter", ","));
+        kTest(kXml_SetChildText(xml, root, "Output/Serial/Protocol", "1"));
+
+        kTest(kXml_SaveBytes(xml, data, size, kAlloc_App()));
+    }
+    kFinally
+    {
+        kObject_Destroy(xml);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+static kSize Bench_CollectLookups(kXml xml, kXmlItem parent, BenchLookup* lookups, kSize capacity, kSize count)
+{
+    kXmlItem child = kXml_FirstChild(xml, parent);
+
+    while (!kIsNull(child))
+    {
+        const kChar* name = kXml_ItemName(xml, child);
+        kXmlItem prev = kXml_PreviousSibling(xml, child);
+        kSize occurrence = 0;
+
+        while (!kIsNull(prev))
+        {
+            if (kStrEquals(kXml_ItemName(xml, prev), name))
+            {
+                occurrence++;
+            }
+            prev = kXml_PreviousSibling(xml, prev);
+        }
+
+        if (count < capacity)
+        {
+            lookups[count].parent = parent;
+
+            if (occurrence == 0)    kStrCopy(lookups[count].path, kCountOf(lookups[count].path), name);
+            else                    kStrPrintf(lookups[count].path, kCountOf(lookups[count].path), "%s[%u]", name, (k32u)occurrence);
+        }
+        count++;
+
+        if ((occurrence == 0) && !kIsNull(kXml_FirstChild(xml, child)))
+        {
+            kXmlItem grandChild = kXml_FirstChild(xml, child);
+
+            if (count < capacity)
+            {
+                lookups[count].parent = parent;
+                kStrPrintf(lookups[count].path, kCountOf(lookups[count].path), "%s/%s", name, kXml_ItemName(xml, grandChild));
+            }
+            count++;
+        }
+
+        count = Bench_CollectLookups(xml, child, lookups, capacity, count);
+
+        child = kXml_NextSibling(xml, child);
+    }
+
+    return count;
+}
+
+static kStatus Bench_Run(const kChar* label, const kByte* data, kSize size, k32u iterations)
+{
+    kXml xml = kNULL;
+    BenchLookup* lookups = kNULL;
+    kByte* output = kNULL;
+    kSize outputSize = 0;
+    kSize lookupCount = 0;
+    kSize found = 0;
+    k64u parseTime, lookupTime;
+    k64u start;
+    k32u i;
+    kSize j;
+
+    kTry
+    {
+        //parse
+        start = kTimer_Now();
+        for (i = 0; i < iterations; ++i)
+        {
+            kTest(kXml_LoadBytes(&xml, data, size, kNULL));
+            kTest(kDestroyRef(&xml));
+        }
+        parseTime = kTimer_Now() - start;
+
+        kTest(kXml_LoadBytes(&xml, data, size, kNULL));
+
+        //lookup
+        lookupCount = Bench_CollectLookups(xml, kXml_Root(xml), kNULL, 0, 0);
+        kTest(kMemAllocZero(sizeof(BenchLookup) * kMax_(lookupCount, 1), &lookups));
+        Bench_CollectLookups(xml, kXml_Root(xml), lookups, lookupCount, 0);
+
+        start = kTimer_Now();
+        for (i = 0; i < iterations; ++i)
+        {
+            for (j = 0; j < lookupCount; ++j)
+            {
+                found += !kIsNull(kXml_Child(xml, lookups[j].parent, lookups[j].path));
+            }
+        }
+        lookupTime = kTimer_Now() - start;
+
+        kTestTrue(found == lookupCount * iterations, kERROR);
+
+        kTest(kXml_SaveBytes(xml, &output, &outputSize, kAlloc_App()));
+
+        printf("%s\n", label);
+        printf("  size:        %u bytes, %u lookups\n", (k32u)size, (k32u)lookupCount);
+        printf("  parse:       %.3f ms/doc, %.1f MB/s\n", parseTime / 1000.0 / iterations, (k64f)size * iterations / kMax_(parseTime, 1));
+        printf("  lookup:      %.1f ns/lookup\n", lookupTime * 1000.0 / kMax_(lookupCount * iterations, 1));
+        printf("  read config: %.3f ms (parse + one pass of lookups)\n", (parseTime + lookupTime) / 1000.0 / iterations);
+        printf("  checksum:    %016llX\n", (unsigned long long)Bench_Checksum(output, outputSize));
+    }
+    kFinally
+    {
+        kObject_Destroy(xml);
+        kMemFree(lookups);
+        kAlloc_Free(kAlloc_App(), output);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+kStatus BenchmarkMain(int argc, char** argv)
+{
+    kAssembly api = kNULL;
+    k32u iterations = BENCH_DEFAULT_ITERATIONS;
+    kSize toolCount = BENCH_DEFAULT_TOOL_COUNT;
+    kBool anyFile = kFALSE;
+    kByte* data = kNULL;
+    kSize size = 0;
+    kText64 label;
+    int i;
+
+    kCheck(GoSdk_Construct(&api));
+
+    kTry
+    {
+        for (i = 1; i < argc; ++i)
+        {
+            if (kStrEquals(argv[i], "-i") && (i + 1 < argc))
+            {
+                iterations = (k32u)kMax_(atoi(argv[i + 1]), 1);
+                ++i;
+            }
+            else if (kStrEquals(argv[i], "-t") && (i + 1 < argc))
+            {
+                toolCount = (kSize)kMax_(atoi(argv[i + 1]), 0);
+                ++i;
+            }
+            else
+            {
+                kTest(kFile_Load(argv[i], &data, &size, kAlloc_App()));
+                kTest(Bench_Run(argv[i], data, size, iterations));
+                kTest(kAlloc_FreeRef(kAlloc_App(), &data));
+                anyFile = kTRUE;
+            }
+        }
+
+        if (!anyFile)
+        {
+            kTest(Bench_Generate(toolCount, &data, &size));
+            kTest(kStrPrintf(label, kCountOf(label), "synthetic job (%u tools)", (k32u)toolCount));
+            kTest(Bench_Run(label, data, size, iterations));
+        }
+    }
+    kFinally
+    {
+        kAlloc_Free(kAlloc_App(), data);
+        kObject_Destroy(api);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+int main(int argc, char** argv)
+{
+    kStatus status = BenchmarkMain(argc, argv);
+
+    if (!kSuccess(status))
+    {
+        printf("Error: %d\n", status);
+    }
+
+    return kSuccess(status) ? 0 : -1;
+}
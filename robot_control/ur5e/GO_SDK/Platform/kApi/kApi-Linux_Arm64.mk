@@ -134,6 +134,7 @@ ifeq ($(config),Debug)
 	../../build/kApi-gnumk_linux_arm64-Debug/kDat6Serializer.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Debug/kDirectory.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Debug/kFile.cpp.o \
+	../../build/kApi-gnumk_linux_arm64-Debug/kHeightCodec.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Debug/kHttpServer.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Debug/kHttpServerChannel.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Debug/kHttpServerRequest.cpp.o \
@@ -168,9 +169,11 @@ ifeq ($(config),Debug)
 	../../build/kApi-gnumk_linux_arm64-Debug/kObjectPool.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Debug/kPlugin.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Debug/kPoolAlloc.cpp.o \
+	../../build/kApi-gnumk_linux_arm64-Debug/kStatsAlloc.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Debug/kProcess.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Debug/kSymbolInfo.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Debug/kTimeSpan.cpp.o \
+	../../build/kApi-gnumk_linux_arm64-Debug/kTrace.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Debug/kUserAlloc.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Debug/kUtils.cpp.o
 	DEP_FILES = ../../build/kApi-gnumk_linux_arm64-Debug/kAlloc.cpp.d \
@@ -210,6 +213,7 @@ ifeq ($(config),Debug)
 	../../build/kApi-gnumk_linux_arm64-Debug/kDat6Serializer.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Debug/kDirectory.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Debug/kFile.cpp.d \
+	../../build/kApi-gnumk_linux_arm64-Debug/kHeightCodec.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Debug/kHttpServer.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Debug/kHttpServerChannel.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Debug/kHttpServerRequest.cpp.d \
@@ -244,9 +248,11 @@ ifeq ($(config),Debug)
 	../../build/kApi-gnumk_linux_arm64-Debug/kObjectPool.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Debug/kPlugin.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Debug/kPoolAlloc.cpp.d \
+	../../build/kApi-gnumk_linux_arm64-Debug/kStatsAlloc.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Debug/kProcess.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Debug/kSymbolInfo.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Debug/kTimeSpan.cpp.d \
+	../../build/kApi-gnumk_linux_arm64-Debug/kTrace.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Debug/kUserAlloc.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Debug/kUtils.cpp.d
 	TARGET_DEPS = 
@@ -333,6 +339,7 @@ ifeq ($(config),Release)
 	../../build/kApi-gnumk_linux_arm64-Release/kDat6Serializer.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Release/kDirectory.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Release/kFile.cpp.o \
+	../../build/kApi-gnumk_linux_arm64-Release/kHeightCodec.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Release/kHttpServer.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Release/kHttpServerChannel.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Release/kHttpServerRequest.cpp.o \
@@ -367,9 +374,11 @@ ifeq ($(config),Release)
 	../../build/kApi-gnumk_linux_arm64-Release/kObjectPool.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Release/kPlugin.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Release/kPoolAlloc.cpp.o \
+	../../build/kApi-gnumk_linux_arm64-Release/kStatsAlloc.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Release/kProcess.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Release/kSymbolInfo.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Release/kTimeSpan.cpp.o \
+	../../build/kApi-gnumk_linux_arm64-Release/kTrace.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Release/kUserAlloc.cpp.o \
 	../../build/kApi-gnumk_linux_arm64-Release/kUtils.cpp.o
 	DEP_FILES = ../../build/kApi-gnumk_linux_arm64-Release/kAlloc.cpp.d \
@@ -409,6 +418,7 @@ ifeq ($(config),Release)
 	../../build/kApi-gnumk_linux_arm64-Release/kDat6Serializer.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Release/kDirectory.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Release/kFile.cpp.d \
+	../../build/kApi-gnumk_linux_arm64-Release/kHeightCodec.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Release/kHttpServer.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Release/kHttpServerChannel.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Release/kHttpServerRequest.cpp.d \
@@ -443,9 +453,11 @@ ifeq ($(config),Release)
 	../../build/kApi-gnumk_linux_arm64-Release/kObjectPool.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Release/kPlugin.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Release/kPoolAlloc.cpp.d \
+	../../build/kApi-gnumk_linux_arm64-Release/kStatsAlloc.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Release/kProcess.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Release/kSymbolInfo.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Release/kTimeSpan.cpp.d \
+	../../build/kApi-gnumk_linux_arm64-Release/kTrace.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Release/kUserAlloc.cpp.d \
 	../../build/kApi-gnumk_linux_arm64-Release/kUtils.cpp.d
 	TARGET_DEPS = 
@@ -637,6 +649,10 @@ ifeq ($(config),Debug)
 	$(SILENT) $(info GccArm64 kApi/Io/kFile.cpp)
 	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Debug/kFile.cpp.o -c kApi/Io/kFile.cpp -MMD -MP
 
+../../build/kApi-gnumk_linux_arm64-Debug/kHeightCodec.cpp.o ../../build/kApi-gnumk_linux_arm64-Debug/kHeightCodec.cpp.d: kApi/Io/kHeightCodec.cpp
+	$(SILENT) $(info GccArm64 kApi/Io/kHeightCodec.cpp)
+	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Debug/kHeightCodec.cpp.o -c kApi/Io/kHeightCodec.cpp -MMD -MP
+
 ../../build/kApi-gnumk_linux_arm64-Debug/kHttpServer.cpp.o ../../build/kApi-gnumk_linux_arm64-Debug/kHttpServer.cpp.d: kApi/Io/kHttpServer.cpp
 	$(SILENT) $(info GccArm64 kApi/Io/kHttpServer.cpp)
 	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Debug/kHttpServer.cpp.o -c kApi/Io/kHttpServer.cpp -MMD -MP
@@ -773,6 +789,10 @@ ifeq ($(config),Debug)
 	$(SILENT) $(info GccArm64 kApi/Utils/kPoolAlloc.cpp)
 	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Debug/kPoolAlloc.cpp.o -c kApi/Utils/kPoolAlloc.cpp -MMD -MP
 
+../../build/kApi-gnumk_linux_arm64-Debug/kStatsAlloc.cpp.o ../../build/kApi-gnumk_linux_arm64-Debug/kStatsAlloc.cpp.d: kApi/Utils/kStatsAlloc.cpp
+	$(SILENT) $(info GccArm64 kApi/Utils/kStatsAlloc.cpp)
+	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Debug/kStatsAlloc.cpp.o -c kApi/Utils/kStatsAlloc.cpp -MMD -MP
+
 ../../build/kApi-gnumk_linux_arm64-Debug/kProcess.cpp.o ../../build/kApi-gnumk_linux_arm64-Debug/kProcess.cpp.d: kApi/Utils/kProcess.cpp
 	$(SILENT) $(info GccArm64 kApi/Utils/kProcess.cpp)
 	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Debug/kProcess.cpp.o -c kApi/Utils/kProcess.cpp -MMD -MP
@@ -785,6 +805,10 @@ ifeq ($(config),Debug)
 	$(SILENT) $(info GccArm64 kApi/Utils/kTimeSpan.cpp)
 	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Debug/kTimeSpan.cpp.o -c kApi/Utils/kTimeSpan.cpp -MMD -MP
 
+../../build/kApi-gnumk_linux_arm64-Debug/kTrace.cpp.o ../../build/kApi-gnumk_linux_arm64-Debug/kTrace.cpp.d: kApi/Utils/kTrace.cpp
+	$(SILENT) $(info GccArm64 kApi/Utils/kTrace.cpp)
+	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Debug/kTrace.cpp.o -c kApi/Utils/kTrace.cpp -MMD -MP
+
 ../../build/kApi-gnumk_linux_arm64-Debug/kUserAlloc.cpp.o ../../build/kApi-gnumk_linux_arm64-Debug/kUserAlloc.cpp.d: kApi/Utils/kUserAlloc.cpp
 	$(SILENT) $(info GccArm64 kApi/Utils/kUserAlloc.cpp)
 	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Debug/kUserAlloc.cpp.o -c kApi/Utils/kUserAlloc.cpp -MMD -MP
@@ -945,6 +969,10 @@ ifeq ($(config),Release)
 	$(SILENT) $(info GccArm64 kApi/Io/kFile.cpp)
 	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Release/kFile.cpp.o -c kApi/Io/kFile.cpp -MMD -MP
 
+../../build/kApi-gnumk_linux_arm64-Release/kHeightCodec.cpp.o ../../build/kApi-gnumk_linux_arm64-Release/kHeightCodec.cpp.d: kApi/Io/kHeightCodec.cpp
+	$(SILENT) $(info GccArm64 kApi/Io/kHeightCodec.cpp)
+	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Release/kHeightCodec.cpp.o -c kApi/Io/kHeightCodec.cpp -MMD -MP
+
 ../../build/kApi-gnumk_linux_arm64-Release/kHttpServer.cpp.o ../../build/kApi-gnumk_linux_arm64-Release/kHttpServer.cpp.d: kApi/Io/kHttpServer.cpp
 	$(SILENT) $(info GccArm64 kApi/Io/kHttpServer.cpp)
 	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Release/kHttpServer.cpp.o -c kApi/Io/kHttpServer.cpp -MMD -MP
@@ -1081,6 +1109,10 @@ ifeq ($(config),Release)
 	$(SILENT) $(info GccArm64 kApi/Utils/kPoolAlloc.cpp)
 	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Release/kPoolAlloc.cpp.o -c kApi/Utils/kPoolAlloc.cpp -MMD -MP
 
+../../build/kApi-gnumk_linux_arm64-Release/kStatsAlloc.cpp.o ../../build/kApi-gnumk_linux_arm64-Release/kStatsAlloc.cpp.d: kApi/Utils/kStatsAlloc.cpp
+	$(SILENT) $(info GccArm64 kApi/Utils/kStatsAlloc.cpp)
+	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Release/kStatsAlloc.cpp.o -c kApi/Utils/kStatsAlloc.cpp -MMD -MP
+
 ../../build/kApi-gnumk_linux_arm64-Release/kProcess.cpp.o ../../build/kApi-gnumk_linux_arm64-Release/kProcess.cpp.d: kApi/Utils/kProcess.cpp
 	$(SILENT) $(info GccArm64 kApi/Utils/kProcess.cpp)
 	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Release/kProcess.cpp.o -c kApi/Utils/kProcess.cpp -MMD -MP
@@ -1093,6 +1125,10 @@ ifeq ($(config),Release)
 	$(SILENT) $(info GccArm64 kApi/Utils/kTimeSpan.cpp)
 	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Release/kTimeSpan.cpp.o -c kApi/Utils/kTimeSpan.cpp -MMD -MP
 
+../../build/kApi-gnumk_linux_arm64-Release/kTrace.cpp.o ../../build/kApi-gnumk_linux_arm64-Release/kTrace.cpp.d: kApi/Utils/kTrace.cpp
+	$(SILENT) $(info GccArm64 kApi/Utils/kTrace.cpp)
+	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Release/kTrace.cpp.o -c kApi/Utils/kTrace.cpp -MMD -MP
+
 ../../build/kApi-gnumk_linux_arm64-Release/kUserAlloc.cpp.o ../../build/kApi-gnumk_linux_arm64-Release/kUserAlloc.cpp.d: kApi/Utils/kUserAlloc.cpp
 	$(SILENT) $(info GccArm64 kApi/Utils/kUserAlloc.cpp)
 	$(SILENT) $(GNU_CXX_COMPILER) $(GNU_COMPILER_FLAGS) $(CXX_FLAGS) $(DEFINES) $(INCLUDE_DIRS) -o ../../build/kApi-gnumk_linux_arm64-Release/kUserAlloc.cpp.o -c kApi/Utils/kUserAlloc.cpp -MMD -MP
@@ -1144,6 +1180,7 @@ include ../../build/kApi-gnumk_linux_arm64-Debug/kDat5Serializer.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kDat6Serializer.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kDirectory.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kFile.cpp.d
+include ../../build/kApi-gnumk_linux_arm64-Debug/kHeightCodec.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kHttpServer.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kHttpServerChannel.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kHttpServerRequest.cpp.d
@@ -1178,9 +1215,11 @@ include ../../build/kApi-gnumk_linux_arm64-Debug/kImageUtils.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kObjectPool.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kPlugin.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kPoolAlloc.cpp.d
+include ../../build/kApi-gnumk_linux_arm64-Debug/kStatsAlloc.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kProcess.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kSymbolInfo.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kTimeSpan.cpp.d
+include ../../build/kApi-gnumk_linux_arm64-Debug/kTrace.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kUserAlloc.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Debug/kUtils.cpp.d
 
@@ -1225,6 +1264,7 @@ include ../../build/kApi-gnumk_linux_arm64-Release/kDat5Serializer.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kDat6Serializer.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kDirectory.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kFile.cpp.d
+include ../../build/kApi-gnumk_linux_arm64-Release/kHeightCodec.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kHttpServer.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kHttpServerChannel.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kHttpServerRequest.cpp.d
@@ -1259,9 +1299,11 @@ include ../../build/kApi-gnumk_linux_arm64-Release/kImageUtils.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kObjectPool.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kPlugin.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kPoolAlloc.cpp.d
+include ../../build/kApi-gnumk_linux_arm64-Release/kStatsAlloc.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kProcess.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kSymbolInfo.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kTimeSpan.cpp.d
+include ../../build/kApi-gnumk_linux_arm64-Release/kTrace.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kUserAlloc.cpp.d
 include ../../build/kApi-gnumk_linux_arm64-Release/kUtils.cpp.d
 
@@ -72,12 +72,18 @@ kFx(kStatus) xkXml_Init(kXml xml, kAlloc allocator)
     kCheck(kArrayList_Construct(&obj->pathParseBuffer, kTypeOf(kByte), 128, allocator));
     kCheck(kArrayList_Construct(&obj->itemBlocks, kTypeOf(xkXmlItemBlock), 1, allocator));
     kCheck(kArrayList_Construct(&obj->attrBlocks, kTypeOf(xkXmlAttrBlock), 1, allocator));
+    kCheck(kArrayList_Construct(&obj->nameBlocks, kTypeOf(kPointer), 1, allocator));
 
     obj->itemBlockCount = xkXML_DEFAULT_ITEM_BLOCK_COUNT;
     obj->attrBlockCount = xkXML_DEFAULT_ATTR_BLOCK_COUNT;
     obj->root = kNULL;
     obj->freeItems = kNULL;
     obj->freeAttrs = kNULL;
+    obj->nameCursor = kNULL;
+    obj->nameRemaining = 0;
+    obj->nameTable = kNULL;
+    obj->nameCapacity = 0;
+    obj->nameCount = 0;
 
     return kOK;
 }
@@ -94,9 +100,11 @@ kFx(kStatus) xkXml_VRelease(kXml xml)
     kXml_Clear(xml);       
     xkXml_FreeItemBlocks(xml);
     xkXml_FreeAttrBlocks(xml);
+    xkXml_ClearNames(xml);
 
     kDestroyRef(&obj->itemBlocks);
     kDestroyRef(&obj->attrBlocks);
+    kDestroyRef(&obj->nameBlocks);
     kDestroyRef(&obj->pathParseBuffer);
 
     kCheck(kObject_VRelease(xml));
@@ -162,16 +170,24 @@ kFx(kStatus) kXml_Compact(kXml xml)
     kCheck(kXml_Clear(xml));
     kCheck(kArrayList_Assign(obj->attrBlocks, newObj->attrBlocks));
     kCheck(kArrayList_Assign(obj->itemBlocks, newObj->itemBlocks));
+    kCheck(kArrayList_Assign(obj->nameBlocks, newObj->nameBlocks));
     obj->root = newObj->root;
     obj->freeAttrs = newObj->freeAttrs;
     obj->freeItems = newObj->freeItems;
+    obj->nameCursor = newObj->nameCursor;
+    obj->nameRemaining = newObj->nameRemaining;
+    obj->nameTable = newObj->nameTable;
+    obj->nameCapacity = newObj->nameCapacity;
+    obj->nameCount = newObj->nameCount;
 
     // Remove references to copied data
     kCheck(kArrayList_Clear(newObj->attrBlocks));
     kCheck(kArrayList_Clear(newObj->itemBlocks));
+    kCheck(kArrayList_Clear(newObj->nameBlocks));
     newObj->root = kNULL;
     newObj->freeAttrs = kNULL;
     newObj->freeItems = kNULL;
+    newObj->nameTable = kNULL;
 
     kCheck(kObject_Destroy(newXml));
 
@@ -243,17 +259,17 @@ kFx(kStatus) kXml_Write(kXml xml, kStream stream)
 
 kFx(kStatus) kXml_Load(kXml* xml, const kChar* fileName, kAlloc allocator)
 {
-    kFile file = kNULL;
+    kAlloc alloc = kAlloc_Fallback(allocator); 
     kXml result = kNULL; 
+    kChar* text = kNULL; 
+    kSize size = 0; 
 
     kTry 
     {
         kTest(kXml_Construct(&result, allocator));
         
-        kTest(kFile_Construct(&file, fileName, kFILE_MODE_READ, allocator));
-        kTest(kFile_SetReadBuffer(file, xkXML_FILE_READ_BUFFER_SIZE)); 
-
-        kTest(kXml_Read(result, file));
+        kTest(kFile_Load(fileName, &text, &size, alloc)); 
+        kTest(xkXml_ParseText(result, text, size));
 
         *xml = result; 
         result = kNULL; 
@@ -261,7 +277,7 @@ kFx(kStatus) kXml_Load(kXml* xml, const kChar* fileName, kAlloc allocator)
     kFinally
     {
         kObject_Destroy(result);
-        kObject_Destroy(file);
+        kAlloc_Free(alloc, text);
         kEndFinally();
     }
 
@@ -290,24 +306,7 @@ kFx(kStatus) kXml_Save(kXml xml, const kChar* fileName)
 
 kFx(kStatus) kXml_FromString(kXml xml, kString str)
 {
-    xkXmlParseContext context;
-
-    context.isStream = kFALSE;
-    context.buffer = (kChar*) kString_Chars(str); // isn't modified for non-stream
-    context.currentItem = kNULL;
-    context.position = kString_Chars(str);
-    context.xml = xml;
-
-    // unused
-    context.capacity = 0;
-    context.size = 0;
-    context.eof = kFALSE;
-    context.stream = kNULL;
-
-    kCheck(kXml_Clear(xml));  
-    kCheck(xkXml_Parse(xml, &context));
-
-    return kOK;
+    return xkXml_ParseText(xml, kString_Chars(str), kString_Length(str));
 }
 
 kFx(kStatus) kXml_ToString(kXml xml, kString str)
@@ -333,24 +332,11 @@ kFx(kStatus) kXml_FromText(kXml* xml, const kChar* str, kAlloc allocator)
 {
     kXml result = kNULL; 
     kStatus status;
-    xkXmlParseContext context;
-
-    context.isStream = kFALSE;
-    context.buffer = (kChar*)str; // isn't modified for non-stream
-    context.currentItem = kNULL;
-    context.position = str;
-
-    // unused
-    context.capacity = 0;
-    context.size = 0;
-    context.eof = kFALSE;
-    context.stream = kNULL;
 
     kTry 
     {
         kTest(kXml_Construct(&result, allocator));
-        context.xml = result;
-        kTest(xkXml_Parse(result, &context));
+        kTest(xkXml_ParseText(result, str, kStrLength(str)));
 
         *xml = result; 
     } 
@@ -395,23 +381,18 @@ kFx(kStatus) kXml_SaveBytes(kXml xml, kByte** data, kSize* size, kAlloc allocato
 kFx(kStatus) kXml_LoadBytes(kXml* xml, const kByte* data, kSize size, kAlloc allocator)
 {
     kAlloc alloc = kAlloc_Fallback(allocator); 
-    kMemory stream = kNULL; 
     kXml output = kNULL; 
 
     kTry
     {
-        kTest(kMemory_Construct(&stream, kNULL)); 
-        kTest(kMemory_Attach(stream, (void*)data, 0, size, size)); 
-
         kTest(kXml_Construct(&output, alloc)); 
-        kTest(kXml_Read(output, stream)); 
+        kTest(xkXml_ParseText(output, (const kChar*)data, size)); 
 
         *xml = output; 
         output = kNULL; 
     }
     kFinally
     {
-        kCheck(kObject_Destroy(stream)); 
         kCheck(kObject_Destroy(output)); 
 
         kEndFinally(); 
@@ -431,6 +412,7 @@ kFx(kStatus) kXml_Clear(kXml xml)
 
     kCheck(xkXml_FreeItemBlocks(xml));
     kCheck(xkXml_FreeAttrBlocks(xml));
+    kCheck(xkXml_ClearNames(xml));
 
     return kOK;
 }
@@ -449,9 +431,9 @@ kFx(kStatus) kXml_AddItem(kXml xml, kXmlItem parent, const kChar* name, kXmlItem
     kCheckArgs(xkXml_ValidateName(name)); 
 
     kCheck(xkXml_AllocItem(xml, &itemObj));
+    kCheck(xkXml_InternName(xml, name, kStrLength(name), &itemObj->name));
     kCheck(xkXml_LinkItemUnder(xml, kIsNull(parent) ? kNULL : xkXmlItem_Cast(parent), itemObj));
 
-    kCheck(xkXml_TextFieldSetString(xml, &itemObj->name, name));
     kCheck(xkXml_TextFieldSetString(xml, &itemObj->value, ""));
 
     if (!kIsNull(item))
@@ -469,9 +451,9 @@ kFx(kStatus) kXml_InsertItem(kXml xml, kXmlItem next, const kChar* name, kXmlIte
     kCheckArgs(!kIsNull(next) && xkXml_ValidateName(name)); 
 
     kCheck(xkXml_AllocItem(xml, &itemObj));
+    kCheck(xkXml_InternName(xml, name, kStrLength(name), &itemObj->name));
     kCheck(xkXml_LinkItemBefore(xml, xkXmlItem_Cast(next), itemObj));
 
-    kCheck(xkXml_TextFieldSetString(xml, &itemObj->name, name));
     kCheck(xkXml_TextFieldSetString(xml, &itemObj->value, ""));
 
     if (!kIsNull(item))
@@ -507,22 +489,23 @@ kFx(kStatus) kXml_EnsureChildExists(kXml xml, kXmlItem parent, const kChar* path
     {
         kSize index;
         kSize tokenSize;
-        xkXmlItemClass* tempItem;
+        const kChar* name;
+        xkXmlItemClass* tempItem = kNULL;
 
         delim = xkXml_FindDelimiter(path, xkXML_PATH_DELIMITERS);
         tokenSize = (kSize) (delim - path);
         index = xkXml_ParseNameSubstrIndex(path, tokenSize, &tokenSize);
 
-        if (!kSuccess(xkXml_SetPathParseBuffer(xml, path, tokenSize)))
+        if (!kIsNull(name = xkXml_FindName(xml, path, tokenSize)))
         {
-            return kNULL;
+            tempItem = xkXml_FindChildByName(xml, foundItem, name, index);
         }
 
-        tempItem = xkXml_FindChildByName(xml, foundItem, xkXml_PathParseBuffer(xml), index);
         if (kIsNull(tempItem) && index == 0)
         {
             kXmlItem newItem;
 
+            kCheck(xkXml_SetPathParseBuffer(xml, path, tokenSize));
             kCheck(kXml_AddItem(xml, foundItem, xkXml_PathParseBuffer(xml), &newItem));
             tempItem = xkXmlItem_Cast(newItem);
         }
@@ -568,8 +551,13 @@ kFx(kStatus) kXml_SetItemName(kXml xml, kXmlItem item, const kChar* name)
     xkXmlItemClass* itemObj = xkXmlItem_Cast(item);
 
     kCheckArgs(!kIsNull(item));  
+
+    if (!kIsNull(itemObj->parent))
+    {
+        kCheck(xkXml_InvalidateChildIndex(xml, itemObj->parent));
+    }
  
-    return xkXml_TextFieldSetString(xml, &itemObj->name, name);
+    return xkXml_InternName(xml, name, kStrLength(name), &itemObj->name);
 }
 
 kFx(const kChar*) kXml_ItemName(kXml xml, kXmlItem item)
@@ -578,7 +566,7 @@ kFx(const kChar*) kXml_ItemName(kXml xml, kXmlItem item)
 
     kAssert(!kIsNull(item));  
 
-    return xkXml_TextFieldString(xml, &itemObj->name);
+    return itemObj->name;
 }
 
 kFx(kStatus) kXml_SetItemText(kXml xml, kXmlItem item, const kChar* str)
@@ -797,20 +785,10 @@ kFx(kBool) kXml_ChildExists(kXml xml, kXmlItem parent, const kChar* path)
 kFx(kSize) kXml_ChildCount(kXml xml, kXmlItem parent)
 {
     xkXmlItemClass* parentObj = xkXmlItem_Cast(parent);
-    xkXmlItemClass* childObj;
-    kSize count = 0;
 
     kAssert(!kIsNull(parent));
 
-    childObj = parentObj->firstChild;
-
-    while (!kIsNull(childObj))
-    {
-        ++count;
-        childObj = childObj->next;
-    }
-
-    return count;
+    return parentObj->childCount;
 }
 
 kFx(kXmlItem) kXml_ChildAt(kXml xml, kXmlItem parent, kSize index)
@@ -851,17 +829,19 @@ kFx(kXmlItem) kXml_Child(kXml xml, kXmlItem parent, const kChar* path)
     {
         kSize index;
         kSize tokenSize;
+        const kChar* name;
 
         delim = xkXml_FindDelimiter(path, xkXML_PATH_DELIMITERS);
         tokenSize = (kSize) (delim - path);
         index = xkXml_ParseNameSubstrIndex(path, tokenSize, &tokenSize);
 
-        if (!kSuccess(xkXml_SetPathParseBuffer(xml, path, tokenSize)))
+        // a name that was never interned cannot belong to any element in this document
+        if (kIsNull(name = xkXml_FindName(xml, path, tokenSize)))
         {
             return kNULL;
         }
 
-        foundItem = xkXml_FindChildByName(xml, foundItem, xkXml_PathParseBuffer(xml), index);
+        foundItem = xkXml_FindChildByName(xml, foundItem, name, index);
         if (kIsNull(foundItem))
         {
             break;
@@ -1524,13 +1504,17 @@ kStatus xkXml_AllocItem(kXml xml, xkXmlItemClass** item)
     newItem = obj->freeItems;
     obj->freeItems = obj->freeItems->next;
     
-    kCheck(xkXml_TextFieldInit(xml, &newItem->name));
     kCheck(xkXml_TextFieldInit(xml, &newItem->value));
 
+    newItem->name = "";
     newItem->firstAttr = newItem->lastAttr = kNULL;
     newItem->parent = kNULL;
     newItem->firstChild = newItem->lastChild = kNULL;
     newItem->prev = newItem->next = kNULL;
+    newItem->childCount = 0;
+    newItem->childIndex = kNULL;
+    newItem->childIndexCapacity = 0;
+    newItem->nextNamesake = kNULL;
 
     *item = newItem;
 
@@ -1557,8 +1541,8 @@ kStatus xkXml_FreeItem(kXml xml, xkXmlItemClass* item)
         child = next;
     }
 
-    kCheck(xkXml_TextFieldRelease(xml, &item->name));
     kCheck(xkXml_TextFieldRelease(xml, &item->value));
+    kCheck(xkXml_InvalidateChildIndex(xml, item));
 
     item->next = obj->freeItems;
     obj->freeItems = item;
@@ -1628,6 +1612,13 @@ kStatus xkXml_LinkItemUnder(kXml xml, xkXmlItemClass* parent, xkXmlItemClass* it
             parent->firstChild = item;
             parent->lastChild = item;
         }
+
+        parent->childCount++;
+
+        if (!kIsNull(parent->childIndex))
+        {
+            kCheck(xkXml_IndexChild(xml, parent, item));
+        }
     }
 
     return kOK;
@@ -1646,9 +1637,15 @@ kStatus xkXml_LinkItemBefore(kXml xml, xkXmlItemClass* next, xkXmlItemClass* ite
 
     next->prev = item;
 
-    if (!kIsNull(item->parent) && kIsNull(item->prev))
+    if (!kIsNull(item->parent))
     {
-        item->parent->firstChild = item;
+        if (kIsNull(item->prev))
+        {
+            item->parent->firstChild = item;
+        }
+
+        item->parent->childCount++;
+        kCheck(xkXml_InvalidateChildIndex(xml, item->parent));
     }
 
     return kOK;
@@ -1667,9 +1664,15 @@ kStatus xkXml_LinkItemAfter(kXml xml, xkXmlItemClass* prev, xkXmlItemClass* item
         prev->next->prev = item;
     }
 
-    if (!kIsNull(item->parent) && kIsNull(item->next))
+    if (!kIsNull(item->parent))
     {
-        item->parent->lastChild = item;
+        if (kIsNull(item->next))
+        {
+            item->parent->lastChild = item;
+        }
+
+        item->parent->childCount++;
+        kCheck(xkXml_InvalidateChildIndex(xml, item->parent));
     }
 
     return kOK;
@@ -1691,6 +1694,9 @@ kStatus xkXml_UnlinkItem(kXml xml, xkXmlItemClass* item)
         {
             parentObj->lastChild = itemObj->prev;
         }
+
+        parentObj->childCount--;
+        kCheck(xkXml_InvalidateChildIndex(xml, parentObj));
     }
     else
     {
@@ -1743,6 +1749,7 @@ xkXmlAttrClass* xkXml_FindAttrByName(kXml xml, xkXmlItemClass* item, const kChar
     return kNULL;
 }
 
+// Name must be interned (see xkXml_FindName); names are compared by address. 
 xkXmlItemClass* xkXml_FindChildByName(kXml xml, xkXmlItemClass* parent, const kChar* name, kSize index)
 {
     kObj(kXml, xml);
@@ -1754,13 +1761,26 @@ xkXmlItemClass* xkXml_FindChildByName(kXml xml, xkXmlItemClass* parent, const kC
         {
             return kNULL;
         }
-        if (!kStrEquals(xkXml_TextFieldString(xml, &obj->root->name), name))
+        if (obj->root->name != name)
         {
             return kNULL;
         }
 
         return obj->root;
     }
+    else if ((parent->childCount >= xkXML_CHILD_INDEX_MIN_COUNT) && 
+             (!kIsNull(parent->childIndex) || kSuccess(xkXml_BuildChildIndex(xml, parent))))
+    {
+        xkXmlItemClass* child = parent->childIndex[xkXml_FindChildIndexSlot(parent, name)];
+
+        while (!kIsNull(child) && (index > 0))
+        {
+            child = child->nextNamesake;
+            index--;
+        }
+
+        return child;
+    }
     else
     {
         xkXmlItemClass* child = parent->firstChild;
@@ -1768,7 +1788,7 @@ xkXmlItemClass* xkXml_FindChildByName(kXml xml, xkXmlItemClass* parent, const kC
 
         while (!kIsNull(child))
         {
-            if (kStrEquals(xkXml_TextFieldString(xml, &child->name), name))
+            if (child->name == name)
             {
                 if (i >= index)
                 {
@@ -1954,6 +1974,230 @@ const kChar* xkXml_PathParseBuffer(kXml xml)
     return (kChar*)kArrayList_DataAt(obj->pathParseBuffer, 0);
 }
 
+kStatus xkXml_InternName(kXml xml, const kChar* text, kSize length, const kChar** name)
+{
+    kObj(kXml, xml);
+    kSize hash = xkHashBytes(text, length);
+    kChar* entry = kNULL;
+    kSize mask, slot;
+
+    if (obj->nameCount > 0)
+    {
+        mask = obj->nameCapacity - 1;
+
+        for (slot = hash & mask; !kIsNull(obj->nameTable[slot]); slot = (slot + 1) & mask)
+        {
+            if (xkXml_NameEquals(obj->nameTable[slot], text, length))
+            {
+                *name = obj->nameTable[slot];
+                return kOK;
+            }
+        }
+    }
+
+    if (2*(obj->nameCount + 1) > obj->nameCapacity)
+    {
+        kCheck(xkXml_GrowNameTable(xml));
+    }
+
+    if ((length + 1) > obj->nameRemaining)
+    {
+        kSize blockSize = kMax_(length + 1, xkXML_NAME_BLOCK_SIZE);
+        kPointer block = kNULL;
+        kStatus status;
+
+        kCheck(kAlloc_Get(obj->base.alloc, blockSize, &block));
+
+        if (!kSuccess(status = kArrayList_AddT(obj->nameBlocks, &block)))
+        {
+            kAlloc_Free(obj->base.alloc, block);
+            return status;
+        }
+
+        obj->nameCursor = (kChar*) block;
+        obj->nameRemaining = blockSize;
+    }
+
+    entry = obj->nameCursor;
+    kMemCopy(entry, text, length);
+    entry[length] = '\0';
+
+    obj->nameCursor += length + 1;
+    obj->nameRemaining -= length + 1;
+
+    mask = obj->nameCapacity - 1;
+
+    for (slot = hash & mask; !kIsNull(obj->nameTable[slot]); slot = (slot + 1) & mask)
+    {
+    }
+
+    obj->nameTable[slot] = entry;
+    obj->nameCount++;
+
+    *name = entry;
+
+    return kOK;
+}
+
+const kChar* xkXml_FindName(kXml xml, const kChar* text, kSize length)
+{
+    kObj(kXml, xml);
+    kSize mask, slot;
+
+    if (obj->nameCount == 0)
+    {
+        return kNULL;
+    }
+
+    mask = obj->nameCapacity - 1;
+
+    for (slot = xkHashBytes(text, length) & mask; !kIsNull(obj->nameTable[slot]); slot = (slot + 1) & mask)
+    {
+        if (xkXml_NameEquals(obj->nameTable[slot], text, length))
+        {
+            return obj->nameTable[slot];
+        }
+    }
+
+    return kNULL;
+}
+
+kStatus xkXml_GrowNameTable(kXml xml)
+{
+    kObj(kXml, xml);
+    kSize capacity = kMax_(2*obj->nameCapacity, xkXML_NAME_TABLE_MIN_CAPACITY);
+    const kChar** table = kNULL;
+    kSize i, slot;
+
+    kCheck(kAlloc_GetZero(obj->base.alloc, capacity*sizeof(const kChar*), &table));
+
+    for (i = 0; i < obj->nameCapacity; ++i)
+    {
+        const kChar* entry = obj->nameTable[i];
+
+        if (!kIsNull(entry))
+        {
+            for (slot = xkHashBytes(entry, kStrLength(entry)) & (capacity - 1); !kIsNull(table[slot]); slot = (slot + 1) & (capacity - 1))
+            {
+            }
+
+            table[slot] = entry;
+        }
+    }
+
+    kCheck(kAlloc_Free(obj->base.alloc, obj->nameTable));
+
+    obj->nameTable = table;
+    obj->nameCapacity = capacity;
+
+    return kOK;
+}
+
+kStatus xkXml_ClearNames(kXml xml)
+{
+    kObj(kXml, xml);
+    kSize i;
+
+    for (i = 0; i < kArrayList_Count(obj->nameBlocks); ++i)
+    {
+        kCheck(kAlloc_Free(obj->base.alloc, *kArrayList_AtT(obj->nameBlocks, i, kPointer)));
+    }
+
+    kCheck(kArrayList_Clear(obj->nameBlocks));
+    kCheck(kAlloc_FreeRef(obj->base.alloc, &obj->nameTable));
+
+    obj->nameCursor = kNULL;
+    obj->nameRemaining = 0;
+    obj->nameCapacity = 0;
+    obj->nameCount = 0;
+
+    return kOK;
+}
+
+kStatus xkXml_BuildChildIndex(kXml xml, xkXmlItemClass* parent)
+{
+    kObj(kXml, xml);
+    kSize capacity = xkXML_CHILD_INDEX_MIN_COUNT;
+    xkXmlItemClass* child;
+
+    // leave room for appended children, which are indexed incrementally
+    while (capacity < 4*parent->childCount)
+    {
+        capacity *= 2;
+    }
+
+    kCheck(kAlloc_GetZero(obj->base.alloc, capacity*sizeof(xkXmlItemClass*), &parent->childIndex));
+    parent->childIndexCapacity = capacity;
+
+    // visit children in reverse, so that each slot ends up referring to the first child with its name
+    for (child = parent->lastChild; !kIsNull(child); child = child->prev)
+    {
+        kSize slot = xkXml_FindChildIndexSlot(parent, child->name);
+
+        child->nextNamesake = parent->childIndex[slot];
+        parent->childIndex[slot] = child;
+    }
+
+    return kOK;
+}
+
+kStatus xkXml_IndexChild(kXml xml, xkXmlItemClass* parent, xkXmlItemClass* item)
+{
+    xkXmlItemClass* namesake;
+    kSize slot;
+
+    if ((2*parent->childCount) > parent->childIndexCapacity)
+    {
+        return xkXml_InvalidateChildIndex(xml, parent);
+    }
+
+    item->nextNamesake = kNULL;
+    slot = xkXml_FindChildIndexSlot(parent, item->name);
+    namesake = parent->childIndex[slot];
+
+    if (kIsNull(namesake))
+    {
+        parent->childIndex[slot] = item;
+    }
+    else
+    {
+        while (!kIsNull(namesake->nextNamesake))
+        {
+            namesake = namesake->nextNamesake;
+        }
+
+        namesake->nextNamesake = item;
+    }
+
+    return kOK;
+}
+
+kSize xkXml_FindChildIndexSlot(xkXmlItemClass* parent, const kChar* name)
+{
+    kSize mask = parent->childIndexCapacity - 1;
+    kSize slot = xkHashPointer((kPointer)name) & mask;
+
+    while (!kIsNull(parent->childIndex[slot]) && (parent->childIndex[slot]->name != name))
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+kStatus xkXml_InvalidateChildIndex(kXml xml, xkXmlItemClass* parent)
+{
+    kObj(kXml, xml);
+
+    if (!kIsNull(parent->childIndex))
+    {
+        kCheck(kAlloc_FreeRef(obj->base.alloc, &parent->childIndex));
+        parent->childIndexCapacity = 0;
+    }
+
+    return kOK;
+}
+
 kStatus xkXml_AddEscapedString(kXml xml, const kChar* in, kString out)
 {
     kSize i, j;
@@ -2080,7 +2324,7 @@ kStatus xkXml_ItemToString(kXml xml, kString str, xkXmlItemClass* item, kSize le
     }
 
     value = xkXml_TextFieldString(xml, &item->value);
-    name = xkXml_TextFieldString(xml, &item->name);
+    name = item->name;
 
     for (i = 0; i < level; ++i)
     {
@@ -2601,7 +2845,8 @@ kStatus xkXml_ParseTag(kXml xml, xkXmlParseContext* context, xkXmlTagType* tagTy
 
     if (context->buffer[tokenBegin] == '/') // closing item
     {       
-        if (strncmp(xkXml_TextFieldString(xml, &context->currentItem->name), &context->buffer[tokenBegin + 1], tokenEnd - tokenBegin - 1) != 0)
+        if (kIsNull(context->currentItem) || 
+            !xkXml_NameEquals(context->currentItem->name, &context->buffer[tokenBegin + 1], tokenEnd - tokenBegin - 1))
         {
             return kERROR; // mismatched tags
         }
@@ -2615,9 +2860,9 @@ kStatus xkXml_ParseTag(kXml xml, xkXmlParseContext* context, xkXmlTagType* tagTy
 
         parentItem = context->currentItem;
         kCheck(xkXml_AllocItem(xml, &context->currentItem));
+        kCheck(xkXml_InternName(xml, &context->buffer[tokenBegin], tokenEnd - tokenBegin, &context->currentItem->name));
         kCheck(xkXml_LinkItemUnder(xml, parentItem, context->currentItem));
 
-        kCheck(xkXml_Substr(xml, context->buffer, tokenBegin, tokenEnd, &context->currentItem->name));
         kCheck(xkXml_ParseAttributes(xml, context));
 
         // parse until end
@@ -2809,3 +3054,268 @@ kStatus xkXml_ParseDeclaration(kXml xml, xkXmlParseContext* context)
 
     return kERROR;
 }
+
+// Single-pass parser for documents that are fully resident in memory. Produces the same tree as 
+// xkXml_Parse, but scans the source text in place rather than copying it character by character. 
+
+kStatus xkXml_ParseText(kXml xml, const kChar* text, kSize length)
+{
+    kObj(kXml, xml);
+    const kChar* it = text;
+    const kChar* end = text + length;
+    const kChar* terminator = (const kChar*) memchr(text, '\0', length);
+    const kChar* valueBegin = text;
+    const kChar* valueEnd = text;
+    xkXmlItemClass* currentItem = kNULL;
+    xkXmlTagType tagType = TAG_CLOSE;
+
+    kCheck(kXml_Clear(xml));
+
+    // as with xkXml_Parse, the document ends at the first null character
+    if (!kIsNull(terminator))
+    {
+        end = terminator;
+    }
+
+    while (!kIsNull(it = (const kChar*) memchr(it, '<', (kSize)(end - it))))
+    {
+        valueEnd = it++;
+
+        while ((it < end) && kChar_IsSpace(*it))
+        {
+            ++it;
+        }
+
+        if (it >= end)
+        {
+            return kERROR;
+        }
+
+        if (*it == '!')
+        {
+            if (((end - it) < 3) || (it[1] != '-') || (it[2] != '-'))
+            {
+                return kERROR;
+            }
+
+            if (kIsNull(it = xkXml_FindText(it + 3, end, "-->")))
+            {
+                return kERROR;
+            }
+
+            it += 3;
+        }
+        else if (*it == '?')
+        {
+            if (kIsNull(it = xkXml_FindText(it + 1, end, "?>")))
+            {
+                return kERROR;
+            }
+
+            it += 2;
+        }
+        else
+        {
+            xkXmlTagType prevTagType = tagType;
+            xkXmlItemClass* prevItem = currentItem;
+
+            kCheck(xkXml_ParseTextTag(xml, &it, end, &currentItem, &tagType));
+
+            if (tagType == TAG_OPEN)
+            {
+                valueBegin = ++it;
+            }
+            else
+            {
+                // only the content of a non-nested open/close pair is considered as value (see xkXml_Parse)
+                if ((tagType == TAG_CLOSE) && (prevTagType == TAG_OPEN))
+                {
+                    kCheck(xkXml_UnescapeSubstr(xml, text, (kSize)(valueBegin - text), (kSize)(valueEnd - text), &prevItem->value));
+                }
+
+                if (kIsNull(currentItem))
+                {
+                    // root element is complete
+                    break;
+                }
+
+                ++it;
+            }
+        }
+    }
+
+    if (!kIsNull(currentItem) || kIsNull(obj->root))
+    {
+        return kERROR;
+    }
+
+    return kOK;
+}
+
+const kChar* xkXml_FindText(const kChar* begin, const kChar* end, const kChar* pattern)
+{
+    kSize length = kStrLength(pattern);
+
+    while ((kSize)(end - begin) >= length)
+    {
+        if (kIsNull(begin = (const kChar*) memchr(begin, pattern[0], (kSize)(end - begin) - length + 1)))
+        {
+            return kNULL;
+        }
+
+        if (memcmp(begin, pattern, length) == 0)
+        {
+            return begin;
+        }
+
+        ++begin;
+    }
+
+    return kNULL;
+}
+
+kStatus xkXml_ParseTextTag(kXml xml, const kChar** position, const kChar* end, xkXmlItemClass** currentItem, xkXmlTagType* tagType)
+{
+    const kChar* it = *position;
+    const kChar* nameBegin = it++;
+
+    while ((it < end) && !xkXml_IsTokenEnd(*it))
+    {
+        ++it;
+    }
+
+    if ((it >= end) || (*it == '<') || (*it == '='))
+    {
+        return kERROR;
+    }
+
+    if (*nameBegin == '/') // closing item
+    {
+        if (kIsNull(*currentItem) || !xkXml_NameEquals((*currentItem)->name, nameBegin + 1, (kSize)(it - nameBegin - 1)))
+        {
+            return kERROR; // mismatched tags
+        }
+
+        *currentItem = (*currentItem)->parent;
+        *tagType = TAG_CLOSE;
+    }
+    else // beginning item
+    {
+        xkXmlItemClass* parentItem = *currentItem;
+        xkXmlItemClass* item = kNULL;
+
+        kCheck(xkXml_AllocItem(xml, &item));
+        kCheck(xkXml_InternName(xml, nameBegin, (kSize)(it - nameBegin), &item->name));
+        kCheck(xkXml_LinkItemUnder(xml, parentItem, item));
+
+        kCheck(xkXml_ParseTextAttributes(xml, &it, end, item));
+
+        if (*it == '/') // empty item
+        {
+            ++it;
+            *currentItem = parentItem;
+            *tagType = TAG_EMPTY;
+        }
+        else
+        {
+            *currentItem = item;
+            *tagType = TAG_OPEN;
+        }
+    }
+
+    while ((it < end) && kChar_IsSpace(*it))
+    {
+        ++it;
+    }
+
+    if ((it >= end) || (*it != '>'))
+    {
+        return kERROR;
+    }
+
+    *position = it;
+
+    return kOK;
+}
+
+kStatus xkXml_ParseTextAttributes(kXml xml, const kChar** position, const kChar* end, xkXmlItemClass* item)
+{
+    const kChar* it = *position;
+
+    while (kTRUE)
+    {
+        const kChar* tokenBegin;
+        xkXmlAttrClass* attr = kNULL;
+
+        while ((it < end) && kChar_IsSpace(*it))
+        {
+            ++it;
+        }
+
+        if (it >= end)
+        {
+            return kERROR;
+        }
+
+        if ((*it == '/') || (*it == '>'))
+        {
+            break;
+        }
+
+        tokenBegin = it;
+
+        while ((it < end) && !xkXml_IsTokenEnd(*it))
+        {
+            ++it;
+        }
+
+        if ((it >= end) || (*it == '<'))
+        {
+            return kERROR;
+        }
+
+        // allocate and insert
+        kCheck(xkXml_AllocAttr(xml, &attr));
+        kCheck(xkXml_LinkAttr(xml, item, attr));
+        kCheck(xkXml_Substr(xml, tokenBegin, 0, (kSize)(it - tokenBegin), &attr->name));
+
+        // parse value
+        while ((it < end) && kChar_IsSpace(*it))
+        {
+            ++it;
+        }
+
+        if ((it < end) && (*it == '='))
+        {
+            const kChar* valueEnd;
+            kChar quote;
+
+            ++it;
+
+            while ((it < end) && kChar_IsSpace(*it))
+            {
+                ++it;
+            }
+
+            if ((it >= end) || ((*it != '\'') && (*it != '\"')))
+            {
+                return kERROR;
+            }
+
+            quote = *it++;
+
+            if (kIsNull(valueEnd = (const kChar*) memchr(it, quote, (kSize)(end - it))))
+            {
+                return kERROR;
+            }
+
+            kCheck(xkXml_Substr(xml, it, 0, (kSize)(valueEnd - it), &attr->value));
+
+            it = valueEnd + 1;
+        }
+    }
+
+    *position = it;
+
+    return kOK;
+}
@@ -22,6 +22,11 @@
  * kXml supports the kObject_Clone method. 
  *
  * kXml supports the kdat6 serialization protocol. 
+ *
+ * Element names are interned per document, and the children of larger elements are indexed by 
+ * name when first searched, so that kXml_Child lookups do not need to compare strings or visit 
+ * every sibling. Documents that are available in memory (kXml_LoadBytes, kXml_FromText, 
+ * kXml_FromString, kXml_Load) are parsed in a single pass over the source text.
  */
 //typedef kObject kXml;       --forward-declared in kApiDef.x.h 
 
@@ -16,6 +16,9 @@
 #define xkXML_DEFAULT_TEXT_SIZE          (64)
 #define xkXML_DEFAULT_ITEM_BLOCK_COUNT   (128)
 #define xkXML_DEFAULT_ATTR_BLOCK_COUNT   (128)
+#define xkXML_NAME_BLOCK_SIZE            (4096)     //size of each interned name storage block
+#define xkXML_NAME_TABLE_MIN_CAPACITY    (64)       //initial slot count of the interned name table
+#define xkXML_CHILD_INDEX_MIN_COUNT      (8)        //minimum child count before a hashed child index is built
 
 #define xkXML_PATH_DELIMITERS            "\\/"
 #define xkXML_DEFAULT_HEADER             "?xml version=\"1.0\" encoding=\"UTF-8\"?"
@@ -41,7 +44,7 @@ struct xkXmlAttrClassTag
 
 struct xkXmlItemClassTag
 {
-    xkXmlTextField name;
+    const kChar* name;                  //interned element name (see xkXml_InternName)
     xkXmlTextField value;
 
     xkXmlAttrClass* firstAttr;
@@ -53,6 +56,11 @@ struct xkXmlItemClassTag
     xkXmlItemClass* parent;
     xkXmlItemClass* prev;
     xkXmlItemClass* next;
+
+    kSize childCount;                   //number of direct children
+    xkXmlItemClass** childIndex;        //lazily-built hash table of first child per name (or kNULL)
+    kSize childIndexCapacity;           //child index slot count (power of two)
+    xkXmlItemClass* nextNamesake;       //next sibling with the same name; valid while parent->childIndex exists
 };
 
 typedef struct
@@ -105,6 +113,13 @@ typedef struct kXmlClass
     kArrayList attrBlocks;
     xkXmlAttrClass* freeAttrs;
 
+    kArrayList nameBlocks;              //interned name storage blocks (kArrayList<kPointer>)
+    kChar* nameCursor;                  //next free byte in the current name block
+    kSize nameRemaining;                //free bytes in the current name block
+    const kChar** nameTable;            //open-addressed table of interned names
+    kSize nameCapacity;                 //name table slot count (power of two)
+    kSize nameCount;                    //number of interned names
+
     kChar formatBuffer[xkXML_FORMAT_BUFFER_SIZE];
     kArrayList pathParseBuffer;
 } kXmlClass; 
@@ -172,6 +187,16 @@ kStatus xkXml_UnescapeSubstr(kXml xml, const kChar* input, kSize begin, kSize en
 const kChar* xkXml_FindDelimiter(const kChar* str, const kChar* delims);
 kSize xkXml_ParseNameSubstrIndex(const kChar* str, kSize size, kSize* adjustedSize);
 
+kStatus xkXml_InternName(kXml xml, const kChar* text, kSize length, const kChar** name);
+const kChar* xkXml_FindName(kXml xml, const kChar* text, kSize length);
+kStatus xkXml_GrowNameTable(kXml xml);
+kStatus xkXml_ClearNames(kXml xml);
+
+kStatus xkXml_BuildChildIndex(kXml xml, xkXmlItemClass* parent);
+kStatus xkXml_IndexChild(kXml xml, xkXmlItemClass* parent, xkXmlItemClass* item);
+kSize xkXml_FindChildIndexSlot(xkXmlItemClass* parent, const kChar* name);
+kStatus xkXml_InvalidateChildIndex(kXml xml, xkXmlItemClass* parent);
+
 kStatus xkXml_SetPathParseBuffer(kXml xml, const kChar* text, kSize size);
 const kChar* xkXml_PathParseBuffer(kXml xml);
 
@@ -190,6 +215,11 @@ kStatus xkXml_AdvanceParser(xkXmlParseContext* context);
 kStatus xkXml_SkipWhitespace(xkXmlParseContext* context);
 kStatus xkXml_SkipToken(xkXmlParseContext* context);
 
+kStatus xkXml_ParseText(kXml xml, const kChar* text, kSize length);
+const kChar* xkXml_FindText(const kChar* begin, const kChar* end, const kChar* pattern);
+kStatus xkXml_ParseTextTag(kXml xml, const kChar** position, const kChar* end, xkXmlItemClass** currentItem, xkXmlTagType* tagType);
+kStatus xkXml_ParseTextAttributes(kXml xml, const kChar** position, const kChar* end, xkXmlItemClass* item);
+
 kFx(kStatus) xkXml_Init(kXml xml, kAlloc allocator);
 kFx(kStatus) xkXml_VClone(kXml xml, kXml source, kAlloc valueAlloc, kObject context);
 
@@ -198,4 +228,14 @@ kInlineFx(xkXmlItemClass*) xkXmlItem_Cast(kXmlItem item)
     return kCast(xkXmlItemClass*, item);
 }
 
+kInlineFx(kBool) xkXml_NameEquals(const kChar* name, const kChar* text, kSize length)
+{
+    return kStrnEquals(name, text, length) && (name[length] == '\0');
+}
+
+kInlineFx(kBool) xkXml_IsTokenEnd(kChar ch)
+{
+    return kChar_IsSpace(ch) || (ch == '<') || (ch == '/') || (ch == '>') || (ch == '=');
+}
+
 #endif
@@ -342,7 +342,7 @@ kFx(kStatus) kDat5Serializer_WriteData(kDat5Serializer serializer, kObject objec
             if (shouldCompress)
             {
                 kTest(kSerializer_WriteByte(serializer, xkDAT5_SERIALIZER_CMD_COMPRESSED_OBJECT));
-                kTest(xkDat5Serializer_BeginCompression(serializer));
+                kTest(xkDat5Serializer_BeginCompression(serializer, object));
             }
             else
             {
@@ -634,7 +634,7 @@ kFx(kStatus) xkDat5Serializer_ReadTypeExplicitVersion(kDat5Serializer serializer
 }
 
 
-kFx(kStatus) xkDat5Serializer_BeginCompression(kDat5Serializer serializer)
+kFx(kStatus) xkDat5Serializer_BeginCompression(kDat5Serializer serializer, kObject object)
 {
     kObj(kDat5Serializer, serializer);
 
@@ -644,6 +644,9 @@ kFx(kStatus) xkDat5Serializer_BeginCompression(kDat5Serializer serializer)
 
     kCheck(xkSerializer_FlushEx(serializer, kFALSE));
 
+    //let the compressor adapt to the object (e.g., its dimensions)
+    kCheck(kCompressor_BeginWrite(obj->compressStream, object));
+
     //replace underlying stream with compression stream
     obj->base.writeStream = obj->compressStream;
 
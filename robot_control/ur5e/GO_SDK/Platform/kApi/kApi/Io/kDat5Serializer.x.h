@@ -123,7 +123,7 @@ kFx(kStatus) xkDat5Serializer_VReadType(kDat5Serializer serializer, kType* type,
 kFx(kStatus) xkDat5Serializer_WriteTypeWithoutVersion(kDat5Serializer serializer, kType type, kTypeVersion* version); 
 kFx(kStatus) xkDat5Serializer_ReadTypeExplicitVersion(kDat5Serializer serializer, k32u typeVersionId, kType* type, kTypeVersion* version); 
 
-kFx(kStatus) xkDat5Serializer_BeginCompression(kDat5Serializer serializer);
+kFx(kStatus) xkDat5Serializer_BeginCompression(kDat5Serializer serializer, kObject object);
 kFx(kStatus) xkDat5Serializer_EndCompression(kDat5Serializer serializer);
 
 kFx(kStatus) xkDat5Serializer_BeginDecompression(kDat5Serializer serializer);
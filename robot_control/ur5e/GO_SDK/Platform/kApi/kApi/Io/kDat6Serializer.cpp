@@ -375,7 +375,7 @@ kFx(kStatus) kDat6Serializer_VWriteObject(kDat6Serializer serializer, kObject ob
             if (shouldCompress)
             {
                 kTest(kSerializer_WriteByte(serializer, xkDAT6_SERIALIZER_CMD_COMPRESSED_OBJECT));
-                kTest(xkDat6Serializer_BeginCompression(serializer));
+                kTest(xkDat6Serializer_BeginCompression(serializer, object));
             }
             else
             {
@@ -623,7 +623,7 @@ kFx(kStatus) xkDat6Serializer_ReadSync(kDat6Serializer serializer)
     return kOK; 
 }
 
-kFx(kStatus) xkDat6Serializer_BeginCompression(kDat6Serializer serializer)
+kFx(kStatus) xkDat6Serializer_BeginCompression(kDat6Serializer serializer, kObject object)
 {
     kObj(kDat6Serializer, serializer);
 
@@ -634,6 +634,9 @@ kFx(kStatus) xkDat6Serializer_BeginCompression(kDat6Serializer serializer)
     //flush serializer to underlying stream, but don't flush the underlying stream itself
     kCheck(xkSerializer_FlushEx(serializer, kFALSE));
 
+    //let the compressor adapt to the object (e.g., its dimensions)
+    kCheck(kCompressor_BeginWrite(obj->compressStream, object));
+
     //replace underlying stream with compression stream
     obj->base.writeStream = obj->compressStream;
 
@@ -111,7 +111,7 @@ kFx(kStatus) xkDat6Serializer_VReadType(kDat6Serializer serializer, kType* type,
 kFx(kStatus) xkDat6Serializer_WriteSync(kDat6Serializer serializer); 
 kFx(kStatus) xkDat6Serializer_ReadSync(kDat6Serializer serializer); 
 
-kFx(kStatus) xkDat6Serializer_BeginCompression(kDat6Serializer serializer);
+kFx(kStatus) xkDat6Serializer_BeginCompression(kDat6Serializer serializer, kObject object);
 kFx(kStatus) xkDat6Serializer_EndCompression(kDat6Serializer serializer);
 
 kFx(kStatus) xkDat6Serializer_BeginDecompression(kDat6Serializer serializer);
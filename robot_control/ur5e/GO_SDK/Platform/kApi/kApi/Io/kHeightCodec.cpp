@@ -0,0 +1,1126 @@
+/**
+ * @file    kHeightCodec.cpp
+ *
+ * @internal
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#include <kApi/Io/kHeightCodec.h>
+#include <kApi/Io/kSerializer.h>
+#include <kApi/Data/kArray1.h>
+#include <kApi/Data/kArray2.h>
+#include <kApi/Data/kArray3.h>
+#include <kApi/Data/kImage.h>
+
+kBeginClassEx(k, kHeightCodec)
+    kAddInterface(kHeightCodec, kCompressor)
+
+    kAddPrivateVMethod(kHeightCodec, kObject, VRelease)
+    kAddPrivateVMethod(kHeightCodec, kStream, VReadSomeImpl)
+    kAddPrivateVMethod(kHeightCodec, kStream, VWriteImpl)
+    kAddPrivateVMethod(kHeightCodec, kStream, VFlush)
+
+    kAddPrivateIVMethod(kHeightCodec, kCompressor, VCompressionType, VCompressionType)
+    kAddPrivateIVMethod(kHeightCodec, kCompressor, VRequiredVersion, VRequiredVersion)
+    kAddPrivateIVMethod(kHeightCodec, kCompressor, VConstruct, VConstruct)
+    kAddPrivateIVMethod(kHeightCodec, kCompressor, VBeginWrite, VBeginWrite)
+    kAddPrivateIVMethod(kHeightCodec, kCompressor, VFinishWrite, VFinishWrite)
+    kAddPrivateIVMethod(kHeightCodec, kCompressor, VFinishRead, VFinishRead)
+kEndClassEx()
+
+kFx(kStatus) kHeightCodec_Encode(kArray2 heights, kArray1* encoded, kAlloc allocator)
+{
+    kAlloc alloc = kAlloc_Fallback(allocator);
+    kSize length = kArray2_Length(heights, 0);
+    kSize width = kArray2_Length(heights, 1);
+    xkHeightCodecJob job;
+    kArray1 output = kNULL;
+    kByte* data = kNULL;
+    kStatus status;
+
+    kCheckArgs(kArray2_ItemType(heights) == kTypeOf(k16s));
+    kCheckArgs((length <= k32U_MAX) && (width <= k32U_MAX));
+
+    kCheck(xkHeightCodec_BeginEncode(&job, kArray2_DataT(heights, k16s), length*width, width, alloc));
+
+    kTry
+    {
+        kTest(kArray1_Construct(&output, kTypeOf(kByte), xkHEIGHT_CODEC_ARRAY_HEADER_SIZE + xkHeightCodec_EncodedSize(&job), alloc));
+
+        data = kArray1_DataT(output, kByte);
+
+        xkHeightCodec_Write32u(&data[0], xkHEIGHT_CODEC_MAGIC);
+        xkHeightCodec_Write32u(&data[4], (k32u)length);
+        xkHeightCodec_Write32u(&data[8], (k32u)width);
+        xkHeightCodec_Write32u(&data[12], 0);
+    }
+    kCatch(&status)
+    {
+        kObject_Destroy(output);
+        xkHeightCodec_EndEncode(&job, kNULL);
+        kEndCatch(status);
+    }
+
+    kCheck(xkHeightCodec_EndEncode(&job, &data[xkHEIGHT_CODEC_ARRAY_HEADER_SIZE]));
+
+    *encoded = output;
+
+    return kOK;
+}
+
+kFx(kStatus) kHeightCodec_Decode(kArray1 encoded, kArray2* heights, kAlloc allocator)
+{
+    kAlloc alloc = kAlloc_Fallback(allocator);
+    const kByte* data = kArray1_DataT(encoded, kByte);
+    kSize size = kArray1_Length(encoded);
+    kArray2 output = kNULL;
+    kSize length, width;
+    kStatus status;
+
+    kCheckArgs(kArray1_ItemType(encoded) == kTypeOf(kByte));
+    kCheckTrue(size >= xkHEIGHT_CODEC_ARRAY_HEADER_SIZE, kERROR_FORMAT);
+    kCheckTrue(xkHeightCodec_Read32u(&data[0]) == xkHEIGHT_CODEC_MAGIC, kERROR_FORMAT);
+
+    length = xkHeightCodec_Read32u(&data[4]);
+    width = xkHeightCodec_Read32u(&data[8]);
+
+    //validate the header before allocating, so that a corrupt stream cannot request an arbitrary amount of memory
+    kCheckTrue((width == 0) ? (length == 0) : (length <= kSIZE_MAX/sizeof(k16s)/width), kERROR_FORMAT);
+    kCheck(xkHeightCodec_CheckEncodedSize(size - xkHEIGHT_CODEC_ARRAY_HEADER_SIZE, length*width, width));
+
+    kCheck(kArray2_Construct(&output, kTypeOf(k16s), length, width, alloc));
+
+    kTry
+    {
+        kTest(xkHeightCodec_DecodeSamples(&data[xkHEIGHT_CODEC_ARRAY_HEADER_SIZE], size - xkHEIGHT_CODEC_ARRAY_HEADER_SIZE,
+            kArray2_DataT(output, k16s), length*width, width, alloc));
+    }
+    kCatch(&status)
+    {
+        kObject_Destroy(output);
+        kEndCatch(status);
+    }
+
+    *heights = output;
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_BeginEncode(xkHeightCodecJob* job, const k16s* samples, kSize count, kSize width, kAlloc alloc)
+{
+    kStatus status;
+
+    kCheckArgs((count == 0) || (width > 0));
+
+    kMemSet(job, 0, sizeof(xkHeightCodecJob));
+
+    job->input = samples;
+    job->count = count;
+    job->width = width;
+    job->rowCount = (count == 0) ? 0 : kDivideCeilUInt_(count, width);
+    job->bandRows = (width == 0) ? 1 : kMax_(1, kDivideCeilUInt_(xkHEIGHT_CODEC_BAND_SAMPLES, width));
+    job->bandCount = kDivideCeilUInt_(job->rowCount, job->bandRows);
+    job->alloc = alloc;
+
+    kCheckTrue(job->bandCount <= k32U_MAX, kERROR_PARAMETER);
+
+    kTry
+    {
+        if (job->bandCount > 0)
+        {
+            kTest(kAlloc_GetZero(alloc, job->bandCount*sizeof(kByte*), &job->bandBuffers));
+            kTest(kAlloc_GetZero(alloc, job->bandCount*sizeof(kSize), &job->bandCapacities));
+            kTest(kAlloc_GetZero(alloc, job->bandCount*sizeof(kSize), &job->bandSizes));
+
+            if ((count >= xkHEIGHT_CODEC_PARALLEL_MIN) && (job->bandCount > 1))
+            {
+                kTest(kParallel_Execute(xkHeightCodec_OnEncodeBands, kNULL, job));
+            }
+            else
+            {
+                kTest(kParallel_ExecuteDirect(xkHeightCodec_OnEncodeBands, kNULL, job));
+            }
+        }
+    }
+    kCatch(&status)
+    {
+        xkHeightCodec_EndEncode(job, kNULL);
+        kEndCatch(status);
+    }
+
+    return kOK;
+}
+
+kFx(kSize) xkHeightCodec_EncodedSize(const xkHeightCodecJob* job)
+{
+    kSize size = 8 + 4*job->bandCount;
+    kSize i;
+
+    for (i = 0; i < job->bandCount; ++i)
+    {
+        size += job->bandSizes[i];
+    }
+
+    return size;
+}
+
+kFx(kStatus) xkHeightCodec_EndEncode(xkHeightCodecJob* job, kByte* output)
+{
+    kSize i;
+
+    if (!kIsNull(output))
+    {
+        xkHeightCodec_Write32u(&output[0], (k32u)job->bandRows);
+        xkHeightCodec_Write32u(&output[4], (k32u)job->bandCount);
+        output += 8;
+
+        for (i = 0; i < job->bandCount; ++i)
+        {
+            xkHeightCodec_Write32u(output, (k32u)job->bandSizes[i]);
+            output += 4;
+        }
+
+        for (i = 0; i < job->bandCount; ++i)
+        {
+            kMemCopy(output, job->bandBuffers[i], job->bandSizes[i]);
+            output += job->bandSizes[i];
+        }
+    }
+
+    if (!kIsNull(job->bandBuffers))
+    {
+        for (i = 0; i < job->bandCount; ++i)
+        {
+            kAlloc_FreeRef(job->alloc, &job->bandBuffers[i]);
+        }
+    }
+
+    kAlloc_FreeRef(job->alloc, &job->bandBuffers);
+    kAlloc_FreeRef(job->alloc, &job->bandCapacities);
+    kAlloc_FreeRef(job->alloc, &job->bandSizes);
+
+    return kOK;
+}
+
+// Rejects sample counts that an encoded payload of the given size cannot describe. Every row needs at 
+// least a predictor byte, a run count, and runs covering the row; a row without valid samples is the 
+// smallest case, so the check bounds output allocation by the payload size up to the row width. 
+kFx(kStatus) xkHeightCodec_CheckEncodedSize(kSize size, kSize count, kSize width)
+{
+    kSize fullRows, partialRow, rowSize;
+
+    kCheckTrue((count == 0) || (width > 0), kERROR_FORMAT);
+    kCheckTrue(count <= kSIZE_MAX/sizeof(k16s), kERROR_FORMAT);
+    kCheckTrue(size >= 8, kERROR_FORMAT);
+
+    if (count == 0)
+    {
+        return kOK;
+    }
+
+    fullRows = count/width;
+    partialRow = count % width;
+    rowSize = 3 + xkHeightCodec_VarintSize(width);
+
+    kCheckTrue(fullRows <= (size - 8)/rowSize, kERROR_FORMAT);
+
+    if (partialRow > 0)
+    {
+        kCheckTrue((size - 8 - fullRows*rowSize) >= 3 + xkHeightCodec_VarintSize(partialRow), kERROR_FORMAT);
+    }
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_DecodeSamples(const kByte* data, kSize size, k16s* samples, kSize count, kSize width, kAlloc alloc)
+{
+    xkHeightCodecJob job;
+    const kByte* bandData = kNULL;
+    kSize remaining;
+    kSize i;
+
+    kCheckTrue(size >= 8, kERROR_FORMAT);
+    kCheckTrue((count == 0) || (width > 0), kERROR_FORMAT);
+
+    kMemSet(&job, 0, sizeof(xkHeightCodecJob));
+
+    job.output = samples;
+    job.count = count;
+    job.width = width;
+    job.rowCount = (count == 0) ? 0 : kDivideCeilUInt_(count, width);
+    job.bandRows = xkHeightCodec_Read32u(&data[0]);
+    job.bandCount = xkHeightCodec_Read32u(&data[4]);
+    job.alloc = alloc;
+
+    kCheckTrue(job.bandRows > 0, kERROR_FORMAT);
+    kCheckTrue(job.bandCount == kDivideCeilUInt_(job.rowCount, job.bandRows), kERROR_FORMAT);
+    kCheckTrue((size - 8)/4 >= job.bandCount, kERROR_FORMAT);
+
+    if (job.bandCount == 0)
+    {
+        return kOK;
+    }
+
+    bandData = &data[8 + 4*job.bandCount];
+    remaining = size - 8 - 4*job.bandCount;
+
+    kTry
+    {
+        kTest(kAlloc_Get(alloc, job.bandCount*sizeof(kSize), &job.bandSizes));
+        kTest(kAlloc_Get(alloc, job.bandCount*sizeof(const kByte*), &job.bandData));
+
+        for (i = 0; i < job.bandCount; ++i)
+        {
+            job.bandSizes[i] = xkHeightCodec_Read32u(&data[8 + 4*i]);
+            job.bandData[i] = bandData;
+
+            kTestTrue(job.bandSizes[i] <= remaining, kERROR_FORMAT);
+
+            bandData += job.bandSizes[i];
+            remaining -= job.bandSizes[i];
+        }
+
+        if ((count >= xkHEIGHT_CODEC_PARALLEL_MIN) && (job.bandCount > 1))
+        {
+            kTest(kParallel_Execute(xkHeightCodec_OnDecodeBands, kNULL, &job));
+        }
+        else
+        {
+            kTest(kParallel_ExecuteDirect(xkHeightCodec_OnDecodeBands, kNULL, &job));
+        }
+    }
+    kFinally
+    {
+        kAlloc_FreeRef(alloc, &job.bandSizes);
+        kAlloc_FreeRef(alloc, &job.bandData);
+
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_OnEncodeBands(kPointer receiver, kParallel sender, kParallelArgs* args)
+{
+    xkHeightCodecJob* job = (xkHeightCodecJob*) args->content;
+    kSize begin = kParallelArgs_Begin(args, 0, job->bandCount);
+    kSize end = kParallelArgs_End(args, 0, job->bandCount);
+    kSize i;
+
+    for (i = begin; i < end; ++i)
+    {
+        kCheck(xkHeightCodec_EncodeBand(job, i));
+    }
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_OnDecodeBands(kPointer receiver, kParallel sender, kParallelArgs* args)
+{
+    xkHeightCodecJob* job = (xkHeightCodecJob*) args->content;
+    kSize begin = kParallelArgs_Begin(args, 0, job->bandCount);
+    kSize end = kParallelArgs_End(args, 0, job->bandCount);
+    kSize i;
+
+    for (i = begin; i < end; ++i)
+    {
+        kCheck(xkHeightCodec_DecodeBand(job, i));
+    }
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_EncodeBand(xkHeightCodecJob* job, kSize band)
+{
+    kSize width = job->width;
+    kSize firstRow = band*job->bandRows;
+    kSize lastRow = kMin_(firstRow + job->bandRows, job->rowCount);
+    kSize rowWorstCase = 16 + 5*(width + 1) + 2*width + kDivideCeilUInt_(width, xkHEIGHT_CODEC_BLOCK_SIZE);
+    kSize bandSamples = kMin_((lastRow - firstRow)*width, job->count - firstRow*width);
+    kByte* scratch = kNULL;
+    k16s* context[2];
+    k16u* residuals = kNULL;
+    k32u* runs = kNULL;
+    kByte* buffer = kNULL;
+    kSize capacity = kMax_(rowWorstCase, bandSamples);
+    kSize used = 0;
+    kSize row;
+    kStatus status;
+
+    kCheck(kAlloc_Get(job->alloc, 2*width*sizeof(k16s) + (width + xkHEIGHT_CODEC_BLOCK_SIZE)*sizeof(k16u) + (width + 2)*sizeof(k32u), &scratch));
+
+    context[0] = (k16s*)scratch;
+    context[1] = context[0] + width;
+    runs = (k32u*)(context[1] + width);
+    residuals = (k16u*)(runs + width + 2);
+
+    kTry
+    {
+        kTest(kAlloc_Get(job->alloc, capacity, &buffer));
+
+        for (row = firstRow; row < lastRow; ++row)
+        {
+            const k16s* input = &job->input[row*width];
+            kSize length = kMin_(width, job->count - row*width);
+            const k16s* up = (row == firstRow) ? kNULL : context[(row - 1) & 1];
+
+            if ((capacity - used) < rowWorstCase)
+            {
+                kByte* grown = kNULL;
+                kSize grownCapacity = kMax_(2*capacity, used + rowWorstCase);
+
+                kTest(kAlloc_Get(job->alloc, grownCapacity, &grown));
+                kMemCopy(grown, buffer, used);
+                kAlloc_FreeRef(job->alloc, &buffer);
+
+                buffer = grown;
+                capacity = grownCapacity;
+            }
+
+            used = (kSize)(xkHeightCodec_EncodeRow(&buffer[used], input, length, up, context[row & 1], residuals, runs) - buffer);
+        }
+
+        kTestTrue(used <= k32U_MAX, kERROR_PARAMETER);
+
+        job->bandBuffers[band] = buffer;
+        job->bandCapacities[band] = capacity;
+        job->bandSizes[band] = used;
+    }
+    kCatch(&status)
+    {
+        kAlloc_FreeRef(job->alloc, &buffer);
+        kAlloc_FreeRef(job->alloc, &scratch);
+        kEndCatch(status);
+    }
+
+    kAlloc_FreeRef(job->alloc, &scratch);
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_DecodeBand(xkHeightCodecJob* job, kSize band)
+{
+    kSize width = job->width;
+    kSize firstRow = band*job->bandRows;
+    kSize lastRow = kMin_(firstRow + job->bandRows, job->rowCount);
+    const kByte* reader = job->bandData[band];
+    const kByte* end = reader + job->bandSizes[band];
+    kByte* scratch = kNULL;
+    k16s* context[2];
+    k16u* residuals = kNULL;
+    k32u* runs = kNULL;
+    kSize row;
+    kStatus status = kOK;
+
+    kCheck(kAlloc_Get(job->alloc, 2*width*sizeof(k16s) + (width + xkHEIGHT_CODEC_BLOCK_SIZE)*sizeof(k16u) + (width + 2)*sizeof(k32u), &scratch));
+
+    context[0] = (k16s*)scratch;
+    context[1] = context[0] + width;
+    runs = (k32u*)(context[1] + width);
+    residuals = (k16u*)(runs + width + 2);
+
+    for (row = firstRow; (row < lastRow) && kSuccess(status); ++row)
+    {
+        kSize length = kMin_(width, job->count - row*width);
+        const k16s* up = (row == firstRow) ? kNULL : context[(row - 1) & 1];
+
+        status = xkHeightCodec_DecodeRow(&reader, end, &job->output[row*width], length, up, context[row & 1], residuals, runs);
+    }
+
+    if (kSuccess(status) && (reader != end))
+    {
+        status = kERROR_FORMAT;
+    }
+
+    kAlloc_FreeRef(job->alloc, &scratch);
+
+    return status;
+}
+
+kFx(kByte*) xkHeightCodec_EncodeRow(kByte* writer, const k16s* row, kSize length, const k16s* up, k16s* context, k16u* residuals, k32u* runs)
+{
+    k16u* leftResiduals = residuals;
+    k64u leftCost = 0, upCost = 0, paethCost = 0;
+    k32s fill = kIsNull(up) ? 0 : up[0];
+    k32s left = fill;
+    k32s upLeft = fill;
+    kSize runCount = 0;
+    kSize validCount = 0;
+    kSize runStart = 0;
+    kBool inValidRun = kTRUE;
+    k32u predictor = xkHEIGHT_CODEC_PREDICT_LEFT;
+    kSize c, i;
+
+    //first pass: invalid runs, context row, and residual cost of each predictor
+    for (c = 0; c < length; ++c)
+    {
+        k32s x = row[c];
+        kBool valid = (x != k16S_NULL);
+
+        if (valid != inValidRun)
+        {
+            runs[runCount++] = (k32u)(c - runStart);
+            runStart = c;
+            inValidRun = valid;
+        }
+
+        if (valid)
+        {
+            leftResiduals[validCount++] = xkHeightCodec_ZigZag(x - left);
+            leftCost += leftResiduals[validCount-1];
+
+            if (!kIsNull(up))
+            {
+                upCost += xkHeightCodec_ZigZag(x - up[c]);
+                paethCost += xkHeightCodec_ZigZag(x - xkHeightCodec_Paeth(left, up[c], upLeft));
+            }
+
+            left = x;
+        }
+
+        context[c] = (k16s)left;
+
+        if (!kIsNull(up))
+        {
+            upLeft = up[c];
+        }
+    }
+
+    runs[runCount++] = (k32u)(length - runStart);
+
+    //select the cheapest predictor and recompute residuals if it isn't the left predictor
+    if (!kIsNull(up) && ((upCost < leftCost) || (paethCost < leftCost)))
+    {
+        predictor = (upCost <= paethCost) ? xkHEIGHT_CODEC_PREDICT_UP : xkHEIGHT_CODEC_PREDICT_PAETH;
+
+        left = fill;
+        upLeft = fill;
+        validCount = 0;
+
+        for (c = 0; c < length; ++c)
+        {
+            k32s x = row[c];
+
+            if (x != k16S_NULL)
+            {
+                k32s prediction = (predictor == xkHEIGHT_CODEC_PREDICT_UP) ? up[c] : xkHeightCodec_Paeth(left, up[c], upLeft);
+
+                residuals[validCount++] = xkHeightCodec_ZigZag(x - prediction);
+            }
+
+            left = context[c];
+            upLeft = up[c];
+        }
+    }
+
+    *writer++ = (kByte)predictor;
+
+    writer = xkHeightCodec_WriteVarint(writer, (k32u)runCount);
+
+    for (i = 0; i < runCount; ++i)
+    {
+        writer = xkHeightCodec_WriteVarint(writer, runs[i]);
+    }
+
+    for (i = 0; i < validCount; i += xkHEIGHT_CODEC_BLOCK_SIZE)
+    {
+        writer = xkHeightCodec_PackBlock(writer, &residuals[i], kMin_(validCount - i, (kSize)xkHEIGHT_CODEC_BLOCK_SIZE));
+    }
+
+    return writer;
+}
+
+kFx(kStatus) xkHeightCodec_DecodeRow(const kByte** reader, const kByte* end, k16s* row, kSize length, const k16s* up, k16s* context, k16u* residuals, k32u* runs)
+{
+    const kByte* it = *reader;
+    k32s fill = kIsNull(up) ? 0 : up[0];
+    k32s left = fill;
+    k32u predictor, runCount;
+    kSize validCount = 0;
+    kSize total = 0;
+    kSize c = 0, r = 0;
+    kSize i, j;
+
+    kCheckTrue(it < end, kERROR_FORMAT);
+
+    predictor = *it++;
+
+    kCheckTrue(predictor <= xkHEIGHT_CODEC_PREDICT_PAETH, kERROR_FORMAT);
+    kCheckTrue(!kIsNull(up) || (predictor == xkHEIGHT_CODEC_PREDICT_LEFT), kERROR_FORMAT);
+
+    kCheck(xkHeightCodec_ReadVarint(&it, end, &runCount));
+    kCheckTrue(runCount <= length + 1, kERROR_FORMAT);
+
+    for (i = 0; i < runCount; ++i)
+    {
+        kCheck(xkHeightCodec_ReadVarint(&it, end, &runs[i]));
+
+        total += runs[i];
+        kCheckTrue(total <= length, kERROR_FORMAT);
+
+        if ((i & 1) == 0)
+        {
+            validCount += runs[i];
+        }
+    }
+
+    kCheckTrue(total == length, kERROR_FORMAT);
+
+    for (i = 0; i < validCount; i += xkHEIGHT_CODEC_BLOCK_SIZE)
+    {
+        kCheck(xkHeightCodec_UnpackBlock(&it, end, &residuals[i], kMin_(validCount - i, (kSize)xkHEIGHT_CODEC_BLOCK_SIZE)));
+    }
+
+    for (i = 0; i < runCount; ++i)
+    {
+        kSize runEnd = c + runs[i];
+
+        if ((i & 1) == 0)
+        {
+            if (predictor == xkHEIGHT_CODEC_PREDICT_LEFT)
+            {
+                for (j = c; j < runEnd; ++j)
+                {
+                    left = (k16s)(left + xkHeightCodec_UnZigZag(residuals[r++]));
+                    row[j] = context[j] = (k16s)left;
+                }
+            }
+            else if (predictor == xkHEIGHT_CODEC_PREDICT_UP)
+            {
+                for (j = c; j < runEnd; ++j)
+                {
+                    left = (k16s)(up[j] + xkHeightCodec_UnZigZag(residuals[r++]));
+                    row[j] = context[j] = (k16s)left;
+                }
+            }
+            else
+            {
+                for (j = c; j < runEnd; ++j)
+                {
+                    k32s upLeft = (j == 0) ? fill : up[j-1];
+
+                    left = (k16s)(xkHeightCodec_Paeth(left, up[j], upLeft) + xkHeightCodec_UnZigZag(residuals[r++]));
+                    row[j] = context[j] = (k16s)left;
+                }
+            }
+        }
+        else
+        {
+            for (j = c; j < runEnd; ++j)
+            {
+                row[j] = k16S_NULL;
+                context[j] = (k16s)left;
+            }
+        }
+
+        c = runEnd;
+    }
+
+    *reader = it;
+
+    return kOK;
+}
+
+kFx(kByte*) xkHeightCodec_PackBlock(kByte* writer, const k16u* values, kSize count)
+{
+    k32u combined = 0;
+    k32u bits = 0;
+    k64u accumulator = 0;
+    k32u filled = 0;
+    kSize i;
+
+    for (i = 0; i < count; ++i)
+    {
+        combined |= values[i];
+    }
+
+    while (combined != 0)
+    {
+        bits++;
+        combined >>= 1;
+    }
+
+    *writer++ = (kByte)bits;
+
+    if (bits == 0)
+    {
+        return writer;
+    }
+
+    for (i = 0; i < count; ++i)
+    {
+        accumulator |= (k64u)values[i] << filled;
+        filled += bits;
+
+        while (filled >= 8)
+        {
+            *writer++ = (kByte)accumulator;
+            accumulator >>= 8;
+            filled -= 8;
+        }
+    }
+
+    //a partial final block is padded to a whole byte
+    if (filled > 0)
+    {
+        *writer++ = (kByte)accumulator;
+    }
+
+    return writer;
+}
+
+kFx(kStatus) xkHeightCodec_UnpackBlock(const kByte** reader, const kByte* end, k16u* values, kSize count)
+{
+    const kByte* it = *reader;
+    k32u bits, mask;
+    k64u accumulator = 0;
+    k32u filled = 0;
+    kSize i;
+
+    kCheckTrue(it < end, kERROR_FORMAT);
+
+    bits = *it++;
+
+    kCheckTrue(bits <= xkHEIGHT_CODEC_MAX_BITS, kERROR_FORMAT);
+    kCheckTrue((kSize)(end - it) >= kDivideCeilUInt_(count*bits, 8), kERROR_FORMAT);
+
+    if (bits == 0)
+    {
+        kMemSet(values, 0, count*sizeof(k16u));
+    }
+    else
+    {
+        mask = (1u << bits) - 1;
+
+        for (i = 0; i < count; ++i)
+        {
+            while (filled < bits)
+            {
+                accumulator |= (k64u)(*it++) << filled;
+                filled += 8;
+            }
+
+            values[i] = (k16u)(accumulator & mask);
+            accumulator >>= bits;
+            filled -= bits;
+        }
+    }
+
+    *reader = it;
+
+    return kOK;
+}
+
+/*
+ * kCompressor implementation
+ */
+
+kFx(kCompressionType) xkHeightCodec_VCompressionType()
+{
+    return kCOMPRESSION_TYPE_HEIGHT16;
+}
+
+kFx(kVersion) xkHeightCodec_VRequiredVersion()
+{
+    return kVersion_Create(10, 1, 4, 0);
+}
+
+kFx(kStatus) xkHeightCodec_VConstruct(kObject* compressor, kStream stream, kBool isWriter, k32s level, kAlloc allocator)
+{
+    kAlloc alloc = kAlloc_Fallback(allocator);
+    kStatus status;
+
+    kCheck(kAlloc_GetObject(alloc, kTypeOf(kHeightCodec), compressor));
+
+    if (!kSuccess(status = xkHeightCodec_Init(*compressor, kTypeOf(kHeightCodec), stream, isWriter, level, alloc)))
+    {
+        kAlloc_FreeRef(alloc, compressor);
+    }
+
+    return status;
+}
+
+kFx(kStatus) xkHeightCodec_Init(kHeightCodec codec, kType type, kStream stream, kBool isWriter, k32s level, kAlloc alloc)
+{
+    kObjR(kHeightCodec, codec);
+
+    kCheck(kStream_Init(codec, type, alloc));
+
+    obj->stream = stream;
+    obj->isWriter = isWriter;
+    obj->width = 0;
+    obj->frame = kNULL;
+    obj->frameCapacity = 0;
+    obj->frameLoaded = kFALSE;
+    obj->scratch = kNULL;
+    obj->scratchCapacity = 0;
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_VRelease(kHeightCodec codec)
+{
+    kObj(kHeightCodec, codec);
+
+    kCheck(kObject_FreeMemRef(codec, &obj->frame));
+    kCheck(kObject_FreeMemRef(codec, &obj->scratch));
+
+    kCheck(kStream_VRelease(codec));
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_Reserve(kHeightCodec codec, kByte** buffer, kSize* capacity, kSize size, kBool preserve)
+{
+    kByte* grown = kNULL;
+    kSize grownCapacity;
+
+    if (size <= *capacity)
+    {
+        return kOK;
+    }
+
+    grownCapacity = kMax_(kMax_(2*(*capacity), size), (kSize)xkHEIGHT_CODEC_MIN_FRAME_CAPACITY);
+
+    kCheck(kObject_GetMem(codec, grownCapacity, &grown));
+
+    if (preserve && (*capacity > 0))
+    {
+        kMemCopy(grown, *buffer, *capacity);
+    }
+
+    kObject_FreeMemRef(codec, buffer);
+
+    *buffer = grown;
+    *capacity = grownCapacity;
+
+    return kOK;
+}
+
+// Grows the frame buffer of a writer. The kStream write buffer refers directly to the frame buffer,
+// so that small writes are handled inline by kStream_Write; it must follow every reallocation.
+kFx(kStatus) xkHeightCodec_ReserveFrame(kHeightCodec codec, kSize size)
+{
+    kObj(kHeightCodec, codec);
+
+    kCheck(xkHeightCodec_Reserve(codec, &obj->frame, &obj->frameCapacity, size, kTRUE));
+
+    obj->base.writeBuffer = obj->frame;
+    obj->base.writeCapacity = obj->frameCapacity;
+    obj->base.writeEnd = obj->frameCapacity;
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_VWriteImpl(kHeightCodec codec, const void* buffer, kSize size)
+{
+    kObj(kHeightCodec, codec);
+
+    kCheckState(obj->isWriter);
+
+    //frame content is accumulated until kCompressor_FinishWrite
+    kCheck(xkHeightCodec_ReserveFrame(codec, obj->base.writeBegin + size));
+
+    kMemCopy(&obj->frame[obj->base.writeBegin], buffer, size);
+    obj->base.writeBegin += size;
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_VFlush(kHeightCodec codec)
+{
+    kObj(kHeightCodec, codec);
+
+    return kStream_Flush(obj->stream);
+}
+
+kFx(kSize) xkHeightCodec_SelectLead(const kByte* data, kSize size)
+{
+    kSize count = kMin_((size - 1)/2, (kSize)xkHEIGHT_CODEC_PHASE_SAMPLES);
+    k64u cost[2] = { 0, 0 };
+    kSize lead, i;
+
+    //serialized object headers can leave height samples at an odd offset; pick the alignment
+    //under which neighbouring 16-bit values are most similar
+    for (lead = 0; lead < 2; ++lead)
+    {
+        k32s previous = (k16s)(data[lead] | (data[lead + 1] << 8));
+
+        for (i = 1; i < count; ++i)
+        {
+            k32s value = (k16s)(data[lead + 2*i] | (data[lead + 2*i + 1] << 8));
+
+            cost[lead] += (k64u)kAbs_(value - previous);
+            previous = value;
+        }
+    }
+
+    return (cost[1] < cost[0]) ? 1 : 0;
+}
+
+kFx(kStatus) xkHeightCodec_VBeginWrite(kObject compressor, kObject object)
+{
+    kObj(kHeightCodec, compressor);
+
+    kCheckState(obj->isWriter);
+
+    //rows of arrays and images are predicted from the rows above them
+    if (kObject_Is(object, kTypeOf(kArray2)))
+    {
+        obj->width = kArray2_Length(object, 1);
+    }
+    else if (kObject_Is(object, kTypeOf(kArray3)))
+    {
+        obj->width = kArray3_Length(object, 2);
+    }
+    else if (kObject_Is(object, kTypeOf(kImage)))
+    {
+        obj->width = kImage_Width(object);
+    }
+    else
+    {
+        obj->width = 0;
+    }
+
+    return kOK;
+}
+
+// Estimates the row width of height samples embedded in an object of unknown layout (e.g., a
+// message that contains a height map), as the offset at which samples best predict one another.
+// Offsets that are multiples of the row width predict almost as well, so ties favour the smallest.
+kFx(kSize) xkHeightCodec_EstimateWidth(const k16s* samples, kSize count)
+{
+    kSize maxWidth = kMin_(count/2, (kSize)xkHEIGHT_CODEC_MAX_ESTIMATED_WIDTH);
+    kSize bestWidth = 0;
+    k64u bestCost = k64U_MAX;
+    kSize stride, width, i;
+
+    if (maxWidth < 2)
+    {
+        return kMax_(count, 1);
+    }
+
+    stride = kMax_(1, (count - maxWidth)/xkHEIGHT_CODEC_ESTIMATE_SAMPLES);
+
+    for (width = 1; width <= maxWidth; ++width)
+    {
+        k64u cost = 0;
+
+        for (i = maxWidth; (i < count) && (cost < bestCost); i += stride)
+        {
+            cost += (k64u)kAbs_((k32s)samples[i] - (k32s)samples[i - width]);
+        }
+
+        if (cost < bestCost)
+        {
+            bestCost = cost;
+            bestWidth = width;
+        }
+    }
+
+    //without vertical correlation, rows only serve to bound scratch buffers
+    return (bestWidth <= 1) ? kMin_(count, (kSize)xkHEIGHT_CODEC_STREAM_WIDTH) : bestWidth;
+}
+
+kFx(kStatus) xkHeightCodec_VFinishWrite(kObject compressor)
+{
+    kObj(kHeightCodec, compressor);
+    kSize rawSize = obj->base.writeBegin;
+    kSize lead = (rawSize >= 4) ? xkHeightCodec_SelectLead(obj->frame, rawSize) : 0;
+    kSize count = (rawSize - lead)/2;
+    kSize tail = rawSize - lead - 2*count;
+    kSize width = obj->width;
+    const k16s* samples = kNULL;
+    k16s* aligned = kNULL;
+    kByte* header = kNULL;
+    xkHeightCodecJob job;
+    kSize blobSize;
+    kSize i;
+
+    kCheckState(obj->isWriter);
+
+    if ((lead != 0) || (K_ENDIANNESS != kENDIANNESS_LITTLE))
+    {
+        //re-align samples (and convert to host byte order) in place, after the frame content
+        kCheck(xkHeightCodec_ReserveFrame(compressor, rawSize + 2*count + 2));
+
+        aligned = (k16s*)&obj->frame[kSize_Align(rawSize, 1)];
+
+        for (i = 0; i < count; ++i)
+        {
+            aligned[i] = (k16s)(obj->frame[lead + 2*i] | (obj->frame[lead + 2*i + 1] << 8));
+        }
+
+        samples = aligned;
+    }
+    else
+    {
+        samples = (const k16s*)obj->frame;
+    }
+
+    if (width == 0)
+    {
+        width = xkHeightCodec_EstimateWidth(samples, count);
+    }
+
+    kCheck(xkHeightCodec_BeginEncode(&job, samples, count, width, kObject_Alloc(compressor)));
+
+    blobSize = xkHeightCodec_EncodedSize(&job);
+
+    if (!kSuccess(xkHeightCodec_Reserve(compressor, &obj->scratch, &obj->scratchCapacity, xkHEIGHT_CODEC_FRAME_HEADER_SIZE + blobSize, kFALSE)))
+    {
+        xkHeightCodec_EndEncode(&job, kNULL);
+        return kERROR_MEMORY;
+    }
+
+    header = obj->scratch;
+
+    xkHeightCodec_Write64u(&header[0], rawSize);
+    xkHeightCodec_Write64u(&header[8], blobSize);
+    xkHeightCodec_Write32u(&header[16], (k32u)width);
+    header[20] = (kByte)((lead ? xkHEIGHT_CODEC_FLAG_LEAD : 0) | (tail ? xkHEIGHT_CODEC_FLAG_TAIL : 0));
+    header[21] = lead ? obj->frame[0] : 0;
+    header[22] = tail ? obj->frame[rawSize - 1] : 0;
+    header[23] = 0;
+
+    kCheck(xkHeightCodec_EndEncode(&job, &obj->scratch[xkHEIGHT_CODEC_FRAME_HEADER_SIZE]));
+
+    kCheck(kStream_Write(obj->stream, obj->scratch, xkHEIGHT_CODEC_FRAME_HEADER_SIZE + blobSize));
+
+    obj->base.bytesWritten += rawSize;
+    obj->base.writeBegin = 0;
+    obj->width = 0;
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_LoadFrame(kHeightCodec codec)
+{
+    kObj(kHeightCodec, codec);
+    kByte header[xkHEIGHT_CODEC_FRAME_HEADER_SIZE];
+    k64u rawSize, blobSize;
+    kSize width, lead, tail, count;
+    k16s* aligned = kNULL;
+
+    kCheck(kStream_Read(obj->stream, header, sizeof(header)));
+
+    rawSize = xkHeightCodec_Read64u(&header[0]);
+    blobSize = xkHeightCodec_Read64u(&header[8]);
+    width = xkHeightCodec_Read32u(&header[16]);
+    lead = (header[20] & xkHEIGHT_CODEC_FLAG_LEAD) ? 1 : 0;
+    tail = (header[20] & xkHEIGHT_CODEC_FLAG_TAIL) ? 1 : 0;
+
+    kCheckTrue((rawSize <= kSIZE_MAX/2) && (blobSize <= kSIZE_MAX/2), kERROR_FORMAT);
+    kCheckTrue(rawSize >= lead + tail, kERROR_FORMAT);
+    kCheckTrue(((rawSize - lead - tail) % 2) == 0, kERROR_FORMAT);
+
+    count = (kSize)(rawSize - lead - tail)/2;
+
+    //encoded data never needs 40 bytes per sample, even for single-sample rows; the frame itself is only 
+    //allocated once its blob has been read and shown to be large enough to describe it
+    kCheckTrue((blobSize >= 8) && ((blobSize - 8)/40 <= count), kERROR_FORMAT);
+
+    kCheck(xkHeightCodec_Reserve(codec, &obj->scratch, &obj->scratchCapacity, (kSize)blobSize, kFALSE));
+    kCheck(kStream_Read(obj->stream, obj->scratch, (kSize)blobSize));
+
+    kCheck(xkHeightCodec_CheckEncodedSize((kSize)blobSize, count, width));
+    kCheck(xkHeightCodec_Reserve(codec, &obj->frame, &obj->frameCapacity, (kSize)rawSize + 2, kFALSE));
+
+    //decode into an aligned location; shift by one byte afterwards if the frame began with an unpaired byte
+    aligned = (k16s*)&obj->frame[lead ? 2 : 0];
+
+    kCheck(xkHeightCodec_DecodeSamples(obj->scratch, (kSize)blobSize, aligned, count, width, kObject_Alloc(codec)));
+
+#if (K_ENDIANNESS != kENDIANNESS_LITTLE)
+    for (kSize i = 0; i < count; ++i)
+    {
+        k16u value = (k16u)aligned[i];
+
+        aligned[i] = (k16s)(k16u)((value >> 8) | (value << 8));
+    }
+#endif
+
+    if (lead)
+    {
+        kCheck(kMemMove(&obj->frame[1], aligned, 2*count));
+        obj->frame[0] = header[21];
+    }
+
+    if (tail)
+    {
+        obj->frame[rawSize - 1] = header[22];
+    }
+
+    obj->base.readBuffer = obj->frame;
+    obj->base.readCapacity = obj->frameCapacity;
+    obj->base.readBegin = 0;
+    obj->base.readEnd = (kSize)rawSize;
+    obj->base.bytesRead += rawSize;
+
+    obj->frameLoaded = kTRUE;
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_VReadSomeImpl(kHeightCodec codec, void* buffer, kSize minCount, kSize maxCount, kSize* bytesRead)
+{
+    kObj(kHeightCodec, codec);
+    kByte* writer = (kByte*)buffer;
+    kSize copied = 0;
+    kSize available, amount;
+
+    kCheckState(!obj->isWriter);
+
+    available = obj->base.readEnd - obj->base.readBegin;
+    amount = kMin_(available, maxCount);
+
+    kMemCopy(writer, &obj->base.readBuffer[obj->base.readBegin], amount);
+    obj->base.readBegin += amount;
+    copied += amount;
+
+    if (copied < minCount)
+    {
+        //each compressed object is a single frame; reading past the frame indicates a format error
+        kCheckTrue(!obj->frameLoaded, kERROR_STREAM);
+
+        kCheck(xkHeightCodec_LoadFrame(codec));
+
+        available = obj->base.readEnd - obj->base.readBegin;
+        amount = kMin_(available, maxCount - copied);
+
+        kCheckTrue((copied + amount) >= minCount, kERROR_STREAM);
+
+        kMemCopy(&writer[copied], &obj->base.readBuffer[obj->base.readBegin], amount);
+        obj->base.readBegin += amount;
+        copied += amount;
+    }
+
+    if (!kIsNull(bytesRead))
+    {
+        *bytesRead = copied;
+    }
+
+    return kOK;
+}
+
+kFx(kStatus) xkHeightCodec_VFinishRead(kObject compressor)
+{
+    kObj(kHeightCodec, compressor);
+
+    kCheckState(!obj->isWriter);
+
+    //an object that was serialized without content still produces a frame; consume it
+    if (!obj->frameLoaded)
+    {
+        kCheck(xkHeightCodec_LoadFrame(compressor));
+    }
+
+    kCheckTrue(obj->base.readBegin == obj->base.readEnd, kERROR_FORMAT);
+
+    obj->base.bytesRead -= (obj->base.readEnd - obj->base.readBegin);
+    obj->base.readBegin = obj->base.readEnd = 0;
+    obj->frameLoaded = kFALSE;
+
+    return kOK;
+}
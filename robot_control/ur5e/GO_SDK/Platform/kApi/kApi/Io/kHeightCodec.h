@@ -0,0 +1,62 @@
+/**
+ * @file    kHeightCodec.h
+ * @brief   Declares the kHeightCodec class.
+ *
+ * @internal
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef K_API_HEIGHT_CODEC_H
+#define K_API_HEIGHT_CODEC_H
+
+#include <kApi/kApiDef.h>
+#include <kApi/Io/kHeightCodec.x.h>
+
+/**
+ * @class   kHeightCodec
+ * @extends kStream
+ * @ingroup kApi-Io
+ * @brief   Lossless codec for 16-bit height maps.
+ *
+ * kHeightCodec is specialized for kArray2<k16s> surfaces, in which neighbouring heights are strongly
+ * correlated and invalid samples (k16S_NULL) tend to occur in long spans. Each row is predicted from
+ * its left, upper or Paeth neighbour (selected per row), the prediction residuals are zig-zag encoded
+ * and bit-packed in blocks of 32 samples, and invalid spans are run-length coded. Rows are grouped
+ * into independent bands, so that encoding and decoding can be distributed across cores using kParallel.
+ *
+ * kHeightCodec_Encode and kHeightCodec_Decode can be used to convert kArray2<k16s> objects directly.
+ *
+ * The class also implements the kCompressor interface under the kCOMPRESSION_TYPE_HEIGHT16 identifier,
+ * so that it can be selected with kDat6Serializer_EnableCompression or kSaveCompressed6. In that case,
+ * the row width is taken from each serialized object: the column count of a kArray2 (or kArray3, or the
+ * width of a kImage), or, for other objects (e.g., messages that contain a height map), the width under
+ * which the serialized samples best predict one another. The compression level argument is not used.
+ */
+//typedef kStream kHeightCodec;            --forward-declared in kApiDef.x.h
+
+/**
+ * Encodes a height map.
+ *
+ * @public              @memberof kHeightCodec
+ * @param   heights     Height map (kArray2<k16s>).
+ * @param   encoded     Receives encoded bytes (kArray1<kByte>).
+ * @param   allocator   Memory allocator (or kNULL for default).
+ * @return              Operation status.
+ */
+kFx(kStatus) kHeightCodec_Encode(kArray2 heights, kArray1* encoded, kAlloc allocator);
+
+/**
+ * Decodes a height map that was encoded with kHeightCodec_Encode.
+ *
+ * Row bands are decoded in parallel for sufficiently large height maps.
+ *
+ * @public              @memberof kHeightCodec
+ * @param   encoded     Encoded bytes (kArray1<kByte>).
+ * @param   heights     Receives decoded height map (kArray2<k16s>).
+ * @param   allocator   Memory allocator (or kNULL for default).
+ * @return              Operation status.
+ */
+kFx(kStatus) kHeightCodec_Decode(kArray1 encoded, kArray2* heights, kAlloc allocator);
+
+#endif
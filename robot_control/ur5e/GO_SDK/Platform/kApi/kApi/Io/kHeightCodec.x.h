@@ -0,0 +1,220 @@
+/**
+ * @file    kHeightCodec.x.h
+ *
+ * @internal
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef K_API_HEIGHT_CODEC_X_H
+#define K_API_HEIGHT_CODEC_X_H
+
+#include <kApi/Io/kStream.h>
+#include <kApi/Threads/kParallel.h>
+
+#define xkHEIGHT_CODEC_MAGIC                (0x3143484B)    //"KHC1"; leads kHeightCodec_Encode output
+#define xkHEIGHT_CODEC_ARRAY_HEADER_SIZE    (16)            //magic, length, width, reserved
+#define xkHEIGHT_CODEC_FRAME_HEADER_SIZE    (24)            //raw size, blob size, width, flags, lead, tail, reserved
+
+#define xkHEIGHT_CODEC_BLOCK_SIZE           (32)            //residuals per bit-packed block
+#define xkHEIGHT_CODEC_MAX_BITS             (16)            //maximum residual bit width
+#define xkHEIGHT_CODEC_BAND_SAMPLES         (131072)        //target samples per independently coded band
+#define xkHEIGHT_CODEC_PARALLEL_MIN         (262144)        //minimum samples before work is distributed with kParallel
+#define xkHEIGHT_CODEC_STREAM_WIDTH         (4096)          //row width used by the compressor for data without rows
+#define xkHEIGHT_CODEC_MAX_ESTIMATED_WIDTH  (8192)          //largest row width considered when estimating row width
+#define xkHEIGHT_CODEC_ESTIMATE_SAMPLES     (1024)          //samples compared per candidate when estimating row width
+#define xkHEIGHT_CODEC_PHASE_SAMPLES        (65536)         //samples examined when estimating frame alignment
+#define xkHEIGHT_CODEC_MIN_FRAME_CAPACITY   (65536)         //initial capacity of the compressor frame buffer
+
+#define xkHEIGHT_CODEC_PREDICT_LEFT         (0)
+#define xkHEIGHT_CODEC_PREDICT_UP           (1)
+#define xkHEIGHT_CODEC_PREDICT_PAETH        (2)
+
+#define xkHEIGHT_CODEC_FLAG_LEAD            (0x1)           //frame begins with one unpaired byte
+#define xkHEIGHT_CODEC_FLAG_TAIL            (0x2)           //frame ends with one unpaired byte
+
+/*
+ * Encoded band layout (little endian):
+ *
+ *   blob: [k32u bandRows][k32u bandCount][k32u bandSize x bandCount][band data...]
+ *   row:  [k8u predictor][varint runCount][varint run x runCount][bit-packed residual blocks]
+ *   block: [k8u bits][ceil(count x bits / 8) bytes], with count = 32 except for the final block of a row
+ *
+ * Runs alternate between valid and invalid samples, starting with a (possibly empty) valid run.
+ * Residual blocks cover the valid samples of the row only. The first row of each band is predicted
+ * from its left neighbour, so that bands can be decoded independently.
+ */
+
+typedef struct xkHeightCodecJob
+{
+    const k16s* input;              //encoder source samples
+    k16s* output;                   //decoder destination samples
+    kSize count;                    //total sample count
+    kSize width;                    //row width, in samples
+    kSize rowCount;                 //row count (last row may be partial)
+    kSize bandRows;                 //rows per band
+    kSize bandCount;                //band count
+    kByte** bandBuffers;            //encoder: per-band output buffers
+    kSize* bandCapacities;          //encoder: per-band output buffer capacities
+    kSize* bandSizes;               //encoded size of each band
+    const kByte** bandData;         //decoder: start of each encoded band
+    kAlloc alloc;                   //scratch allocator
+} xkHeightCodecJob;
+
+typedef struct kHeightCodecClass
+{
+    kStreamClass base;
+
+    kStream stream;                 //underlying stream
+    kBool isWriter;                 //compression (kTRUE) or decompression (kFALSE)
+    kSize width;                    //writer: row width of the current object, in samples (0 if unknown)
+
+    kByte* frame;                   //uncompressed frame content
+    kSize frameCapacity;            //frame buffer capacity, in bytes
+    kBool frameLoaded;              //reader: has the current frame been decoded?
+
+    kByte* scratch;                 //encoded frame content
+    kSize scratchCapacity;          //scratch buffer capacity, in bytes
+} kHeightCodecClass;
+
+kDeclareClassEx(k, kHeightCodec, kStream)
+
+/*
+* Private methods.
+*/
+
+kFx(kStatus) xkHeightCodec_Init(kHeightCodec codec, kType type, kStream stream, kBool isWriter, k32s level, kAlloc alloc);
+kFx(kStatus) xkHeightCodec_VRelease(kHeightCodec codec);
+
+kFx(kStatus) xkHeightCodec_VReadSomeImpl(kHeightCodec codec, void* buffer, kSize minCount, kSize maxCount, kSize* bytesRead);
+kFx(kStatus) xkHeightCodec_VWriteImpl(kHeightCodec codec, const void* buffer, kSize size);
+kFx(kStatus) xkHeightCodec_VFlush(kHeightCodec codec);
+
+kFx(kCompressionType) xkHeightCodec_VCompressionType();
+kFx(kVersion) xkHeightCodec_VRequiredVersion();
+kFx(kStatus) xkHeightCodec_VConstruct(kObject* compressor, kStream stream, kBool isWriter, k32s level, kAlloc allocator);
+kFx(kStatus) xkHeightCodec_VBeginWrite(kObject compressor, kObject object);
+kFx(kStatus) xkHeightCodec_VFinishWrite(kObject compressor);
+kFx(kStatus) xkHeightCodec_VFinishRead(kObject compressor);
+
+kFx(kStatus) xkHeightCodec_Reserve(kHeightCodec codec, kByte** buffer, kSize* capacity, kSize size, kBool preserve);
+kFx(kStatus) xkHeightCodec_ReserveFrame(kHeightCodec codec, kSize size);
+kFx(kStatus) xkHeightCodec_LoadFrame(kHeightCodec codec);
+kFx(kSize) xkHeightCodec_EstimateWidth(const k16s* samples, kSize count);
+kFx(kSize) xkHeightCodec_SelectLead(const kByte* data, kSize size);
+
+kFx(kStatus) xkHeightCodec_BeginEncode(xkHeightCodecJob* job, const k16s* samples, kSize count, kSize width, kAlloc alloc);
+kFx(kSize) xkHeightCodec_EncodedSize(const xkHeightCodecJob* job);
+kFx(kStatus) xkHeightCodec_EndEncode(xkHeightCodecJob* job, kByte* output);
+kFx(kStatus) xkHeightCodec_CheckEncodedSize(kSize size, kSize count, kSize width);
+kFx(kStatus) xkHeightCodec_DecodeSamples(const kByte* data, kSize size, k16s* samples, kSize count, kSize width, kAlloc alloc);
+
+kFx(kStatus) xkHeightCodec_OnEncodeBands(kPointer receiver, kParallel sender, kParallelArgs* args);
+kFx(kStatus) xkHeightCodec_OnDecodeBands(kPointer receiver, kParallel sender, kParallelArgs* args);
+kFx(kStatus) xkHeightCodec_EncodeBand(xkHeightCodecJob* job, kSize band);
+kFx(kStatus) xkHeightCodec_DecodeBand(xkHeightCodecJob* job, kSize band);
+
+kFx(kByte*) xkHeightCodec_EncodeRow(kByte* writer, const k16s* row, kSize length, const k16s* up, k16s* context, k16u* residuals, k32u* runs);
+kFx(kStatus) xkHeightCodec_DecodeRow(const kByte** reader, const kByte* end, k16s* row, kSize length, const k16s* up, k16s* context, k16u* residuals, k32u* runs);
+
+kFx(kByte*) xkHeightCodec_PackBlock(kByte* writer, const k16u* values, kSize count);
+kFx(kStatus) xkHeightCodec_UnpackBlock(const kByte** reader, const kByte* end, k16u* values, kSize count);
+
+kInlineFx(k16u) xkHeightCodec_ZigZag(k32s residual)
+{
+    k16s r = (k16s)(k16u)residual;
+
+    return (k16u)(((k32s)r * 2) ^ ((k32s)r >> 15));
+}
+
+kInlineFx(k32s) xkHeightCodec_UnZigZag(k16u value)
+{
+    return (k32s)(value >> 1) ^ -(k32s)(value & 1);
+}
+
+kInlineFx(k32s) xkHeightCodec_Paeth(k32s a, k32s b, k32s c)
+{
+    k32s pa = kAbs_(b - c);
+    k32s pb = kAbs_(a - c);
+    k32s pc = kAbs_(a + b - 2*c);
+
+    if ((pa <= pb) && (pa <= pc))       return a;
+    else if (pb <= pc)                  return b;
+    else                                return c;
+}
+
+kInlineFx(kByte*) xkHeightCodec_WriteVarint(kByte* writer, k32u value)
+{
+    while (value >= 0x80)
+    {
+        *writer++ = (kByte)(value | 0x80);
+        value >>= 7;
+    }
+
+    *writer++ = (kByte)value;
+
+    return writer;
+}
+
+kInlineFx(kSize) xkHeightCodec_VarintSize(kSize value)
+{
+    kSize size = 1;
+
+    while (value >= 0x80)
+    {
+        size++;
+        value >>= 7;
+    }
+
+    return size;
+}
+
+kInlineFx(kStatus) xkHeightCodec_ReadVarint(const kByte** reader, const kByte* end, k32u* value)
+{
+    const kByte* it = *reader;
+    k32u result = 0;
+    k32u shift = 0;
+
+    do
+    {
+        if ((it >= end) || (shift > 28))
+        {
+            return kERROR_FORMAT;
+        }
+
+        result |= (k32u)(*it & 0x7F) << shift;
+        shift += 7;
+    }
+    while (*it++ & 0x80);
+
+    *value = result;
+    *reader = it;
+
+    return kOK;
+}
+
+kInlineFx(void) xkHeightCodec_Write32u(kByte* writer, k32u value)
+{
+    writer[0] = (kByte)(value);
+    writer[1] = (kByte)(value >> 8);
+    writer[2] = (kByte)(value >> 16);
+    writer[3] = (kByte)(value >> 24);
+}
+
+kInlineFx(k32u) xkHeightCodec_Read32u(const kByte* reader)
+{
+    return (k32u)reader[0] | ((k32u)reader[1] << 8) | ((k32u)reader[2] << 16) | ((k32u)reader[3] << 24);
+}
+
+kInlineFx(void) xkHeightCodec_Write64u(kByte* writer, k64u value)
+{
+    xkHeightCodec_Write32u(writer, (k32u)value);
+    xkHeightCodec_Write32u(writer + 4, (k32u)(value >> 32));
+}
+
+kInlineFx(k64u) xkHeightCodec_Read64u(const kByte* reader)
+{
+    return (k64u)xkHeightCodec_Read32u(reader) | ((k64u)xkHeightCodec_Read32u(reader + 4) << 32);
+}
+
+#endif
@@ -21,6 +21,7 @@ kBeginInterfaceEx(k, kCompressor)
     kAddPrivateVMethod(kCompressor, kCompressor, VCompressionType)
     kAddPrivateVMethod(kCompressor, kCompressor, VRequiredVersion)
     kAddPrivateVMethod(kCompressor, kCompressor, VConstruct)
+    kAddPrivateVMethod(kCompressor, kCompressor, VBeginWrite)
     kAddPrivateVMethod(kCompressor, kCompressor, VFinishWrite)
     kAddPrivateVMethod(kCompressor, kCompressor, VFinishRead)
 kEndInterfaceEx() 
@@ -12,6 +12,7 @@
 
 #include <kApi/kApiDef.h>
 #include <kApi/Data/kArrayList.h>
+#include <kApi/Utils/kTrace.h>
 
 #include <kApi/Io/kSerializer.x.h>
 
@@ -376,7 +377,15 @@ kInlineFx(kStatus) kSerializer_WriteObject(kSerializer serializer, kObject objec
  */
 kInlineFx(kStatus) kSerializer_ReadObject(kSerializer serializer, kObject* object, kAlloc allocator)
 {
-    return xkSerializer_VTable(serializer)->VReadObject(serializer, object, allocator);
+    kStatus status; 
+
+    kTrace_Begin("kSerializer.ReadObject"); 
+
+    status = xkSerializer_VTable(serializer)->VReadObject(serializer, object, allocator);
+
+    kTrace_End("kSerializer.ReadObject"); 
+
+    return status; 
 }
 
 /** 
@@ -20,6 +20,7 @@ typedef struct kCompressorVTable
     kCompressionType (kCall* VCompressionType)();
     kVersion (kCall* VRequiredVersion)();
     kStatus (kCall* VConstruct)(kObject* compressor, kStream stream, kBool isWriter, k32s level, kAlloc allocator);
+    kStatus (kCall* VBeginWrite)(kObject compressor, kObject object);
     kStatus (kCall* VFinishWrite)(kObject compressor);
     kStatus (kCall* VFinishRead)(kObject compressor);
 } kCompressorVTable;
@@ -45,6 +46,16 @@ kInlineFx(kStatus) xkCompressor_VConstruct(kObject* compressor, kStream stream,
     return kERROR_UNIMPLEMENTED; 
 }
 
+kInlineFx(kStatus) xkCompressor_VBeginWrite(kObject compressor, kObject object)
+{
+    return kOK;
+}
+
+kInlineFx(kStatus) kCompressor_BeginWrite(kObject compressor, kObject object)
+{
+    return xkCompressor_VTable(compressor)->VBeginWrite(compressor, object);
+}
+
 kInlineFx(kStatus) xkCompressor_VFinishWrite(kObject compressor)
 {
     return kERROR_UNIMPLEMENTED;
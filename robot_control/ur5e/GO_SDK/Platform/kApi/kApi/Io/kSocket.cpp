@@ -458,15 +458,20 @@ kFx(kStatus) xkSocket_WaitEx(kSocket sockt, kSocketEvent events, k64u timeout)
 
 kFx(kStatus) xkSocket_Peek(kSocket sockt, void* buffer, kSize size, kSize* read)
 {
-    return xkSocket_ReadImpl(sockt, buffer, size, read, xkSOCKET_MSG_PEEK);
+    return xkSocket_ReadImpl(sockt, buffer, size, read, xkSOCKET_MSG_PEEK, kTRUE);
 }
 
 kFx(kStatus) kSocket_Read(kSocket sockt, void* buffer, kSize size, kSize* read)
 {
-    return xkSocket_ReadImpl(sockt, buffer, size, read, 0);
+    return xkSocket_ReadImpl(sockt, buffer, size, read, 0, kTRUE);
 }
 
-kFx(kStatus) xkSocket_ReadImpl(kSocket sockt, void* buffer, kSize size, kSize* read, k32s options)
+kFx(kStatus) xkSocket_ReadInterval(kSocket sockt, void* buffer, kSize size, kSize* read)
+{
+    return xkSocket_ReadImpl(sockt, buffer, size, read, 0, kFALSE);
+}
+
+kFx(kStatus) xkSocket_ReadImpl(kSocket sockt, void* buffer, kSize size, kSize* read, k32s options, kBool isTimeoutFatal)
 {
     kObj(kSocket, sockt);
     kSSize result;
@@ -508,7 +513,7 @@ kFx(kStatus) xkSocket_ReadImpl(kSocket sockt, void* buffer, kSize size, kSize* r
             {
                 opStatus = kERROR_TIMEOUT;
 
-                if (obj->socketType == kSOCKET_TYPE_TCP)
+                if ((obj->socketType == kSOCKET_TYPE_TCP) && isTimeoutFatal)
                 {
                     obj->status = kERROR_TIMEOUT;
                 }
@@ -797,6 +802,22 @@ kFx(kStatus) kSocket_SetLingerTime(kSocket sockt, k64u lingerTime)
     return kOK;   
 }
 
+kFx(kStatus) kSocket_SetBusyPoll(kSocket sockt, k64u duration)
+{
+#if defined(K_LINUX) && defined(SO_BUSY_POLL)
+    kObj(kSocket, sockt); 
+    int value = (int) kMin_(duration, k32S_MAX); 
+
+    kCheck(obj->status);
+
+    kCheck(setsockopt(obj->handle, SOL_SOCKET, SO_BUSY_POLL, (char*)&value, sizeof(int)) != xkSOCKET_ERROR); 
+
+    return kOK;   
+#else
+    return kERROR_UNIMPLEMENTED; 
+#endif
+}
+
 kFx(kStatus) xkSocket_SetWriteLowWater(kSocket sockt, kSize size)
 {
     kObj(kSocket, sockt); 
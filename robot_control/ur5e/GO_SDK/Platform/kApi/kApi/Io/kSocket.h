@@ -448,6 +448,20 @@ kFx(kStatus) kSocket_SetNoDelay(kSocket socket, kBool noDelay);
  */
 kFx(kStatus) kSocket_SetLingerTime(kSocket socket, k64u lingerTime); 
 
+/** 
+ * Sets the duration for which blocking reads busy-poll the network device for new data.
+ *
+ * Busy polling reduces receive latency at the expense of CPU time. It affects blocking read 
+ * operations only, and is supported on Linux only (SO_BUSY_POLL). Raising the busy-poll duration 
+ * above the system default may require elevated privileges.
+ *
+ * @public              @memberof kSocket
+ * @param   socket      Socket object. 
+ * @param   duration    Busy-poll duration, in microseconds (0 to disable). 
+ * @return              Operation status (kERROR_UNIMPLEMENTED if not supported). 
+ */
+kFx(kStatus) kSocket_SetBusyPoll(kSocket socket, k64u duration); 
+
 /** 
  * Enables or disables interface index information for datagrams.
  *
@@ -95,6 +95,21 @@ typedef struct kSocketClass
 */
 kFx(kStatus) xkSocket_Peek(kSocket socket, void* buffer, kSize size, kSize* read);
 
+/**
+* Reads one or more bytes from a blocking socket, waiting at most for the socket's read timeout.
+*
+* Unlike kSocket_Read, a timeout does not fail the socket; kERROR_TIMEOUT is returned and the read can
+* be retried. Only for use on platforms where a timed-out receive leaves the connection intact (not Windows).
+*
+* @public              @memberof kSocket
+* @param   socket      Socket object.
+* @param   buffer      Buffer to receive bytes.
+* @param   size        The maximum number of bytes to read.
+* @param   read        The number of bytes that were read.
+* @return              Operation status.
+*/
+kFx(kStatus) xkSocket_ReadInterval(kSocket socket, void* buffer, kSize size, kSize* read);
+
 kFx(kStatus) xkSocket_WaitEx(kSocket socket, kSocketEvent events, k64u timeout);
 
 kFx(kStatus) xkSocket_ConstructFromHandle(kSocket* sockt, kIpVersion ipVersion, kSocketType socktType, xkSocketHandle handle, kAlloc allocator); 
@@ -102,7 +117,7 @@ kFx(kStatus) xkSocket_Init(kSocket sockt, kType type, kIpVersion ipVersion, kSoc
 kFx(kStatus) xkSocket_InitFromHandle(kSocket sockt, kType type, kIpVersion ipVersion, kSocketType socktType, xkSocketHandle handle, kAlloc allocator); 
 kFx(kStatus) xkSocket_VRelease(kSocket sockt); 
 
-kFx(kStatus) xkSocket_ReadImpl(kSocket sockt, void* buffer, kSize size, kSize* read, k32s options); 
+kFx(kStatus) xkSocket_ReadImpl(kSocket sockt, void* buffer, kSize size, kSize* read, k32s options, kBool isTimeoutFatal); 
 
 kFx(k32s) xkSocket_GetLastError();
 kFx(kSSize) xkSocket_Recv(kSocket sockt, void* buffer, kSize size, k32s options);
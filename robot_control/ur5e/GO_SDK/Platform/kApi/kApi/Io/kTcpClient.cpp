@@ -90,6 +90,8 @@ kFx(kStatus) xkTcpClient_InitFromSocket(kTcpClient client, kType type, kSocket s
     obj->isCancelled = 0;
     obj->timedOut = kFALSE;
     obj->isSeekEnabled = kFALSE;
+    obj->isBlockingRead = kFALSE;
+    obj->directReadThreshold = kSIZE_MAX;
 
     kTry
     {
@@ -155,8 +157,6 @@ kFx(kStatus) kTcpClient_SetReadBuffers(kTcpClient client, kSSize socketSize, kSS
 {
     kObj(kTcpClient, client); 
 
-    kCheckState((obj->base.readEnd - obj->base.readBegin) == 0);
-
     if (socketSize >= 0)
     {
         kCheck(kSocket_SetReadBuffer(obj->socket, (kSize)socketSize));
@@ -165,6 +165,8 @@ kFx(kStatus) kTcpClient_SetReadBuffers(kTcpClient client, kSSize socketSize, kSS
 
     if (clientSize >= 0)
     {
+        kCheckState((obj->base.readEnd - obj->base.readBegin) == 0);
+
         kCheck(kObject_FreeMemRef(client, &obj->base.readBuffer)); 
 
         obj->base.readCapacity = 0; 
@@ -181,6 +183,25 @@ kFx(kStatus) kTcpClient_SetReadBuffers(kTcpClient client, kSSize socketSize, kSS
     return kOK;
 }
 
+kFx(kStatus) kTcpClient_ReadBuffers(kTcpClient client, kSize* socketSize, kSize* clientSize)
+{
+    kObj(kTcpClient, client); 
+
+    if (!kIsNull(socketSize))   *socketSize = obj->socketReadBufferSize; 
+    if (!kIsNull(clientSize))   *clientSize = obj->base.readCapacity; 
+
+    return kOK; 
+}
+
+kFx(kStatus) kTcpClient_SetDirectReadThreshold(kTcpClient client, kSize threshold)
+{
+    kObj(kTcpClient, client); 
+
+    obj->directReadThreshold = threshold; 
+
+    return kOK; 
+}
+
 kFx(kStatus) kTcpClient_SetWriteTimeout(kTcpClient client, k64u timeout)
 {
     kObj(kTcpClient, client); 
@@ -215,6 +236,30 @@ kFx(kStatus) kTcpClient_EnableSeek(kTcpClient client, kBool enabled)
     return kOK; 
 }
 
+kFx(kStatus) kTcpClient_EnableBlockingRead(kTcpClient client, kBool enabled)
+{
+    kObj(kTcpClient, client); 
+
+#if defined(K_WINDOWS)
+
+    //a timed-out blocking receive leaves a Windows socket in an indeterminate state, so reads 
+    //continue to wait in intervals
+    obj->isBlockingRead = kFALSE; 
+
+#else
+
+    //blocking reads wake at the cancellation query interval, to observe the read timeout and 
+    //the cancellation handler
+    kCheck(kSocket_SetReadTimeout(obj->socket, enabled ? xkTCP_CLIENT_CANCEL_QUERY_INTERVAL : 0)); 
+    kCheck(kSocket_SetBlocking(obj->socket, enabled)); 
+
+    obj->isBlockingRead = enabled; 
+
+#endif
+
+    return kOK; 
+}
+
 kFx(kStatus) kTcpClient_SetCancelHandler(kTcpClient client, kCallbackFx function, kPointer receiver)
 {
     kObj(kTcpClient, client); 
@@ -375,8 +420,9 @@ kFx(kStatus) xkTcpClient_VReadSomeImpl(kTcpClient client, void* buffer, kSize mi
     //if the request is not yet satisfied
     if (readCount < minCount)
     {
-        //if the request is larger than the internal read buffer, read directly into the caller's buffer; else read into the internal buffer
-        if ((maxCount - readCount) > obj->base.readCapacity)
+        //if the request is larger than the internal read buffer (or the direct read threshold), read directly 
+        //into the caller's buffer; else read into the internal buffer
+        if (((maxCount - readCount) > obj->base.readCapacity) || ((minCount - readCount) >= obj->directReadThreshold))
         {            
             kCheck(xkTcpClient_ReadAtLeast(client, &dest[readCount], minCount-readCount, maxCount-readCount, &mediumCount));
 
@@ -446,6 +492,11 @@ kFx(kStatus) xkTcpClient_ReadAtLeast(kTcpClient client, kByte* buffer, kSize min
 
     kCheck(kSocket_SetEvents(obj->socket, kSOCKET_EVENT_READ)); 
 
+    if (obj->isBlockingRead)
+    {
+        return xkTcpClient_ReadAtLeastBlocking(client, buffer, minCount, maxCount, bytesRead); 
+    }
+
     do
     {
         kCheck(kTcpClient_Status(client)); 
@@ -486,6 +537,54 @@ kFx(kStatus) xkTcpClient_ReadAtLeast(kTcpClient client, kByte* buffer, kSize min
     return kOK;  
 }
 
+kFx(kStatus) xkTcpClient_ReadAtLeastBlocking(kTcpClient client, kByte* buffer, kSize minCount, kSize maxCount, kSize* bytesRead)
+{
+    kObj(kTcpClient, client); 
+    k64u startTime = (obj->readTimeout == 0) ? 0 : kTimer_Now(); 
+    kBool hasTimedOut = kFALSE; 
+    kStatus result; 
+    kSize totalRead = 0; 
+    kSize read; 
+
+    do
+    {
+        kCheck(kTcpClient_Status(client)); 
+
+        hasTimedOut = (obj->readTimeout == 0) ? kFALSE : ((kTimer_Now() - startTime) >= obj->readTimeout); 
+
+        result = xkSocket_ReadInterval(obj->socket, &buffer[totalRead], maxCount-totalRead, &read); 
+
+        if (result == kOK)
+        {
+            obj->base.bytesRead += (k64u) read; 
+            totalRead += read; 
+        }
+        else if ((result == kERROR_TIMEOUT) && !kIsNull(obj->cancelQuery.function))
+        {
+            if (!kSuccess(obj->cancelQuery.function(obj->cancelQuery.receiver, client, kNULL)))
+            {
+                kAtomic32s_Exchange(&obj->isCancelled, kTRUE);
+                return kERROR_ABORT; 
+            }
+        }
+        else if (result != kERROR_TIMEOUT)
+        {
+            return result; 
+        }
+    }
+    while ((totalRead < minCount) && !hasTimedOut); 
+
+    if (totalRead < minCount)
+    {
+        obj->timedOut = kTRUE; 
+        return kERROR_TIMEOUT; 
+    }
+
+    *bytesRead = totalRead; 
+
+    return kOK;  
+}
+
 kFx(kStatus) xkTcpClient_WriteAll(kTcpClient client, const kByte* buffer, kSize count)
 {
     kObj(kTcpClient, client); 
@@ -67,6 +67,9 @@ kFx(kStatus) kTcpClient_SetWriteBuffers(kTcpClient client, kSSize socketSize, kS
  * objects are created in kTcpServer_Accept. Accordingly, server-side implementations should use 
  * kTcpServer_SetReadBuffers to set buffer sizes instead of kTcpClient_SetReadBuffers.
  *
+ * Buffers can be resized while connected; the client buffer can only be resized when it holds no 
+ * unread bytes (see kTcpClient_Available). 
+ *
  * @public              @memberof kTcpClient
  * @param   client      TCP client object. 
  * @param   socketSize  Size of the read buffer maintained by the underlying socket (-1 to leave unchanged).
@@ -76,6 +79,35 @@ kFx(kStatus) kTcpClient_SetWriteBuffers(kTcpClient client, kSSize socketSize, kS
  */
 kFx(kStatus) kTcpClient_SetReadBuffers(kTcpClient client, kSSize socketSize, kSSize clientSize);
 
+/** 
+ * Reports the current sizes of read buffers. 
+ * 
+ * The socket buffer size is the size reported by the underlying socket, which may differ from the 
+ * size requested with kTcpClient_SetReadBuffers (e.g., operating systems may limit or adjust it). 
+ *
+ * @public              @memberof kTcpClient
+ * @param   client      TCP client object. 
+ * @param   socketSize  Receives the size of the socket read buffer (can be kNULL).
+ * @param   clientSize  Receives the size of the client read buffer (can be kNULL).
+ * @return              Operation status. 
+ */
+kFx(kStatus) kTcpClient_ReadBuffers(kTcpClient client, kSize* socketSize, kSize* clientSize);
+
+/** 
+ * Sets the size at which read requests bypass the client read buffer. 
+ * 
+ * Read requests that cannot be satisfied from the client buffer, and that are larger than the client 
+ * buffer, are always read directly into the caller's buffer. Setting a threshold extends this to 
+ * smaller requests, which avoids copying large payloads through the client buffer when the client 
+ * buffer is sized for efficient small reads. By default, no threshold is used (kSIZE_MAX). 
+ *
+ * @public              @memberof kTcpClient
+ * @param   client      TCP client object. 
+ * @param   threshold   Minimum count of outstanding bytes that are read directly into the caller's buffer.
+ * @return              Operation status. 
+ */
+kFx(kStatus) kTcpClient_SetDirectReadThreshold(kTcpClient client, kSize threshold);
+
 /** 
  * Sets the timeout duration for write operations.  
  *
@@ -144,6 +176,28 @@ kFx(kStatus) kTcpClient_SetNoDelay(kTcpClient client, kBool noDelay);
  */
 kFx(kStatus) kTcpClient_EnableSeek(kTcpClient client, kBool enabled);
 
+/** 
+ * Enables blocking reads.
+ *
+ * By default, read operations wait for data in short intervals so that the read timeout and the 
+ * cancellation handler can be observed between waits. When blocking reads are enabled, read operations 
+ * block directly in the underlying socket read, avoiding the separate wait; the socket read wakes at the 
+ * same interval when no data arrives, so the read timeout and the cancellation handler are still observed. 
+ * kTcpClient_Shutdown can be used from another thread to unblock a pending read at once. 
+ * 
+ * On Windows, a timed-out blocking receive leaves the connection in an indeterminate state, so this 
+ * option has no effect. 
+ * 
+ * This method should be called after the connection has been established; it is intended for 
+ * connections that are used primarily for reading. 
+ *
+ * @public              @memberof kTcpClient
+ * @param   client      TCP client object. 
+ * @param   enabled     kTRUE to enable blocking reads. 
+ * @return              Operation status. 
+ */
+kFx(kStatus) kTcpClient_EnableBlockingRead(kTcpClient client, kBool enabled);
+
 /** 
  * Sets a cancel query handler, which can be used to asynchronously terminate read/write operations.
  * 
@@ -24,6 +24,8 @@ typedef struct kTcpClientClass
     kAtomic32s isCancelled;             //Has I/O been cancelled by client owner?
     kBool timedOut;                     //Has client experienced a timeout error?
     kBool isSeekEnabled;                //Provide limited support for seek operations?
+    kBool isBlockingRead;               //Block directly in socket reads (waking at the cancel query interval)?
+    kSize directReadThreshold;          //Reads of at least this size bypass the client read buffer.
 } kTcpClientClass;
 
 kDeclareClassEx(k, kTcpClient, kStream)
@@ -44,6 +46,7 @@ kFx(kStatus) xkTcpClient_VFlush(kTcpClient client);
 kFx(kStatus) xkTcpClient_VFill(kTcpClient client);
 
 kFx(kStatus) xkTcpClient_ReadAtLeast(kTcpClient client, kByte* buffer, kSize minCount, kSize maxCount, kSize* bytesRead); 
+kFx(kStatus) xkTcpClient_ReadAtLeastBlocking(kTcpClient client, kByte* buffer, kSize minCount, kSize maxCount, kSize* bytesRead); 
 kFx(kStatus) xkTcpClient_WriteAll(kTcpClient client, const kByte* buffer, kSize count);
 
 #endif
@@ -8,6 +8,7 @@
  */
 #define K_PLATFORM
 #include <kApi/Threads/kAtomic.h>
+#include <kApi/Threads/kThread.h>
 
 kBeginStaticClassEx(k, kAtomic)
 kEndStaticClassEx()
@@ -21,3 +22,24 @@ kFx(kStatus) xkAtomic_ReleaseStatic()
 {
     return kOK; 
 }
+
+// Acquires a guard that is held only briefly (e.g., to update a few counters). The guard is retried 
+// a few times; after that, the caller sleeps between attempts, so that a real-time thread can't 
+// starve a lower-priority holder on the same processor. Guards are not recursive. 
+kFx(void) xkAtomic32s_EnterSpinGuard(kAtomic32s* guard)
+{
+    k32s attempts = 0; 
+
+    while (!kAtomic32s_CompareExchange(guard, 0, 1))
+    {
+        if (++attempts >= xkATOMIC_SPIN_GUARD_MAX_SPIN)
+        {
+            kThread_Sleep(xkATOMIC_SPIN_GUARD_SLEEP); 
+        }
+    }
+}
+
+kFx(void) xkAtomic32s_ExitSpinGuard(kAtomic32s* guard)
+{
+    kAtomic32s_Exchange(guard, 0); 
+}
@@ -25,6 +25,16 @@ kDeclareStaticClassEx(k, kAtomic)
 kFx(kStatus) xkAtomic_InitStatic();
 kFx(kStatus) xkAtomic_ReleaseStatic();
 
+/*
+* Spin guard
+*/
+
+#define xkATOMIC_SPIN_GUARD_MAX_SPIN        (100)       //attempts to acquire a spin guard before sleeping between attempts
+#define xkATOMIC_SPIN_GUARD_SLEEP           (1000)      //time to sleep between attempts, after spinning (us)
+
+kFx(void) xkAtomic32s_EnterSpinGuard(kAtomic32s* guard);
+kFx(void) xkAtomic32s_ExitSpinGuard(kAtomic32s* guard);
+
 /*
 * Forward Declarations
 */
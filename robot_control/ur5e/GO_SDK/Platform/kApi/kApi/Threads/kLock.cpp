@@ -9,16 +9,34 @@
  */
 #define K_PLATFORM
 #include <kApi/Threads/kLock.h>
+#include <kApi/Data/kArrayList.h>
+#include <kApi/Threads/kTimer.h>
 
 kBeginValueEx(k, kLockOption)
     kAddEnumerator(kLockOption, kLOCK_OPTION_TIMEOUT)
     kAddEnumerator(kLockOption, xkLOCK_OPTION_PRIORITY_INHERITANCE)
+    kAddEnumerator(kLockOption, kLOCK_OPTION_ADAPTIVE)
+kEndValueEx()
+
+kBeginValueEx(k, kLockStats)
+    kAddField(kLockStats, kText64, name)
+    kAddField(kLockStats, k64u, acquisitions)
+    kAddField(kLockStats, k64u, contentions)
+    kAddField(kLockStats, k64u, waitTime)
+    kAddField(kLockStats, k64u, maxWaitTime)
+    kAddField(kLockStats, k64u, holdTime)
+    kAddField(kLockStats, k64u, maxHoldTime)
 kEndValueEx()
 
 kBeginClassEx(k, kLock)
     kAddPrivateVMethod(kLock, kObject, VRelease)
 kEndClassEx()
 
+kDx(kAtomic32s) xkLock_profilingEnabled = kFALSE; 
+
+//registry of named locks; protected by xkLock_EnterRegistry/xkLock_ExitRegistry
+static xkLockProfile* xkLock_registry = kNULL; 
+
 kFx(kStatus) kLock_Construct(kLock* lock, kAlloc allocator)
 {
     return kLock_ConstructEx(lock, kFALSE, allocator);
@@ -40,8 +58,363 @@ kFx(kStatus) kLock_ConstructEx(kLock* lock, kLockOption options, kAlloc allocato
     return status;
 }
 
+kFx(kStatus) kLock_Enter(kLock lock)
+{
+    kObj(kLock, lock);
+
+    if (!kIsNull(obj->profile) && kAtomic32s_Get(&xkLock_profilingEnabled))
+    {
+        return xkLock_EnterProfiled(lock, kINFINITE); 
+    }
+    else if ((obj->options & kLOCK_OPTION_ADAPTIVE) != 0)
+    {
+        return xkLock_AcquireAdaptive(lock, kINFINITE); 
+    }
+
+    return xkLock_Acquire(lock, kINFINITE); 
+}
+
+kFx(kStatus) kLock_EnterEx(kLock lock, k64u timeout)
+{
+    kObj(kLock, lock);
+
+    kAssert(((obj->options & kLOCK_OPTION_TIMEOUT) != 0) || (timeout == kINFINITE)); 
+
+    if (!kIsNull(obj->profile) && kAtomic32s_Get(&xkLock_profilingEnabled))
+    {
+        return xkLock_EnterProfiled(lock, timeout); 
+    }
+    else if ((obj->options & kLOCK_OPTION_ADAPTIVE) != 0)
+    {
+        return xkLock_AcquireAdaptive(lock, timeout); 
+    }
+
+    return xkLock_Acquire(lock, timeout); 
+}
+
+kFx(kStatus) kLock_Exit(kLock lock)
+{
+    kObj(kLock, lock); 
+
+    //depth is nonzero only if the current hold began with a profiled acquisition
+    if (!kIsNull(obj->profile) && (obj->profile->depth > 0))
+    {
+        xkLock_ExitProfiled(lock); 
+    }
+
+    return xkLock_Release(lock); 
+}
+
+// Retries a busy lock before blocking. The number of attempts adapts to the number that 
+// were recently needed (as in glibc's adaptive mutexes). 
+kFx(kStatus) xkLock_AcquireAdaptive(kLock lock, k64u timeout)
+{
+    kObj(kLock, lock);
+    k32s limit = kMin_(xkLOCK_ADAPTIVE_MAX_SPIN, 2*obj->spinEstimate + 10); 
+    k32s attempts = 0; 
+
+    while (!xkLock_TryAcquire(lock))
+    {
+        if (++attempts >= limit)
+        {
+            kCheck(xkLock_Acquire(lock, timeout)); 
+            break;
+        }
+    }
+
+    obj->spinEstimate += (attempts - obj->spinEstimate) / 8; 
+
+    return kOK; 
+}
+
+kFx(kStatus) xkLock_EnterProfiled(kLock lock, k64u timeout)
+{
+    kObj(kLock, lock);
+    xkLockProfile* profile = obj->profile; 
+    kBool contended = kFALSE; 
+    k64u start = 0; 
+    k64u now = 0; 
+
+    if (!xkLock_TryAcquire(lock))
+    {
+        contended = kTRUE; 
+        start = kTimer_Now(); 
+
+        if ((obj->options & kLOCK_OPTION_ADAPTIVE) != 0)
+        {
+            kCheck(xkLock_AcquireAdaptive(lock, timeout)); 
+        }
+        else
+        {
+            kCheck(xkLock_Acquire(lock, timeout)); 
+        }
+    }
+
+    now = kTimer_Now(); 
+
+    xkAtomic32s_EnterSpinGuard(&profile->guard); 
+    {
+        profile->stats.acquisitions++; 
+
+        if (contended)
+        {
+            k64u wait = now - start; 
+
+            profile->stats.contentions++; 
+            profile->stats.waitTime += wait; 
+            profile->stats.maxWaitTime = kMax_(profile->stats.maxWaitTime, wait); 
+        }
+    }
+    xkAtomic32s_ExitSpinGuard(&profile->guard); 
+
+    if (profile->depth++ == 0)
+    {
+        profile->holdStart = now; 
+    }
+
+    return kOK; 
+}
+
+kFx(void) xkLock_ExitProfiled(kLock lock)
+{
+    kObj(kLock, lock);
+    xkLockProfile* profile = obj->profile; 
+
+    if (--profile->depth == 0)
+    {
+        k64u hold = kTimer_Now() - profile->holdStart; 
+
+        xkAtomic32s_EnterSpinGuard(&profile->guard); 
+        {
+            profile->stats.holdTime += hold; 
+            profile->stats.maxHoldTime = kMax_(profile->stats.maxHoldTime, hold); 
+        }
+        xkAtomic32s_ExitSpinGuard(&profile->guard); 
+    }
+}
+
+kFx(kStatus) kLock_SetName(kLock lock, const kChar* name)
+{
+    kObj(kLock, lock);
+    xkLockProfile* profile = kNULL; 
+
+    if (kIsNull(obj->profile))
+    {
+        kCheck(kAlloc_GetZero(kObject_Alloc(lock), sizeof(xkLockProfile), &profile)); 
+        
+        kStrCopy(profile->stats.name, kCountOf(profile->stats.name), name); 
+
+        xkLock_Register(profile); 
+
+        obj->profile = profile; 
+    }
+    else
+    {
+        xkLock_EnterRegistry(); 
+        {
+            kStrCopy(obj->profile->stats.name, kCountOf(obj->profile->stats.name), name); 
+        }
+        xkLock_ExitRegistry(); 
+    }
+
+    return kOK; 
+}
+
+kFx(kStatus) xkLock_ReleaseProfile(kLock lock)
+{
+    kObj(kLock, lock);
+
+    if (!kIsNull(obj->profile))
+    {
+        xkLock_Unregister(obj->profile); 
+
+        kCheck(kAlloc_FreeRef(kObject_Alloc(lock), &obj->profile)); 
+    }
+
+    return kOK; 
+}
+
+kFx(kStatus) kLock_Stats(kLock lock, kLockStats* stats)
+{
+    kObj(kLock, lock);
+
+    kCheckState(!kIsNull(obj->profile)); 
+
+    xkAtomic32s_EnterSpinGuard(&obj->profile->guard); 
+    {
+        *stats = obj->profile->stats; 
+    }
+    xkAtomic32s_ExitSpinGuard(&obj->profile->guard); 
+
+    return kOK; 
+}
+
+kFx(kStatus) kLock_EnableProfiling(kBool enabled)
+{
+    kAtomic32s_Exchange(&xkLock_profilingEnabled, enabled ? kTRUE : kFALSE); 
+
+    return kOK; 
+}
+
+kFx(kStatus) kLock_ClearProfile()
+{
+    xkLockProfile* profile = kNULL; 
+
+    xkLock_EnterRegistry(); 
+    {
+        for (profile = xkLock_registry; !kIsNull(profile); profile = profile->next)
+        {
+            xkAtomic32s_EnterSpinGuard(&profile->guard); 
+            {
+                profile->stats.acquisitions = 0; 
+                profile->stats.contentions = 0; 
+                profile->stats.waitTime = 0; 
+                profile->stats.maxWaitTime = 0; 
+                profile->stats.holdTime = 0; 
+                profile->stats.maxHoldTime = 0; 
+            }
+            xkAtomic32s_ExitSpinGuard(&profile->guard); 
+        }
+    }
+    xkLock_ExitRegistry(); 
+
+    return kOK; 
+}
+
+kFx(kStatus) kLock_ProfileStats(kArrayList* stats, kAlloc allocator)
+{
+    kArrayList output = kNULL; 
+    kStatus status = kOK; 
+    kSize i, j; 
+
+    kCheck(kArrayList_Construct(&output, kTypeOf(kLockStats), 0, allocator)); 
+
+    kTry
+    {
+        xkLockProfile* profile = kNULL; 
+        kLockStats snapshot; 
+
+        xkLock_EnterRegistry(); 
+        {
+            for (profile = xkLock_registry; !kIsNull(profile) && kSuccess(status); profile = profile->next)
+            {
+                xkAtomic32s_EnterSpinGuard(&profile->guard); 
+                {
+                    snapshot = profile->stats; 
+                }
+                xkAtomic32s_ExitSpinGuard(&profile->guard); 
+
+                status = kArrayList_AddT(output, &snapshot); 
+            }
+        }
+        xkLock_ExitRegistry(); 
+
+        kTest(status); 
+
+        //insertion sort, by decreasing wait time
+        for (i = 1; i < kArrayList_Count(output); ++i)
+        {
+            kLockStats item = kArrayList_AsT(output, i, kLockStats); 
+
+            for (j = i; (j > 0) && (kArrayList_AtT(output, j-1, kLockStats)->waitTime < item.waitTime); --j)
+            {
+                kArrayList_SetAsT(output, j, kArrayList_AsT(output, j-1, kLockStats), kLockStats); 
+            }
+
+            kArrayList_SetAsT(output, j, item, kLockStats); 
+        }
+
+        *stats = output; 
+    }
+    kCatch(&status)
+    {
+        kObject_Destroy(output); 
+        kEndCatch(status); 
+    }
+
+    return kOK; 
+}
+
+kFx(kStatus) kLock_LogProfile(kSize count)
+{
+    kArrayList stats = kNULL; 
+    kSize i; 
+
+    kCheck(kLock_ProfileStats(&stats, kNULL)); 
+
+    kTry
+    {
+        kLogf("Lock contention (%u named locks):", (k32u)kArrayList_Count(stats)); 
+
+        for (i = 0; (i < count) && (i < kArrayList_Count(stats)); ++i)
+        {
+            const kLockStats* item = kArrayList_AtT(stats, i, kLockStats); 
+
+            kLogf("  %s: %llu acquisitions, %llu contended, wait %llu us (max %llu us), hold %llu us (max %llu us)", 
+                item->name, item->acquisitions, item->contentions, item->waitTime, item->maxWaitTime, item->holdTime, item->maxHoldTime);
+        }
+    }
+    kFinally
+    {
+        kObject_Destroy(stats); 
+        kEndFinally(); 
+    }
+
+    return kOK; 
+}
+
+kFx(void) xkLock_Register(xkLockProfile* profile)
+{
+    xkLock_EnterRegistry(); 
+    {
+        profile->previous = kNULL; 
+        profile->next = xkLock_registry; 
+
+        if (!kIsNull(xkLock_registry))
+        {
+            xkLock_registry->previous = profile; 
+        }
+
+        xkLock_registry = profile; 
+    }
+    xkLock_ExitRegistry(); 
+}
+
+kFx(void) xkLock_Unregister(xkLockProfile* profile)
+{
+    xkLock_EnterRegistry(); 
+    {
+        if (!kIsNull(profile->previous))
+        {
+            profile->previous->next = profile->next; 
+        }
+        else
+        {
+            xkLock_registry = profile->next; 
+        }
+
+        if (!kIsNull(profile->next))
+        {
+            profile->next->previous = profile->previous; 
+        }
+    }
+    xkLock_ExitRegistry(); 
+}
+
 #if defined(K_WINDOWS)
 
+static SRWLOCK xkLock_registryLock = SRWLOCK_INIT; 
+
+kFx(void) xkLock_EnterRegistry()
+{
+    AcquireSRWLockExclusive(&xkLock_registryLock); 
+}
+
+kFx(void) xkLock_ExitRegistry()
+{
+    ReleaseSRWLockExclusive(&xkLock_registryLock); 
+}
+
 kFx(kStatus) xkLock_Init(kLock lock, kLockOption options, kType type, kAlloc allocator)
 {
     kObjR(kLock, lock);
@@ -49,6 +422,8 @@ kFx(kStatus) xkLock_Init(kLock lock, kLockOption options, kType type, kAlloc all
     kCheck(kObject_Init(lock, type, allocator)); 
 
     obj->options = options;
+    obj->profile = kNULL; 
+    obj->spinEstimate = xkLOCK_ADAPTIVE_INITIAL_SPIN; 
     kZero(obj->criticalSection); 
     kZero(obj->mutex);
 
@@ -74,6 +449,8 @@ kFx(kStatus) xkLock_Init(kLock lock, kLockOption options, kType type, kAlloc all
 kFx(kStatus) xkLock_VRelease(kLock lock)
 {
     kObj(kLock, lock); 
+
+    kCheck(xkLock_ReleaseProfile(lock)); 
     
     if ((obj->options & kLOCK_OPTION_TIMEOUT) != 0)
     {
@@ -94,37 +471,24 @@ kFx(kStatus) xkLock_VRelease(kLock lock)
     return kOK; 
 }
 
-kFx(kStatus) kLock_Enter(kLock lock)
+kFx(kBool) xkLock_TryAcquire(kLock lock)
 {
     kObj(kLock, lock);
 
     if ((obj->options & kLOCK_OPTION_TIMEOUT) != 0)
     {
-        DWORD waitResult = WaitForSingleObject(obj->mutex, kOS_INFINITE);
-
-        if (waitResult == WAIT_TIMEOUT)
-        {
-            return kERROR_TIMEOUT;
-        }
-        else if (waitResult != WAIT_OBJECT_0)
-        {
-            return kERROR_OS;
-        }
+        return (WaitForSingleObject(obj->mutex, 0) == WAIT_OBJECT_0);
     }
     else
     {
-        EnterCriticalSection(&obj->criticalSection);
+        return (TryEnterCriticalSection(&obj->criticalSection) != 0);
     }
-
-    return kOK;
 }
 
-kFx(kStatus) kLock_EnterEx(kLock lock, k64u timeout)
+kFx(kStatus) xkLock_Acquire(kLock lock, k64u timeout)
 {
     kObj(kLock, lock);
 
-    kAssert((obj->options & kLOCK_OPTION_TIMEOUT) != 0 || (timeout == kINFINITE)); 
-
     if ((obj->options & kLOCK_OPTION_TIMEOUT) != 0)
     {
         DWORD osTimeout = (DWORD)xkTimeToKernelTime(timeout);
@@ -147,7 +511,7 @@ kFx(kStatus) kLock_EnterEx(kLock lock, k64u timeout)
     return kOK;
 }
 
-kFx(kStatus) kLock_Exit(kLock lock)
+kFx(kStatus) xkLock_Release(kLock lock)
 {
     kObj(kLock, lock); 
 
@@ -168,6 +532,18 @@ kFx(kStatus) kLock_Exit(kLock lock)
 
 #elif defined(K_POSIX)
 
+static pthread_mutex_t xkLock_registryMutex = PTHREAD_MUTEX_INITIALIZER; 
+
+kFx(void) xkLock_EnterRegistry()
+{
+    pthread_mutex_lock(&xkLock_registryMutex); 
+}
+
+kFx(void) xkLock_ExitRegistry()
+{
+    pthread_mutex_unlock(&xkLock_registryMutex); 
+}
+
 kFx(kStatus) xkLock_Init(kLock lock, kLockOption options, kType type, kAlloc allocator)
 {
     kObjR(kLock, lock); 
@@ -180,6 +556,8 @@ kFx(kStatus) xkLock_Init(kLock lock, kLockOption options, kType type, kAlloc all
 
     kZero(obj->mutex);
     obj->options = options;
+    obj->profile = kNULL; 
+    obj->spinEstimate = xkLOCK_ADAPTIVE_INITIAL_SPIN; 
 
     if (((obj->options & kLOCK_OPTION_TIMEOUT) != 0) &&
         ((obj->options & xkLOCK_OPTION_PRIORITY_INHERITANCE) != 0))
@@ -232,6 +610,8 @@ kFx(kStatus) xkLock_Init(kLock lock, kLockOption options, kType type, kAlloc all
 kFx(kStatus) xkLock_VRelease(kLock lock)
 {
     kObj(kLock, lock); 
+
+    kCheck(xkLock_ReleaseProfile(lock)); 
     
     kCheck(pthread_mutex_destroy(&obj->mutex) == 0);
 
@@ -240,23 +620,19 @@ kFx(kStatus) xkLock_VRelease(kLock lock)
     return kOK; 
 }
 
-kFx(kStatus) kLock_Enter(kLock lock)
+kFx(kBool) xkLock_TryAcquire(kLock lock)
 {
     kObj(kLock, lock);
 
-    kCheckTrue(pthread_mutex_lock(&obj->mutex) == 0, kERROR_OS);
-
-    return kOK; 
+    return (pthread_mutex_trylock(&obj->mutex) == 0); 
 }
 
-kFx(kStatus) kLock_EnterEx(kLock lock, k64u timeout)
+kFx(kStatus) xkLock_Acquire(kLock lock, k64u timeout)
 {
     kObj(kLock, lock);
     struct timespec tm;
     int result = 0;
 
-    kAssert(((obj->options & kLOCK_OPTION_TIMEOUT) != 0) || (timeout == kINFINITE)); 
-
     if (timeout == kINFINITE)
     {
         kCheckTrue(pthread_mutex_lock(&obj->mutex) == 0, kERROR_OS);
@@ -280,7 +656,7 @@ kFx(kStatus) kLock_EnterEx(kLock lock, k64u timeout)
     return kOK; 
 }
 
-kFx(kStatus) kLock_Exit(kLock lock)
+kFx(kStatus) xkLock_Release(kLock lock)
 {
     kObj(kLock, lock); 
 
@@ -11,6 +11,7 @@
 #define K_API_LOCK_H
 
 #include <kApi/kApiDef.h>
+#include <kApi/Threads/kAtomic.h>
 
 /**
  * @class   kLockOption
@@ -23,8 +24,26 @@ typedef k32s kLockOption;
 /** @relates kLockOption @{ */
 #define kLOCK_OPTION_NONE                  (0x0)       ///< No options
 #define kLOCK_OPTION_TIMEOUT               (0x1)       ///< Can wait with timeout.
+#define kLOCK_OPTION_ADAPTIVE              (0x4)       ///< Spins briefly before blocking, if the lock is busy.
 /** @} */
 
+/**
+ * @struct  kLockStats
+ * @extends kValue
+ * @ingroup kApi-Threads
+ * @brief   Contention statistics for a named lock.
+ */
+typedef struct kLockStats
+{
+    kText64 name;               ///< Lock name.
+    k64u acquisitions;          ///< Number of profiled acquisitions.
+    k64u contentions;           ///< Number of profiled acquisitions that found the lock busy.
+    k64u waitTime;              ///< Total time spent waiting to acquire the lock (us).
+    k64u maxWaitTime;           ///< Longest wait to acquire the lock (us).
+    k64u holdTime;              ///< Total time for which the lock was held (us).
+    k64u maxHoldTime;           ///< Longest time for which the lock was held (us).
+} kLockStats;
+
 #include <kApi/Threads/kLock.x.h>
 
 /**
@@ -36,6 +55,15 @@ typedef k32s kLockOption;
  * The kLock class optionally supports lock timeouts. Use the kLock_ConstructEx
  * method with kLOCK_OPTION_TIMEOUT to construct a lock that can support the use of finite 
  * timeout values in the kLock_EnterEx method. 
+ *
+ * Locks constructed with kLOCK_OPTION_ADAPTIVE retry a busy lock for a short, self-adjusting 
+ * number of attempts before blocking. This can reduce latency for locks that are held briefly 
+ * but acquired frequently from several threads. 
+ *
+ * Locks that have been named with kLock_SetName can be profiled for contention. While profiling 
+ * is enabled (kLock_EnableProfiling), each named lock counts its acquisitions, the acquisitions 
+ * that had to wait, and its wait and hold times. kLock_ProfileStats and kLock_LogProfile report 
+ * these statistics for all named locks. Locks that are not named are unaffected by profiling.
  */
 
 /** 
@@ -109,4 +137,65 @@ kFx(kStatus) kLock_EnterEx(kLock lock, k64u timeout);
  */
 kFx(kStatus) kLock_Exit(kLock lock); 
 
+/** 
+ * Names the lock and adds it to the registry of locks that can be profiled.
+ *
+ * This function should be called before the lock is shared with other threads. 
+ *
+ * @public              @memberof kLock
+ * @param   lock        Lock object. 
+ * @param   name        Lock name (need not be unique).
+ * @return              Operation status. 
+ */
+kFx(kStatus) kLock_SetName(kLock lock, const kChar* name); 
+
+/** 
+ * Reports contention statistics for a named lock.
+ *
+ * @public              @memberof kLock
+ * @param   lock        Lock object. 
+ * @param   stats       Receives lock statistics. 
+ * @return              Operation status (kERROR_STATE if the lock is not named). 
+ */
+kFx(kStatus) kLock_Stats(kLock lock, kLockStats* stats); 
+
+/** 
+ * Enables or disables contention profiling for named locks (default: disabled).
+ *
+ * @public              @memberof kLock
+ * @param   enabled     kTRUE to enable profiling. 
+ * @return              Operation status. 
+ */
+kFx(kStatus) kLock_EnableProfiling(kBool enabled); 
+
+/** 
+ * Resets the contention statistics of all named locks.
+ *
+ * @public              @memberof kLock
+ * @return              Operation status. 
+ */
+kFx(kStatus) kLock_ClearProfile(); 
+
+/** 
+ * Reports contention statistics for all named locks, ordered by decreasing total wait time.
+ *
+ * Statistics are read without acquiring the profiled locks. Each entry is a consistent snapshot 
+ * of one lock, but entries for different locks are captured at slightly different times. 
+ *
+ * @public              @memberof kLock
+ * @param   stats       Receives a list of lock statistics (kArrayList<kLockStats>). 
+ * @param   allocator   Memory allocator for the list (or kNULL for default). 
+ * @return              Operation status. 
+ */
+kFx(kStatus) kLock_ProfileStats(kArrayList* stats, kAlloc allocator); 
+
+/** 
+ * Logs contention statistics for the named locks with the largest total wait times.
+ *
+ * @public              @memberof kLock
+ * @param   count       Maximum number of locks to report. 
+ * @return              Operation status. 
+ */
+kFx(kStatus) kLock_LogProfile(kSize count); 
+
 #endif
@@ -10,10 +10,28 @@
 #define K_API_LOCK_X_H
 
 kDeclareValueEx(k, kLockOption, kValue)
+kDeclareValueEx(k, kLockStats, kValue)
 kDeclareClassEx(k, kLock, kObject)
 
 #define xkLOCK_OPTION_PRIORITY_INHERITANCE          (0x2)       ///< Priority of thread that acquires the lock is increased to priority of highest priority waiting thread. Not supported on all platforms.
 
+#define xkLOCK_ADAPTIVE_MAX_SPIN                    (100)       ///< Maximum attempts to acquire an adaptive lock before blocking.
+#define xkLOCK_ADAPTIVE_INITIAL_SPIN                (10)        ///< Initial estimate of attempts needed to acquire an adaptive lock.
+
+//Contention profile of a named lock. Statistics are protected by the profile guard; the recursion 
+//depth and hold start time are only accessed by the lock holder. 
+typedef struct xkLockProfile
+{
+    struct xkLockProfile* next;         //next profile in registry
+    struct xkLockProfile* previous;     //previous profile in registry
+    kAtomic32s guard;                   //spin guard; protects statistics
+    kLockStats stats;                   //accumulated statistics
+    k64u holdStart;                     //time at which the lock was last acquired (us)
+    k32u depth;                         //recursion depth of profiled acquisitions
+} xkLockProfile; 
+
+kExtern kDx(kAtomic32s) xkLock_profilingEnabled;         ///< Is contention profiling enabled?
+
 #if defined(K_PLATFORM)
 
 #if defined(K_WINDOWS)
@@ -33,6 +51,8 @@ typedef struct kLockClass
 {
     kObjectClass base; 
     kLockOption options;           //lock options
+    xkLockProfile* profile;        //contention profile, for named locks (or kNULL)
+    k32s spinEstimate;             //expected attempts to acquire an adaptive lock; updated by lock owner
     xkLockPlatformFields()
 } kLockClass;
 
@@ -43,6 +63,20 @@ typedef struct kLockClass
 kFx(kStatus) xkLock_Init(kLock lock, kLockOption options, kType type, kAlloc allocator); 
 kFx(kStatus) xkLock_VRelease(kLock lock); 
 
+kFx(kBool) xkLock_TryAcquire(kLock lock); 
+kFx(kStatus) xkLock_Acquire(kLock lock, k64u timeout); 
+kFx(kStatus) xkLock_Release(kLock lock); 
+kFx(kStatus) xkLock_AcquireAdaptive(kLock lock, k64u timeout); 
+
+kFx(kStatus) xkLock_EnterProfiled(kLock lock, k64u timeout); 
+kFx(void) xkLock_ExitProfiled(kLock lock); 
+kFx(kStatus) xkLock_ReleaseProfile(kLock lock); 
+
+kFx(void) xkLock_EnterRegistry(); 
+kFx(void) xkLock_ExitRegistry(); 
+kFx(void) xkLock_Register(xkLockProfile* profile); 
+kFx(void) xkLock_Unregister(xkLockProfile* profile); 
+
 #endif
 
 #endif
@@ -66,12 +66,14 @@ kFx(kStatus) xkMsgQueue_Init(kMsgQueue queue, kType type, kType itemType, kAlloc
     obj->onDrop.function = kNULL; 
     obj->onDrop.receiver = kNULL;
     obj->dropCount = 0;
+    obj->highWatermark = 0;
 
     kTry
     {
         kTest(xkMsgQueue_Layout(queue, itemType)); 
         kTest(kSemaphore_Construct(&obj->canRemove, 0, allocator)); 
         kTest(kLock_Construct(&obj->lock, allocator)); 
+        kTest(kLock_SetName(obj->lock, "kMsgQueue.lock")); 
     }
     kCatch(&status)
     {
@@ -154,6 +156,13 @@ kFx(kStatus) kMsgQueue_SetDropHandler(kMsgQueue queue, kMsgQueueDropFx onDrop, k
     return kOK; 
 }
 
+kFx(kStatus) kMsgQueue_SetName(kMsgQueue queue, const kChar* name)
+{
+    kObj(kMsgQueue, queue); 
+
+    return kLock_SetName(obj->lock, name); 
+}
+
 kFx(kStatus) kMsgQueue_SetMaxSize(kMsgQueue queue, kSize size)
 {
     kObj(kMsgQueue, queue); 
@@ -249,6 +258,8 @@ kFx(kStatus) kMsgQueue_AddEx(kMsgQueue queue, void* item, kMsgQueueItemOption op
             xkMsgQueue_Prune(queue, xkMSG_QUEUE_NORMAL_PRUNE_OPTIONS, obj->maxCount, obj->maxSize); 
         }
         
+        obj->highWatermark = kMax_(obj->highWatermark, obj->count - obj->inbandCount); 
+
         if (obj->pruneCount > 0)
         {       
             shouldPost = kFALSE; 
@@ -551,3 +562,17 @@ kFx(k64u) kMsgQueue_DropCount(kMsgQueue queue)
     
     return dropCount; 
 }
+
+kFx(kSize) kMsgQueue_HighWatermark(kMsgQueue queue)
+{
+    kObj(kMsgQueue, queue); 
+    kSize highWatermark = 0; 
+
+    kLock_Enter(obj->lock); 
+    {
+        highWatermark = obj->highWatermark; 
+    }
+    kLock_Exit(obj->lock); 
+    
+    return highWatermark; 
+}
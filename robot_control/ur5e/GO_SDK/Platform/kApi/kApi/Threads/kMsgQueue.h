@@ -222,6 +222,20 @@ kFx(kStatus) kMsgQueue_Reserve(kMsgQueue queue, kSize count);
  */
 kFx(kStatus) kMsgQueue_SetDropHandler(kMsgQueue queue, kMsgQueueDropFx onDrop, kPointer receiver);
 
+/** 
+ * Sets the name under which the queue's internal lock is profiled (default: "kMsgQueue.lock").
+ *
+ * See kLock_SetName and kLock_EnableProfiling. 
+ * 
+ * This method is not thread-safe. 
+ *
+ * @public              @memberof kMsgQueue
+ * @param   queue       Queue object. 
+ * @param   name        Lock name (need not be unique).
+ * @return              Operation status. 
+ */
+kFx(kStatus) kMsgQueue_SetName(kMsgQueue queue, const kChar* name);
+
 /** 
  * Adds an item to the queue. 
  * 
@@ -444,4 +458,15 @@ kFx(kSize) kMsgQueue_DataSize(kMsgQueue queue);
  */
 kFx(k64u) kMsgQueue_DropCount(kMsgQueue queue);
 
+/** 
+ * Reports the largest count of items that the queue has held since it was constructed. 
+ *
+ * This method is thread-safe. 
+ *
+ * @public              @memberof kMsgQueue
+ * @param   queue       Queue object. 
+ * @return              Largest count of items. 
+ */
+kFx(kSize) kMsgQueue_HighWatermark(kMsgQueue queue);
+
 #endif
@@ -52,6 +52,7 @@ typedef struct kMsgQueueClass
     kLock lock;                         //mutual exclusion lock 
     kCallback onDrop;                   //drop handler
     k64u dropCount;                     //number of items dropped 
+    kSize highWatermark;                //largest count of items held
 } kMsgQueueClass;
 
 kDeclareClassEx(k, kMsgQueue, kObject)
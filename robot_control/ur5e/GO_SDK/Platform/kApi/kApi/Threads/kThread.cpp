@@ -13,6 +13,7 @@
 #include <kApi/Data/kMath.h>
 #include <kApi/Threads/kSemaphore.h>
 #include <kApi/Threads/kTimer.h>
+#include <kApi/Utils/kTrace.h>
 #include <kApi/Utils/kUtils.h>
 
 /*
@@ -431,8 +432,12 @@ unsigned int __stdcall xkThread_EntryPoint(void *arg)
 {
     kObj(kThread, arg); 
     
+    xkTrace_SetThreadName(obj->name);
+
     unsigned int result = (unsigned int) obj->function(obj->context);
 
+    xkTrace_ExitThread();
+
     if (xkTHREAD_LOG_ENABLED)
     {    
         kLogf("kThread: %s exited (%s).", obj->name, kStatus_Name(result)); 
@@ -871,8 +876,12 @@ void* xkThread_EntryPoint(void* arg)
     //signal that thread has started 
     kSemaphore_Post(obj->hasStarted); 
     
+    xkTrace_SetThreadName(obj->name);
+
     kStatus result = obj->function(obj->context);
 
+    xkTrace_ExitThread();
+
     //signal thread completion
     kSemaphore_Post(obj->hasJoined); 
 
@@ -1070,8 +1079,12 @@ void* xkThread_EntryPoint(void* arg)
     kThread thread = arg;
     kObj(kThread, thread); 
   
+    xkTrace_SetThreadName(obj->name);
+
     kStatus result = obj->function(obj->context);
 
+    xkTrace_ExitThread();
+
     //signal thread completion
     kSemaphore_Post(obj->hasJoined); 
 
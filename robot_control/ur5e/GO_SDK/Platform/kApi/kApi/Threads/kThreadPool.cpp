@@ -14,6 +14,7 @@
 #include <kApi/Threads/kMsgQueue.h>
 #include <kApi/Threads/kSemaphore.h>
 #include <kApi/Threads/kThread.h>
+#include <kApi/Utils/kTrace.h>
 
 /*
  * kThreadPoolJob
@@ -127,8 +128,12 @@ kFx(kStatus) xkThreadPoolJob_Execute(kThreadPoolJob job)
 {
     kObj(kThreadPoolJob, job);
 
+    kTrace_Begin("kThreadPool.Job"); 
+
     obj->status = obj->entryFx(obj->entryContext); 
 
+    kTrace_End("kThreadPool.Job"); 
+
     return kOK; 
 }
 
@@ -238,6 +243,7 @@ kFx(kStatus) xkThreadPool_Init(kThreadPool pool, kType type, kSize threadCount,
         kTest(kLock_ConstructEx(&obj->configLock, xkLOCK_OPTION_PRIORITY_INHERITANCE, alloc));
 
         kTest(kLock_ConstructEx(&obj->queueLock, xkLOCK_OPTION_PRIORITY_INHERITANCE, alloc));
+        kTest(kLock_SetName(obj->queueLock, "kThreadPool.queueLock"));
 
         kTest(kQueue_Construct(&obj->freeJobQueue, kTypeOf(kThreadPoolJob), initialJobCount, alloc));
         
@@ -250,6 +256,7 @@ kFx(kStatus) xkThreadPool_Init(kThreadPool pool, kType type, kSize threadCount,
         }
 
         kTest(kMsgQueue_Construct(&obj->jobQueue, kTypeOf(kThreadPoolJob), alloc));
+        kTest(kMsgQueue_SetName(obj->jobQueue, "kThreadPool.jobQueue"));
         kTest(kMsgQueue_Reserve(obj->jobQueue, initialJobCount));
 
         kTest(kArray1_Construct(&obj->threads, kTypeOf(kThread), threadCount, alloc));
@@ -0,0 +1,771 @@
+/** 
+ * @file    kStatsAlloc.cpp
+ *
+ * @internal
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#include <kApi/Utils/kStatsAlloc.h>
+#include <kApi/Data/kArrayList.h>
+#include <kApi/Data/kMap.h>
+#include <kApi/Data/kString.h>
+#include <kApi/Threads/kLock.h>
+#include <kApi/Threads/kPeriodic.h>
+#include <kApi/Threads/kTimer.h>
+#include <kApi/Utils/kBackTrace.h>
+
+kBeginValueEx(k, kStatsAllocInfo)
+    kAddField(kStatsAllocInfo, k64u, liveBytes)
+    kAddField(kStatsAllocInfo, k64u, peakBytes)
+    kAddField(kStatsAllocInfo, k64u, liveCount)
+    kAddField(kStatsAllocInfo, k64u, allocCount)
+    kAddField(kStatsAllocInfo, k64f, allocRate)
+    kAddField(kStatsAllocInfo, k64f, byteRate)
+kEndValueEx()
+
+kBeginValueEx(k, kStatsAllocTypeInfo)
+    kAddField(kStatsAllocTypeInfo, kPointer, type)
+    kAddField(kStatsAllocTypeInfo, kStatsAllocInfo, info)
+kEndValueEx()
+
+kBeginValueEx(k, xkStatsAllocSample)
+    kAddField(xkStatsAllocSample, kSize, size)
+    kAddField(xkStatsAllocSample, k32u, weight)
+    kAddField(xkStatsAllocSample, kBool, counted)
+kEndValueEx()
+
+kBeginValueEx(k, xkStatsAllocTypeRecord)
+    kAddField(xkStatsAllocTypeRecord, kStatsAllocInfo, info)
+    kAddField(xkStatsAllocTypeRecord, k64u, pendingCount)
+    kAddField(xkStatsAllocTypeRecord, k64u, pendingBytes)
+kEndValueEx()
+
+kBeginClassEx(k, kStatsAlloc)
+    kAddPrivateVMethod(kStatsAlloc, kObject, VRelease)
+    kAddPrivateVMethod(kStatsAlloc, kAlloc, VGet)
+    kAddPrivateVMethod(kStatsAlloc, kAlloc, VFree)
+kEndClassEx()
+
+//assigned to each thread on first use, to select a counter shard (0: not yet assigned)
+static xkSTATS_ALLOC_THREAD_LOCAL k32u xkStatsAlloc_threadIndex = 0; 
+static kAtomic32s xkStatsAlloc_threadCount = 0; 
+
+kFx(kStatus) kStatsAlloc_Construct(kStatsAlloc* object, const kChar* name, kAlloc innerAlloc, kAlloc allocator)
+{
+    kAlloc alloc = kAlloc_Fallback(allocator);
+    kStatus status; 
+
+    kCheck(kAlloc_GetObject(alloc, kTypeOf(kStatsAlloc), object)); 
+
+    if (!kSuccess(status = xkStatsAlloc_Init(*object, kTypeOf(kStatsAlloc), name, innerAlloc, alloc)))
+    {
+        kAlloc_FreeRef(alloc, object); 
+    }
+
+    return status; 
+} 
+
+kFx(kStatus) xkStatsAlloc_Init(kStatsAlloc object, kType type, const kChar* name, kAlloc innerAlloc, kAlloc alloc)
+{
+    kObjR(kStatsAlloc, object); 
+    kStatus exception = kOK; 
+    kSize i; 
+
+    kCheck(kAlloc_Init(object, type, alloc)); 
+
+    obj->base.traits = kAlloc_Traits(innerAlloc);
+
+    obj->innerAlloc = innerAlloc; 
+    obj->name[0] = 0;
+    obj->samplePeriod = xkSTATS_ALLOC_DEFAULT_SAMPLE_PERIOD; 
+    obj->captureTraces = kFALSE; 
+    obj->merger = kNULL; 
+    obj->lock = kNULL;
+    obj->samples = kNULL;
+    obj->types = kNULL;
+    obj->mergeTime = kTimer_Now(); 
+
+    kZero(obj->previous); 
+    kZero(obj->classInfo); 
+    kZero(obj->totalInfo); 
+
+    for (i = 0; i < kCountOf(obj->shards); ++i)
+    {
+        kZero(obj->shards[i]); 
+        kAtomic32s_Init(&obj->shards[i].lock, 0); 
+        obj->shards[i].sampleSeed = (k32u)(i + 1); 
+    }
+
+    kTry
+    {
+        kTestArgs(!kIsNull(innerAlloc)); 
+
+        if (!kIsNull(name))
+        {
+            kTest(kStrCopy(obj->name, kCountOf(obj->name), name)); 
+        }
+
+        kTest(kLock_ConstructEx(&obj->lock, xkLOCK_OPTION_PRIORITY_INHERITANCE, alloc));         
+        kTest(kMap_Construct(&obj->samples, kTypeOf(kPointer), kTypeOf(xkStatsAllocSample), 0, alloc)); 
+        kTest(kMap_Construct(&obj->types, kTypeOf(kPointer), kTypeOf(xkStatsAllocTypeRecord), 0, alloc)); 
+        kTest(kPeriodic_Construct(&obj->merger, alloc)); 
+    }
+    kCatch(&exception)
+    {
+        xkStatsAlloc_VRelease(object); 
+        kEndCatch(exception); 
+    }
+
+    return kOK; 
+}
+
+kFx(kStatus) xkStatsAlloc_VRelease(kStatsAlloc object)
+{
+    kObj(kStatsAlloc, object); 
+
+    kCheck(kObject_Destroy(obj->merger)); 
+
+    if (!kIsNull(obj->samples))
+    {
+        kMapItem it = kMap_First(obj->samples); 
+
+        while (!kIsNull(it))
+        {
+            kCheck(kObject_Destroy(kMap_ValueT(obj->samples, it, xkStatsAllocSample)->trace)); 
+
+            it = kMap_Next(obj->samples, it); 
+        }
+    }
+
+    kCheck(kObject_Destroy(obj->samples)); 
+    kCheck(kObject_Destroy(obj->types)); 
+    kCheck(kObject_Destroy(obj->lock)); 
+
+    return kAlloc_VRelease(object); 
+}
+
+kFx(kStatus) kStatsAlloc_SetSampling(kStatsAlloc object, k32u period, kBool captureTraces)
+{
+    kObj(kStatsAlloc, object); 
+
+    obj->samplePeriod = period; 
+    obj->captureTraces = captureTraces; 
+
+    return kOK; 
+}
+
+kFx(kStatus) kStatsAlloc_SetMergePeriod(kStatsAlloc object, k64u period)
+{
+    kObj(kStatsAlloc, object); 
+
+    kCheck(kPeriodic_Stop(obj->merger)); 
+
+    if (period > 0)
+    {
+        kCheck(kPeriodic_Start(obj->merger, period, xkStatsAlloc_OnMerge, object)); 
+    }
+
+    return kOK; 
+}
+
+kFx(kStatus) xkStatsAlloc_OnMerge(kStatsAlloc object, kPeriodic timer)
+{
+    return kStatsAlloc_Merge(object); 
+}
+
+kFx(kStatus) kStatsAlloc_Merge(kStatsAlloc object)
+{
+    kObj(kStatsAlloc, object); 
+
+    kCheck(kLock_Enter(obj->lock)); 
+
+    kTry
+    {
+        k64u now = kTimer_Now(); 
+        k64f interval = (k64f)(now - obj->mergeTime) / 1000000.0; 
+
+        kTest(xkStatsAlloc_MergeCounters(object, interval)); 
+        kTest(xkStatsAlloc_MergeTypes(object, interval)); 
+
+        obj->mergeTime = now; 
+    }
+    kFinally
+    {
+        kCheck(kLock_Exit(obj->lock)); 
+        kEndFinally(); 
+    }
+
+    return kOK; 
+}
+
+// Combines the shard counters into statistics per size class, and overall. 
+kFx(kStatus) xkStatsAlloc_MergeCounters(kStatsAlloc object, k64f interval)
+{
+    kObj(kStatsAlloc, object); 
+    xkStatsAllocCounters counters[xkSTATS_ALLOC_SIZE_CLASS_COUNT]; 
+    k64u totalLive = 0; 
+    k64u totalLiveCount = 0; 
+    k64u totalAllocs = 0; 
+    k64u totalAllocBytes = 0; 
+    k64u totalPrevAllocs = 0; 
+    k64u totalPrevAllocBytes = 0; 
+    kSize i, j; 
+
+    kZero(counters); 
+
+    for (i = 0; i < kCountOf(obj->shards); ++i)
+    {
+        xkStatsAllocShard* shard = &obj->shards[i]; 
+
+        xkAtomic32s_EnterSpinGuard(&shard->lock); 
+
+        for (j = 0; j < kCountOf(counters); ++j)
+        {
+            counters[j].allocCount += shard->classes[j].allocCount; 
+            counters[j].allocBytes += shard->classes[j].allocBytes; 
+            counters[j].freeCount += shard->classes[j].freeCount; 
+            counters[j].freeBytes += shard->classes[j].freeBytes; 
+        }
+
+        xkStatsAlloc_ExitShard(shard); 
+    }
+
+    for (j = 0; j < kCountOf(counters); ++j)
+    {
+        kStatsAllocInfo* info = &obj->classInfo[j]; 
+
+        //shards are read one at a time, so a block freed on another thread can briefly appear to be 
+        //freed before it was allocated
+        info->liveBytes = (counters[j].allocBytes > counters[j].freeBytes) ? counters[j].allocBytes - counters[j].freeBytes : 0; 
+        info->liveCount = (counters[j].allocCount > counters[j].freeCount) ? counters[j].allocCount - counters[j].freeCount : 0; 
+        info->peakBytes = kMax_(info->peakBytes, info->liveBytes); 
+        info->allocCount = counters[j].allocCount; 
+
+        xkStatsAlloc_UpdateRates(info, counters[j].allocCount - obj->previous[j].allocCount, counters[j].allocBytes - obj->previous[j].allocBytes, interval); 
+
+        totalLive += info->liveBytes; 
+        totalLiveCount += info->liveCount; 
+        totalAllocs += counters[j].allocCount; 
+        totalAllocBytes += counters[j].allocBytes; 
+        totalPrevAllocs += obj->previous[j].allocCount; 
+        totalPrevAllocBytes += obj->previous[j].allocBytes; 
+
+        obj->previous[j] = counters[j]; 
+    }
+
+    obj->totalInfo.liveBytes = totalLive; 
+    obj->totalInfo.liveCount = totalLiveCount; 
+    obj->totalInfo.peakBytes = kMax_(obj->totalInfo.peakBytes, totalLive); 
+    obj->totalInfo.allocCount = totalAllocs; 
+
+    xkStatsAlloc_UpdateRates(&obj->totalInfo, totalAllocs - totalPrevAllocs, totalAllocBytes - totalPrevAllocBytes, interval); 
+
+    return kOK; 
+}
+
+// Recomputes estimated statistics per object type from the outstanding samples.
+kFx(kStatus) xkStatsAlloc_MergeTypes(kStatsAlloc object, k64f interval)
+{
+    kObj(kStatsAlloc, object); 
+    kMapItem it = kNULL; 
+
+    for (it = kMap_First(obj->types); !kIsNull(it); it = kMap_Next(obj->types, it))
+    {
+        xkStatsAllocTypeRecord* record = kMap_ValueT(obj->types, it, xkStatsAllocTypeRecord); 
+
+        record->info.liveBytes = 0; 
+        record->info.liveCount = 0; 
+    }
+
+    for (it = kMap_First(obj->samples); !kIsNull(it); it = kMap_Next(obj->samples, it))
+    {
+        kByte* data = kMap_KeyAsT(obj->samples, it, kByte*); 
+        xkStatsAllocSample* sample = kMap_ValueT(obj->samples, it, xkStatsAllocSample); 
+        xkStatsAllocTypeRecord* record = kNULL; 
+        kMapItem recordItem = kNULL; 
+
+        //the type is fixed once counted; a sample seen before its header was initialized stays 
+        //attributed to the null type, so that its record can always be found below
+        if (!sample->counted)
+        {
+            if (kIsNull(sample->type))
+            {
+                sample->type = xkStatsAlloc_ObjectType(object, data, sample->size, kTRUE); 
+            }
+
+            kCheck(xkStatsAlloc_CountSample(object, sample)); 
+        }
+
+        kCheck(kMap_FindItemT(obj->types, &sample->type, &recordItem)); 
+        record = kMap_ValueT(obj->types, recordItem, xkStatsAllocTypeRecord); 
+
+        record->info.liveBytes += (k64u)sample->size * sample->weight; 
+        record->info.liveCount += sample->weight; 
+    }
+
+    for (it = kMap_First(obj->types); !kIsNull(it); it = kMap_Next(obj->types, it))
+    {
+        xkStatsAllocTypeRecord* record = kMap_ValueT(obj->types, it, xkStatsAllocTypeRecord); 
+
+        record->info.peakBytes = kMax_(record->info.peakBytes, record->info.liveBytes); 
+        record->info.allocCount += record->pendingCount; 
+
+        xkStatsAlloc_UpdateRates(&record->info, record->pendingCount, record->pendingBytes, interval); 
+
+        record->pendingCount = 0; 
+        record->pendingBytes = 0; 
+    }
+
+    return kOK; 
+}
+
+kFx(void) xkStatsAlloc_UpdateRates(kStatsAllocInfo* info, k64u count, k64u bytes, k64f interval)
+{
+    if (interval > 0)
+    {
+        info->allocRate = (k64f)count / interval; 
+        info->byteRate = (k64f)bytes / interval; 
+    }
+}
+
+kFx(kStatus) kStatsAlloc_Stats(kStatsAlloc object, kStatsAllocInfo* info)
+{
+    kObj(kStatsAlloc, object); 
+
+    kCheck(kLock_Enter(obj->lock)); 
+    {
+        *info = obj->totalInfo; 
+    }
+    kCheck(kLock_Exit(obj->lock)); 
+
+    return kOK; 
+}
+
+kFx(kSize) kStatsAlloc_SizeClassCount()
+{
+    return xkSTATS_ALLOC_SIZE_CLASS_COUNT; 
+}
+
+kFx(k64u) kStatsAlloc_SizeClassLimit(kSize index)
+{
+    return (index + 1 < xkSTATS_ALLOC_SIZE_CLASS_COUNT) ? ((k64u)xkSTATS_ALLOC_MIN_CLASS_SIZE << index) : k64U_MAX; 
+}
+
+kFx(kStatus) kStatsAlloc_SizeClassStats(kStatsAlloc object, kSize index, kStatsAllocInfo* info)
+{
+    kObj(kStatsAlloc, object); 
+
+    kCheckArgs(index < xkSTATS_ALLOC_SIZE_CLASS_COUNT); 
+
+    kCheck(kLock_Enter(obj->lock)); 
+    {
+        *info = obj->classInfo[index]; 
+    }
+    kCheck(kLock_Exit(obj->lock)); 
+
+    return kOK; 
+}
+
+kFx(kStatus) kStatsAlloc_TypeStats(kStatsAlloc object, kArrayList* types, kAlloc allocator)
+{
+    kObj(kStatsAlloc, object); 
+    kArrayList output = kNULL; 
+    kSize i, j; 
+
+    kCheck(kLock_Enter(obj->lock)); 
+
+    kTry
+    {
+        kMapItem it = kNULL; 
+
+        kTest(kArrayList_Construct(&output, kTypeOf(kStatsAllocTypeInfo), kMap_Count(obj->types), allocator)); 
+
+        for (it = kMap_First(obj->types); !kIsNull(it); it = kMap_Next(obj->types, it))
+        {
+            kStatsAllocTypeInfo item; 
+
+            item.type = kMap_KeyAsT(obj->types, it, kType); 
+            item.info = kMap_ValueT(obj->types, it, xkStatsAllocTypeRecord)->info; 
+
+            kTest(kArrayList_AddT(output, &item)); 
+        }
+
+        //insertion sort, by decreasing live bytes (the number of types is modest)
+        for (i = 1; i < kArrayList_Count(output); ++i)
+        {
+            kStatsAllocTypeInfo item = kArrayList_AsT(output, i, kStatsAllocTypeInfo); 
+
+            for (j = i; (j > 0) && (kArrayList_AtT(output, j-1, kStatsAllocTypeInfo)->info.liveBytes < item.info.liveBytes); --j)
+            {
+                kArrayList_SetAsT(output, j, kArrayList_AsT(output, j-1, kStatsAllocTypeInfo), kStatsAllocTypeInfo); 
+            }
+
+            kArrayList_SetAsT(output, j, item, kStatsAllocTypeInfo); 
+        }
+
+        *types = output; 
+        output = kNULL; 
+    }
+    kFinally
+    {
+        kObject_Destroy(output); 
+
+        kCheck(kLock_Exit(obj->lock)); 
+        kEndFinally(); 
+    }
+
+    return kOK; 
+}
+
+kFx(kStatus) kStatsAlloc_LogSamples(kStatsAlloc object, kSize count)
+{
+    kObj(kStatsAlloc, object); 
+    kMap groups = kNULL;                //weighted live bytes per back trace -- kMap<kBackTrace, k64u>
+    kArrayList lines = kNULL; 
+    kSize i, j; 
+
+    kCheck(kLock_Enter(obj->lock)); 
+
+    kTry
+    {
+        kMapItem it = kNULL; 
+
+        kTest(kMap_Construct(&groups, kTypeOf(kBackTrace), kTypeOf(k64u), 0, kObject_Alloc(object))); 
+
+        for (it = kMap_First(obj->samples); !kIsNull(it); it = kMap_Next(obj->samples, it))
+        {
+            const xkStatsAllocSample* sample = kMap_ValueT(obj->samples, it, xkStatsAllocSample); 
+            k64u bytes = (k64u)sample->size * sample->weight; 
+            kMapItem groupItem = kNULL; 
+
+            if (!kIsNull(sample->trace))
+            {
+                if (kSuccess(kMap_FindItemT(groups, &sample->trace, &groupItem)))
+                {
+                    bytes += kMap_ValueAsT(groups, groupItem, k64u); 
+                    kMap_SetValueT(groups, groupItem, &bytes); 
+                }
+                else
+                {
+                    kTest(kMap_AddT(groups, &sample->trace, &bytes)); 
+                }
+            }
+        }
+
+        kLogf("%s: %llu back traces for sampled live allocations.", obj->name, (k64u)kMap_Count(groups)); 
+
+        //repeatedly select and log the largest remaining group
+        for (i = 0; (i < count) && (kMap_Count(groups) > 0); ++i)
+        {
+            kMapItem largest = kMap_First(groups); 
+            kBackTrace trace = kNULL; 
+
+            for (it = kMap_Next(groups, largest); !kIsNull(it); it = kMap_Next(groups, it))
+            {
+                if (kMap_ValueAsT(groups, it, k64u) > kMap_ValueAsT(groups, largest, k64u))
+                {
+                    largest = it; 
+                }
+            }
+
+            trace = kMap_KeyAsT(groups, largest, kBackTrace); 
+
+            kLogf("  Estimated live bytes: %llu", kMap_ValueAsT(groups, largest, k64u)); 
+
+            kTest(kBackTrace_Describe(trace, &lines, kObject_Alloc(object))); 
+
+            for (j = 0; j < kArrayList_Count(lines); ++j)
+            {
+                kLogf("    %s", kString_Chars(kArrayList_AsT(lines, j, kString))); 
+            }
+
+            kTest(kDisposeRef(&lines)); 
+            kTest(kMap_RemoveItem(groups, largest)); 
+        }
+    }
+    kFinally
+    {
+        kObject_Dispose(lines); 
+        kObject_Destroy(groups); 
+
+        kCheck(kLock_Exit(obj->lock)); 
+        kEndFinally(); 
+    }
+
+    return kOK; 
+}
+
+kFx(k32u) xkStatsAlloc_SizeClass(kSize size)
+{
+    kSize limit = xkSTATS_ALLOC_MIN_CLASS_SIZE; 
+    k32u index = 0; 
+
+    while ((size > limit) && (index + 1 < xkSTATS_ALLOC_SIZE_CLASS_COUNT))
+    {
+        limit <<= 1; 
+        index++; 
+    }
+
+    return index; 
+}
+
+// Chooses the number of allocations until the next sample. The interval is varied around the sampling 
+// period, so that sampling does not lock step with repetitive allocation patterns. 
+kFx(k32u) xkStatsAlloc_NextInterval(xkStatsAllocShard* shard, k32u period)
+{
+    k32u x = shard->sampleSeed; 
+
+    if (period <= 1)
+    {
+        return period; 
+    }
+
+    //xorshift32
+    x ^= x << 13; 
+    x ^= x >> 17; 
+    x ^= x << 5; 
+
+    shard->sampleSeed = x; 
+
+    //uniform in [1, 2*period - 1], averaging period
+    return 1 + (x % (2 * period - 1)); 
+}
+
+// Locks the counter shard for the calling thread. 
+kFx(xkStatsAllocShard*) xkStatsAlloc_EnterShard(kStatsAlloc object)
+{
+    kObj(kStatsAlloc, object); 
+    xkStatsAllocShard* shard = kNULL; 
+
+    if (xkStatsAlloc_threadIndex == 0)
+    {
+        xkStatsAlloc_threadIndex = (k32u) kAtomic32s_Increment(&xkStatsAlloc_threadCount); 
+    }
+
+    shard = &obj->shards[(xkStatsAlloc_threadIndex - 1) % xkSTATS_ALLOC_SHARD_COUNT]; 
+
+    xkAtomic32s_EnterSpinGuard(&shard->lock); 
+
+    return shard; 
+}
+
+kFx(void) xkStatsAlloc_ExitShard(xkStatsAllocShard* shard)
+{
+    xkAtomic32s_ExitSpinGuard(&shard->lock); 
+}
+
+kFx(kStatus) xkStatsAlloc_VGet(kStatsAlloc object, kSize size, void* mem, kMemoryAlignment alignment)
+{
+    kObj(kStatsAlloc, object); 
+    kSize alignmentSize = kMemoryAlignment_Size(alignment); 
+    kSize prefix = alignmentSize; 
+    k32u sizeClass = xkStatsAlloc_SizeClass(size); 
+    k32u sampleWeight = 0; 
+    xkStatsAllocShard* shard = kNULL; 
+    xkStatsAllocHeader* header = kNULL; 
+    kByte* allocatedMem = kNULL; 
+    kByte* data = kNULL; 
+
+    //the header immediately precedes the data; the prefix preserves the requested alignment
+    while (prefix < sizeof(xkStatsAllocHeader))
+    {
+        prefix += alignmentSize; 
+    }
+
+    kCheck(kAlloc_Get(obj->innerAlloc, size + prefix, &allocatedMem, alignment)); 
+
+    data = allocatedMem + prefix; 
+    header = (xkStatsAllocHeader*)(data - sizeof(xkStatsAllocHeader)); 
+
+    header->size = size; 
+    header->prefix = (k32u) prefix; 
+    header->sampled = kFALSE; 
+
+    shard = xkStatsAlloc_EnterShard(object); 
+    {
+        shard->classes[sizeClass].allocCount++; 
+        shard->classes[sizeClass].allocBytes += size; 
+
+        if (shard->sampleCountdown > 1)
+        {
+            shard->sampleCountdown--; 
+        }
+        else
+        {
+            k32u period = obj->samplePeriod; 
+
+            sampleWeight = (shard->sampleCountdown == 1) ? period : 0; 
+            shard->sampleCountdown = xkStatsAlloc_NextInterval(shard, period); 
+        }
+    }
+    xkStatsAlloc_ExitShard(shard); 
+
+    //sampling failures only affect the statistics
+    if ((sampleWeight > 0) && kSuccess(xkStatsAlloc_AddSample(object, data, size, sampleWeight)))
+    {
+        header->sampled = kTRUE; 
+    }
+
+    *(void**)mem = data; 
+
+    return kOK; 
+}
+
+kFx(kStatus) xkStatsAlloc_VFree(kStatsAlloc object, void* mem)
+{
+    kObj(kStatsAlloc, object); 
+
+    if (!kIsNull(mem))
+    {
+        xkStatsAllocHeader* header = (xkStatsAllocHeader*)((kByte*)mem - sizeof(xkStatsAllocHeader)); 
+        kSize size = header->size; 
+        k32u sizeClass = xkStatsAlloc_SizeClass(size); 
+        xkStatsAllocShard* shard = kNULL; 
+
+        if (header->sampled)
+        {
+            xkStatsAlloc_RemoveSample(object, (kByte*)mem); 
+        }
+
+        shard = xkStatsAlloc_EnterShard(object); 
+        {
+            shard->classes[sizeClass].freeCount++; 
+            shard->classes[sizeClass].freeBytes += size; 
+        }
+        xkStatsAlloc_ExitShard(shard); 
+
+        kCheck(kAlloc_Free(obj->innerAlloc, (kByte*)mem - header->prefix)); 
+    }
+
+    return kOK; 
+}
+
+kFx(kStatus) xkStatsAlloc_AddSample(kStatsAlloc object, kByte* data, kSize size, k32u weight)
+{
+    kObj(kStatsAlloc, object); 
+    xkStatsAllocSample sample; 
+
+    sample.size = size; 
+    sample.weight = weight; 
+    sample.counted = kFALSE; 
+    sample.type = kNULL; 
+    sample.trace = kNULL; 
+
+    //clear any stale object header, so that the block is identified only once initialized
+    kMemSet(data, 0, kMin_(size, sizeof(kObjectClass))); 
+
+    if (obj->captureTraces)
+    {
+        kCheck(kBackTrace_Construct(&sample.trace, kObject_Alloc(object))); 
+
+        if (!kSuccess(kBackTrace_Capture(sample.trace, 2)))
+        {
+            kDestroyRef(&sample.trace); 
+        }
+    }
+
+    kCheck(kLock_Enter(obj->lock)); 
+
+    kTry
+    {
+        kTest(kMap_AddT(obj->samples, &data, &sample)); 
+        sample.trace = kNULL; 
+    }
+    kFinally
+    {
+        kObject_Destroy(sample.trace); 
+
+        kCheck(kLock_Exit(obj->lock)); 
+        kEndFinally(); 
+    }
+
+    return kOK; 
+}
+
+kFx(kStatus) xkStatsAlloc_RemoveSample(kStatsAlloc object, kByte* data)
+{
+    kObj(kStatsAlloc, object); 
+    kMapItem item = kNULL; 
+
+    kCheck(kLock_Enter(obj->lock)); 
+
+    kTry
+    {
+        if (kSuccess(kMap_FindItemT(obj->samples, &data, &item)))
+        {
+            xkStatsAllocSample* sample = kMap_ValueT(obj->samples, item, xkStatsAllocSample); 
+
+            //short-lived allocations are counted here, if they were not seen by a merge
+            if (!sample->counted)
+            {
+                if (kIsNull(sample->type))
+                {
+                    sample->type = xkStatsAlloc_ObjectType(object, data, sample->size, kFALSE); 
+                }
+
+                kTest(xkStatsAlloc_CountSample(object, sample)); 
+            }
+
+            kObject_Destroy(sample->trace); 
+            kTest(kMap_RemoveItem(obj->samples, item)); 
+        }
+    }
+    kFinally
+    {
+        kCheck(kLock_Exit(obj->lock)); 
+        kEndFinally(); 
+    }
+
+    return kOK; 
+}
+
+// Adds a sampled allocation to the allocation counts of its type. 
+kFx(kStatus) xkStatsAlloc_CountSample(kStatsAlloc object, xkStatsAllocSample* sample)
+{
+    kObj(kStatsAlloc, object); 
+    kMapItem item = kNULL; 
+    xkStatsAllocTypeRecord* record = kNULL; 
+
+    if (!kSuccess(kMap_FindItemT(obj->types, &sample->type, &item)))
+    {
+        xkStatsAllocTypeRecord newRecord; 
+
+        kZero(newRecord); 
+
+        kCheck(kMap_AddItemT(obj->types, &sample->type, &newRecord, &item)); 
+    }
+
+    record = kMap_ValueT(obj->types, item, xkStatsAllocTypeRecord); 
+
+    record->pendingCount += sample->weight; 
+    record->pendingBytes += (k64u)sample->size * sample->weight; 
+
+    sample->counted = kTRUE; 
+
+    return kOK; 
+}
+
+// Identifies the type of an object allocated from this allocator, or returns kNULL. 
+kFx(kType) xkStatsAlloc_ObjectType(kStatsAlloc object, const kByte* data, kSize size, kBool isLive)
+{
+    kObj(kStatsAlloc, object); 
+    const kObjectClass* candidate = (const kObjectClass*) data; 
+    kType type = kNULL; 
+
+    if ((size < sizeof(kObjectClass)) || (candidate->alloc != object) || kIsNull(candidate->type))
+    {
+        return kNULL; 
+    }
+
+    type = candidate->type; 
+
+    //a live object carries a valid tag; a released object does not, so its type is accepted only 
+    //if it has already been identified in a live object
+    if (isLive ? !xkObject_RawVerifyTag((kObject)data) : !kMap_Has(obj->types, &type))
+    {
+        return kNULL; 
+    }
+
+    return (kType_InnerSize(type) == size) ? type : kNULL; 
+}
@@ -0,0 +1,176 @@
+/** 
+ * @file    kStatsAlloc.h
+ * @brief   Declares the kStatsAlloc class. 
+ *
+ * @internal
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef K_API_STATS_ALLOC_H
+#define K_API_STATS_ALLOC_H
+
+#include <kApi/kApiDef.h>
+
+/**
+ * @struct  kStatsAllocInfo
+ * @extends kValue
+ * @ingroup kApi-Utils
+ * @brief   Memory usage statistics reported by kStatsAlloc.
+ */
+typedef struct kStatsAllocInfo
+{
+    k64u liveBytes;         ///< Bytes currently allocated.
+    k64u peakBytes;         ///< Largest value of liveBytes observed at a merge.
+    k64u liveCount;         ///< Count of outstanding allocations.
+    k64u allocCount;        ///< Total count of allocations.
+    k64f allocRate;         ///< Allocations per second, between the two most recent merges.
+    k64f byteRate;          ///< Bytes allocated per second, between the two most recent merges.
+} kStatsAllocInfo; 
+
+/**
+ * @struct  kStatsAllocTypeInfo
+ * @extends kValue
+ * @ingroup kApi-Utils
+ * @brief   Estimated memory usage statistics for one object type.
+ */
+typedef struct kStatsAllocTypeInfo
+{
+    kType type;             ///< Object type (kNULL for memory that is not an object, such as array buffers).
+    kStatsAllocInfo info;   ///< Statistics, estimated from sampled allocations.
+} kStatsAllocTypeInfo; 
+
+#include <kApi/Utils/kStatsAlloc.x.h>
+
+/**
+ * @class   kStatsAlloc
+ * @extends kAlloc
+ * @ingroup kApi-Utils
+ * @brief   Memory allocator that keeps low-overhead usage statistics.
+ *
+ * kStatsAlloc forwards requests to an inner allocator and counts allocated bytes and 
+ * allocations by size class. Unlike kDebugAlloc, it does not record individual allocations, 
+ * so it is suitable for permanent use in production. Counters are kept in per-thread shards 
+ * and are combined by kStatsAlloc_Merge, either on request or periodically 
+ * (kStatsAlloc_SetMergePeriod); the query functions report the state at the most recent merge.
+ * 
+ * Statistics by object type are estimated by sampling: one in every N allocations is recorded 
+ * on average (optionally with a back trace), identified by its object header, and weighted by N. 
+ * Memory that is not an object header (e.g. array buffers) is reported with a null type.
+ * 
+ * To use kStatsAlloc as the application allocator, construct it within a handler registered 
+ * with kApiLib_SetAppAllocConstructHandler.
+ */
+//typedef kAlloc kStatsAlloc;         --forward-declared in kApiDef.x.h 
+
+/** 
+ * Constructs a new kStatsAlloc allocator. 
+ *
+ * @public               @memberof kStatsAlloc
+ * @param   object       Receives the constructed kStatsAlloc object. 
+ * @param   name         Descriptive name for this memory allocator (or kNULL for none).
+ * @param   innerAlloc   Memory allocator to use for target allocations.
+ * @param   allocator    Memory allocator to use for this object itself (or kNULL for default). 
+ * @return               Operation status. 
+ */
+kFx(kStatus) kStatsAlloc_Construct(kStatsAlloc* object, const kChar* name, kAlloc innerAlloc, kAlloc allocator); 
+
+/** 
+ * Configures allocation sampling. 
+ *
+ * Sampling is enabled by default (one in xkSTATS_ALLOC_DEFAULT_SAMPLE_PERIOD allocations, 
+ * without back traces). 
+ *
+ * @public                  @memberof kStatsAlloc
+ * @param   object          Memory allocator.  
+ * @param   period          Sample one in this many allocations (or zero to disable sampling). 
+ * @param   captureTraces   Capture a back trace with each sample?
+ * @return                  Operation status. 
+ */
+kFx(kStatus) kStatsAlloc_SetSampling(kStatsAlloc object, k32u period, kBool captureTraces); 
+
+/** 
+ * Sets the period at which statistics are merged in a background thread.
+ *
+ * @public              @memberof kStatsAlloc
+ * @param   object      Memory allocator.  
+ * @param   period      Merge period, in microseconds (or zero to merge only on request). 
+ * @return              Operation status. 
+ */
+kFx(kStatus) kStatsAlloc_SetMergePeriod(kStatsAlloc object, k64u period); 
+
+/** 
+ * Combines per-thread counters and sampled allocations into the reported statistics.
+ *
+ * @public              @memberof kStatsAlloc
+ * @param   object      Memory allocator.  
+ * @return              Operation status. 
+ */
+kFx(kStatus) kStatsAlloc_Merge(kStatsAlloc object); 
+
+/** 
+ * Reports overall statistics, as of the most recent merge.
+ *
+ * @public              @memberof kStatsAlloc
+ * @param   object      Memory allocator.  
+ * @param   info        Receives statistics. 
+ * @return              Operation status. 
+ */
+kFx(kStatus) kStatsAlloc_Stats(kStatsAlloc object, kStatsAllocInfo* info); 
+
+/** 
+ * Reports the number of size classes.
+ *
+ * @public              @memberof kStatsAlloc
+ * @return              Count of size classes. 
+ */
+kFx(kSize) kStatsAlloc_SizeClassCount(); 
+
+/** 
+ * Reports the largest allocation size in a size class.
+ *
+ * Size classes are powers of two; the last class has no upper limit (k64U_MAX). 
+ *
+ * @public              @memberof kStatsAlloc
+ * @param   index       Size class index. 
+ * @return              Largest allocation size in the class, in bytes. 
+ */
+kFx(k64u) kStatsAlloc_SizeClassLimit(kSize index); 
+
+/** 
+ * Reports statistics for one size class, as of the most recent merge.
+ *
+ * @public              @memberof kStatsAlloc
+ * @param   object      Memory allocator.  
+ * @param   index       Size class index. 
+ * @param   info        Receives statistics. 
+ * @return              Operation status. 
+ */
+kFx(kStatus) kStatsAlloc_SizeClassStats(kStatsAlloc object, kSize index, kStatsAllocInfo* info); 
+
+/** 
+ * Reports estimated statistics for each object type, as of the most recent merge.
+ *
+ * Types are listed in order of decreasing live bytes. 
+ *
+ * @public              @memberof kStatsAlloc
+ * @param   object      Memory allocator.  
+ * @param   types       Receives a list of statistics -- kArrayList<kStatsAllocTypeInfo>.
+ * @param   allocator   Memory allocator for the list (or kNULL for default). 
+ * @return              Operation status. 
+ */
+kFx(kStatus) kStatsAlloc_TypeStats(kStatsAlloc object, kArrayList* types, kAlloc allocator); 
+
+/** 
+ * Logs the back traces that account for the most sampled memory that is currently allocated.
+ *
+ * Back traces are available only if enabled with kStatsAlloc_SetSampling.
+ *
+ * @public              @memberof kStatsAlloc
+ * @param   object      Memory allocator.  
+ * @param   count       Maximum number of back traces to log.
+ * @return              Operation status. 
+ */
+kFx(kStatus) kStatsAlloc_LogSamples(kStatsAlloc object, kSize count); 
+
+#endif
@@ -0,0 +1,123 @@
+/** 
+ * @file    kStatsAlloc.x.h
+ *
+ * @internal
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef K_API_STATS_ALLOC_X_H
+#define K_API_STATS_ALLOC_X_H
+
+#include <kApi/kAlloc.h>
+#include <kApi/Threads/kAtomic.h>
+
+#define xkSTATS_ALLOC_SHARD_COUNT               (32)            //number of counter shards
+#define xkSTATS_ALLOC_SIZE_CLASS_COUNT          (24)            //number of size classes
+#define xkSTATS_ALLOC_MIN_CLASS_SIZE            (16)            //largest allocation in the first size class
+#define xkSTATS_ALLOC_DEFAULT_SAMPLE_PERIOD     (1024)          //default allocation sampling period
+
+#if defined(K_MSVC)
+#   define xkSTATS_ALLOC_THREAD_LOCAL           __declspec(thread)
+#else
+#   define xkSTATS_ALLOC_THREAD_LOCAL           __thread
+#endif
+
+kDeclareValueEx(k, kStatsAllocInfo, kValue)
+kDeclareValueEx(k, kStatsAllocTypeInfo, kValue)
+
+//Precedes the data of each allocation.
+typedef struct xkStatsAllocHeader
+{
+    kSize size;                         //requested size
+    k32u prefix;                        //offset from the start of the inner allocation to the data
+    k32u sampled;                       //is the allocation recorded in the sample map? 
+} xkStatsAllocHeader; 
+
+typedef struct xkStatsAllocCounters
+{
+    k64u allocCount; 
+    k64u allocBytes; 
+    k64u freeCount; 
+    k64u freeBytes; 
+} xkStatsAllocCounters; 
+
+//Counters for the threads that map to a shard. Threads usually have a shard to themselves, 
+//so the shard lock is normally uncontended. 
+typedef struct xkStatsAllocShard
+{
+    kAtomic32s lock;                    //spin lock; protects all fields below
+    k32u sampleCountdown;               //allocations remaining until the next sample
+    k32u sampleSeed;                    //random state used to vary the sampling interval
+    xkStatsAllocCounters classes[xkSTATS_ALLOC_SIZE_CLASS_COUNT]; 
+    kByte padding[64];                  //keeps the next shard's lock off this shard's cache lines
+} xkStatsAllocShard; 
+
+typedef struct xkStatsAllocSample
+{
+    kSize size;                         //allocation size
+    k32u weight;                        //sampling period when the sample was taken
+    kBool counted;                      //has the allocation been added to its type record? 
+    kType type;                         //object type, once identified
+    kBackTrace trace;                   //allocation back trace (or kNULL)
+} xkStatsAllocSample; 
+
+kDeclareValueEx(k, xkStatsAllocSample, kValue)
+
+typedef struct xkStatsAllocTypeRecord
+{
+    kStatsAllocInfo info;               //estimated statistics, as of the last merge
+    k64u pendingCount;                  //weighted allocations since the last merge
+    k64u pendingBytes;                  //weighted bytes allocated since the last merge
+} xkStatsAllocTypeRecord; 
+
+kDeclareValueEx(k, xkStatsAllocTypeRecord, kValue)
+
+typedef struct kStatsAllocClass
+{
+    kAllocClass base; 
+    kAlloc innerAlloc;                  //inner allocator, used to allocate requested memory
+    kText32 name;                       //descriptive name for this allocator
+    xkStatsAllocShard shards[xkSTATS_ALLOC_SHARD_COUNT];   //per-thread counters
+
+    volatile k32u samplePeriod;         //allocation sampling period (0 to disable)
+    volatile kBool captureTraces;       //capture back traces with samples? 
+    kPeriodic merger;                   //merges statistics in the background
+
+    kLock lock;                         //protects all fields below
+    kMap samples;                       //sampled outstanding allocations -- kMap<kPointer, xkStatsAllocSample>
+    kMap types;                         //statistics per object type -- kMap<kPointer, xkStatsAllocTypeRecord>
+    xkStatsAllocCounters previous[xkSTATS_ALLOC_SIZE_CLASS_COUNT];   //counters at the last merge
+    kStatsAllocInfo classInfo[xkSTATS_ALLOC_SIZE_CLASS_COUNT];       //statistics per size class
+    kStatsAllocInfo totalInfo;          //overall statistics
+    k64u mergeTime;                     //time of the last merge (us)
+} kStatsAllocClass;
+
+kDeclareClassEx(k, kStatsAlloc, kAlloc)
+
+/* 
+* Private methods. 
+*/
+
+kFx(kStatus) xkStatsAlloc_Init(kStatsAlloc object, kType type, const kChar* name, kAlloc innerAlloc, kAlloc alloc); 
+kFx(kStatus) xkStatsAlloc_VRelease(kStatsAlloc object); 
+
+kFx(kStatus) xkStatsAlloc_VGet(kStatsAlloc object, kSize size, void* mem, kMemoryAlignment alignment);
+kFx(kStatus) xkStatsAlloc_VFree(kStatsAlloc object, void* mem); 
+
+kFx(xkStatsAllocShard*) xkStatsAlloc_EnterShard(kStatsAlloc object); 
+kFx(void) xkStatsAlloc_ExitShard(xkStatsAllocShard* shard); 
+kFx(k32u) xkStatsAlloc_SizeClass(kSize size); 
+kFx(k32u) xkStatsAlloc_NextInterval(xkStatsAllocShard* shard, k32u period); 
+
+kFx(kStatus) xkStatsAlloc_AddSample(kStatsAlloc object, kByte* data, kSize size, k32u weight); 
+kFx(kStatus) xkStatsAlloc_RemoveSample(kStatsAlloc object, kByte* data); 
+kFx(kStatus) xkStatsAlloc_CountSample(kStatsAlloc object, xkStatsAllocSample* sample); 
+kFx(kType) xkStatsAlloc_ObjectType(kStatsAlloc object, const kByte* data, kSize size, kBool isLive); 
+
+kFx(kStatus) xkStatsAlloc_OnMerge(kStatsAlloc object, kPeriodic timer); 
+kFx(kStatus) xkStatsAlloc_MergeCounters(kStatsAlloc object, k64f interval); 
+kFx(kStatus) xkStatsAlloc_MergeTypes(kStatsAlloc object, k64f interval); 
+kFx(void) xkStatsAlloc_UpdateRates(kStatsAllocInfo* info, k64u count, k64u bytes, k64f interval); 
+
+#endif
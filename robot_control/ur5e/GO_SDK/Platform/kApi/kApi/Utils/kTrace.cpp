@@ -0,0 +1,383 @@
+/** 
+ * @file    kTrace.cpp
+ *
+ * @internal
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#include <kApi/Utils/kTrace.h>
+#include <kApi/Io/kFile.h>
+#include <kApi/Io/kStream.h>
+#include <kApi/Threads/kLock.h>
+#include <kApi/Threads/kTimer.h>
+
+kBeginStaticClassEx(k, kTrace)
+kEndStaticClassEx()
+
+kDx(kAtomic32s) xkTrace_enabled = kFALSE; 
+
+//incremented each time the library is initialized, so that stale thread buffers are not reused
+static k32u xkTrace_generation = 0; 
+
+static xkTRACE_THREAD_LOCAL xkTraceBuffer* xkTrace_threadBuffer = kNULL; 
+static xkTRACE_THREAD_LOCAL k32u xkTrace_threadGeneration = 0; 
+static xkTRACE_THREAD_LOCAL const kChar* xkTrace_threadName = kNULL; 
+
+kFx(kStatus) xkTrace_InitStatic()
+{
+    kStaticObj(kTrace);
+
+    sobj->lock = kNULL; 
+    sobj->buffers = kNULL; 
+    sobj->bufferCount = 0; 
+    sobj->capacity = xkTRACE_DEFAULT_CAPACITY; 
+
+    xkTrace_generation++; 
+
+    kCheck(kLock_Construct(&sobj->lock, kNULL)); 
+
+    return kOK; 
+}
+
+kFx(kStatus) xkTrace_ReleaseStatic()
+{
+    kStaticObj(kTrace);
+
+    kAtomic32s_Exchange(&xkTrace_enabled, kFALSE); 
+
+    while (!kIsNull(sobj->buffers))
+    {
+        xkTraceBuffer* next = sobj->buffers->next; 
+
+        kCheck(kAlloc_Free(kAlloc_App(), sobj->buffers)); 
+
+        sobj->buffers = next; 
+    }
+
+    kCheck(kDestroyRef(&sobj->lock)); 
+
+    return kOK; 
+}
+
+kFx(kStatus) kTrace_Enable(kBool enabled)
+{
+    kAtomic32s_Exchange(&xkTrace_enabled, enabled ? kTRUE : kFALSE); 
+
+    return kOK; 
+}
+
+kFx(kStatus) kTrace_SetCapacity(kSize capacity)
+{
+    kStaticObj(kTrace);
+    kSize roundedCapacity = 2; 
+
+    kCheckArgs((capacity > 0) && (capacity <= xkTRACE_MAX_CAPACITY)); 
+
+    while (roundedCapacity < capacity)
+    {
+        roundedCapacity *= 2; 
+    }
+
+    kLock_Enter(sobj->lock); 
+    {
+        sobj->capacity = roundedCapacity; 
+    }
+    kLock_Exit(sobj->lock); 
+
+    return kOK; 
+}
+
+kFx(kSize) kTrace_Capacity()
+{
+    kStaticObj(kTrace);
+
+    return sobj->capacity; 
+}
+
+kFx(kStatus) kTrace_Clear()
+{
+    kStaticObj(kTrace);
+    xkTraceBuffer* buffer = kNULL; 
+
+    kLock_Enter(sobj->lock); 
+    {
+        for (buffer = sobj->buffers; !kIsNull(buffer); buffer = buffer->next)
+        {
+            buffer->tail = (k32u) kAtomic32s_Get(&buffer->head); 
+        }
+    }
+    kLock_Exit(sobj->lock); 
+
+    return kOK; 
+}
+
+kFx(void) xkTrace_SetThreadName(const kChar* name)
+{
+    xkTrace_threadName = name; 
+}
+
+// Called by kThread before a thread exits; its buffer can then be taken over (and its events 
+// discarded) by a thread that starts later. 
+kFx(void) xkTrace_ExitThread()
+{
+    kStaticObj(kTrace);
+    xkTraceBuffer* buffer = xkTrace_threadBuffer; 
+
+    if (!kIsNull(buffer) && (xkTrace_threadGeneration == xkTrace_generation))
+    {
+        kLock_Enter(sobj->lock); 
+        {
+            buffer->isReleased = kTRUE; 
+        }
+        kLock_Exit(sobj->lock); 
+    }
+
+    xkTrace_threadBuffer = kNULL; 
+    xkTrace_threadName = kNULL; 
+}
+
+kFx(void) xkTrace_Add(const kChar* name, k32u phase)
+{
+    xkTraceBuffer* buffer = xkTrace_threadBuffer; 
+    xkTraceEvent* event = kNULL; 
+    k32u head; 
+
+    if (kIsNull(buffer) || (xkTrace_threadGeneration != xkTrace_generation))
+    {
+        if (!kSuccess(xkTrace_AddBuffer(&buffer)))
+        {
+            return; 
+        }
+
+        xkTrace_threadBuffer = buffer; 
+        xkTrace_threadGeneration = xkTrace_generation; 
+    }
+
+    //only the owning thread writes to the buffer; the head is published after the event is complete
+    head = (k32u) kAtomic32s_Get(&buffer->head); 
+    event = &buffer->events[head & buffer->mask]; 
+
+    event->ticks = kTimer_Ticks(); 
+    event->name = name; 
+    event->phase = phase; 
+
+    kAtomic32s_Exchange(&buffer->head, (k32s)(head + 1)); 
+}
+
+kFx(kStatus) xkTrace_AddBuffer(xkTraceBuffer** buffer)
+{
+    kStaticObj(kTrace);
+    xkTraceBuffer* output = kNULL; 
+    kStatus status = kOK; 
+
+    kLock_Enter(sobj->lock); 
+    {
+        kSize size = sizeof(xkTraceBuffer) + (sobj->capacity - 1)*sizeof(xkTraceEvent); 
+        xkTraceBuffer** link = &sobj->buffers; 
+
+        //reuse a buffer released by an exited thread; released buffers of a different capacity are freed
+        while (!kIsNull(*link) && kIsNull(output))
+        {
+            xkTraceBuffer* candidate = *link; 
+
+            if (!candidate->isReleased)
+            {
+                link = &candidate->next; 
+            }
+            else if (candidate->mask == (k32u)(sobj->capacity - 1))
+            {
+                output = candidate; 
+            }
+            else
+            {
+                *link = candidate->next; 
+
+                kAlloc_Free(kAlloc_App(), candidate); 
+            }
+        }
+
+        if (kIsNull(output) && kSuccess(status = kAlloc_GetZero(kAlloc_App(), size, &output)))
+        {
+            output->next = sobj->buffers; 
+            sobj->buffers = output; 
+        }
+
+        if (kSuccess(status))
+        {
+            output->threadIndex = ++sobj->bufferCount; 
+            output->mask = (k32u)(sobj->capacity - 1); 
+            kAtomic32s_Init(&output->head, 0); 
+            output->tail = 0; 
+            output->isReleased = kFALSE; 
+
+            if (!kIsNull(xkTrace_threadName) && (xkTrace_threadName[0] != 0))
+            {
+                kStrCopy(output->threadName, kCountOf(output->threadName), xkTrace_threadName); 
+            }
+            else
+            {
+                kStrPrintf(output->threadName, kCountOf(output->threadName), "Thread %u", output->threadIndex); 
+            }
+
+            *buffer = output; 
+        }
+    }
+    kLock_Exit(sobj->lock); 
+
+    return status; 
+}
+
+// Copies the retained events of a buffer, omitting any that were overwritten during the copy. 
+kFx(kSize) xkTrace_Snapshot(xkTraceBuffer* buffer, xkTraceEvent* events)
+{
+    k32u limit = buffer->mask;      //one slot is reserved for the event being written
+    k32u head = (k32u) kAtomic32s_Get(&buffer->head); 
+    k32u count = kMin_(head - buffer->tail, limit); 
+    k32u first = head - count; 
+    k32u overwritten; 
+    k32u i; 
+
+    for (i = 0; i < count; ++i)
+    {
+        events[i] = buffer->events[(first + i) & buffer->mask]; 
+    }
+
+    head = (k32u) kAtomic32s_Get(&buffer->head); 
+    overwritten = ((head - first) > limit) ? (head - first) - limit : 0; 
+
+    if (overwritten >= count)
+    {
+        return 0; 
+    }
+
+    for (i = overwritten; i < count; ++i)
+    {
+        events[i - overwritten] = events[i]; 
+    }
+
+    return count - overwritten; 
+}
+
+kFx(kStatus) xkTrace_WriteText(kStream stream, const kChar* format, ...)
+{
+    kChar text[256]; 
+    kVarArgList argList; 
+    kStatus status; 
+
+    kVarArgList_Start(argList, format);
+    {
+        status = kStrPrintvf(text, kCountOf(text), format, argList); 
+    }
+    kVarArgList_End(argList); 
+
+    kCheck(status); 
+
+    return kStream_Write(stream, text, kStrLength(text)); 
+}
+
+kFx(kStatus) xkTrace_WriteName(kStream stream, const kChar* name)
+{
+    kChar text[256]; 
+    kSize length = 0; 
+
+    text[length++] = '"'; 
+
+    while ((*name != 0) && (length < kCountOf(text) - 3))
+    {
+        if ((*name == '"') || (*name == '\\'))
+        {
+            text[length++] = '\\'; 
+            text[length++] = *name; 
+        }
+        else if ((k8u)*name >= 0x20)
+        {
+            text[length++] = *name; 
+        }
+
+        name++; 
+    }
+
+    text[length++] = '"'; 
+
+    return kStream_Write(stream, text, length); 
+}
+
+kFx(kStatus) kTrace_Write(kStream stream)
+{
+    kStaticObj(kTrace);
+    xkTraceBuffer* buffer = kNULL; 
+    xkTraceEvent* events = kNULL; 
+    kSize maxCapacity = 0; 
+    kSize count, i; 
+    k64f timeScale = (k64f) kApiLib_TimerMultiplier() / (k64f) kApiLib_TimerDivider(); 
+    kBool isFirst = kTRUE; 
+
+    kLock_Enter(sobj->lock); 
+
+    kTry
+    {
+        for (buffer = sobj->buffers; !kIsNull(buffer); buffer = buffer->next)
+        {
+            maxCapacity = kMax_(maxCapacity, (kSize)buffer->mask + 1); 
+        }
+
+        if (maxCapacity > 0)
+        {
+            kTest(kAlloc_Get(kAlloc_App(), maxCapacity*sizeof(xkTraceEvent), &events)); 
+        }
+
+        kTest(xkTrace_WriteText(stream, "{\"traceEvents\":[")); 
+
+        for (buffer = sobj->buffers; !kIsNull(buffer); buffer = buffer->next)
+        {
+            kTest(xkTrace_WriteText(stream, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", 
+                isFirst ? "" : ",", buffer->threadIndex)); 
+            kTest(xkTrace_WriteName(stream, buffer->threadName)); 
+            kTest(xkTrace_WriteText(stream, "}}")); 
+
+            isFirst = kFALSE; 
+
+            count = xkTrace_Snapshot(buffer, events); 
+
+            for (i = 0; i < count; ++i)
+            {
+                kTest(xkTrace_WriteText(stream, ",\n{\"name\":")); 
+                kTest(xkTrace_WriteName(stream, events[i].name)); 
+                kTest(xkTrace_WriteText(stream, ",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}", 
+                    (kChar)events[i].phase, (k64f)events[i].ticks * timeScale, buffer->threadIndex)); 
+            }
+        }
+
+        kTest(xkTrace_WriteText(stream, "\n],\"displayTimeUnit\":\"ns\"}\n")); 
+        kTest(kStream_Flush(stream)); 
+    }
+    kFinally
+    {
+        kAlloc_Free(kAlloc_App(), events); 
+        kLock_Exit(sobj->lock); 
+
+        kEndFinally(); 
+    }
+
+    return kOK; 
+}
+
+kFx(kStatus) kTrace_Save(const kChar* fileName)
+{
+    kFile file = kNULL; 
+
+    kCheck(kFile_Construct(&file, fileName, kFILE_MODE_WRITE, kNULL)); 
+
+    kTry
+    {
+        kTest(kTrace_Write(file)); 
+    }
+    kFinally
+    {
+        kObject_Destroy(file); 
+        kEndFinally(); 
+    }
+
+    return kOK; 
+}
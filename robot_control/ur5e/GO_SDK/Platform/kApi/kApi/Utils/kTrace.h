@@ -0,0 +1,150 @@
+/** 
+ * @file    kTrace.h
+ * @brief   Declares the kTrace class. 
+ *
+ * @internal
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef K_API_TRACE_H
+#define K_API_TRACE_H
+
+#include <kApi/kApiDef.h>
+#include <kApi/Threads/kAtomic.h>
+#include <kApi/Utils/kTrace.x.h>
+
+/**
+ * @class   kTrace
+ * @extends kObject
+ * @ingroup kApi-Utils
+ * @brief   Collection of static functions to record timed events for performance analysis.
+ *
+ * When tracing is enabled, kTrace_Begin and kTrace_End record timestamped events into a 
+ * fixed-size ring buffer that belongs to the calling thread. Recording does not take locks; 
+ * when the buffer is full, the oldest events are overwritten. When tracing is disabled, 
+ * kTrace_Begin and kTrace_End only test a flag. 
+ *
+ * The recorded events can be written in the Chrome trace event format (JSON) at any time, 
+ * for viewing in chrome://tracing or Perfetto. Events are grouped by thread; threads 
+ * created with kThread are labelled with the kThread name. 
+ *
+ * When a kThread exits, its events are retained until a thread that starts later takes over 
+ * its buffer. Buffers of other threads are retained until the library is released. 
+ *
+@code {.c}
+
+kTrace_Enable(kTRUE); 
+
+//...run the scenario of interest
+
+kTrace_Enable(kFALSE); 
+kTrace_Save("trace.json"); 
+
+@endcode
+ */
+//typedef kObject kTrace;               --forward-declared in kApiDef.x.h 
+
+/** 
+ * Enables or disables event recording. 
+ * 
+ * This function is thread-safe. 
+ *
+ * @public              @memberof kTrace
+ * @param   enabled     kTRUE to record events. 
+ * @return              Operation status. 
+ */
+kFx(kStatus) kTrace_Enable(kBool enabled); 
+
+/** 
+ * Reports whether event recording is enabled. 
+ *
+ * @public              @memberof kTrace
+ * @return              kTRUE if events are recorded. 
+ */
+kInlineFx(kBool) kTrace_IsEnabled()
+{
+    return (kBool) kAtomic32s_Get(&xkTrace_enabled); 
+}
+
+/** 
+ * Sets the number of events retained per thread. 
+ * 
+ * The capacity is rounded up to a power of two. It applies to threads that record their first event 
+ * after this call; each such thread uses approximately 24 bytes per event until kApiLib is destroyed.
+ *
+ * @public              @memberof kTrace
+ * @param   capacity    Number of events retained per thread. 
+ * @return              Operation status. 
+ */
+kFx(kStatus) kTrace_SetCapacity(kSize capacity); 
+
+/** 
+ * Gets the number of events retained per thread. 
+ *
+ * @public              @memberof kTrace
+ * @return              Number of events retained per thread. 
+ */
+kFx(kSize) kTrace_Capacity(); 
+
+/** 
+ * Discards the events recorded so far. 
+ *
+ * @public              @memberof kTrace
+ * @return              Operation status. 
+ */
+kFx(kStatus) kTrace_Clear(); 
+
+/** 
+ * Writes the recorded events to a stream in the Chrome trace event format (JSON). 
+ * 
+ * Events can continue to be recorded while this function runs; events that are overwritten 
+ * during the export are omitted. 
+ *
+ * @public              @memberof kTrace
+ * @param   stream      Output stream. 
+ * @return              Operation status. 
+ */
+kFx(kStatus) kTrace_Write(kStream stream); 
+
+/** 
+ * Writes the recorded events to a file in the Chrome trace event format (JSON). 
+ *
+ * @public              @memberof kTrace
+ * @param   fileName    Output file name. 
+ * @return              Operation status. 
+ */
+kFx(kStatus) kTrace_Save(const kChar* fileName); 
+
+/** 
+ * Records the beginning of a timed section on the calling thread. 
+ * 
+ * The name is stored by reference and must remain valid until the events are exported 
+ * (e.g., a string literal). 
+ *
+ * @public              @memberof kTrace
+ * @param   name        Section name. 
+ */
+kInlineFx(void) kTrace_Begin(const kChar* name)
+{
+    if (kTrace_IsEnabled())
+    {
+        xkTrace_Add(name, xkTRACE_PHASE_BEGIN); 
+    }
+}
+
+/** 
+ * Records the end of a timed section on the calling thread. 
+ *
+ * @public              @memberof kTrace
+ * @param   name        Section name (as passed to kTrace_Begin). 
+ */
+kInlineFx(void) kTrace_End(const kChar* name)
+{
+    if (kTrace_IsEnabled())
+    {
+        xkTrace_Add(name, xkTRACE_PHASE_END); 
+    }
+}
+
+#endif
@@ -0,0 +1,71 @@
+/** 
+ * @file    kTrace.x.h
+ *
+ * @internal
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ * Licensed under the MIT License.
+ * Redistributed files must retain the above copyright notice.
+ */
+#ifndef K_API_TRACE_X_H
+#define K_API_TRACE_X_H
+
+#define xkTRACE_DEFAULT_CAPACITY        (8192)          ///< Default number of events retained per thread.
+#define xkTRACE_MAX_CAPACITY            (1 << 24)       ///< Maximum number of events retained per thread.
+
+#define xkTRACE_PHASE_BEGIN             ('B')           ///< Chrome trace event phase: section begins.
+#define xkTRACE_PHASE_END               ('E')           ///< Chrome trace event phase: section ends.
+
+#if defined(K_MSVC)
+#   define xkTRACE_THREAD_LOCAL         __declspec(thread)
+#else
+#   define xkTRACE_THREAD_LOCAL         __thread
+#endif
+
+typedef struct xkTraceEvent
+{
+    k64u ticks;                         //timestamp, in kTimer ticks
+    const kChar* name;                  //section name (not owned)
+    k32u phase;                         //xkTRACE_PHASE_*
+} xkTraceEvent; 
+
+typedef struct xkTraceBuffer
+{
+    struct xkTraceBuffer* next;         //next buffer in registry
+    k32u threadIndex;                   //trace thread id (registration order)
+    kText64 threadName;                 //name of the recording thread
+    k32u mask;                          //capacity - 1 (capacity is a power of two)
+    kAtomic32s head;                    //number of events written (modulo 2^32); written only by owner
+    k32u tail;                          //number of events discarded by kTrace_Clear (modulo 2^32)
+    kBool isReleased;                   //owning thread has exited; buffer can be reused by another thread
+    xkTraceEvent events[1];             //ring of events (capacity items)
+} xkTraceBuffer; 
+
+typedef struct kTraceStatic
+{
+    kLock lock;                         //protects buffer registry and settings
+    xkTraceBuffer* buffers;             //registry of per-thread buffers
+    k32u bufferCount;                   //number of registered buffers
+    kSize capacity;                     //events per thread, for new buffers
+} kTraceStatic;
+
+kDeclareStaticClassEx(k, kTrace)
+
+kExtern kDx(kAtomic32s) xkTrace_enabled;                  ///< Is event recording enabled?
+
+/* 
+* Private methods. 
+*/
+
+kFx(kStatus) xkTrace_InitStatic(); 
+kFx(kStatus) xkTrace_ReleaseStatic(); 
+
+kFx(void) xkTrace_Add(const kChar* name, k32u phase); 
+kFx(void) xkTrace_SetThreadName(const kChar* name); 
+kFx(void) xkTrace_ExitThread(); 
+
+kFx(kStatus) xkTrace_AddBuffer(xkTraceBuffer** buffer); 
+kFx(kSize) xkTrace_Snapshot(xkTraceBuffer* buffer, xkTraceEvent* events); 
+kFx(kStatus) xkTrace_WriteText(kStream stream, const kChar* format, ...); 
+kFx(kStatus) xkTrace_WriteName(kStream stream, const kChar* name); 
+
+#endif
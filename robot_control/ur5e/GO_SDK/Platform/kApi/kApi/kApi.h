@@ -47,6 +47,7 @@
 #include <kApi/Io/kDat6Serializer.h>
 #include <kApi/Io/kDirectory.h>
 #include <kApi/Io/kFile.h>
+#include <kApi/Io/kHeightCodec.h>
 #include <kApi/Io/kHttpServer.h>
 #include <kApi/Io/kHttpServerChannel.h>
 #include <kApi/Io/kHttpServerRequest.h>
@@ -80,8 +81,10 @@
 #include <kApi/Utils/kObjectPool.h>
 #include <kApi/Utils/kPlugin.h>
 #include <kApi/Utils/kPoolAlloc.h>
+#include <kApi/Utils/kStatsAlloc.h>
 #include <kApi/Utils/kSymbolInfo.h>
 #include <kApi/Utils/kTimeSpan.h>
+#include <kApi/Utils/kTrace.h>
 #include <kApi/Utils/kUserAlloc.h>
 #include <kApi/Utils/kUtils.h>
 
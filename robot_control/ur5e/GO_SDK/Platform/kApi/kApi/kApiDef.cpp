@@ -1873,6 +1873,7 @@ kEndEnumEx()
 
 kBeginEnumEx(k, kCompressionType)
     kAddEnumerator(kCompressionType, kCOMPRESSION_TYPE_ZSTD)
+    kAddEnumerator(kCompressionType, kCOMPRESSION_TYPE_HEIGHT16)
 kEndEnumEx()
 
 kBeginEnumEx(k, kCompressionPreset)
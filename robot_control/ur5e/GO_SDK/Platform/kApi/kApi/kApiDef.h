@@ -1898,6 +1898,7 @@ typedef k32s kCompressionType;
 /** @relates kCompressionType @{ */
 #define kCOMPRESSION_TYPE_NULL       (0)     ///< None. 
 #define kCOMPRESSION_TYPE_ZSTD       (1)     ///< Zstandard compression.
+#define kCOMPRESSION_TYPE_HEIGHT16   (2)     ///< Lossless 16-bit height map compression (kHeightCodec).
 
 /** @} */
 
@@ -624,6 +624,7 @@
     xkAddClassDebugHint(kDynamicLib)                             \
     xkAddClassDebugHint(kEvent)                                  \
     xkAddClassDebugHint(kPoolAlloc)                              \
+    xkAddClassDebugHint(kStatsAlloc)                             \
     xkAddClassDebugHint(kUserAlloc)                              \
                                                                  \
     xkAddValueDebugHint(kEnumeratorInfo)                         \
@@ -907,12 +908,14 @@ kForwardDeclareClass(k, kTcpServer, kObject)
 kForwardDeclareClass(k, kThread, kObject)
 kForwardDeclareClass(k, kThreadPool, kObject)
 kForwardDeclareClass(k, kTimer, kObject)
+kForwardDeclareClass(k, kTrace, kObject)
 kForwardDeclareClass(k, kXml, kObject)
 
 kForwardDeclareClass(k, kDebugAlloc, kAlloc)
 kForwardDeclareClass(k, kHeapAlloc, kAlloc)
 kForwardDeclareClass(k, kUserAlloc, kAlloc)
 kForwardDeclareClass(k, kPoolAlloc, kAlloc)
+kForwardDeclareClass(k, kStatsAlloc, kAlloc)
 
 kForwardDeclareClass(k, kBlowfishCipher, kCipher)
 
@@ -921,6 +924,7 @@ kForwardDeclareClass(k, kDat6Serializer, kSerializer)
 
 kForwardDeclareClass(k, kCipherStream, kStream)
 kForwardDeclareClass(k, kFile, kStream)
+kForwardDeclareClass(k, kHeightCodec, kStream)
 kForwardDeclareClass(k, kMemory, kStream)
 kForwardDeclareClass(k, kPipeStream, kStream)
 kForwardDeclareClass(k, kTcpClient, kStream)
@@ -117,6 +117,7 @@ kBeginAssemblyEx(k, kApiLib, kAPI_VERSION, kAPI_VERSION)
     kAddType(kIpEntry)
     kAddType(kIpVersion)
     kAddType(kLockOption)
+    kAddType(kLockStats)
     kAddType(kLogArgs)
     kAddType(kLogOption)
     kAddType(kMacAddress)
@@ -152,6 +153,10 @@ kBeginAssemblyEx(k, kApiLib, kAPI_VERSION, kAPI_VERSION)
     kAddType(kSSize)
     kAddType(kSocketType)
     kAddType(kSocketEvent)
+    kAddType(kStatsAllocInfo)
+    kAddType(kStatsAllocTypeInfo)
+    kAddType(xkStatsAllocSample)
+    kAddType(xkStatsAllocTypeRecord)
     kAddType(kStatus)
     kAddType(kText16)
     kAddType(kText32)
@@ -195,6 +200,7 @@ kBeginAssemblyEx(k, kApiLib, kAPI_VERSION, kAPI_VERSION)
     kAddType(kFile)
     kAddType(kHash)
     kAddType(kHeapAlloc)
+    kAddType(kHeightCodec)
     kAddType(kHttpServer)
     kAddType(kHttpServerChannel)
     kAddType(kHttpServerRequest)
@@ -222,6 +228,7 @@ kBeginAssemblyEx(k, kApiLib, kAPI_VERSION, kAPI_VERSION)
     kAddType(kSerializer)
     kAddType(kSha1Hash)
     kAddType(kSocket)
+    kAddType(kStatsAlloc)
     kAddType(kStream)
     kAddType(kString)
     kAddType(kSymbolInfo)
@@ -231,6 +238,7 @@ kBeginAssemblyEx(k, kApiLib, kAPI_VERSION, kAPI_VERSION)
     kAddType(kThreadPool)
     kAddType(kThreadPoolJob)
     kAddType(kTimer)
+    kAddType(kTrace)
     kAddType(kType)
     kAddType(kUdpClient)
     kAddType(kUserAlloc)
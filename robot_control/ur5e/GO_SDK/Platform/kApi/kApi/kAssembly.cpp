@@ -11,6 +11,7 @@
 #include <kApi/Data/kArrayList.h>
 #include <kApi/Data/kMap.h>
 #include <kApi/Threads/kLock.h>
+#include <kApi/Threads/kTimer.h>
 #include <kApi/Utils/kEvent.h>
 
 kBeginFullClassEx(k, kAssembly)
@@ -400,11 +401,19 @@ kFx(kStatus) xkAssembly_AddPriority(kAssembly assembly, xkAssemblyRegisterFx cal
 kFx(kStatus) xkAssembly_Finalize(kAssembly assembly)
 {
     kObjR(kAssembly, assembly); 
+    k64u startTicks; 
 
     kCheck(xkAssembly_InitDependencies(assembly)); 
+
+    //the timer query handler is installed during kApiLib type initialization; 
+    //until then, read the default tick source that it will be configured to use
+    startTicks = kApiLib_HasTimerQueryHandler() ? kTimer_Ticks() : xkTimer_DefaultTickQuery(); 
+
     kCheck(xkAssembly_InitTypes(assembly)); 
     kCheck(xkAssembly_MapTypes(assembly)); 
 
+    obj->initDuration = kTimer_FromTicks(kTimer_Ticks() - startTicks); 
+
     kCheck(xkAssembly_AddAssembly(assembly)); 
 
     obj->isRegistered = kTRUE; 
@@ -592,7 +601,7 @@ kFx(kStatus) xkAssembly_MapTypes(kAssembly assembly)
     kObjR(kAssembly, assembly); 
     kStatus status = kOK;
 
-    kCheck(kMap_Construct(&obj->typeMap, kTypeOf(kTypeName), kTypeOf(kType), 0, kNULL)); 
+    kCheck(kMap_Construct(&obj->typeMap, kTypeOf(kTypeName), kTypeOf(kType), obj->typeCount, kNULL)); 
 
     for (kSize i = 0; i < obj->typeCount; ++i)
     {
@@ -270,6 +270,23 @@ kFx(kStatus) kAssembly_FindType(kAssembly assembly, const kChar* name, kType* ty
  */
 kFx(kStatus) kAssembly_FindDerivedTypes(kAssembly assembly, kType base, kArrayList types); 
 
+/** 
+ * Gets the time that was required to register and initialize the types in an assembly. 
+ *
+ * The reported duration excludes the time required to load assembly dependencies. It can be 
+ * used to profile application startup. 
+ *
+ * @public              @memberof kAssembly
+ * @param   assembly    Assembly. 
+ * @return              Type initialization time (us). 
+ */
+kInlineFx(k64u) kAssembly_InitDuration(kAssembly assembly)
+{
+    kObj(kAssembly, assembly);
+
+    return obj->initDuration;
+}
+
 /** 
  * Gets the count of assembly dependencies. 
  *
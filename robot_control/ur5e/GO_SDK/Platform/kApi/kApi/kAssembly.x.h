@@ -48,6 +48,7 @@ typedef struct kAssemblyClass
     kType* types; 
     kSize typeCount; 
     kMap typeMap; 
+    k64u initDuration;              //time required to register and initialize types (us), excluding dependencies
 } kAssemblyClass;
 
 typedef struct kAssemblyVTable
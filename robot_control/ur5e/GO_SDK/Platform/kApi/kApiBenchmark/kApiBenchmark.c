@@ -0,0 +1,748 @@
+/*
+ * kApiBenchmark.c
+ *
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ *
+ * Licensed under The MIT License.
+ * Redistributions of files must retain the above copyright notice.
+ *
+ * Purpose: Measures the cost of core kApi containers, threading primitives and allocators.
+ *
+ * Usage: kApiBenchmark [-o file] [-t maxThreads] [-l label]
+ *
+ * The following are measured:
+ * - kMap, kArrayList and kQueue insert/find/remove throughput at several container sizes
+ * - kMsgQueue producer/consumer throughput with 1..maxThreads producers and one consumer
+ * - kThreadPool dispatch and round-trip latency
+ * - kParallel_Execute overhead, compared with the same work done in a serial loop
+ * - kAlloc_App and kPoolAlloc allocate/free rates, compared with malloc/free
+ *
+ * Results are written as JSON (to stdout, or to the file given with -o), so that runs from
+ * different builds can be compared. The optional label is copied into the output to identify
+ * the build. Each result has a group, a name, a size or thread-count parameter and either a
+ * throughput (ops, nsPerOp, opsPerSec) or a latency distribution (meanNs, p50Ns, p99Ns, maxNs).
+ * Latencies are limited to the resolution of kTimer_Ticks (1 us on some platforms).
+ */
+#include <kApi/kApiLib.h>
+#include <kApi/Data/kArrayList.h>
+#include <kApi/Data/kMap.h>
+#include <kApi/Data/kQueue.h>
+#include <kApi/Threads/kMsgQueue.h>
+#include <kApi/Threads/kParallel.h>
+#include <kApi/Threads/kThread.h>
+#include <kApi/Threads/kThreadPool.h>
+#include <kApi/Threads/kTimer.h>
+#include <kApi/Utils/kPoolAlloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_DEFAULT_MAX_THREADS           (4)
+#define BENCH_CONTAINER_OPS                 (1 << 20)
+#define BENCH_MSG_QUEUE_ITEMS               (1 << 18)
+#define BENCH_POOL_SAMPLES                  (2000)
+#define BENCH_PARALLEL_OPS                  (1 << 24)
+#define BENCH_PARALLEL_MAX_SLICES           (256)
+#define BENCH_ALLOC_BATCH                   (256)
+#define BENCH_ALLOC_BYTES                   (1 << 28)
+#define BENCH_ALLOC_MAX_ROUNDS              (4096)
+#define BENCH_KEY_MULTIPLIER                (2654435761u)
+
+typedef struct BenchReport
+{
+    FILE* out;
+    kSize count;
+} BenchReport;
+
+typedef struct BenchProducer
+{
+    kMsgQueue queue;
+    kSize count;
+    kStatus status;
+} BenchProducer;
+
+typedef struct BenchPoolTask
+{
+    k64u startTicks;
+} BenchPoolTask;
+
+typedef struct BenchParallelSum
+{
+    const k32f* data;
+    kSize count;
+    k64f partial[BENCH_PARALLEL_MAX_SLICES];
+} BenchParallelSum;
+
+typedef struct BenchAllocator
+{
+    const kChar* name;
+    kAlloc alloc;           //kNULL for malloc/free
+} BenchAllocator;
+
+static volatile k64u Bench_sink = 0;
+
+static const kSize Bench_containerSizes[] = { 64, 4096, 262144 };
+static const kSize Bench_parallelSizes[] = { 1024, 65536, 1048576 };
+static const kSize Bench_allocSizes[] = { 16, 256, 4096, 65536 };
+
+static k64u Bench_Ns(k64u ticks)
+{
+    return kTimer_FromTicks(1000 * ticks);
+}
+
+static void Bench_BeginResult(BenchReport* report, const kChar* group, const kChar* name, const kChar* paramName, kSize param)
+{
+    fprintf(report->out, "%s\n    { \"group\": \"%s\", \"name\": \"%s\", \"%s\": %u", (report->count > 0) ? "," : "", group, name, paramName, (k32u)param);
+
+    report->count++;
+}
+
+static void Bench_Throughput(BenchReport* report, const kChar* group, const kChar* name, const kChar* paramName, kSize param, k64u ops, k64u ticks)
+{
+    k64u ns = kMax_(Bench_Ns(ticks), 1);
+
+    Bench_BeginResult(report, group, name, paramName, param);
+
+    fprintf(report->out, ", \"ops\": %llu, \"nsPerOp\": %.2f, \"opsPerSec\": %.0f }",
+        (unsigned long long)ops, (k64f)ns / kMax_(ops, 1), ops * 1.0e9 / ns);
+}
+
+static int Bench_CompareTicks(const void* a, const void* b)
+{
+    k64u first = *(const k64u*)a;
+    k64u second = *(const k64u*)b;
+
+    return (first < second) ? -1 : (first > second) ? 1 : 0;
+}
+
+static void Bench_Latency(BenchReport* report, const kChar* group, const kChar* name, const kChar* paramName, kSize param, k64u* ticks, kSize count)
+{
+    k64u total = 0;
+    kSize i;
+
+    qsort(ticks, count, sizeof(k64u), Bench_CompareTicks);
+
+    for (i = 0; i < count; ++i)
+    {
+        total += ticks[i];
+    }
+
+    Bench_BeginResult(report, group, name, paramName, param);
+
+    fprintf(report->out, ", \"count\": %u, \"meanNs\": %.0f, \"p50Ns\": %llu, \"p99Ns\": %llu, \"maxNs\": %llu }",
+        (k32u)count, (k64f)Bench_Ns(total) / count,
+        (unsigned long long)Bench_Ns(ticks[count / 2]),
+        (unsigned long long)Bench_Ns(ticks[(count * 99) / 100]),
+        (unsigned long long)Bench_Ns(ticks[count - 1]));
+}
+
+static kStatus Bench_Map(BenchReport* report, kSize size)
+{
+    kMap map = kNULL;
+    kSize rounds = kMax_(BENCH_CONTAINER_OPS / size, 1);
+    k64u insertTicks = 0, findTicks = 0, removeTicks = 0, start;
+    k32u key, value;
+    k64u sum = 0;
+    kSize r, i;
+
+    kTry
+    {
+        for (r = 0; r < rounds; ++r)
+        {
+            kTest(kMap_Construct(&map, kTypeOf(k32u), kTypeOf(k32u), 0, kNULL));
+
+            start = kTimer_Ticks();
+            for (i = 0; i < size; ++i)
+            {
+                key = (k32u)i * BENCH_KEY_MULTIPLIER;
+                value = (k32u)i;
+                kTest(kMap_AddT(map, &key, &value));
+            }
+            insertTicks += kTimer_Ticks() - start;
+
+            start = kTimer_Ticks();
+            for (i = 0; i < size; ++i)
+            {
+                key = (k32u)i * BENCH_KEY_MULTIPLIER;
+                kTest(kMap_FindT(map, &key, &value));
+                sum += value;
+            }
+            findTicks += kTimer_Ticks() - start;
+
+            start = kTimer_Ticks();
+            for (i = 0; i < size; ++i)
+            {
+                key = (k32u)i * BENCH_KEY_MULTIPLIER;
+                kTest(kMap_DiscardT(map, &key));
+            }
+            removeTicks += kTimer_Ticks() - start;
+
+            kTest(kDestroyRef(&map));
+        }
+
+        Bench_sink += sum;
+
+        Bench_Throughput(report, "kMap", "insert", "size", size, (k64u)rounds * size, insertTicks);
+        Bench_Throughput(report, "kMap", "find", "size", size, (k64u)rounds * size, findTicks);
+        Bench_Throughput(report, "kMap", "remove", "size", size, (k64u)rounds * size, removeTicks);
+    }
+    kFinally
+    {
+        kObject_Destroy(map);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+static kStatus Bench_ArrayList(BenchReport* report, kSize size)
+{
+    kArrayList list = kNULL;
+    kSize rounds = kMax_(BENCH_CONTAINER_OPS / size, 1);
+    k64u insertTicks = 0, findTicks = 0, removeTicks = 0, start;
+    k32u value;
+    k64u sum = 0;
+    kSize r, i;
+
+    kTry
+    {
+        for (r = 0; r < rounds; ++r)
+        {
+            kTest(kArrayList_Construct(&list, kTypeOf(k32u), 0, kNULL));
+
+            start = kTimer_Ticks();
+            for (i = 0; i < size; ++i)
+            {
+                value = (k32u)i;
+                kTest(kArrayList_AddT(list, &value));
+            }
+            insertTicks += kTimer_Ticks() - start;
+
+            start = kTimer_Ticks();
+            for (i = 0; i < size; ++i)
+            {
+                sum += kArrayList_AsT(list, (i * BENCH_KEY_MULTIPLIER) % size, k32u);
+            }
+            findTicks += kTimer_Ticks() - start;
+
+            start = kTimer_Ticks();
+            for (i = 0; i < size; ++i)
+            {
+                kTest(kArrayList_RemoveT(list, kArrayList_Count(list) - 1, &value));
+            }
+            removeTicks += kTimer_Ticks() - start;
+
+            kTest(kDestroyRef(&list));
+        }
+
+        Bench_sink += sum;
+
+        Bench_Throughput(report, "kArrayList", "add", "size", size, (k64u)rounds * size, insertTicks);
+        Bench_Throughput(report, "kArrayList", "index", "size", size, (k64u)rounds * size, findTicks);
+        Bench_Throughput(report, "kArrayList", "removeLast", "size", size, (k64u)rounds * size, removeTicks);
+    }
+    kFinally
+    {
+        kObject_Destroy(list);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+static kStatus Bench_Queue(BenchReport* report, kSize size)
+{
+    kQueue queue = kNULL;
+    kSize rounds = kMax_(BENCH_CONTAINER_OPS / size, 1);
+    k64u insertTicks = 0, removeTicks = 0, start;
+    k32u value;
+    k64u sum = 0;
+    kSize r, i;
+
+    kTry
+    {
+        for (r = 0; r < rounds; ++r)
+        {
+            kTest(kQueue_Construct(&queue, kTypeOf(k32u), 0, kNULL));
+
+            start = kTimer_Ticks();
+            for (i = 0; i < size; ++i)
+            {
+                value = (k32u)i;
+                kTest(kQueue_AddT(queue, &value));
+            }
+            insertTicks += kTimer_Ticks() - start;
+
+            start = kTimer_Ticks();
+            for (i = 0; i < size; ++i)
+            {
+                kTest(kQueue_Remove(queue, &value));
+                sum += value;
+            }
+            removeTicks += kTimer_Ticks() - start;
+
+            kTest(kDestroyRef(&queue));
+        }
+
+        Bench_sink += sum;
+
+        Bench_Throughput(report, "kQueue", "add", "size", size, (k64u)rounds * size, insertTicks);
+        Bench_Throughput(report, "kQueue", "remove", "size", size, (k64u)rounds * size, removeTicks);
+    }
+    kFinally
+    {
+        kObject_Destroy(queue);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+static kStatus kCall Bench_ProducerEntry(BenchProducer* producer)
+{
+    k64u item;
+    kSize i;
+
+    for (i = 0; i < producer->count; ++i)
+    {
+        item = i;
+
+        if (!kSuccess(producer->status = kMsgQueue_AddT(producer->queue, &item)))
+        {
+            break;
+        }
+    }
+
+    return producer->status;
+}
+
+static kStatus Bench_MsgQueue(BenchReport* report, kSize producerCount)
+{
+    kMsgQueue queue = kNULL;
+    kThread threads[BENCH_PARALLEL_MAX_SLICES] = { kNULL };
+    BenchProducer producers[BENCH_PARALLEL_MAX_SLICES];
+    kSize itemsPerProducer = BENCH_MSG_QUEUE_ITEMS / producerCount;
+    kSize total = itemsPerProducer * producerCount;
+    k64u start, ticks;
+    k64u item, sum = 0;
+    kSize i;
+
+    kTry
+    {
+        kTest(kMsgQueue_Construct(&queue, kTypeOf(k64u), kNULL));
+
+        for (i = 0; i < producerCount; ++i)
+        {
+            producers[i].queue = queue;
+            producers[i].count = itemsPerProducer;
+            producers[i].status = kOK;
+
+            kTest(kThread_Construct(&threads[i], kNULL));
+        }
+
+        start = kTimer_Ticks();
+
+        for (i = 0; i < producerCount; ++i)
+        {
+            kTest(kThread_Start(threads[i], (kThreadFx)Bench_ProducerEntry, &producers[i]));
+        }
+
+        for (i = 0; i < total; ++i)
+        {
+            kTest(kMsgQueue_RemoveT(queue, &item, kINFINITE));
+            sum += item;
+        }
+
+        ticks = kTimer_Ticks() - start;
+
+        for (i = 0; i < producerCount; ++i)
+        {
+            kTest(kThread_Join(threads[i], kINFINITE, kNULL));
+            kTest(producers[i].status);
+        }
+
+        Bench_sink += sum;
+
+        Bench_Throughput(report, "kMsgQueue", "producerConsumer", "producers", producerCount, total, ticks);
+    }
+    kFinally
+    {
+        for (i = 0; i < producerCount; ++i)
+        {
+            kObject_Destroy(threads[i]);
+        }
+
+        kObject_Destroy(queue);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+static kStatus kCall Bench_PoolTaskEntry(BenchPoolTask* task)
+{
+    task->startTicks = kTimer_Ticks();
+
+    return kOK;
+}
+
+static kStatus Bench_ThreadPool(BenchReport* report, kSize threadCount)
+{
+    kThreadPool pool = kNULL;
+    kThreadPoolTransaction transaction = kNULL;
+    k64u* dispatchTicks = kNULL;
+    k64u* roundTripTicks = kNULL;
+    BenchPoolTask task;
+    k64u start;
+    kSize i;
+
+    kTry
+    {
+        kTest(kAlloc_Get(kAlloc_App(), BENCH_POOL_SAMPLES * sizeof(k64u), &dispatchTicks));
+        kTest(kAlloc_Get(kAlloc_App(), BENCH_POOL_SAMPLES * sizeof(k64u), &roundTripTicks));
+
+        kTest(kThreadPool_Construct(&pool, threadCount, kNULL));
+
+        for (i = 0; i < BENCH_POOL_SAMPLES; ++i)
+        {
+            start = kTimer_Ticks();
+
+            kTest(kThreadPool_BeginExecute(pool, (kThreadFx)Bench_PoolTaskEntry, &task, &transaction));
+            kTest(kThreadPool_EndExecute(pool, transaction, kINFINITE, kNULL));
+
+            roundTripTicks[i] = kTimer_Ticks() - start;
+            dispatchTicks[i] = task.startTicks - start;
+        }
+
+        Bench_Latency(report, "kThreadPool", "dispatch", "threads", threadCount, dispatchTicks, BENCH_POOL_SAMPLES);
+        Bench_Latency(report, "kThreadPool", "roundTrip", "threads", threadCount, roundTripTicks, BENCH_POOL_SAMPLES);
+    }
+    kFinally
+    {
+        kObject_Destroy(pool);
+        kAlloc_Free(kAlloc_App(), roundTripTicks);
+        kAlloc_Free(kAlloc_App(), dispatchTicks);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+static k64f Bench_Sum(const k32f* data, kSize begin, kSize end)
+{
+    k64f sum = 0;
+    kSize i;
+
+    for (i = begin; i < end; ++i)
+    {
+        sum += data[i];
+    }
+
+    return sum;
+}
+
+static kStatus kCall Bench_ParallelSumSlice(BenchParallelSum* context, kParallel sender, kParallelArgs* args)
+{
+    kCheckArgs(args->index < BENCH_PARALLEL_MAX_SLICES);
+
+    context->partial[args->index] = Bench_Sum(context->data,
+        kParallelArgs_Begin(args, 0, context->count),
+        kParallelArgs_End(args, 0, context->count));
+
+    return kOK;
+}
+
+static kStatus kCall Bench_ParallelEmpty(kPointer receiver, kParallel sender, kParallelArgs* args)
+{
+    return kOK;
+}
+
+static kStatus Bench_Parallel(BenchReport* report, kSize size)
+{
+    BenchParallelSum context;
+    k32f* data = kNULL;
+    kSize calls = kMax_(BENCH_PARALLEL_OPS / size, 16);
+    k64u serialTicks, parallelTicks, start;
+    k64f sum = 0;
+    kSize i, j;
+
+    kTry
+    {
+        kTest(kAlloc_Get(kAlloc_App(), size * sizeof(k32f), &data));
+
+        for (i = 0; i < size; ++i)
+        {
+            data[i] = (k32f)(i % 1000);
+        }
+
+        context.data = data;
+        context.count = size;
+
+        start = kTimer_Ticks();
+        for (i = 0; i < calls; ++i)
+        {
+            sum += Bench_Sum(data, 0, size);
+        }
+        serialTicks = kTimer_Ticks() - start;
+
+        start = kTimer_Ticks();
+        for (i = 0; i < calls; ++i)
+        {
+            memset(context.partial, 0, sizeof(context.partial));
+
+            kTest(kParallel_Execute((kParallelFx)Bench_ParallelSumSlice, &context, kNULL));
+
+            for (j = 0; j < BENCH_PARALLEL_MAX_SLICES; ++j)
+            {
+                sum += context.partial[j];
+            }
+        }
+        parallelTicks = kTimer_Ticks() - start;
+
+        Bench_sink += (k64u)sum;
+
+        Bench_Throughput(report, "kParallel", "serialSum", "size", size, calls, serialTicks);
+        Bench_Throughput(report, "kParallel", "parallelSum", "size", size, calls, parallelTicks);
+    }
+    kFinally
+    {
+        kAlloc_Free(kAlloc_App(), data);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+static kStatus Bench_ParallelOverhead(BenchReport* report)
+{
+    kSize calls = 20000;
+    k64u start, ticks;
+    kSize i;
+
+    start = kTimer_Ticks();
+    for (i = 0; i < calls; ++i)
+    {
+        kCheck(kParallel_Execute(Bench_ParallelEmpty, kNULL, kNULL));
+    }
+    ticks = kTimer_Ticks() - start;
+
+    Bench_Throughput(report, "kParallel", "emptyExecute", "threads", kParallel_ThreadCount(), calls, ticks);
+
+    return kOK;
+}
+
+static kStatus Bench_AllocGet(const BenchAllocator* allocator, kSize size, void* mem)
+{
+    if (kIsNull(allocator->alloc))
+    {
+        *(void**)mem = malloc(size);
+
+        return kIsNull(*(void**)mem) ? kERROR_MEMORY : kOK;
+    }
+
+    return kAlloc_Get(allocator->alloc, size, mem);
+}
+
+static kStatus Bench_AllocFree(const BenchAllocator* allocator, void* mem)
+{
+    if (kIsNull(allocator->alloc))
+    {
+        free(mem);
+
+        return kOK;
+    }
+
+    return kAlloc_Free(allocator->alloc, mem);
+}
+
+static kStatus Bench_Allocator(BenchReport* report, const BenchAllocator* allocator, kSize size)
+{
+    void* buffers[BENCH_ALLOC_BATCH] = { kNULL };
+    kSize rounds = kClamp_(BENCH_ALLOC_BYTES / (size * BENCH_ALLOC_BATCH), 16, BENCH_ALLOC_MAX_ROUNDS);
+    k64u start, ticks;
+    kSize r, i;
+
+    kTry
+    {
+        start = kTimer_Ticks();
+
+        for (r = 0; r < rounds; ++r)
+        {
+            for (i = 0; i < BENCH_ALLOC_BATCH; ++i)
+            {
+                kTest(Bench_AllocGet(allocator, size, &buffers[i]));
+
+                //touch the buffer so that lazily-mapped memory is counted
+                *(k8u*)buffers[i] = (k8u)i;
+            }
+
+            for (i = 0; i < BENCH_ALLOC_BATCH; ++i)
+            {
+                kTest(Bench_AllocFree(allocator, buffers[i]));
+                buffers[i] = kNULL;
+            }
+        }
+
+        ticks = kTimer_Ticks() - start;
+
+        Bench_Throughput(report, "alloc", allocator->name, "size", size, (k64u)rounds * BENCH_ALLOC_BATCH, ticks);
+    }
+    kFinally
+    {
+        for (i = 0; i < BENCH_ALLOC_BATCH; ++i)
+        {
+            Bench_AllocFree(allocator, buffers[i]);
+        }
+
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+static kStatus Bench_Allocators(BenchReport* report)
+{
+    kPoolAlloc poolAlloc = kNULL;
+    BenchAllocator allocators[3];
+    kSize i, j;
+
+    kTry
+    {
+        //carve small buffers from blocks and cache freed buffers up to 64 KB
+        kTest(kPoolAlloc_Construct(&poolAlloc, kNULL));
+        kTest(kPoolAlloc_SetMaxBlockBufferSize(poolAlloc, 1024));
+        kTest(kPoolAlloc_SetMaxCachedBufferSize(poolAlloc, 65536));
+        kTest(kPoolAlloc_Start(poolAlloc));
+
+        allocators[0].name = "malloc";
+        allocators[0].alloc = kNULL;
+        allocators[1].name = "kAlloc_App";
+        allocators[1].alloc = kAlloc_App();
+        allocators[2].name = "kPoolAlloc";
+        allocators[2].alloc = poolAlloc;
+
+        for (i = 0; i < kCountOf(allocators); ++i)
+        {
+            for (j = 0; j < kCountOf(Bench_allocSizes); ++j)
+            {
+                kTest(Bench_Allocator(report, &allocators[i], Bench_allocSizes[j]));
+            }
+        }
+    }
+    kFinally
+    {
+        kObject_Destroy(poolAlloc);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+static kStatus Bench_Run(BenchReport* report, kSize maxThreads)
+{
+    kSize i;
+
+    for (i = 0; i < kCountOf(Bench_containerSizes); ++i)
+    {
+        kCheck(Bench_Map(report, Bench_containerSizes[i]));
+        kCheck(Bench_ArrayList(report, Bench_containerSizes[i]));
+        kCheck(Bench_Queue(report, Bench_containerSizes[i]));
+    }
+
+    for (i = 1; i <= maxThreads; ++i)
+    {
+        kCheck(Bench_MsgQueue(report, i));
+    }
+
+    kCheck(Bench_ThreadPool(report, 1));
+
+    if (maxThreads > 1)
+    {
+        kCheck(Bench_ThreadPool(report, maxThreads));
+    }
+
+    kCheck(Bench_ParallelOverhead(report));
+
+    for (i = 0; i < kCountOf(Bench_parallelSizes); ++i)
+    {
+        kCheck(Bench_Parallel(report, Bench_parallelSizes[i]));
+    }
+
+    kCheck(Bench_Allocators(report));
+
+    return kOK;
+}
+
+kStatus BenchmarkMain(int argc, char** argv)
+{
+    kAssembly api = kNULL;
+    BenchReport report;
+    const kChar* outputPath = kNULL;
+    const kChar* label = "";
+    kSize maxThreads = BENCH_DEFAULT_MAX_THREADS;
+    int arg;
+
+    report.out = stdout;
+    report.count = 0;
+
+    kCheck(kApiLib_Construct(&api));
+
+    kTry
+    {
+        for (arg = 1; arg < argc; ++arg)
+        {
+            if (kStrEquals(argv[arg], "-o") && (arg + 1 < argc))
+            {
+                outputPath = argv[++arg];
+            }
+            else if (kStrEquals(argv[arg], "-t") && (arg + 1 < argc))
+            {
+                int threads = atoi(argv[++arg]);
+
+                maxThreads = (kSize)kClamp_(threads, 1, BENCH_PARALLEL_MAX_SLICES);
+            }
+            else if (kStrEquals(argv[arg], "-l") && (arg + 1 < argc))
+            {
+                label = argv[++arg];
+            }
+        }
+
+        if (!kIsNull(outputPath))
+        {
+            report.out = fopen(outputPath, "w");
+            kTestTrue(!kIsNull(report.out), kERROR_NOT_FOUND);
+        }
+
+        fprintf(report.out, "{\n  \"benchmark\": \"kApiBenchmark\",\n  \"label\": \"%s\",\n", label);
+        fprintf(report.out, "  \"processorCount\": %u,\n  \"maxThreads\": %u,\n", (k32u)kThread_ProcessorCount(), (k32u)maxThreads);
+        fprintf(report.out, "  \"results\": [");
+
+        kTest(Bench_Run(&report, maxThreads));
+
+        fprintf(report.out, "\n  ]\n}\n");
+    }
+    kFinally
+    {
+        if (!kIsNull(report.out) && (report.out != stdout))
+        {
+            fclose(report.out);
+        }
+
+        kObject_Destroy(api);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+int main(int argc, char** argv)
+{
+    kStatus status = BenchmarkMain(argc, argv);
+
+    if (!kSuccess(status))
+    {
+        fprintf(stderr, "Error: %d\n", status);
+    }
+
+    return kSuccess(status) ? 0 : -1;
+}
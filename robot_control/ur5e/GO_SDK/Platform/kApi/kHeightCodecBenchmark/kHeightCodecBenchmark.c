@@ -0,0 +1,274 @@
+/*
+ * kHeightCodecBenchmark.c
+ *
+ * Copyright (C) 2024 by LMI Technologies Inc.
+ *
+ * Licensed under The MIT License.
+ * Redistributions of files must retain the above copyright notice.
+ *
+ * Purpose: Measures kHeightCodec compression ratio and encode/decode throughput.
+ *
+ * Usage: kHeightCodecBenchmark [-i iterations]
+ *
+ * A synthetic surface (a sloped, noisy part with occluded edges and scattered dropouts) is
+ * encoded and decoded with kHeightCodec_Encode/kHeightCodec_Decode. Throughput is reported
+ * in MB/s of raw k16s samples. The same surface, and several height maps of other shapes, are
+ * then written through one kDat6Serializer with HEIGHT16 compression and verified after
+ * reading them back.
+ */
+#include <kApi/kApiLib.h>
+#include <kApi/Data/kArray1.h>
+#include <kApi/Data/kArray2.h>
+#include <kApi/Io/kDat6Serializer.h>
+#include <kApi/Io/kHeightCodec.h>
+#include <kApi/Io/kMemory.h>
+#include <kApi/Threads/kTimer.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_DEFAULT_ITERATIONS            (50)
+#define BENCH_SURFACE_LENGTH                (2000)
+#define BENCH_SURFACE_WIDTH                 (1920)
+#define BENCH_SURFACE_NOISE                 (8)
+#define BENCH_SERIALIZER_ROUNDS             (4)
+#define BENCH_LINE_WIDTH                    (1500)
+#define BENCH_LINE_COUNT                    (600)
+
+static const kSize Bench_shapes[][2] = { { 1000, 2048 }, { 333, 1277 }, { 1, 5 }, { 257, 4099 } };
+
+static void Bench_FillSurface(k16s* data, kSize rows, kSize columns, kSize seed)
+{
+    k32u random = (k32u)(seed*2654435761u + 1);
+    kSize i, j;
+
+    for (i = 0; i < rows; ++i)
+    {
+        //each profile is occluded at both edges, by an amount that drifts along the part
+        kSize margin = columns/16 + (i % 37);
+
+        for (j = 0; j < columns; ++j)
+        {
+            random = random*1664525u + 1013904223u;
+
+            if ((j < margin) || (j >= columns - margin) || ((random >> 24) == 0))
+            {
+                data[i*columns + j] = k16S_NULL;
+            }
+            else
+            {
+                k32s slope = (k32s)(i*3 + j*2) - 6000;
+                k32s noise = (k32s)((random >> 16) % (2*BENCH_SURFACE_NOISE + 1)) - BENCH_SURFACE_NOISE;
+
+                data[i*columns + j] = (k16s)(slope + noise);
+            }
+        }
+    }
+}
+
+static kBool Bench_HeightsEqual(kObject expected, kObject actual)
+{
+    if (kIsNull(actual) || (kObject_Type(expected) != kObject_Type(actual)))
+    {
+        return kFALSE;
+    }
+    else if (kObject_Is(expected, kTypeOf(kArray2)))
+    {
+        return (kArray2_Length(expected, 0) == kArray2_Length(actual, 0))
+            && (kArray2_Length(expected, 1) == kArray2_Length(actual, 1))
+            && (memcmp(kArray2_Data(expected), kArray2_Data(actual), kArray2_DataSize(expected)) == 0);
+    }
+    else
+    {
+        return (kArray1_Length(expected) == kArray1_Length(actual))
+            && (memcmp(kArray1_Data(expected), kArray1_Data(actual), kArray1_DataSize(expected)) == 0);
+    }
+}
+
+static k64f Bench_MBps(kSize bytes, k64u time)
+{
+    return (k64f)bytes / kMax_(time, 1);
+}
+
+static kStatus Bench_RunCodec(kSize iterations)
+{
+    kArray2 surface = kNULL;
+    kArray1 encoded = kNULL;
+    kArray2 decoded = kNULL;
+    kSize rawSize = 0;
+    k64u start, encodeTime = 0, decodeTime = 0;
+    kSize i;
+
+    kTry
+    {
+        kTest(kArray2_Construct(&surface, kTypeOf(k16s), BENCH_SURFACE_LENGTH, BENCH_SURFACE_WIDTH, kNULL));
+        Bench_FillSurface(kArray2_DataT(surface, k16s), BENCH_SURFACE_LENGTH, BENCH_SURFACE_WIDTH, 0);
+
+        rawSize = kArray2_DataSize(surface);
+
+        for (i = 0; i < iterations; ++i)
+        {
+            kTest(kDestroyRef(&encoded));
+
+            start = kTimer_Now();
+            kTest(kHeightCodec_Encode(surface, &encoded, kNULL));
+            encodeTime += kTimer_Now() - start;
+
+            kTest(kDestroyRef(&decoded));
+
+            start = kTimer_Now();
+            kTest(kHeightCodec_Decode(encoded, &decoded, kNULL));
+            decodeTime += kTimer_Now() - start;
+
+            kTestTrue(Bench_HeightsEqual(surface, decoded), kERROR_FORMAT);
+        }
+
+        printf("kHeightCodec_Encode/Decode (%u x %u surface, %u iterations)\n", BENCH_SURFACE_LENGTH, BENCH_SURFACE_WIDTH, (k32u)iterations);
+        printf("  ratio:       %.2f (%u -> %u bytes)\n", (k64f)rawSize / kArray1_Length(encoded), (k32u)rawSize, (k32u)kArray1_Length(encoded));
+        printf("  encode:      %.0f MB/s\n", Bench_MBps(rawSize*iterations, encodeTime));
+        printf("  decode:      %.0f MB/s\n", Bench_MBps(rawSize*iterations, decodeTime));
+    }
+    kFinally
+    {
+        kObject_Destroy(decoded);
+        kObject_Destroy(encoded);
+        kObject_Destroy(surface);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+static kStatus Bench_RunSerializer()
+{
+    kObject objects[kCountOf(Bench_shapes) + 2];
+    kMemory memory = kNULL;
+    kSerializer writer = kNULL;
+    kSerializer reader = kNULL;
+    kObject object = kNULL;
+    kSize rawSize = 0;
+    k64u start, writeTime, readTime = 0;
+    kSize i, j;
+
+    kZero(objects);
+
+    kTry
+    {
+        //height maps of various shapes, then one without a row dimension, so that the codec has 
+        //to estimate the row width from the samples
+        kTest(kArray2_Construct(&objects[0], kTypeOf(k16s), BENCH_SURFACE_LENGTH, BENCH_SURFACE_WIDTH, kNULL));
+        Bench_FillSurface(kArray2_DataT(objects[0], k16s), BENCH_SURFACE_LENGTH, BENCH_SURFACE_WIDTH, 0);
+        rawSize += kArray2_DataSize(objects[0]);
+
+        for (i = 0; i < kCountOf(Bench_shapes); ++i)
+        {
+            kTest(kArray2_Construct(&objects[i+1], kTypeOf(k16s), Bench_shapes[i][0], Bench_shapes[i][1], kNULL));
+            Bench_FillSurface(kArray2_DataT(objects[i+1], k16s), Bench_shapes[i][0], Bench_shapes[i][1], i + 1);
+            rawSize += kArray2_DataSize(objects[i+1]);
+        }
+
+        kTest(kArray1_Construct(&objects[i+1], kTypeOf(k16s), BENCH_LINE_COUNT*BENCH_LINE_WIDTH, kNULL));
+        Bench_FillSurface(kArray1_DataT(objects[i+1], k16s), BENCH_LINE_COUNT, BENCH_LINE_WIDTH, i + 1);
+        rawSize += kArray1_DataSize(objects[i+1]);
+
+        kTest(kMemory_Construct(&memory, kNULL));
+        kTest(kDat6Serializer_Construct(&writer, memory, kNULL));
+        kTest(kDat6Serializer_EnableCompression(writer, kCOMPRESSION_TYPE_HEIGHT16, 0));
+        kTest(kDat6Serializer_Construct(&reader, memory, kNULL));
+
+        //every object goes through the same writer, so that each one starts with the buffers
+        //left behind by the previous one
+        start = kTimer_Now();
+
+        for (i = 0; i < BENCH_SERIALIZER_ROUNDS; ++i)
+        {
+            for (j = 0; j < kCountOf(objects); ++j)
+            {
+                kTest(kSerializer_WriteObject(writer, objects[j]));
+            }
+        }
+
+        kTest(kSerializer_Flush(writer));
+
+        writeTime = kTimer_Now() - start;
+
+        kTest(kStream_Seek(memory, 0, kSEEK_ORIGIN_BEGIN));
+
+        for (i = 0; i < BENCH_SERIALIZER_ROUNDS; ++i)
+        {
+            for (j = 0; j < kCountOf(objects); ++j)
+            {
+                start = kTimer_Now();
+                kTest(kSerializer_ReadObject(reader, &object, kNULL));
+                readTime += kTimer_Now() - start;
+
+                kTestTrue(Bench_HeightsEqual(objects[j], object), kERROR_FORMAT);
+                kTest(kDestroyRef(&object));
+            }
+        }
+
+        printf("kDat6Serializer with HEIGHT16 compression (%u objects, %u rounds)\n", (k32u)kCountOf(objects), BENCH_SERIALIZER_ROUNDS);
+        printf("  ratio:       %.2f\n", (k64f)(rawSize*BENCH_SERIALIZER_ROUNDS) / kMemory_Length(memory));
+        printf("  write:       %.0f MB/s\n", Bench_MBps(rawSize*BENCH_SERIALIZER_ROUNDS, writeTime));
+        printf("  read:        %.0f MB/s\n", Bench_MBps(rawSize*BENCH_SERIALIZER_ROUNDS, readTime));
+    }
+    kFinally
+    {
+        for (i = 0; i < kCountOf(objects); ++i)
+        {
+            kObject_Destroy(objects[i]);
+        }
+
+        kObject_Destroy(object);
+        kObject_Destroy(reader);
+        kObject_Destroy(writer);
+        kObject_Destroy(memory);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+kStatus BenchmarkMain(int argc, char** argv)
+{
+    kAssembly api = kNULL;
+    kSize iterations = BENCH_DEFAULT_ITERATIONS;
+    int arg;
+
+    kCheck(kApiLib_Construct(&api));
+
+    kTry
+    {
+        for (arg = 1; arg < argc; ++arg)
+        {
+            if (kStrEquals(argv[arg], "-i") && (arg + 1 < argc))
+            {
+                int value = atoi(argv[++arg]);
+
+                iterations = (kSize)kMax_(value, 1);
+            }
+        }
+
+        kTest(Bench_RunCodec(iterations));
+        kTest(Bench_RunSerializer());
+    }
+    kFinally
+    {
+        kObject_Destroy(api);
+        kEndFinally();
+    }
+
+    return kOK;
+}
+
+int main(int argc, char** argv)
+{
+    kStatus status = BenchmarkMain(argc, argv);
+
+    if (!kSuccess(status))
+    {
+        fprintf(stderr, "Error: %d\n", status);
+    }
+
+    return kSuccess(status) ? 0 : -1;
+}
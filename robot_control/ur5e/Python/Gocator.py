@@ -76,6 +76,7 @@ GoSdk.GoResampledProfileMsg_At.restype = ctypes.POINTER(ctypes.c_short)
 GoSdk.GoSensor_CopyFile.argtypes = [GoSensor ,c_char_p, c_char_p]
 GoSdk.GoSensor_FileNameAt.argtypes = [GoSensor,ctypes.c_uint64,c_char_p,ctypes.c_uint64]
 GoSdk.GoProfileMsg_At.restype = ctypes.POINTER(ctypes.c_int16)
+GoSdk.GoSessionPool_System.restype = GoSystem
 
 
 def getVersionStr():
@@ -534,6 +535,10 @@ def RecieveData(dataset):
 def get_measurement_decision():
     return measurement_decision
 
+def reset_measurement_decision():
+    global measurement_decision
+    measurement_decision = None
+
 # if __name__ == "__main__":
 #     # Instantiate system objects
 #     api = kAssembly(kNULL)
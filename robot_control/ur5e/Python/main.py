@@ -5,7 +5,7 @@ import psutil
 import time
 import ctypes
 import GoSdk_MsgHandler
-from Gocator import GoSdk, kApi, RecieveData, get_measurement_decision, kObject_Destroy, kIpAddress,  GoDataSet, GoDataMsg, kNULL
+from Gocator import GoSdk, kApi, RecieveData, get_measurement_decision, reset_measurement_decision, kObject_Destroy, kIpAddress,  GoDataSet, GoDataMsg, kNULL, kOK
 import epick_gripper as gripper
 import camera as cam
 
@@ -20,6 +20,7 @@ ur_cap_port = 50002
 robot_ip = "192.168.1.5"
 scanner_ip = b"192.168.1.10" 
 RECEIVE_TIMEOUT = 10000
+SNAPSHOT_TIMEOUT = 5000000  # us
 
 # Home positions
 scanning_pose =  [0.18460770962661585, -0.4198238765759319, 0.2576206095505704, -0.5978738392574462, 3.075728673810618, -0.018057268513576502]
@@ -46,6 +47,17 @@ rtde_c = RTDEControl(robot_ip, rtde_frequency, RTDEControl.FLAG_VERBOSE | RTDECo
 #Live camera feed
 #cam.camera_feed()
 
+# Initialize SDK once; the session pool keeps the sensor connected between parts
+api = ctypes.c_void_p()
+pool = ctypes.c_void_p()
+GoSdk.GoSdk_Construct(ctypes.byref(api))
+GoSdk.GoSessionPool_Construct(ctypes.byref(pool), None)
+GoSdk.GoSessionPool_EnableData(pool, True)
+system = ctypes.c_void_p(GoSdk.GoSessionPool_System(pool))
+
+ipAddr_ref = kIpAddress()
+kApi.kIpAddress_Parse(ctypes.byref(ipAddr_ref), scanner_ip)
+
 while True:
     try:
         # Move UR5e to home position before scanning
@@ -56,45 +68,43 @@ while True:
         time.sleep(1)
         
         # Initialize scanner
-        api = ctypes.c_void_p()
-        system = ctypes.c_void_p()
         sensor = ctypes.c_void_p()
         dataset = GoDataSet()   
         dataObj = GoDataMsg()
         
-        # Initialize SDK
-        GoSdk.GoSdk_Construct(ctypes.byref(api))
-        GoSdk.GoSystem_Construct(ctypes.byref(system), None)
-        
-        # Connect to sensor
-        ipAddr_ref = kIpAddress()
-        kApi.kIpAddress_Parse(ctypes.byref(ipAddr_ref), scanner_ip)
-        GoSdk.GoSystem_FindSensorByIpAddress(system, ctypes.byref(ipAddr_ref), ctypes.byref(sensor))
-        GoSdk.GoSensor_Connect(sensor)
-        GoSdk.GoSystem_EnableData(system, True)
-        
-        Mgr = GoSdk_MsgHandler.MsgManager(GoSdk, system, dataset)
-        Mgr.SetDataHandler(RECEIVE_TIMEOUT, RecieveData)
+        # Acquire connected sensor from the session pool; retry on the next cycle if the
+        # scanner can't be reached
+        status = GoSdk.GoSessionPool_Acquire(pool, ctypes.byref(ipAddr_ref), ctypes.byref(sensor))
+        if status != kOK:
+            print(f"[ERROR] Could not acquire the scanner session (status {status}). Retrying...")
+            time.sleep(1)
+            continue
 
-        # Start scanning
-        print(20*"*")
-        print("Scanning the object...")
-        print()
-        GoSdk.GoSensor_Stop(sensor)
-        GoSdk.GoSensor_Snapshot(sensor)
-        time.sleep(1)
-        print("Scan Completed!")
-        print()
+        # The session goes back to the pool even if the scan raises; otherwise every later
+        # acquire would fail because the session is still in use
+        try:
+            # Start scanning; the snapshot's dataset is returned directly
+            print(20*"*")
+            print("Scanning the object...")
+            print()
 
-        #Get Measurement Decision
-        measurement_decision = get_measurement_decision()
-        
-        # Disconnect scanner
-        Mgr.SetDataHandler(RECEIVE_TIMEOUT, kNULL)
-        Mgr.thread.join()
+            # A failed scan must not reuse the previous part's decision
+            reset_measurement_decision()
 
-        kObject_Destroy(system)
-        kObject_Destroy(api)
+            GoSdk.GoSensor_Stop(sensor)
+            status = GoSdk.GoSensor_SnapshotAndReceive(sensor, ctypes.byref(dataset), ctypes.c_uint64(SNAPSHOT_TIMEOUT))
+            if status == kOK:
+                RecieveData(dataset)
+                print("Scan Completed!")
+            else:
+                print(f"[ERROR] Scan failed (status {status}).")
+            print()
+
+            #Get Measurement Decision
+            measurement_decision = get_measurement_decision()
+        finally:
+            # Return scanner to the session pool
+            GoSdk.GoSessionPool_Release(pool, sensor)
 
         if measurement_decision != 1:   #fault object
             print("Fault object detected ! Placing it away...")
@@ -132,4 +142,7 @@ while True:
         print(f"Error occurred: {str(e)}")
         time.sleep(1)
 
+kObject_Destroy(pool)
+kObject_Destroy(api)
+
 print("UR5e connection closed.")